@@ -26,6 +26,13 @@ struct OrtRunOptions {
   // So it is possible that only some of the nodes are executed.
   bool only_execute_path_to_fetches = false;
 
+  // Maximum number of threads, including the calling thread, that parallel loops of the Run
+  // may use from the session's intra-op thread pool. 0 means no limit.
+  int max_degree_of_parallelism = 0;
+
+  // Priority of the Run's work in the session's intra-op thread pool.
+  OrtRunPriority priority = ORT_RUN_PRIORITY_NORMAL;
+
 #ifdef ENABLE_TRAINING
   // Set to 'true' to run in training mode.
   bool training_mode = true;
@@ -334,7 +334,10 @@ class Node {
   bool ClearAttribute(const std::string& attr_name);
 
   /** Gets the Node's mutable attributes. */
-  NodeAttributes& GetMutableAttributes() noexcept { return attributes_; }
+  NodeAttributes& GetMutableAttributes() noexcept {
+    ResetTypeAndShapeInferenceState();
+    return attributes_;
+  }
 
   /** Gets the Graph instance that is instantiated from a GraphProto attribute during Graph::Resolve.
   @param attr_name Attribute name for the GraphProto attribute.
@@ -510,6 +513,18 @@ class Node {
 
   void SetFunctionBody(const Function& func);
 
+#if !defined(ORT_MINIMAL_BUILD)
+  // Returns true if the input and output NodeArgs are unchanged since type/shape inferencing last succeeded for
+  // this node, in which case running it again would produce the same result.
+  bool IsTypeAndShapeInferenceUpToDate() const;
+
+  // Record the versions of the input and output NodeArgs after type/shape inferencing succeeded.
+  void SetTypeAndShapeInferenceUpToDate();
+#endif
+
+  // Force type/shape inferencing to run for this node in the next Resolve.
+  void ResetTypeAndShapeInferenceState() noexcept { inferred_arg_versions_.clear(); }
+
   const Definitions& GetDefinitions() const noexcept { return definitions_; }
   const Relationships& GetRelationships() const noexcept { return relationships_; }
 
@@ -565,6 +580,10 @@ class Node {
 
   // Graph instances for subgraphs that are owned by this Node
   std::vector<std::unique_ptr<Graph>> subgraphs_;
+
+  // Number of input defs followed by the versions of the input and output NodeArgs when type/shape inferencing last
+  // succeeded. Empty if it needs to run in the next Resolve.
+  std::vector<uint64_t> inferred_arg_versions_;
 };
 
 /**
@@ -1209,6 +1228,10 @@ class Graph {
   // Initialize overridable initializers container
   void ComputeOverridableInitializers();
 
+  // Record that the initializer with the given name was added, removed or replaced, so that the type/shape
+  // inferencing of the nodes consuming it runs again in the next Resolve.
+  void MarkInitializerChanged(const std::string& name);
+
 #if !defined(ORT_MINIMAL_BUILD)
   // Build and verify node connection (edges).
   // Verify NodeArg name/type/shape matching correctly.
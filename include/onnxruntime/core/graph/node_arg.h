@@ -96,6 +96,7 @@ class NodeArg {
  private:
   ORT_DISALLOW_COPY_AND_ASSIGNMENT(NodeArg);
   friend class Graph;
+  friend class Node;
 
   NodeArg(NodeArgInfo&& node_arg_info);
 
@@ -104,6 +105,9 @@ class NodeArg {
   void SetType(const ONNX_NAMESPACE::TypeProto& type_proto);
 #endif
 
+  // Record that the type/shape info, or the value of the initializer with this name, changed.
+  void MarkChanged() noexcept;
+
   // Node arg PType.
   ONNX_NAMESPACE::DataType type_;
 
@@ -112,5 +116,9 @@ class NodeArg {
 
   // Flag indicates whether <*this> node arg exists or not.
   bool exists_;
+
+  // Version of the type/shape info. It is unique across all NodeArg instances and changes whenever the info changes,
+  // so Graph::Resolve can skip the type/shape inferencing of nodes whose inputs have the same versions as last time.
+  uint64_t version_;
 };
 }  // namespace onnxruntime
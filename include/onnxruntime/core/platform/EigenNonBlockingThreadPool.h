@@ -24,6 +24,8 @@
 #pragma warning(disable : 4127)
 #pragma warning(disable : 4805)
 #endif
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include "unsupported/Eigen/CXX11/ThreadPool"
 
@@ -37,6 +39,13 @@
 #include "core/platform/ort_mutex.h"
 #include "core/platform/Barrier.h"
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define ORT_THREAD_POOL_USE_FUTEX
+#endif
+
 // ORT thread pool overview
 // ------------------------
 //
@@ -60,7 +69,12 @@
 //   work.
 //
 //   This spin-then-block behavior is configured via a flag provided
-//   when creating the thread pool, and by the constant spin_count.
+//   when creating the thread pool.  The number of iterations that a
+//   worker spins for is adapted by ThreadPoolSpinLimit from how soon
+//   work has arrived in the past, so that threads stop burning CPU
+//   when the pool is lightly loaded.  Blocked workers park on a futex
+//   where available, and are woken individually by the thread pushing
+//   work to them.
 //
 // - Although all tasks are simple void()->void functions,
 //   conceptually there are three different kinds:
@@ -193,6 +207,8 @@ class ThreadPoolProfiler {
   void LogCoreAndBlock(std::ptrdiff_t){};
   void LogThreadId(int){};
   void LogRun(int){};
+  void LogSpin(int, uint64_t, bool, int){};
+  void LogWake(int, uint64_t){};
   std::string DumpChildThreadStat() { return {}; }
 };
 #else
@@ -219,6 +235,8 @@ class ThreadPoolProfiler {
   void LogCoreAndBlock(std::ptrdiff_t block_size);  //called in main thread to log core and block size for task breakdown
   void LogThreadId(int thread_idx);                 //called in child thread to log its id
   void LogRun(int thread_idx);                      //called in child thread to log num of run
+  void LogSpin(int thread_idx, uint64_t spin_ns, bool found_work, int spin_limit);  //called in child thread after spinning for work
+  void LogWake(int thread_idx, uint64_t wake_latency_ns);  //called in child thread after being woken from blocking
   std::string DumpChildThreadStat();                //return all child statitics collected so far
 
  private:
@@ -243,6 +261,13 @@ class ThreadPoolProfiler {
     uint64_t num_run_ = 0;
     onnxruntime::TimePoint last_logged_point_ = Clock::now();
     int32_t core_ = -1;  //core that the child thread is running on
+    uint64_t spin_ns_ = 0;  //time spent spinning for work
+    uint64_t num_spin_hit_ = 0;  //spins that found work
+    uint64_t num_spin_miss_ = 0;  //spins that gave up and blocked
+    int spin_limit_ = 0;  //latest adaptive spin limit, in iterations
+    uint64_t num_wake_ = 0;  //wake-ups from blocking
+    uint64_t wake_latency_ns_ = 0;  //total time from a wake-up request until the thread ran
+    uint64_t max_wake_latency_ns_ = 0;
     PaddingToAvoidFalseSharing padding_; //to prevent false sharing
   };
   std::vector<ChildThreadStat> child_thread_stats_;
@@ -291,8 +316,12 @@ class ExtendedThreadPoolInterface : public Eigen::ThreadPoolInterface {
   //
   // [ Note that this 20% overhead is more than paid for when we have
   // two loops execute in series in a parallel section. ]
+  //
+  // If high_priority is set then workers pick up the loop's tasks
+  // ahead of other queued work.
   virtual void RunInParallel(std::function<void(unsigned idx)> fn,
-                             unsigned n, std::ptrdiff_t block_size) = 0;
+                             unsigned n, std::ptrdiff_t block_size,
+                             bool high_priority) = 0;
   virtual void StartProfiling()  = 0;
   virtual std::string StopProfiling() = 0;
 };
@@ -307,6 +336,10 @@ class ThreadPoolParallelSection {
   // maximum degree of parallelism that the section will support.
   std::vector<std::pair<int,unsigned>> tasks;
 
+  // Whether the section's tasks are submitted to the workers' high
+  // priority queues.  Set before the section starts.
+  bool high_priority{false};
+
   // State shared between the main thread and worker threads
   // -------------------------------------------------------
 
@@ -356,6 +389,71 @@ class ThreadPoolLoop {
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ThreadPoolLoop);
 };
 
+// Number of iterations that an idle worker spins for work before
+// blocking in the OS.  Spinning keeps the latency of handing work to
+// an idle thread low, but burns a core for as long as the pool
+// remains idle.  The limit therefore tracks how long the worker has
+// actually had to wait for work:
+//
+// - When work arrives while spinning, the limit moves toward a
+//   multiple of the number of iterations it took, so that a worker
+//   fed with back-to-back loops keeps spinning just long enough.
+//
+// - When no work arrives before the limit, the spin was wasted and
+//   the limit is halved toward its minimum.  A lightly loaded pool
+//   therefore quickly stops burning CPU between requests.
+//
+// - When the worker, having given up and blocked, is then woken with
+//   work within the time it had spent spinning, a longer spin would
+//   have avoided the OS round trip, and the limit is doubled.
+//
+// Each worker owns its own instance, so no synchronization is needed.
+
+class ThreadPoolSpinLimit {
+ public:
+  explicit ThreadPoolSpinLimit(int max_spin_count)
+      : max_(max_spin_count),
+        min_(std::min(max_spin_count, kMinSpinCount)),
+        limit_(max_spin_count) {
+  }
+
+  int Get() const {
+    return limit_;
+  }
+
+  // Work was found after spinning for the given number of iterations.
+  void OnWorkFound(int iterations) {
+    const int64_t target = std::min<int64_t>(static_cast<int64_t>(iterations) * kHeadroom, max_);
+    limit_ = Clamp(limit_ + static_cast<int>((target - limit_) / kSmoothing));
+  }
+
+  // No work was found within the limit.
+  void OnSpinMiss() {
+    limit_ = Clamp(limit_ - (limit_ - min_ + 1) / 2);
+  }
+
+  // The worker blocked after spinning for spin_ns, and was woken with
+  // work after blocked_ns.
+  void OnWokenForWork(uint64_t spin_ns, uint64_t blocked_ns) {
+    if (blocked_ns <= spin_ns) {
+      limit_ = Clamp(static_cast<int>(std::min<int64_t>(static_cast<int64_t>(limit_) * 2, max_)));
+    }
+  }
+
+ private:
+  static constexpr int kMinSpinCount = 1 << 10;
+  static constexpr int kHeadroom = 4;
+  static constexpr int kSmoothing = 8;
+
+  int Clamp(int limit) const {
+    return std::max(min_, std::min(max_, limit));
+  }
+
+  const int max_;
+  const int min_;
+  int limit_;
+};
+
 template <typename Work, typename Tag, unsigned kSize>
 class RunQueue {
  public:
@@ -902,7 +1000,7 @@ void EndParallelSectionInternal(PerThread &pt,
   ps.active = false;
 
   if (ps.dispatch_q_idx > -1) {
-    Queue& q = worker_data_[ps.dispatch_q_idx].queue;
+    Queue& q = worker_data_[ps.dispatch_q_idx].GetQueue(ps.high_priority);
     if (q.RevokeWithTag(pt.tag, ps.dispatch_w_idx)) {
       ps.dispatch_q_idx = -1; // cancel dispatch if not started yet
     } else {
@@ -920,7 +1018,7 @@ void EndParallelSectionInternal(PerThread &pt,
   unsigned tasks_revoked = 0;
   while (!ps.tasks.empty()) {
     const auto& item = ps.tasks.back();
-    Queue& q = worker_data_[item.first].queue;
+    Queue& q = worker_data_[item.first].GetQueue(ps.high_priority);
     if (q.RevokeWithTag(pt.tag, item.second)) {
       tasks_revoked++;
     }
@@ -989,7 +1087,7 @@ void RunInParallelInternal(PerThread& pt,
         }
       }
       WorkerData& td = worker_data_[q_idx];
-      Queue& q = td.queue;
+      Queue& q = td.GetQueue(ps.high_priority);
       unsigned w_idx;
       Task t = q.PushBackWithTag(call_worker_fn, pt.tag, w_idx);
       if (!t) {
@@ -1010,7 +1108,7 @@ void RunInParallelInternal(PerThread& pt,
     ps.dispatch_q_idx = Rand(&pt.rand) % num_threads_;
   }
   WorkerData& dispatch_td = worker_data_[ps.dispatch_q_idx];
-  Queue& dispatch_que = dispatch_td.queue;
+  Queue& dispatch_que = dispatch_td.GetQueue(ps.high_priority);
   // assign dispatch task to selected dispatcher
   Task t = dispatch_que.PushBackWithTag(dispatch_task, pt.tag, ps.dispatch_w_idx);
   if (t) {
@@ -1063,7 +1161,7 @@ void RunInParallelSection(ThreadPoolParallelSection &ps,
   loop.fn(0);
   profiler_.LogEndAndStart(ThreadPoolProfiler::RUN);
   if (ps.dispatch_q_idx > -1) {
-    Queue& q = worker_data_[ps.dispatch_q_idx].queue;
+    Queue& q = worker_data_[ps.dispatch_q_idx].GetQueue(ps.high_priority);
     if (q.RevokeWithTag(pt->tag, ps.dispatch_w_idx)) {
       ps.dispatch_q_idx = -1;  // cancel dispatch if not started yet
     } else {
@@ -1093,10 +1191,12 @@ void RunInParallelSection(ThreadPoolParallelSection &ps,
 //  2. run fn(...) itself.
 // For all other threads:
 //  1. run fn(...);
-void RunInParallel(std::function<void(unsigned idx)> fn, unsigned n, std::ptrdiff_t block_size) override {
+void RunInParallel(std::function<void(unsigned idx)> fn, unsigned n, std::ptrdiff_t block_size,
+                   bool high_priority) override {
   profiler_.LogStartAndCoreAndBlock(block_size);
   PerThread* pt = GetPerThread();
   ThreadPoolParallelSection ps;
+  ps.high_priority = high_priority;
   StartParallelSectionInternal(*pt, ps);
   RunInParallelInternal(*pt, ps, n, fn);  // select dispatcher and do job distribution;
   profiler_.LogEndAndStart(ThreadPoolProfiler::DISTRIBUTION);
@@ -1177,11 +1277,42 @@ int CurrentThreadId() const EIGEN_FINAL {
                 "Per-thread state should be trivially destructible");
 
   struct WorkerData {
-    constexpr WorkerData() : thread(), queue() {
+    constexpr WorkerData() : thread(), queue(), high_priority_queue() {
     }
     std::unique_ptr<Thread> thread;
     Queue queue;
 
+    // Tasks of high priority parallel loops.  The worker drains this
+    // queue before taking work from its normal queue, so high priority
+    // loops do not wait behind queued normal priority work.
+    Queue high_priority_queue;
+
+    Queue& GetQueue(bool high_priority) {
+      return high_priority ? high_priority_queue : queue;
+    }
+
+    // Pop work for the worker itself, high priority work first.
+    Task PopFront() {
+      Task t = high_priority_queue.PopFront();
+      if (!t) {
+        t = queue.PopFront();
+      }
+      return t;
+    }
+
+    // Steal work from the worker, high priority work first.
+    Task PopBack() {
+      Task t = high_priority_queue.PopBack();
+      if (!t) {
+        t = queue.PopBack();
+      }
+      return t;
+    }
+
+    bool Empty() const {
+      return high_priority_queue.Empty() && queue.Empty();
+    }
+
     // Each thread has a status, available read-only without locking, and protected
     // by the mutex field below for updates.  The status is used for three
     // purposes:
@@ -1202,7 +1333,8 @@ int CurrentThreadId() const EIGEN_FINAL {
     //    need for mutex / condvar operations in the case where the thread pool
     //    remains busy.
 
-    enum class ThreadStatus : uint8_t {
+    // 32 bits wide so that the status can be used as a futex word.
+    enum class ThreadStatus : uint32_t {
       Spinning,  // Spinning in the work loop, and other cases (initialization) where
                  // the thread will soon be in the loop
       Active,    // Running user code, not waiting for work
@@ -1229,8 +1361,16 @@ int CurrentThreadId() const EIGEN_FINAL {
         seen = status;
         assert(seen != ThreadStatus::Blocking);
         if (seen == ThreadStatus::Blocked) {
+          wake_request_ns.store(NowNs(), std::memory_order_relaxed);
           status = ThreadStatus::Waking;
+#ifdef ORT_THREAD_POOL_USE_FUTEX
+          // Wake only the target thread, and do so after releasing the
+          // mutex so that it does not immediately block again on it.
+          lk.unlock();
+          syscall(SYS_futex, StatusWord(), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#else
           cv.notify_one();
+#endif
         }
       }
     }
@@ -1254,20 +1394,50 @@ int CurrentThreadId() const EIGEN_FINAL {
       status = ThreadStatus::Blocking;
       if (should_block()) {
         status = ThreadStatus::Blocked;
+#ifdef ORT_THREAD_POOL_USE_FUTEX
+        // Park on the status word itself.  The wait returns immediately
+        // if EnsureAwake has already changed the status.
+        lk.unlock();
+        while (status == ThreadStatus::Blocked) {
+          syscall(SYS_futex, StatusWord(), FUTEX_WAIT_PRIVATE,
+                  static_cast<uint32_t>(ThreadStatus::Blocked), nullptr, nullptr, 0);
+        }
+        lk.lock();
+#else
         while (status == ThreadStatus::Blocked) {
           cv.wait(lk);
         }
+#endif
         post_block();
       }
       status = ThreadStatus::Spinning;
     }
 
+    // Time at which the latest wake-up of the thread was requested.
+    std::atomic<uint64_t> wake_request_ns{0};
+
   private:
+#ifdef ORT_THREAD_POOL_USE_FUTEX
+    uint32_t* StatusWord() {
+      return reinterpret_cast<uint32_t*>(&status);
+    }
+#endif
+
     std::atomic<ThreadStatus> status{ThreadStatus::Spinning};
+    static_assert(sizeof(std::atomic<ThreadStatus>) == sizeof(uint32_t),
+                  "Thread status should be usable as a futex word");
     OrtMutex mutex;
+#ifndef ORT_THREAD_POOL_USE_FUTEX
     OrtCondVar cv;
+#endif
   };
 
+  static uint64_t NowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+  }
+
   Environment& env_;
   const int num_threads_;
   const bool allow_spinning_;
@@ -1302,7 +1472,6 @@ int CurrentThreadId() const EIGEN_FINAL {
   void WorkerLoop(int thread_id) {
     PerThread* pt = GetPerThread();
     WorkerData& td = worker_data_[thread_id];
-    Queue& q = td.queue;
     bool should_exit = false;
     pt->pool = this;
     pt->rand = GlobalThreadIdHash();
@@ -1312,14 +1481,27 @@ int CurrentThreadId() const EIGEN_FINAL {
     SetGoodWorkerHint(thread_id, true /* Is good */);
 
     const int log2_spin = 20;
-    const int spin_count = allow_spinning_ ? (1ull<<log2_spin) : 0;
-    const int steal_count = spin_count/100;
+    const int max_spin_count = allow_spinning_ ? (1ull<<log2_spin) : 0;
+    ThreadPoolSpinLimit spin_limit(max_spin_count);
+
+    // Set after waking from blocking, until the worker next looks for work
+    bool woken = false;
+    uint64_t woken_spin_ns = 0;
+    uint64_t woken_blocked_ns = 0;
 
     SetDenormalAsZero(set_denormal_as_zero_);
     profiler_.LogThreadId(thread_id);
 
     while (!should_exit) {
-      Task t = q.PopFront();
+      Task t = td.PopFront();
+      if (woken) {
+        // Only wake-ups that delivered work tell us that we should have
+        // spun for longer.
+        if (t) {
+          spin_limit.OnWokenForWork(woken_spin_ns, woken_blocked_ns);
+        }
+        woken = false;
+      }
       if (!t) {
         // Spin waiting for work.  We indicate, via SetGOodWorkerHint that we are
         // spinning.  This will bias other threads toward pushing work to our queue.
@@ -1327,11 +1509,26 @@ int CurrentThreadId() const EIGEN_FINAL {
         // threads which are not themselves spinning.
 
         SetGoodWorkerHint(thread_id, true);
-        for (int i = 0; i < spin_count && !t && !done_; i++) {
-          t = ((i + 1) % steal_count == 0) ? TrySteal() : q.PopFront();
+        const int spin_count = spin_limit.Get();
+        // Steal about 100 times per spin whatever the current limit, so a
+        // worker whose limit has adapted down still looks at other queues.
+        const int steal_count = std::max(1, spin_count / 100);
+        const uint64_t spin_start_ns = spin_count > 0 ? NowNs() : 0;
+        int i = 0;
+        for (; i < spin_count && !t && !done_; i++) {
+          t = ((i + 1) % steal_count == 0) ? TrySteal() : td.PopFront();
           onnxruntime::concurrency::SpinPause();
         }
         SetGoodWorkerHint(thread_id, false);
+        const uint64_t spin_ns = spin_count > 0 ? NowNs() - spin_start_ns : 0;
+        if (spin_count > 0) {
+          if (t) {
+            spin_limit.OnWorkFound(i);
+          } else {
+            spin_limit.OnSpinMiss();
+          }
+          profiler_.LogSpin(thread_id, spin_ns, static_cast<bool>(t), spin_limit.Get());
+        }
 
         if (!t) {
           // No work passed to us while spinning; make a further full attempt to
@@ -1340,6 +1537,7 @@ int CurrentThreadId() const EIGEN_FINAL {
             t = Steal(true /* true => check all queues */);
           }
           if (!t) {
+            const uint64_t block_start_ns = NowNs();
             td.SetBlocked(
                 // Pre-block test
                 [&]() -> bool {
@@ -1349,7 +1547,7 @@ int CurrentThreadId() const EIGEN_FINAL {
                   int victim = NonEmptyQueueIndex();
                   if (victim != -1) {
                     should_block = false;
-                    t = worker_data_[victim].queue.PopBack();
+                    t = worker_data_[victim].PopBack();
                   }
                   // Number of blocked threads is used as termination condition.
                   // If we are shutting down and all worker threads blocked without work,
@@ -1381,6 +1579,12 @@ int CurrentThreadId() const EIGEN_FINAL {
                 // Post-block update (executed only if we blocked)
                 [&]() {
                   blocked_--;
+                  const uint64_t now_ns = NowNs();
+                  woken = spin_count > 0;
+                  woken_spin_ns = spin_ns;
+                  woken_blocked_ns = now_ns - block_start_ns;
+                  const uint64_t wake_request_ns = td.wake_request_ns.load(std::memory_order_relaxed);
+                  profiler_.LogWake(thread_id, now_ns > wake_request_ns ? now_ns - wake_request_ns : 0);
                 });
           }
         }
@@ -1425,7 +1629,7 @@ int CurrentThreadId() const EIGEN_FINAL {
         assert(victim < size);
         if (round == 1 ||
             worker_data_[victim].GetStatus() == WorkerData::ThreadStatus::Active) {
-          Task t = worker_data_[victim].queue.PopBack();
+          Task t = worker_data_[victim].PopBack();
           if (t) {
             return t;
           }
@@ -1454,7 +1658,7 @@ int CurrentThreadId() const EIGEN_FINAL {
     unsigned inc = all_coprimes_[size - 1][r % all_coprimes_[size - 1].size()];
     unsigned victim = r % size;
     for (unsigned i = 0; i < size; i++) {
-      if (!worker_data_[victim].queue.Empty()) {
+      if (!worker_data_[victim].Empty()) {
         return victim;
       }
       victim += inc;
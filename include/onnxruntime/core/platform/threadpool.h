@@ -222,6 +222,51 @@ class ThreadPool {
                   "Per-thread state should be trivially destructible");
   };
 
+  // Per-thread settings for the parallel loops started by the calling
+  // thread.  InferenceSession::Run installs them from the RunOptions
+  // for the duration of the call, so that requests sharing a session
+  // (or the global thread pools) can each be limited to a share of the
+  // intra-op threads, and so that latency-critical requests can have
+  // their work picked up ahead of work already queued by other
+  // requests.
+  //
+  // The degree of parallelism limit is applied through
+  // DegreeOfParallelism, and so it is honored by all of the parallel
+  // loop APIs below and by libraries such as MLAS that size their
+  // work using it.  The priority is applied by the Eigen thread pool
+  // when it hands loop iterations to its worker threads: each worker
+  // runs queued high priority work before any queued normal priority
+  // work.  Work that is already running is not interrupted.
+  //
+  // Neither setting has an effect when using OpenMP.
+
+  enum class Priority : int {
+    Normal = 0,
+    High = 1,
+  };
+
+  struct RunSettings {
+    // Maximum degree of parallelism, including the calling thread.
+    // 0 means no limit beyond the size of the pool.
+    int max_degree_of_parallelism{0};
+    Priority priority{Priority::Normal};
+  };
+
+  class ScopedRunSettings {
+  public:
+    explicit ScopedRunSettings(const RunSettings& settings);
+    ~ScopedRunSettings();
+
+  private:
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ScopedRunSettings);
+    const RunSettings saved_settings_;
+  };
+
+  // Returns the settings installed on the calling thread.  Executors
+  // that run nodes on other threads capture these and re-install them
+  // on the threads running the nodes.
+  static RunSettings CurrentRunSettings();
+
   // Schedules fn() for execution in the pool of threads.  The function may run
   // synchronously if it cannot be enqueued.  This will occur if the thread pool's
   // degree-of-parallelism is 1, but it may also occur for implementation-dependent
@@ -387,6 +432,10 @@ class ThreadPool {
  private:
   friend class LoopCounter;
 
+  static thread_local RunSettings current_run_settings;
+  static_assert(std::is_trivially_destructible<RunSettings>::value,
+                "Per-thread state should be trivially destructible");
+
   // Returns the number of threads created in the pool.  This may be different from the
   // value returned by DegreeOfParallelism to code using the pool.
   int NumThreads() const;
@@ -221,6 +221,13 @@ typedef enum ExecutionMode {
   ORT_PARALLEL = 1,
 } ExecutionMode;
 
+// Priority of the intra-op work of a Run. Parallel loops of a high priority Run are picked up by the
+// intra-op threads ahead of queued work of normal priority Runs.
+typedef enum OrtRunPriority {
+  ORT_RUN_PRIORITY_NORMAL = 0,
+  ORT_RUN_PRIORITY_HIGH = 1,
+} OrtRunPriority;
+
 // Set the language projection, default is C, which means it will classify the language not in the list to C also.
 typedef enum OrtLanguageProjection {
   ORT_PROJECTION_C = 0,  // default
@@ -1277,6 +1284,46 @@ struct OrtApi {
      */
   ORT_API2_STATUS(KernelInfoGetAttributeArray_int64, _In_ const OrtKernelInfo* info, _In_ const char* name,
                   _Out_ int64_t* out, _Inout_ size_t* size);
+
+  /**
+   * Get the per-kernel statistics collected by the sampling profiler, which is enabled with the
+   * "session.profiling.sample_rate" session config entry. The statistics are aggregated over all sampled runs
+   * since the session was created and can be read at any time while the session is running.
+   * \param allocator used to allocate the returned string
+   * \param out is set to a JSON document with the run counts and, for each kernel, the sample count, mean/p50/p99/max
+   *  latency in microseconds and mean output bytes. It is set to an empty string if the sampling profiler is
+   *  disabled.
+   */
+  ORT_API2_STATUS(SessionGetProfilingSnapshot, _In_ OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /**
+   * Limit the number of threads, including the calling thread, that parallel loops of Run calls using these
+   * options may use from the session's intra-op thread pool. 0 (the default) means no limit.
+   * Has no effect when onnxruntime is built with OpenMP.
+   */
+  ORT_API2_STATUS(RunOptionsSetMaxDegreeOfParallelism, _Inout_ OrtRunOptions* options, int value);
+  ORT_API2_STATUS(RunOptionsGetMaxDegreeOfParallelism, _In_ const OrtRunOptions* options, _Out_ int* out);
+
+  /**
+   * Set the priority of the intra-op work of Run calls using these options. Work that is already running is not
+   * preempted; high priority parallel loops are picked up by the intra-op threads before queued work of normal
+   * priority. Has no effect when onnxruntime is built with OpenMP.
+   */
+  ORT_API2_STATUS(RunOptionsSetPriority, _Inout_ OrtRunOptions* options, OrtRunPriority priority);
+  ORT_API2_STATUS(RunOptionsGetPriority, _In_ const OrtRunOptions* options, _Out_ OrtRunPriority* out);
+
+  /**
+   * Get the duration of each phase of the session initialization, e.g. model loading, each application of a graph
+   * transformer, graph partitioning, execution planning, initializer loading, kernel creation and prepacking.
+   * The phases are recorded whether or not profiling is enabled; if it is, they are also written to the profile as
+   * SESSION_EVENT entries.
+   * \param allocator used to allocate the returned string
+   * \param out is set to a JSON array of {"name", "dur"} objects, with the durations in microseconds, in the order
+   *  the phases were recorded.
+   */
+  ORT_API2_STATUS(SessionGetInitializationTimings, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
 };
 
 /*
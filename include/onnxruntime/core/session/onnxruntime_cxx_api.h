@@ -288,6 +288,13 @@ struct RunOptions : Base<OrtRunOptions> {
   RunOptions& SetTerminate();
   // unset the terminate flag so this RunOptions instance can be used in a new Session::Run call
   RunOptions& UnsetTerminate();
+
+  // limit the intra-op threads used by Session::Run calls made using this RunOptions instance, 0 means no limit
+  RunOptions& SetMaxDegreeOfParallelism(int value);
+  int GetMaxDegreeOfParallelism() const;
+
+  RunOptions& SetPriority(OrtRunPriority priority);
+  OrtRunPriority GetPriority() const;
 };
 
 struct SessionOptions : Base<OrtSessionOptions> {
@@ -367,6 +374,8 @@ struct Session : Base<OrtSession> {
   char* GetOverridableInitializerName(size_t index, OrtAllocator* allocator) const;
   char* EndProfiling(OrtAllocator* allocator) const;
   uint64_t GetProfilingStartTimeNs() const;
+  char* GetProfilingSnapshot(OrtAllocator* allocator) const;
+  char* GetInitializationTimings(OrtAllocator* allocator) const;
   ModelMetadata GetModelMetadata() const;
 
   TypeInfo GetInputTypeInfo(size_t index) const;
@@ -395,6 +395,28 @@ inline RunOptions& RunOptions::UnsetTerminate() {
   return *this;
 }
 
+inline RunOptions& RunOptions::SetMaxDegreeOfParallelism(int value) {
+  ThrowOnError(GetApi().RunOptionsSetMaxDegreeOfParallelism(p_, value));
+  return *this;
+}
+
+inline int RunOptions::GetMaxDegreeOfParallelism() const {
+  int out;
+  ThrowOnError(GetApi().RunOptionsGetMaxDegreeOfParallelism(p_, &out));
+  return out;
+}
+
+inline RunOptions& RunOptions::SetPriority(OrtRunPriority priority) {
+  ThrowOnError(GetApi().RunOptionsSetPriority(p_, priority));
+  return *this;
+}
+
+inline OrtRunPriority RunOptions::GetPriority() const {
+  OrtRunPriority out;
+  ThrowOnError(GetApi().RunOptionsGetPriority(p_, &out));
+  return out;
+}
+
 inline SessionOptions::SessionOptions() {
   ThrowOnError(GetApi().CreateSessionOptions(&p_));
 }
@@ -582,6 +604,18 @@ inline uint64_t Session::GetProfilingStartTimeNs() const {
   return out;
 }
 
+inline char* Session::GetProfilingSnapshot(OrtAllocator* allocator) const {
+  char* out;
+  ThrowOnError(GetApi().SessionGetProfilingSnapshot(p_, allocator, &out));
+  return out;
+}
+
+inline char* Session::GetInitializationTimings(OrtAllocator* allocator) const {
+  char* out;
+  ThrowOnError(GetApi().SessionGetInitializationTimings(p_, allocator, &out));
+  return out;
+}
+
 inline ModelMetadata Session::GetModelMetadata() const {
   OrtModelMetadata* out;
   ThrowOnError(GetApi().SessionGetModelMetadata(p_, &out));
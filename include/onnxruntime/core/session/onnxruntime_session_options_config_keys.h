@@ -20,6 +20,12 @@
 // If the config value is set to "1" then the prepacking is disabled, otherwise prepacking is enabled (default value)
 static const char* const kOrtSessionOptionsConfigDisablePrepacking = "session.disable_prepacking";
 
+// Key for disable parallel initialization.
+// By default the initializers are deserialized, and the kernels of the CPU execution provider are created and
+// prepacked, on the intra-op thread pool. If the config value is set to "1" these steps run sequentially, e.g. for
+// custom op kernels whose constructors are not thread safe.
+static const char* const kOrtSessionOptionsConfigDisableParallelInitialization = "session.disable_parallel_initialization";
+
 // A value of "1" means allocators registered in the env will be used. "0" means the allocators created in the session
 // will be used. Use this to override the usage of env allocators on a per session level.
 static const char* const kOrtSessionOptionsConfigUseEnvAllocators = "session.use_env_allocators";
@@ -51,12 +57,55 @@ static const char* const kOrtSessionOptionsDisableQuantQDQ = "session.disable_qu
 // GeluApproximation has side effects which may change the inference results. It is disabled by default due to this.
 static const char* const kOrtSessionOptionsEnableGeluApproximation = "optimization.enable_gelu_approximation";
 
+// Minimum fraction of zero elements, in the range (0, 1], that a constant MatMul/Gemm weight must have for the node
+// to be replaced by the SparseMatMul contrib op, which skips the zero elements during the multiply.
+// The default is "0", which disables the replacement.
+static const char* const kOrtSessionOptionsConfigSparseMatMulThreshold = "optimization.sparse_matmul_threshold";
+
+// Maximum size in bytes of a tensor produced by constant folding. Nodes producing a larger tensor, e.g. a Tile or
+// Expand of a constant, are left in the graph so that folding them doesn't blow up the size of the model.
+// The default is "0", which means no limit.
+static const char* const kOrtSessionOptionsConfigConstantFoldingMaxTensorSize =
+    "optimization.constant_folding_max_tensor_size";
+
+// Budget in bytes of the process wide cache of the tensors produced by constant folding, keyed by a hash of the
+// folded subgraph. A hit also requires the operators, attributes and input types and shapes to match. Sessions
+// loading the same model reuse the cached tensors instead of evaluating the subgraphs again.
+// The cache is shared by all sessions, and the oldest entries are evicted once it exceeds the budget of the session
+// adding to it. The default is "0", which disables the cache.
+static const char* const kOrtSessionOptionsConfigConstantFoldingCacheSize =
+    "optimization.constant_folding_cache_size";
+
 // Enable or disable using device allocator for allocating initialized tensor memory. "1": enable; "0": disable. The default is "0".
 // Using device allocators means the memory allocation is made using malloc/new.
 static const char* const kOrtSessionOptionsUseDeviceAllocatorForInitializers = "session.use_device_allocator_for_initializers";
 
+// Select how the offsets of the memory pattern are planned when enable_mem_pattern is set.
+// "first_fit": default, each tensor is placed in the best fitting free gap in the order it is allocated in the
+// first run.
+// "greedy_by_size": the lifetimes of the tensors in the first run are recorded and the offsets are assigned
+// offline, largest tensor first, which usually results in a smaller buffer.
+// The planned size and the lower bound given by the peak live size are logged at INFO level.
+static const char* const kOrtSessionOptionsConfigMemoryPatternPlanner = "session.memory_pattern_planner";
+
+// Configure whether the memory pattern of new input shapes is generated before the first run with them, when
+// enable_mem_pattern is set. The sizes of the activations are evaluated from the shapes inferred for them, whose
+// symbolic dimensions are bound from the dimensions of the inputs, so that the activations of the first run are
+// allocated in a single block too. This is only done if the sizes of all the activations can be inferred; otherwise
+// the pattern is traced from the first run with each input shape.
+// "0": disable. "1": enable (default).
+static const char* const kOrtSessionOptionsConfigSymbolicMemoryPlanning = "session.symbolic_memory_planning";
+
 // Configure whether to allow the inter_op/intra_op threads spinning a number of times before blocking
 // "0": thread will block if found no job to run
 // "1": default, thread will spin a number of times before blocking
 static const char* const kOrtSessionOptionsConfigAllowInterOpSpinning = "session.inter_op.allow_spinning";
 static const char* const kOrtSessionOptionsConfigAllowIntraOpSpinning = "session.intra_op.allow_spinning";
+
+// Configure the sampling profiler, which aggregates per-kernel latency histograms of 1 in every N runs and can be
+// left enabled in production. The aggregated statistics are read with the SessionGetProfilingSnapshot API.
+// "session.profiling.sample_rate": N. The default is "0", which disables the sampling profiler.
+// "session.profiling.sample_buffer_size": number of events each thread can buffer between drains. The default is
+// "4096". Events that do not fit are dropped and reported in the snapshot.
+static const char* const kOrtSessionOptionsConfigProfilingSampleRate = "session.profiling.sample_rate";
+static const char* const kOrtSessionOptionsConfigProfilingSampleBufferSize = "session.profiling.sample_buffer_size";
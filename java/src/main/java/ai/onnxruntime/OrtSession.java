@@ -251,17 +251,77 @@ public class OrtSession implements AutoCloseable {
   public Result run(
       Map<String, OnnxTensor> inputs, Set<String> requestedOutputs, RunOptions runOptions)
       throws OrtException {
+    return run(inputs, requestedOutputs, Collections.<String, OnnxTensor>emptyMap(), runOptions);
+  }
+
+  /**
+   * Scores an input feed dict, writing the outputs into the supplied preallocated tensors.
+   *
+   * <p>The pinned outputs are written in place, so no output is allocated by the run. Backing the
+   * inputs and pinned outputs with direct {@link java.nio.ByteBuffer}s avoids any copy between Java
+   * and native memory, and the tensors can be reused across runs. The pinned outputs must have the
+   * type and shape of the outputs produced by the model.
+   *
+   * @param inputs The inputs to score.
+   * @param pinnedOutputs The preallocated output tensors, keyed by output name.
+   * @throws OrtException If there was an error in native code, the input or output names are
+   *     invalid, or if there are zero or too many inputs or outputs.
+   */
+  public void run(Map<String, OnnxTensor> inputs, Map<String, OnnxTensor> pinnedOutputs)
+      throws OrtException {
+    run(inputs, pinnedOutputs, null);
+  }
+
+  /**
+   * Scores an input feed dict, writing the outputs into the supplied preallocated tensors.
+   *
+   * <p>See {@link #run(Map, Map)}.
+   *
+   * @param inputs The inputs to score.
+   * @param pinnedOutputs The preallocated output tensors, keyed by output name.
+   * @param runOptions The RunOptions to control this run.
+   * @throws OrtException If there was an error in native code, the input or output names are
+   *     invalid, or if there are zero or too many inputs or outputs.
+   */
+  public void run(
+      Map<String, OnnxTensor> inputs, Map<String, OnnxTensor> pinnedOutputs, RunOptions runOptions)
+      throws OrtException {
+    run(inputs, Collections.<String>emptySet(), pinnedOutputs, runOptions).close();
+  }
+
+  /**
+   * Scores an input feed dict, returning the map of requested inferred outputs and writing the
+   * pinned outputs into the supplied preallocated tensors.
+   *
+   * <p>The returned outputs are sorted based on the supplied set traveral order, and do not include
+   * the pinned outputs. Closing the result does not close the pinned outputs.
+   *
+   * @param inputs The inputs to score.
+   * @param requestedOutputs The requested outputs, which are allocated by the run.
+   * @param pinnedOutputs The preallocated output tensors, keyed by output name.
+   * @param runOptions The RunOptions to control this run.
+   * @return The inferred outputs which were not pinned.
+   * @throws OrtException If there was an error in native code, the input or output names are
+   *     invalid, or if there are zero or too many inputs or outputs.
+   */
+  public Result run(
+      Map<String, OnnxTensor> inputs,
+      Set<String> requestedOutputs,
+      Map<String, OnnxTensor> pinnedOutputs,
+      RunOptions runOptions)
+      throws OrtException {
     if (!closed) {
       if (inputs.isEmpty() || (inputs.size() > numInputs)) {
         throw new OrtException(
             "Unexpected number of inputs, expected [1," + numInputs + ") found " + inputs.size());
       }
-      if (requestedOutputs.isEmpty() || (requestedOutputs.size() > numOutputs)) {
+      int totalOutputs = requestedOutputs.size() + pinnedOutputs.size();
+      if (totalOutputs == 0 || (totalOutputs > numOutputs)) {
         throw new OrtException(
             "Unexpected number of requestedOutputs, expected [1,"
                 + numOutputs
                 + ") found "
-                + requestedOutputs.size());
+                + totalOutputs);
       }
       String[] inputNamesArray = new String[inputs.size()];
       long[] inputHandles = new long[inputs.size()];
@@ -276,17 +336,31 @@ public class OrtSession implements AutoCloseable {
               "Unknown input name " + t.getKey() + ", expected one of " + inputNames.toString());
         }
       }
-      String[] outputNamesArray = new String[requestedOutputs.size()];
+      // The requested outputs come first, followed by the pinned outputs.
+      String[] outputNamesArray = new String[totalOutputs];
+      long[] outputHandles = new long[totalOutputs];
       i = 0;
       for (String s : requestedOutputs) {
-        if (outputNames.contains(s)) {
+        if (outputNames.contains(s) && !pinnedOutputs.containsKey(s)) {
           outputNamesArray[i] = s;
           i++;
+        } else if (pinnedOutputs.containsKey(s)) {
+          throw new OrtException("Output " + s + " is both requested and pinned");
         } else {
           throw new OrtException(
               "Unknown output name " + s + ", expected one of " + outputNames.toString());
         }
       }
+      for (Map.Entry<String, OnnxTensor> t : pinnedOutputs.entrySet()) {
+        if (outputNames.contains(t.getKey())) {
+          outputNamesArray[i] = t.getKey();
+          outputHandles[i] = t.getValue().getNativeHandle();
+          i++;
+        } else {
+          throw new OrtException(
+              "Unknown output name " + t.getKey() + ", expected one of " + outputNames.toString());
+        }
+      }
       long runOptionsHandle = runOptions == null ? 0 : runOptions.nativeHandle;
 
       OnnxValue[] outputValues =
@@ -298,9 +372,12 @@ public class OrtSession implements AutoCloseable {
               inputHandles,
               inputNamesArray.length,
               outputNamesArray,
+              outputHandles,
               outputNamesArray.length,
               runOptionsHandle);
-      return new Result(outputNamesArray, outputValues);
+      int numRequested = requestedOutputs.size();
+      return new Result(
+          Arrays.copyOf(outputNamesArray, numRequested), Arrays.copyOf(outputValues, numRequested));
     } else {
       throw new IllegalStateException("Trying to score a closed OrtSession.");
     }
@@ -411,6 +488,8 @@ public class OrtSession implements AutoCloseable {
    * @param inputs The input tensors.
    * @param numInputs The number of inputs.
    * @param outputNamesArray The requested output names.
+   * @param outputs The preallocated output tensors, zero (i.e. the null pointer) for the outputs to
+   *     be allocated by the run.
    * @param numOutputs The number of requested outputs.
    * @param runOptionsHandle The (possibly null) pointer to the run options.
    * @return The OnnxValues produced by this run.
@@ -424,6 +503,7 @@ public class OrtSession implements AutoCloseable {
       long[] inputs,
       long numInputs,
       String[] outputNamesArray,
+      long[] outputs,
       long numOutputs,
       long runOptionsHandle)
       throws OrtException;
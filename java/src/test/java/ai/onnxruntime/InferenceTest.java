@@ -33,6 +33,7 @@ import java.nio.file.Path;
 import java.nio.file.Paths;
 import java.util.ArrayList;
 import java.util.Arrays;
+import java.util.Collections;
 import java.util.EnumSet;
 import java.util.HashMap;
 import java.util.HashSet;
@@ -971,6 +972,47 @@ public class InferenceTest {
     }
   }
 
+  @Test
+  public void testPinnedOutputs() throws OrtException {
+    // model takes 1x5 input of fixed type, echoes back
+    String modelPath = getResourcePath("/test_types_FLOAT.pb").toString();
+
+    try (OrtEnvironment env = OrtEnvironment.getEnvironment("testPinnedOutputs");
+        SessionOptions options = new SessionOptions();
+        OrtSession session = env.createSession(modelPath, options)) {
+      String inputName = session.getInputNames().iterator().next();
+      String outputName = session.getOutputNames().iterator().next();
+      long[] shape = new long[] {1, 5};
+      FloatBuffer inputBuffer =
+          ByteBuffer.allocateDirect(5 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+      FloatBuffer outputBuffer =
+          ByteBuffer.allocateDirect(5 * 4).order(ByteOrder.nativeOrder()).asFloatBuffer();
+
+      try (OnnxTensor input = OnnxTensor.createTensor(env, inputBuffer, shape);
+          OnnxTensor output = OnnxTensor.createTensor(env, outputBuffer, shape)) {
+        Map<String, OnnxTensor> inputs = Collections.singletonMap(inputName, input);
+        Map<String, OnnxTensor> outputs = Collections.singletonMap(outputName, output);
+        // the tensors view the direct buffers, so they are reused across the runs
+        for (int i = 0; i < 3; i++) {
+          float[] inputArr = new float[] {i, -i, 2 * i, -2 * i, 3 * i};
+          inputBuffer.put(inputArr).rewind();
+          session.run(inputs, outputs);
+          float[] resultArray = new float[5];
+          outputBuffer.get(resultArray).rewind();
+          assertArrayEquals(inputArr, resultArray, 1e-6f);
+        }
+
+        // a pinned output can't be requested as well
+        try {
+          session.run(inputs, Collections.singleton(outputName), outputs, null);
+          fail("Should have thrown OrtException");
+        } catch (OrtException e) {
+          // pass
+        }
+      }
+    }
+  }
+
   @Test
   public void testRunOptions() throws OrtException {
     // model takes 1x5 input of fixed type, echoes back
@@ -34,16 +34,9 @@ class OnnxruntimeSessionHandler implements SessionHandler {
 
   async run(feeds: SessionHandler.FeedsType, fetches: SessionHandler.FetchesType, options: InferenceSession.RunOptions):
       Promise<SessionHandler.ReturnType> {
-    return new Promise((resolve, reject) => {
-      process.nextTick(() => {
-        try {
-          resolve(this.#inferenceSession.run(feeds, fetches, options));
-        } catch (e) {
-          // reject if any error is thrown
-          reject(e);
-        }
-      });
-    });
+    // the native run() does not block the event loop; an error thrown while validating the arguments rejects the
+    // returned promise since this is an async function.
+    return this.#inferenceSession.run(feeds, fetches, options);
   }
 }
 
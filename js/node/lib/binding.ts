@@ -17,7 +17,8 @@ type RunOptions = InferenceSession.RunOptions;
 
 
 /**
- * Binding exports a simple synchronized inference session object wrap.
+ * Binding exports a simple inference session object wrap. Model loading is synchronized, while run() executes on a
+ * thread of the libuv thread pool and returns a promise.
  */
 export declare namespace Binding {
   export interface InferenceSession {
@@ -27,7 +28,7 @@ export declare namespace Binding {
     readonly inputNames: string[];
     readonly outputNames: string[];
 
-    run(feeds: FeedsType, fetches: FetchesType, options: RunOptions): ReturnType;
+    run(feeds: FeedsType, fetches: FetchesType, options: RunOptions): Promise<ReturnType>;
   }
 
   export interface InferenceSessionConstructor {
@@ -128,6 +128,107 @@ Napi::Value InferenceSessionWrap::GetOutputNames(const Napi::CallbackInfo &info)
   return scope.Escape(CreateNapiArrayFrom(env, outputNames_));
 }
 
+namespace {
+
+// RunWorker runs a session on a thread of the libuv thread pool, so that the event loop is not blocked during the
+// inference and a process can run many inferences at the same time.
+//
+// The input tensors and the preallocated output tensors are used in place. The JavaScript objects that own their
+// data are referenced by the worker until the run completes, so that they are not garbage collected meanwhile.
+class RunWorker : public Napi::AsyncWorker {
+public:
+  RunWorker(Napi::Env env, Napi::Object session, Ort::Session &ortSession)
+      : Napi::AsyncWorker(env, "onnxruntime-node:run"), deferred_(Napi::Promise::Deferred::New(env)),
+        session_(Napi::Persistent(session)), ortSession_(ortSession), runOptions_(nullptr),
+        defaultRunOptions_(nullptr) {}
+
+  Napi::Promise Promise() const { return deferred_.Promise(); }
+
+  void AddInput(Napi::Env env, const char *name, Napi::Value value) {
+    inputValues_.push_back(NapiValueToOrtValue(env, value));
+    inputNames_.push_back(name);
+    Pin(value);
+  }
+
+  void AddOutput(Napi::Env env, const char *name, Napi::Value value) {
+    if (value.IsNull()) {
+      outputValues_.emplace_back(nullptr);
+      preallocatedOutputs_.emplace_back();
+    } else {
+      outputValues_.push_back(NapiValueToOrtValue(env, value));
+      preallocatedOutputs_.push_back(Napi::Persistent(value.As<Napi::Object>()));
+      Pin(value);
+    }
+    outputNames_.push_back(name);
+  }
+
+  void SetRunOptions(Ort::RunOptions &&runOptions) { runOptions_ = std::move(runOptions); }
+  void SetDefaultRunOptions(Ort::RunOptions &runOptions) { defaultRunOptions_ = &runOptions; }
+
+protected:
+  // called on a thread of the libuv thread pool
+  void Execute() override {
+    try {
+      ortSession_.Run(runOptions_ == nullptr ? *defaultRunOptions_ : runOptions_,
+                      inputNames_.empty() ? nullptr : &inputNames_[0],
+                      inputValues_.empty() ? nullptr : &inputValues_[0], inputValues_.size(),
+                      outputNames_.empty() ? nullptr : &outputNames_[0],
+                      outputValues_.empty() ? nullptr : &outputValues_[0], outputValues_.size());
+    } catch (std::exception const &e) {
+      SetError(e.what());
+    }
+  }
+
+  // called on the JavaScript main thread
+  void OnOK() override {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+
+    try {
+      Napi::Object result = Napi::Object::New(env);
+      for (size_t i = 0; i < outputNames_.size(); i++) {
+        // a preallocated output is returned as is, since the run has written the result into its data
+        result.Set(outputNames_[i], preallocatedOutputs_[i].IsEmpty()
+                                        ? OrtValueToNapiValue(env, outputValues_[i])
+                                        : Napi::Value(preallocatedOutputs_[i].Value()));
+      }
+      deferred_.Resolve(result);
+    } catch (Napi::Error const &e) {
+      deferred_.Reject(e.Value());
+    } catch (std::exception const &e) {
+      deferred_.Reject(Napi::Error::New(env, e.what()).Value());
+    }
+  }
+
+  // called on the JavaScript main thread
+  void OnError(const Napi::Error &e) override { deferred_.Reject(e.Value()); }
+
+private:
+  void Pin(Napi::Value value) {
+    auto data = value.As<Napi::Object>().Get("data");
+    if (data.IsObject()) {
+      pinnedData_.push_back(Napi::Persistent(data.As<Napi::Object>()));
+    }
+  }
+
+  Napi::Promise::Deferred deferred_;
+
+  // keeps the session object alive until the run completes
+  Napi::ObjectReference session_;
+  Ort::Session &ortSession_;
+  Ort::RunOptions runOptions_;
+  Ort::RunOptions *defaultRunOptions_;
+
+  std::vector<const char *> inputNames_;
+  std::vector<Ort::Value> inputValues_;
+  std::vector<const char *> outputNames_;
+  std::vector<Ort::Value> outputValues_;
+  std::vector<Napi::ObjectReference> preallocatedOutputs_;
+  std::vector<Napi::ObjectReference> pinnedData_;
+};
+
+} // namespace
+
 Napi::Value InferenceSessionWrap::Run(const Napi::CallbackInfo &info) {
   Napi::Env env = info.Env();
   ORT_NAPI_THROW_ERROR_IF(!this->initialized_, env, "Session is not initialized.");
@@ -142,51 +243,32 @@ Napi::Value InferenceSessionWrap::Run(const Napi::CallbackInfo &info) {
   auto feed = info[0].As<Napi::Object>();
   auto fetch = info[1].As<Napi::Object>();
 
-  std::vector<const char *> inputNames_cstr;
-  std::vector<Ort::Value> inputValues;
-  std::vector<const char *> outputNames_cstr;
-  std::vector<Ort::Value> outputValues;
-  std::vector<bool> reuseOutput;
-  size_t inputIndex = 0;
-  size_t outputIndex = 0;
-
   try {
+    std::unique_ptr<RunWorker> worker{new RunWorker(env, info.This().As<Napi::Object>(), *session_)};
+
     for (auto &name : inputNames_) {
       if (feed.Has(name)) {
-        inputIndex++;
-        inputNames_cstr.push_back(name.c_str());
-        auto value = feed.Get(name);
-        inputValues.push_back(NapiValueToOrtValue(env, value));
+        worker->AddInput(env, name.c_str(), feed.Get(name));
       }
     }
     for (auto &name : outputNames_) {
       if (fetch.Has(name)) {
-        outputIndex++;
-        outputNames_cstr.push_back(name.c_str());
-        auto value = fetch.Get(name);
-        reuseOutput.push_back(!value.IsNull());
-        outputValues.emplace_back(value.IsNull() ? Ort::Value{nullptr} : NapiValueToOrtValue(env, value));
+        worker->AddOutput(env, name.c_str(), fetch.Get(name));
       }
     }
 
-    Ort::RunOptions runOptions{nullptr};
     if (info.Length() > 2) {
-      runOptions = Ort::RunOptions{};
+      Ort::RunOptions runOptions;
       ParseRunOptions(info[2].As<Napi::Object>(), runOptions);
+      worker->SetRunOptions(std::move(runOptions));
+    } else {
+      worker->SetDefaultRunOptions(*defaultRunOptions_);
     }
 
-    session_->Run(runOptions == nullptr ? *defaultRunOptions_.get() : runOptions,
-                  inputIndex == 0 ? nullptr : &inputNames_cstr[0], inputIndex == 0 ? nullptr : &inputValues[0],
-                  inputIndex, outputIndex == 0 ? nullptr : &outputNames_cstr[0],
-                  outputIndex == 0 ? nullptr : &outputValues[0], outputIndex);
-
-    Napi::Object result = Napi::Object::New(env);
-
-    for (size_t i = 0; i < outputIndex; i++) {
-      result.Set(outputNames_[i], OrtValueToNapiValue(env, outputValues[i]));
-    }
-
-    return scope.Escape(result);
+    // the worker deletes itself after it completes
+    auto promise = worker->Promise();
+    worker.release()->Queue();
+    return scope.Escape(promise);
   } catch (Napi::Error const &e) {
     throw e;
   } catch (std::exception const &e) {
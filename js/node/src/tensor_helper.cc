@@ -247,10 +247,16 @@ Napi::Value OrtValueToNapiValue(Napi::Env env, Ort::Value &value) {
     returnValue.Set("data", Napi::Value(env, stringArray));
   } else {
     // number data
-    // TODO: optimize memory
-    auto arrayBuffer = Napi::ArrayBuffer::New(env, size * DATA_TYPE_ELEMENT_SIZE_MAP[elemType]);
+    // the array buffer is created on the tensor data, and releases the OrtValue when it is garbage collected.
+    Napi::ArrayBuffer arrayBuffer;
     if (size > 0) {
-      memcpy(arrayBuffer.Data(), value.GetTensorMutableData<void>(), size * DATA_TYPE_ELEMENT_SIZE_MAP[elemType]);
+      std::unique_ptr<Ort::Value> owner{new Ort::Value(std::move(value))};
+      arrayBuffer = Napi::ArrayBuffer::New(
+          env, owner->GetTensorMutableData<void>(), size * DATA_TYPE_ELEMENT_SIZE_MAP[elemType],
+          [](Napi::Env, void *, Ort::Value *ownedValue) { delete ownedValue; }, owner.get());
+      owner.release();
+    } else {
+      arrayBuffer = Napi::ArrayBuffer::New(env, 0);
     }
     napi_value typedArrayData;
     napi_status status =
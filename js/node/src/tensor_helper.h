@@ -11,5 +11,6 @@
 // convert a Javascript OnnxValue object to an OrtValue object
 Ort::Value NapiValueToOrtValue(Napi::Env env, Napi::Value value);
 
-// convert an OrtValue object to a Javascript OnnxValue object
+// convert an OrtValue object to a Javascript OnnxValue object.
+// the data of a numeric tensor is not copied: the OrtValue is moved into the returned object, which owns it from then.
 Napi::Value OrtValueToNapiValue(Napi::Env env, Ort::Value &value);
@@ -23,4 +23,12 @@ describe('E2E Tests - InferenceSession.run()', async () => {
       assertTensorEqual(result.softmaxout_1, expectedOutput0);
     }
   }).timeout('120s');
+
+  it('concurrent run() calls', async () => {
+    const results = await Promise.all(
+        Array.from({length: 16}, () => session!.run({'data_0': input0}, ['softmaxout_1'])));
+    for (const result of results) {
+      assertTensorEqual(result.softmaxout_1, expectedOutput0);
+    }
+  }).timeout('120s');
 });
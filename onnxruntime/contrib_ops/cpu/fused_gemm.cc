@@ -14,6 +14,13 @@ class FusedGemm final : public Gemm<T> {
  public:
   FusedGemm(const OpKernelInfo& info) : Gemm<T>(info) {
     std::string activation = info.GetAttrOrDefault<std::string>("activation", "");
+
+    // the activations supported by MLAS are applied to each tile of the output as it is produced
+    if (GetMlasActivation(info, activation, this->mlas_activation_)) {
+      this->has_mlas_activation_ = true;
+      return;
+    }
+
     NodeAttributes attrs;
     for (const auto& p : info.node().GetAttributes()) {
       if (p.first.size() > ACTIVATION_NAME_PREFIX_LEN && p.first.compare(0, ACTIVATION_NAME_PREFIX_LEN, ACTIVATION_NAME_PREFIX) == 0) {
@@ -22,6 +29,26 @@ class FusedGemm final : public Gemm<T> {
     }
     ORT_THROW_IF_ERROR(functors::ElementWiseRangedTransform<T>::Create(activation, attrs, this->activation_));
   }
+
+ private:
+  static bool GetMlasActivation(const OpKernelInfo& info, const std::string& activation_type,
+                                MLAS_ACTIVATION& activation) {
+    if (activation_type == "Relu") {
+      activation.ActivationKind = MlasReluActivation;
+    } else if (activation_type == "Sigmoid") {
+      activation.ActivationKind = MlasLogisticActivation;
+    } else if (activation_type == "Tanh") {
+      activation.ActivationKind = MlasTanhActivation;
+    } else if (activation_type == "Gelu") {
+      activation.ActivationKind = MlasGeluActivation;
+    } else if (activation_type == "LeakyRelu") {
+      activation.ActivationKind = MlasLeakyReluActivation;
+      activation.Parameters.LeakyRelu.alpha = info.GetAttrOrDefault<float>("activation_alpha", 0.01f);
+    } else {
+      return false;
+    }
+    return true;
+  }
 };
 
 ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(
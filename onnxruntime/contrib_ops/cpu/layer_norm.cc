@@ -5,8 +5,10 @@
 
 #include "core/common/safeint.h"
 #include "core/framework/tensor.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/platform/threadpool.h"
 #include "core/providers/common.h"
+#include "core/providers/cpu/fp16_helpers.h"
 #include "core/util/math_cpuonly.h"
 
 namespace onnxruntime {
@@ -34,6 +36,92 @@ namespace contrib {
 
 REGISTER_KERNEL_TYPED(float)
 REGISTER_KERNEL_TYPED(double)
+REGISTER_KERNEL_TYPED(MLFloat16)
+
+namespace {
+
+// Normalizes the rows with the fused MLAS kernel. Returns false if the element type is not supported.
+template <typename T>
+bool ComputeWithMlas(const T*, const T*, const T*, T*, T*, T*, int64_t, int64_t, float, bool,
+                     concurrency::ThreadPool*) {
+  return false;
+}
+
+template <>
+bool ComputeWithMlas<float>(const float* input, const float* scale, const float* bias, float* output,
+                            float* mean, float* inv_std_dev, int64_t norm_count, int64_t norm_size, float epsilon,
+                            bool simplified, concurrency::ThreadPool* tp) {
+  MlasLayerNormalization(input, nullptr, nullptr, scale, bias, output, mean, inv_std_dev,
+                         static_cast<size_t>(norm_count), static_cast<size_t>(norm_size), epsilon, simplified, tp);
+  return true;
+}
+
+template <bool simplified>
+Status ComputeHalf(OpKernelContext* p_ctx, int64_t axis_attr, float epsilon) {
+  const Tensor* X = p_ctx->Input<Tensor>(0);
+  const Tensor* scale = p_ctx->Input<Tensor>(1);
+  const Tensor* bias = simplified ? nullptr : p_ctx->Input<Tensor>(2);
+  const MLFloat16* X_data = X->Data<MLFloat16>();
+
+  const TensorShape& x_shape = X->Shape();
+  const int64_t axis = HandleNegativeAxis(axis_attr, x_shape.NumDimensions());
+  const size_t norm_count = static_cast<size_t>(x_shape.SizeToDimension(axis));
+  const size_t norm_size = static_cast<size_t>(x_shape.SizeFromDimension(axis));
+
+  MLFloat16* Y_data = p_ctx->Output(0, x_shape)->MutableData<MLFloat16>();
+
+  std::vector<int64_t> mean_inv_std_dev_dim(x_shape.GetDims());
+  std::fill(mean_inv_std_dev_dim.begin() + axis, mean_inv_std_dev_dim.end(), 1);
+
+  Tensor* mean = simplified ? nullptr : p_ctx->Output(1, TensorShape(mean_inv_std_dev_dim));
+  Tensor* inv_std_dev = p_ctx->Output(simplified ? 1 : 2, TensorShape(mean_inv_std_dev_dim));
+  MLFloat16* mean_data = (mean != nullptr) ? mean->MutableData<MLFloat16>() : nullptr;
+  MLFloat16* inv_std_dev_data = (inv_std_dev != nullptr) ? inv_std_dev->MutableData<MLFloat16>() : nullptr;
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(p_ctx->GetTempSpaceAllocator(&alloc));
+
+  concurrency::ThreadPool* tp = p_ctx->GetOperatorThreadPool();
+  auto scale_data = fp16::ToFloatBuffer(alloc, *scale, tp);
+  IAllocatorUniquePtr<float> bias_data;
+  if (bias != nullptr) {
+    bias_data = fp16::ToFloatBuffer(alloc, *bias, tp);
+  }
+
+  // Each block of rows is widened to single precision, normalized by MLAS and narrowed back, so the single
+  // precision copy stays in the cache.
+  constexpr size_t kBlockElements = 16384;
+  const size_t block_rows = std::max<size_t>(1, kBlockElements / std::max<size_t>(norm_size, 1));
+  const std::ptrdiff_t block_count = static_cast<std::ptrdiff_t>((norm_count + block_rows - 1) / block_rows);
+  const double block_size = static_cast<double>(block_rows * norm_size);
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, block_count, {block_size * sizeof(MLFloat16), block_size * sizeof(MLFloat16), block_size * 8.0},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        std::vector<float> buffer(block_rows * norm_size);
+        std::vector<float> statistics(block_rows * 2);
+        for (std::ptrdiff_t block = first; block < last; block++) {
+          const size_t row = static_cast<size_t>(block) * block_rows;
+          const size_t rows = std::min(block_rows, norm_count - row);
+          const size_t count = rows * norm_size;
+          MlasConvertHalfToFloatBuffer(&X_data[row * norm_size].val, buffer.data(), count);
+          MlasLayerNormalization(buffer.data(), nullptr, nullptr, scale_data.get(), bias_data.get(), buffer.data(),
+                                 statistics.data(), statistics.data() + block_rows, rows, norm_size, epsilon,
+                                 simplified, nullptr);
+          MlasConvertFloatToHalfBuffer(buffer.data(), &Y_data[row * norm_size].val, count);
+          if (mean_data != nullptr) {
+            MlasConvertFloatToHalfBuffer(statistics.data(), &mean_data[row].val, rows);
+          }
+          if (inv_std_dev_data != nullptr) {
+            MlasConvertFloatToHalfBuffer(statistics.data() + block_rows, &inv_std_dev_data[row].val, rows);
+          }
+        }
+      });
+
+  return Status::OK();
+}
+
+}  // namespace
 
 template <typename T, bool simplified>
 LayerNorm<T, simplified>::LayerNorm(const OpKernelInfo& op_kernel_info)
@@ -101,6 +189,11 @@ Status LayerNorm<T, simplified>::Compute(OpKernelContext* p_ctx) const {
     inv_std_dev_data = static_cast<T*>(inv_std_dev_data_buf_ptr.get());
   }
 
+  if (ComputeWithMlas<T>(X_data, scale_data, bias_data, Y_data, mean_data, inv_std_dev_data,
+                         norm_count, norm_size, epsilon_, simplified, p_ctx->GetOperatorThreadPool())) {
+    return Status::OK();
+  }
+
   concurrency::ThreadPool::TryBatchParallelFor(p_ctx->GetOperatorThreadPool(), static_cast<int32_t>(norm_count),
                                                [&](ptrdiff_t task_idx) {
                                                  const T* p_input = X_data + task_idx * norm_size;
@@ -140,5 +233,15 @@ Status LayerNorm<T, simplified>::Compute(OpKernelContext* p_ctx) const {
   return Status::OK();
 }
 
+template <>
+Status LayerNorm<MLFloat16, false>::Compute(OpKernelContext* p_ctx) const {
+  return ComputeHalf<false>(p_ctx, axis_, epsilon_);
+}
+
+template <>
+Status LayerNorm<MLFloat16, true>::Compute(OpKernelContext* p_ctx) const {
+  return ComputeHalf<true>(p_ctx, axis_, epsilon_);
+}
+
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "core/common/common.h"
+#include "core/framework/float16.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/tensor.h"
 
@@ -21,5 +22,11 @@ class LayerNorm final : public OpKernel {
   float epsilon_;
 };
 
+// The half precision kernels normalize in single precision, see layer_norm.cc.
+template <>
+Status LayerNorm<MLFloat16, false>::Compute(OpKernelContext* p_op_kernel_context) const;
+template <>
+Status LayerNorm<MLFloat16, true>::Compute(OpKernelContext* p_op_kernel_context) const;
+
 }  // namespace contrib
 }  // namespace onnxruntime
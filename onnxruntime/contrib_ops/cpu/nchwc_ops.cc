@@ -2,12 +2,14 @@
 // Licensed under the MIT License.
 
 #include "nchwc_ops.h"
+#include "core/providers/common.h"
 #include "core/mlas/inc/mlas.h"
 
 namespace onnxruntime {
 namespace contrib {
 
-Status ReorderInput::Compute(OpKernelContext* context) const {
+template <typename T>
+Status ReorderInput<T>::Compute(OpKernelContext* context) const {
   const auto* X = context->Input<Tensor>(0);
   const auto& X_shape = X->Shape().GetDims();
   const auto X_rank = X_shape.size();
@@ -18,8 +20,8 @@ Status ReorderInput::Compute(OpKernelContext* context) const {
   const auto* X_spatial_dims = X_shape.data() + (channels_last_ ? 1 : 2);
 
   // The current implementation of MlasReorderInputNchw does not work for channels that
-  // are not a multiple of 4.
-  ORT_ENFORCE((channels % 4) == 0);
+  // are not a multiple of 4. The quantized implementation has no such restriction.
+  ORT_ENFORCE(!std::is_same<T, float>::value || (channels % 4) == 0);
 
   const int64_t nchwc_block_size = static_cast<int64_t>(MlasNchwcGetBlockSize());
   const int64_t nchwc_channels = (channels + nchwc_block_size - 1) & ~(nchwc_block_size - 1);
@@ -66,8 +68,8 @@ Status ReorderInput::Compute(OpKernelContext* context) const {
     worker_count = total_work;
   }
 
-  const auto* x_data = X->template Data<float>();
-  auto* y_data = Y->template MutableData<float>();
+  const auto* x_data = X->template Data<T>();
+  auto* y_data = Y->template MutableData<T>();
 
   auto reorder_worker = [&](ptrdiff_t batch) {
     auto work = concurrency::ThreadPool::PartitionWork(batch, worker_count, total_work);
@@ -125,7 +127,8 @@ Status ReorderInput::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
-Status ReorderOutput::Compute(OpKernelContext* context) const {
+template <typename T>
+Status ReorderOutput<T>::Compute(OpKernelContext* context) const {
   const auto* X = context->Input<Tensor>(0);
   const auto& X_shape = X->Shape().GetDims();
   const auto X_rank = X_shape.size();
@@ -142,8 +145,8 @@ Status ReorderOutput::Compute(OpKernelContext* context) const {
   }
   auto* Y = context->Output(0, Y_shape);
 
-  const auto* x_data = X->template Data<float>();
-  auto* y_data = Y->template MutableData<float>();
+  const auto* x_data = X->template Data<T>();
+  auto* y_data = Y->template MutableData<T>();
   if (channels_last_) {
     MlasReorderOutputNhwc(Y_shape.data(), x_data, y_data);
   } else {
@@ -223,6 +226,156 @@ Status NchwcConv::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+Status NchwcQLinearConv::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  // Support packing the filter tensor. The NCHWc transformer has already
+  // reordered the filter to the HWIO format, except for depthwise convolutions
+  // which consume the filter directly.
+  if (input_idx != 3) {
+    return Status::OK();
+  }
+
+  const auto& shape = tensor.Shape().GetDims();
+  if (shape.size() != 4 || (shape[0] % conv_attrs_.group) != 0) {
+    return Status::OK();
+  }
+
+  const size_t group_count = static_cast<size_t>(conv_attrs_.group);
+  if (shape[1] == 1 && (shape[0] / conv_attrs_.group) == 1) {
+    return Status::OK();
+  }
+
+  const bool is_W_signed = tensor.IsDataType<int8_t>();
+
+  const size_t packed_W_size = MlasNchwcPackFilterSize(shape.data(), group_count, is_W_signed);
+  if (packed_W_size == 0) {
+    return Status::OK();
+  }
+
+  auto alloc = Info().GetAllocator(0, OrtMemTypeDefault);
+  auto* packed_W = alloc->Alloc(packed_W_size);
+  packed_W_buffer_ = BufferUniquePtr(packed_W, BufferDeleter(alloc));
+
+  MlasNchwcPackFilter(shape.data(), group_count, static_cast<const uint8_t*>(tensor.DataRaw()), is_W_signed, packed_W);
+
+  W_shape_ = tensor.Shape();
+  is_W_signed_ = is_W_signed;
+  is_W_packed_ = true;
+  is_packed = true;
+  return Status::OK();
+}
+
+Status NchwcQLinearConv::Compute(OpKernelContext* context) const {
+  const auto* X = context->Input<Tensor>(0);
+  const auto* X_scale = context->Input<Tensor>(1);
+  const auto* X_zero_point = context->Input<Tensor>(2);
+  const auto* W = is_W_packed_ ? nullptr : context->Input<Tensor>(3);
+  const auto* W_scale = context->Input<Tensor>(4);
+  const auto* W_zero_point = context->Input<Tensor>(5);
+  const auto* Y_scale = context->Input<Tensor>(6);
+  const auto* Y_zero_point = context->Input<Tensor>(7);
+  const auto* B = context->Input<Tensor>(8);
+
+  const auto& X_shape = X->Shape();
+  const auto& W_shape = (W != nullptr) ? W->Shape() : W_shape_;
+
+  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X_shape, W_shape));
+  ORT_ENFORCE(X_shape.NumDimensions() == 4);
+  ORT_ENFORCE((X_shape[1] % MlasNchwcGetBlockSize()) == 0);
+
+  // The filter, filter scale, and bias tensors are aligned to the NCHWc block
+  // size by the NCHWc transformer.
+  const int64_t M = W_shape[0];
+
+  ORT_ENFORCE(IsScalarOr1ElementVector(X_scale),
+              "NchwcQLinearConv : input scale must be a scalar or 1D tensor of size 1");
+  ORT_ENFORCE(IsScalarOr1ElementVector(X_zero_point),
+              "NchwcQLinearConv : input zero point must be a scalar or 1D tensor of size 1");
+  ORT_ENFORCE(IsScalarOr1ElementVector(Y_scale),
+              "NchwcQLinearConv : result scale must be a scalar or 1D tensor of size 1");
+  ORT_ENFORCE(IsScalarOr1ElementVector(Y_zero_point),
+              "NchwcQLinearConv : result zero point must be a scalar or 1D tensor of size 1");
+
+  const uint8_t X_zero_point_value = *X_zero_point->template Data<uint8_t>();
+  const uint8_t Y_zero_point_value = *Y_zero_point->template Data<uint8_t>();
+
+  const int64_t W_zero_point_size = W_zero_point->Shape().Size();
+  const auto* W_zero_point_data = static_cast<const uint8_t*>(W_zero_point->DataRaw());
+  const uint8_t W_zero_point_value = W_zero_point_data[0];
+  for (int64_t i = 1; i < W_zero_point_size; i++) {
+    if (W_zero_point_data[i] != W_zero_point_value) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "NchwcQLinearConv : filter zero point must be constant");
+    }
+  }
+
+  const int64_t W_scale_size = W_scale->Shape().Size();
+  if (W_scale_size != 1 && W_scale_size != M) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "NchwcQLinearConv : filter scale shape invalid");
+  }
+
+  const float X_scale_value = *X_scale->template Data<float>();
+  const float Y_scale_value = *Y_scale->template Data<float>();
+  const auto* W_scale_data = W_scale->template Data<float>();
+
+  std::vector<float> output_scales(static_cast<size_t>(W_scale_size));
+  for (int64_t i = 0; i < W_scale_size; i++) {
+    output_scales[i] = (X_scale_value * W_scale_data[i] / Y_scale_value);
+  }
+
+  if (B != nullptr && B->Shape().Size() != M) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "NchwcQLinearConv : bias shape invalid");
+  }
+
+  std::vector<int64_t> kernel_shape;
+  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W_shape, kernel_shape));
+  if (kernel_shape.size() != 2) {
+    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "Unsupported convolution size.");
+  }
+
+  std::vector<int64_t> pads(conv_attrs_.pads);
+  if (pads.empty()) {
+    pads.resize(kernel_shape.size() * 2, 0);
+  }
+  std::vector<int64_t> dilations(conv_attrs_.dilations);
+  if (dilations.empty()) {
+    dilations.resize(kernel_shape.size(), 1);
+  }
+  std::vector<int64_t> strides(conv_attrs_.strides);
+  if (strides.empty()) {
+    strides.resize(kernel_shape.size(), 1);
+  }
+
+  std::vector<int64_t> Y_dims;
+  Y_dims.insert(Y_dims.begin(), {X_shape[0], M});
+  TensorShape input_shape = X->Shape().Slice(2);
+  ORT_RETURN_IF_ERROR(conv_attrs_.InferOutputShape(input_shape, kernel_shape, strides, dilations, pads, Y_dims));
+  auto* Y = context->Output(0, Y_dims);
+
+  MlasNchwcConv(X_shape.GetDims().data(),
+                kernel_shape.data(),
+                dilations.data(),
+                pads.data(),
+                strides.data(),
+                Y_dims.data(),
+                static_cast<size_t>(conv_attrs_.group),
+                X->template Data<uint8_t>(),
+                X_zero_point_value,
+                is_W_packed_ ? packed_W_buffer_.get() : W->DataRaw(),
+                W_zero_point_value,
+                is_W_packed_ ? is_W_signed_ : W->IsDataType<int8_t>(),
+                is_W_packed_,
+                B != nullptr ? B->template Data<int32_t>() : nullptr,
+                output_scales.data(),
+                output_scales.size() > 1,
+                Y_zero_point_value,
+                Y->template MutableData<uint8_t>(),
+                context->GetOperatorThreadPool());
+
+  return Status::OK();
+}
+
+template <typename T>
 Status NchwcPoolBase::NchwcPool(OpKernelContext* context, MLAS_POOLING_KIND kind) const {
   const auto* X = context->Input<Tensor>(0);
   const auto& X_shape = X->Shape();
@@ -240,20 +393,21 @@ Status NchwcPoolBase::NchwcPool(OpKernelContext* context, MLAS_POOLING_KIND kind
                 pool_attrs_.global_pooling ? nullptr : pads.data(),
                 pool_attrs_.global_pooling ? nullptr : pool_attrs_.strides.data(),
                 output_dims.data(),
-                X->template Data<float>(),
-                Y->template MutableData<float>(),
+                X->template Data<T>(),
+                Y->template MutableData<T>(),
                 context->GetOperatorThreadPool());
 
   return Status::OK();
 }
 
-Status NchwcMaxPool::Compute(OpKernelContext* context) const {
-  return NchwcPoolBase::NchwcPool(context, MlasMaximumPooling);
+template <typename T>
+Status NchwcMaxPool<T>::Compute(OpKernelContext* context) const {
+  return NchwcPoolBase::NchwcPool<T>(context, MlasMaximumPooling);
 }
 
 Status NchwcAveragePool::Compute(OpKernelContext* context) const {
-  return NchwcPoolBase::NchwcPool(context, pool_attrs_.count_include_pad ? MlasAveragePoolingIncludePad
-                                                                         : MlasAveragePoolingExcludePad);
+  return NchwcPoolBase::NchwcPool<float>(context, pool_attrs_.count_include_pad ? MlasAveragePoolingIncludePad
+                                                                                : MlasAveragePoolingExcludePad);
 }
 
 Status NchwcUpsample::Compute(OpKernelContext* context) const {
@@ -282,7 +436,15 @@ ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
     float,
     KernelDefBuilder()
         .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
-    ReorderInput);
+    ReorderInput<float>);
+
+ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
+    ReorderInput,
+    1,
+    uint8_t,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<uint8_t>()),
+    ReorderInput<uint8_t>);
 
 ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
     ReorderOutput,
@@ -290,7 +452,15 @@ ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
     float,
     KernelDefBuilder()
         .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
-    ReorderOutput);
+    ReorderOutput<float>);
+
+ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
+    ReorderOutput,
+    1,
+    uint8_t,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<uint8_t>()),
+    ReorderOutput<uint8_t>);
 
 ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
     Conv,
@@ -301,13 +471,32 @@ ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
         .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
     NchwcConv);
 
+ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
+    QLinearConv,
+    1,
+    uint8_t,
+    KernelDefBuilder()
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T2", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
+        .TypeConstraint("T3", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T4", DataTypeImpl::GetTensorType<int32_t>()),
+    NchwcQLinearConv);
+
 ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
     MaxPool,
     1,
     float,
     KernelDefBuilder()
         .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
-    NchwcMaxPool);
+    NchwcMaxPool<float>);
+
+ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
+    MaxPool,
+    1,
+    uint8_t,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<uint8_t>()),
+    NchwcMaxPool<uint8_t>);
 
 ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
     GlobalMaxPool,
@@ -315,7 +504,7 @@ ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
     float,
     KernelDefBuilder()
         .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
-    NchwcMaxPool);
+    NchwcMaxPool<float>);
 
 ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
     AveragePool,
@@ -12,6 +12,7 @@
 namespace onnxruntime {
 namespace contrib {
 
+template <typename T>
 class ReorderInput : public OpKernel {
  public:
   ReorderInput(const OpKernelInfo& info) : OpKernel(info) {
@@ -24,6 +25,7 @@ class ReorderInput : public OpKernel {
   int64_t channels_last_;
 };
 
+template <typename T>
 class ReorderOutput : public OpKernel {
  public:
   ReorderOutput(const OpKernelInfo& info) : OpKernel(info) {
@@ -53,6 +55,23 @@ class NchwcConv : public OpKernel {
   MLAS_ACTIVATION activation_;
 };
 
+class NchwcQLinearConv : public OpKernel {
+ public:
+  NchwcQLinearConv(const OpKernelInfo& info) : OpKernel(info), conv_attrs_(info) {
+  }
+
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  ConvAttributes conv_attrs_;
+  TensorShape W_shape_;
+  BufferUniquePtr packed_W_buffer_;
+  bool is_W_signed_{false};
+  bool is_W_packed_{false};
+};
+
 class NchwcPoolBase : public PoolBase {
  public:
   NchwcPoolBase(const OpKernelInfo& info) : PoolBase(info) {
@@ -61,9 +80,11 @@ class NchwcPoolBase : public PoolBase {
     }
   }
 
+  template <typename T>
   Status NchwcPool(OpKernelContext* context, MLAS_POOLING_KIND kind) const;
 };
 
+template <typename T>
 class NchwcMaxPool : public OpKernel, public NchwcPoolBase {
  public:
   NchwcMaxPool(const OpKernelInfo& info) : OpKernel(info), NchwcPoolBase(info) {
@@ -28,6 +28,7 @@ class QAttention : public OpKernel, public AttentionCPUBase {
   BufferUniquePtr packed_weights_;
   size_t packed_weights_size_;
   TensorShape weight_shape_;
+  bool input_is_signed_;
   bool weights_is_signed_;
 };
 
@@ -39,14 +40,19 @@ ONNX_OPERATOR_TYPED_KERNEL_EX(
     float,
     kCpuExecutionProvider,
     KernelDefBuilder()
-        .TypeConstraint("T1", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T1", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
         .TypeConstraint("T2", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
         .TypeConstraint("T3", DataTypeImpl::GetTensorType<float>())
         .TypeConstraint("T4", DataTypeImpl::GetTensorType<int32_t>()),
     QAttention<float>);
 
 template <typename T>
-QAttention<T>::QAttention(const OpKernelInfo& info) : OpKernel(info), AttentionCPUBase(info) {}
+QAttention<T>::QAttention(const OpKernelInfo& info) : OpKernel(info), AttentionCPUBase(info) {
+  // The packed format of the weights depends on the signedness of the input.
+  const auto* input_type = info.GetInputType(0);
+  input_is_signed_ = input_type != nullptr &&
+                     input_type->tensor_type().elem_type() == ONNX_NAMESPACE::TensorProto_DataType_INT8;
+}
 
 template <typename T>
 Status QAttention<T>::PrePack(const Tensor& weights, int input_idx, bool& is_packed) {
@@ -75,7 +81,7 @@ Status QAttention<T>::PrePack(const Tensor& weights, int input_idx, bool& is_pac
   const auto* weights_data = static_cast<const uint8_t*>(weights.DataRaw());
   weights_is_signed_ = weights.IsDataType<int8_t>();
 
-  packed_weights_size_ = MlasGemmPackBSize(head_size, input_hidden_size, weights_is_signed_);
+  packed_weights_size_ = MlasGemmPackBSize(head_size, input_hidden_size, input_is_signed_, weights_is_signed_);
   if (packed_weights_size_ == 0) {
     return Status::OK();
   }
@@ -86,7 +92,7 @@ Status QAttention<T>::PrePack(const Tensor& weights, int input_idx, bool& is_pac
   packed_weights_ = BufferUniquePtr(packed_weights_data, BufferDeleter(alloc));
 
   for (size_t i = 0; i < loop_len; i++) {
-    MlasGemmPackB(head_size, input_hidden_size, weights_data, hidden_size_x3, weights_is_signed_, packed_weights_data);
+    MlasGemmPackB(head_size, input_hidden_size, weights_data, hidden_size_x3, input_is_signed_, weights_is_signed_, packed_weights_data);
     packed_weights_data += packed_weights_size_;
     weights_data += head_size;
   }
@@ -141,7 +147,7 @@ Status QAttention<T>::Compute(OpKernelContext* context) const {
   if (i_zp_tensor != nullptr) {
     ORT_RETURN_IF_NOT(IsScalarOr1ElementVector(i_zp_tensor),
                       "input zero point must be a scalar or 1D tensor of size 1.");
-    input_zero_point = *i_zp_tensor->template Data<uint8_t>();
+    input_zero_point = *static_cast<const uint8_t*>(i_zp_tensor->DataRaw());
   }
 
   uint8_t weight_zero_point = 0;
@@ -184,7 +190,7 @@ Status QAttention<T>::Compute(OpKernelContext* context) const {
 
   {
     const int loop_len = 3 * batch_size * num_heads_;
-    const auto* input_data = input->template Data<uint8_t>();
+    const auto* input_data = static_cast<const uint8_t*>(input->DataRaw());
     const auto* bias_data = bias->template Data<T>();
 
     const auto* weights_data = packed_weights_ ? nullptr : static_cast<const uint8_t*>(weights->DataRaw());
@@ -194,6 +200,7 @@ Status QAttention<T>::Compute(OpKernelContext* context) const {
     gemm_shape.M = sequence_length;
     gemm_shape.N = head_size;
     gemm_shape.K = input_hidden_size;
+    gemm_shape.AIsSigned = input->IsDataType<int8_t>();
     gemm_shape.BIsSigned = weights_is_signed;
 
     std::vector<MLAS_GEMM_U8X8_DATA_PARAMS> gemm_data_vec(loop_len);
@@ -24,6 +24,7 @@ protected:
                        const uint8_t* a_data,
                        const TensorShape& a_shape,
                        uint8_t a_zero_point,
+                       bool a_is_signed,
                        const Tensor* b,
                        uint8_t b_zero_point,
                        float multiplier,
@@ -34,6 +35,7 @@ Status MatMulIntegerToFloatBase::ComputeCommon(OpKernelContext* ctx,
                                                const uint8_t* a_data,
                                                const TensorShape& a_shape,
                                                uint8_t a_zero_point,
+                                               bool a_is_signed,
                                                const Tensor* b,
                                                uint8_t b_zero_point,
                                                float multiplier,
@@ -54,6 +56,7 @@ Status MatMulIntegerToFloatBase::ComputeCommon(OpKernelContext* ctx,
   gemm_shape.M = static_cast<size_t>(helper.M());
   gemm_shape.N = static_cast<size_t>(helper.N());
   gemm_shape.K = static_cast<size_t>(helper.K());
+  gemm_shape.AIsSigned = a_is_signed;
   gemm_shape.BIsSigned = packed_b_ ? b_is_signed_ : b->IsDataType<int8_t>();
 
   const size_t num_gemms = helper.OutputOffsets().size();
@@ -159,6 +162,7 @@ Status DynamicQuantizeMatMul::Compute(OpKernelContext* ctx) const {
                        a_data_quant,
                        a->Shape(),
                        a_zero_point,
+                       false,
                        b,
                        b_zero_point,
                        a_scale * b_scale,
@@ -185,7 +189,7 @@ Status MatMulIntegerToFloat::Compute(OpKernelContext* ctx) const {
   if (a_zero_point_tensor != nullptr) {
     ORT_ENFORCE(IsScalarOr1ElementVector(a_zero_point_tensor),
                 "MatMulIntegerToFloat : input A zero point must be a scalar or 1D tensor of size 1. Per-Channel is not supported yet.");
-    a_zero_point = *a_zero_point_tensor->Data<uint8_t>();
+    a_zero_point = *static_cast<const uint8_t*>(a_zero_point_tensor->DataRaw());
   }
 
   uint8_t b_zero_point = 0;
@@ -197,9 +201,10 @@ Status MatMulIntegerToFloat::Compute(OpKernelContext* ctx) const {
   }
 
   return ComputeCommon(ctx,
-                       a->Data<uint8_t>(),
+                       static_cast<const uint8_t*>(a->DataRaw()),
                        a->Shape(),
                        a_zero_point,
+                       a->IsDataType<int8_t>(),
                        b,
                        b_zero_point,
                        a_scale * b_scale,
@@ -229,5 +234,17 @@ ONNX_OPERATOR_TYPED_KERNEL_EX(
         .TypeConstraint("T3", DataTypeImpl::GetTensorType<float>()),
     MatMulIntegerToFloat);
 
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    MatMulIntegerToFloat,
+    kMSDomain,
+    1,
+    int8_t,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<int8_t>())
+        .TypeConstraint("T2", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
+        .TypeConstraint("T3", DataTypeImpl::GetTensorType<float>()),
+    MatMulIntegerToFloat);
+
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+class MatMulNBits final : public OpKernel {
+ public:
+  MatMulNBits(const OpKernelInfo& info) : OpKernel(info) {
+    int64_t K;
+    int64_t N;
+    ORT_ENFORCE(info.GetAttr<int64_t>("K", &K).IsOK());
+    ORT_ENFORCE(info.GetAttr<int64_t>("N", &N).IsOK());
+    K_ = static_cast<size_t>(K);
+    N_ = static_cast<size_t>(N);
+    bits_ = static_cast<size_t>(info.GetAttrOrDefault<int64_t>("bits", 4));
+    block_size_ = static_cast<size_t>(info.GetAttrOrDefault<int64_t>("block_size", 32));
+
+    packed_b_size_ = MlasBlkQGemmPackBSize(N_, K_, block_size_, bits_);
+    ORT_ENFORCE(packed_b_size_ != 0, "MatMulNBits: unsupported combination of bits=", bits_,
+                " and block_size=", block_size_, " (K=", K_, ", N=", N_, ")");
+  }
+
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  Status PackB(const Tensor& b, const Tensor& scales, const Tensor* zero_points, void* packed_b) const;
+
+  size_t K_;
+  size_t N_;
+  size_t bits_;
+  size_t block_size_;
+  size_t packed_b_size_;
+
+  BufferUniquePtr packed_b_;
+};
+
+ONNX_OPERATOR_KERNEL_EX(
+    MatMulNBits,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("T2", DataTypeImpl::GetTensorType<uint8_t>()),
+    MatMulNBits);
+
+Status MatMulNBits::PackB(const Tensor& b, const Tensor& scales, const Tensor* zero_points, void* packed_b) const {
+  const size_t k_blocks = (K_ + block_size_ - 1) / block_size_;
+  const size_t blob_size = block_size_ * bits_ / 8;
+  const size_t zero_point_size = N_ * ((k_blocks * bits_ + 7) / 8);
+
+  ORT_RETURN_IF_NOT(static_cast<size_t>(b.Shape().Size()) == N_ * k_blocks * blob_size,
+                    "MatMulNBits: B must have N * k_blocks * blob_size elements");
+  ORT_RETURN_IF_NOT(static_cast<size_t>(scales.Shape().Size()) == N_ * k_blocks,
+                    "MatMulNBits: scales must have N * k_blocks elements");
+  ORT_RETURN_IF_NOT(zero_points == nullptr || static_cast<size_t>(zero_points->Shape().Size()) == zero_point_size,
+                    "MatMulNBits: zero_points must have N * ((k_blocks * bits + 7) / 8) elements");
+
+  MlasBlkQGemmPackB(N_, K_, block_size_, bits_, b.Data<uint8_t>(), scales.Data<float>(),
+                    zero_points != nullptr ? zero_points->Data<uint8_t>() : nullptr, packed_b);
+  return Status::OK();
+}
+
+Status MatMulNBits::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  // only pack B, which also needs the scales and zero points to be constant
+  if (input_idx != 1) {
+    return Status::OK();
+  }
+
+  const Tensor* scales = nullptr;
+  if (!Info().TryGetConstantInput(2, &scales)) {
+    return Status::OK();
+  }
+
+  const Tensor* zero_points = nullptr;
+  const auto& input_defs = Info().node().InputDefs();
+  if (input_defs.size() > 3 && input_defs[3]->Exists() && !Info().TryGetConstantInput(3, &zero_points)) {
+    return Status::OK();
+  }
+
+  auto alloc = Info().GetAllocator(0, OrtMemTypeDefault);
+  auto* packed_b_data = alloc->Alloc(packed_b_size_);
+  BufferUniquePtr packed_b(packed_b_data, BufferDeleter(alloc));
+  ORT_RETURN_IF_ERROR(PackB(tensor, *scales, zero_points, packed_b_data));
+
+  packed_b_ = std::move(packed_b);
+  is_packed = true;
+  return Status::OK();
+}
+
+Status MatMulNBits::Compute(OpKernelContext* ctx) const {
+  concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
+
+  const Tensor* a = ctx->Input<Tensor>(0);
+  const Tensor* bias = ctx->Input<Tensor>(4);
+
+  const auto& a_shape = a->Shape();
+  ORT_RETURN_IF_NOT(a_shape.NumDimensions() >= 1 && static_cast<size_t>(a_shape[a_shape.NumDimensions() - 1]) == K_,
+                    "MatMulNBits: the last dimension of A must be K");
+  ORT_RETURN_IF_NOT(bias == nullptr || static_cast<size_t>(bias->Shape().Size()) == N_,
+                    "MatMulNBits: bias must have N elements");
+
+  std::vector<int64_t> y_dims = a_shape.GetDims();
+  y_dims.back() = static_cast<int64_t>(N_);
+  Tensor* y = ctx->Output(0, TensorShape(y_dims));
+
+  // Bail out early if the output is going to be empty
+  if (y->Shape().Size() == 0)
+    return Status::OK();
+
+  const void* packed_b = packed_b_.get();
+
+  BufferUniquePtr temp_packed_b;
+  if (packed_b == nullptr) {
+    // Prepacking is disabled or the weight isn't constant, so pack B for this run.
+    AllocatorPtr alloc;
+    ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&alloc));
+    auto* temp_packed_b_data = alloc->Alloc(packed_b_size_);
+    temp_packed_b = BufferUniquePtr(temp_packed_b_data, BufferDeleter(alloc));
+    ORT_RETURN_IF_ERROR(PackB(*ctx->Input<Tensor>(1), *ctx->Input<Tensor>(2), ctx->Input<Tensor>(3),
+                              temp_packed_b_data));
+    packed_b = temp_packed_b_data;
+  }
+
+  const size_t M = static_cast<size_t>(a_shape.Size()) / K_;
+
+  MlasBlkQGemm(M, N_, K_, a->Data<float>(), K_, packed_b,
+               bias != nullptr ? bias->Data<float>() : nullptr,
+               y->MutableData<float>(), N_, thread_pool);
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
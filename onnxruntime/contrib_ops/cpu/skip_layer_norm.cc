@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/framework/tensor.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/util/math_cpuonly.h"
 #include "core/providers/common.h"
 #include "core/platform/threadpool.h"
@@ -24,6 +25,27 @@ namespace contrib {
 REGISTER_KERNEL_TYPED(float)
 REGISTER_KERNEL_TYPED(double)
 
+namespace {
+
+// Adds the residual and bias and normalizes the rows with the fused MLAS kernel. Returns false if the
+// element type is not supported.
+template <typename T>
+bool ComputeWithMlas(const T*, const T*, const T*, const T*, const T*, T*, int64_t, int64_t, float,
+                     concurrency::ThreadPool*) {
+  return false;
+}
+
+template <>
+bool ComputeWithMlas<float>(const float* input, const float* skip, const float* gamma, const float* beta,
+                            const float* bias, float* output, int64_t task_count, int64_t hidden_size,
+                            float epsilon, concurrency::ThreadPool* tp) {
+  MlasLayerNormalization(input, skip, bias, gamma, beta, output, nullptr, nullptr,
+                         static_cast<size_t>(task_count), static_cast<size_t>(hidden_size), epsilon, false, tp);
+  return true;
+}
+
+}  // namespace
+
 template <typename T>
 SkipLayerNorm<T>::SkipLayerNorm(const OpKernelInfo& op_kernel_info)
     : OpKernel(op_kernel_info) {
@@ -98,6 +120,11 @@ Status SkipLayerNorm<T>::Compute(OpKernelContext* p_ctx) const {
 
   T* output_data = output->MutableData<T>();
 
+  if (ComputeWithMlas<T>(input_data, skip_data, gamma_data, beta_data, bias_data, output_data,
+                         task_count, hidden_size, epsilon_, p_ctx->GetOperatorThreadPool())) {
+    return Status::OK();
+  }
+
   concurrency::ThreadPool::TryBatchParallelFor(p_ctx->GetOperatorThreadPool(), static_cast<int32_t>(task_count),
                                                [&](ptrdiff_t task_idx) {
                                                  const T* p_input = input_data + task_idx * hidden_size;
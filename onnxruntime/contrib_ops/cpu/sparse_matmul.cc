@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/op_kernel.h"
+#include "core/providers/cpu/math/matmul_helper.h"
+#include "core/mlas/inc/mlas.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+class SparseMatMul final : public OpKernel {
+ public:
+  SparseMatMul(const OpKernelInfo& info) : OpKernel(info) {
+    info.GetAttrOrDefault<float>("alpha", &alpha_, 1.0f);
+    info.GetAttrOrDefault<float>("beta", &beta_, 1.0f);
+    int64_t trans_b;
+    info.GetAttrOrDefault<int64_t>("transB", &trans_b, 0);
+    trans_b_ = trans_b != 0;
+  }
+
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  float alpha_;
+  float beta_;
+  bool trans_b_;
+
+  TensorShape b_shape_;
+  BufferUniquePtr packed_b_;
+};
+
+ONNX_OPERATOR_KERNEL_EX(
+    SparseMatMul,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    SparseMatMul);
+
+Status SparseMatMul::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  // only pack Matrix B
+  if (input_idx != 1 || tensor.Shape().NumDimensions() != 2) {
+    return Status::OK();
+  }
+
+  const size_t K = static_cast<size_t>(trans_b_ ? tensor.Shape()[1] : tensor.Shape()[0]);
+  const size_t N = static_cast<size_t>(trans_b_ ? tensor.Shape()[0] : tensor.Shape()[1]);
+  const CBLAS_TRANSPOSE trans_b = trans_b_ ? CblasTrans : CblasNoTrans;
+
+  const size_t packed_b_size = MlasSparseGemmPackBSize(trans_b, N, K, tensor.Data<float>(), trans_b_ ? K : N);
+  if (packed_b_size == 0) {
+    return Status::OK();
+  }
+
+  auto alloc = Info().GetAllocator(0, OrtMemTypeDefault);
+  auto* packed_b_data = alloc->Alloc(packed_b_size);
+  packed_b_ = BufferUniquePtr(packed_b_data, BufferDeleter(alloc));
+  MlasSparseGemmPackB(trans_b, N, K, tensor.Data<float>(), trans_b_ ? K : N, packed_b_data);
+
+  b_shape_ = tensor.Shape();
+  is_packed = true;
+  return Status::OK();
+}
+
+Status SparseMatMul::Compute(OpKernelContext* ctx) const {
+  concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
+
+  const Tensor* a = ctx->Input<Tensor>(0);
+  const Tensor* b = packed_b_ ? nullptr : ctx->Input<Tensor>(1);
+  const Tensor* bias = ctx->Input<Tensor>(2);
+  const auto& b_shape = b ? b->Shape() : b_shape_;
+
+  ORT_RETURN_IF_NOT(b_shape.NumDimensions() == 2, "SparseMatMul requires a 2-D B input");
+
+  MatMulComputeHelper helper;
+  ORT_RETURN_IF_ERROR(helper.Compute(a->Shape(), b_shape, false, trans_b_));
+  Tensor* y = ctx->Output(0, helper.OutputShape());
+
+  // Bail out early if the output is going to be empty
+  if (y->Shape().Size() == 0)
+    return Status::OK();
+
+  const size_t M = static_cast<size_t>(helper.M());
+  const size_t N = static_cast<size_t>(helper.N());
+  const size_t K = static_cast<size_t>(helper.K());
+
+  const float* bias_data = nullptr;
+  if (bias != nullptr) {
+    ORT_RETURN_IF_NOT(bias->Shape().Size() == 1 || bias->Shape().Size() == static_cast<int64_t>(N),
+                      "SparseMatMul bias must be a scalar or have N elements");
+    bias_data = bias->Data<float>();
+  }
+  const bool scalar_bias = bias != nullptr && bias->Shape().Size() == 1;
+
+  const auto* a_data = a->Data<float>();
+  auto* y_data = y->MutableData<float>();
+
+  const size_t max_len = helper.OutputOffsets().size();
+  for (size_t i = 0; i < max_len; i++) {
+    float* c = y_data + helper.OutputOffsets()[i];
+
+    // Broadcast the scaled bias to each row of the output, then accumulate the product.
+    if (bias_data != nullptr) {
+      for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+          c[m * N + n] = beta_ * bias_data[scalar_bias ? 0 : n];
+        }
+      }
+    }
+    const float beta = bias_data != nullptr ? 1.0f : 0.0f;
+
+    if (packed_b_) {
+      MlasSparseGemm(M, N, K, alpha_, a_data + helper.LeftOffsets()[i], K, packed_b_.get(),
+                     beta, c, N, thread_pool);
+    } else {
+      // Prepacking is disabled, so multiply with the dense B.
+      MlasGemm(CblasNoTrans, trans_b_ ? CblasTrans : CblasNoTrans, M, N, K, alpha_,
+               a_data + helper.LeftOffsets()[i], K, b->Data<float>() + helper.RightOffsets()[i],
+               trans_b_ ? K : N, beta, c, N, thread_pool);
+    }
+  }
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
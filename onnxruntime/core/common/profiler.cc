@@ -247,6 +247,31 @@ void Profiler::EndTimeAndRecordEvent(EventCategory category,
   }
 }
 
+void Profiler::RecordInitializationPhase(const std::string& phase_name,
+                                         const TimePoint& start_time,
+                                         const std::initializer_list<std::pair<std::string, std::string>>& event_args) {
+  const TimePoint end_time = std::chrono::high_resolution_clock::now();
+  InitializationPhase phase{phase_name, std::string(), TimeDiffMicroSeconds(start_time, end_time)};
+  for (const auto& event_arg : event_args) {
+    if (event_arg.first == "graph") {
+      phase.graph = event_arg.second;
+    }
+  }
+  {
+    std::lock_guard<OrtMutex> lock(initialization_phases_mutex_);
+    initialization_phases_.push_back(std::move(phase));
+  }
+
+  if (enabled_) {
+    EndTimeAndRecordEvent(SESSION_EVENT, phase_name, start_time, end_time, event_args);
+  }
+}
+
+std::vector<Profiler::InitializationPhase> Profiler::GetInitializationPhases() const {
+  std::lock_guard<OrtMutex> lock(initialization_phases_mutex_);
+  return initialization_phases_;
+}
+
 std::string Profiler::EndProfiling() {
   if (!enabled_) {
     return std::string();
@@ -277,15 +302,16 @@ std::string Profiler::EndProfiling() {
     profile_stream_ << "\"dur\" :" << rec.dur << ",";
     profile_stream_ << "\"ts\" :" << rec.ts << ",";
     profile_stream_ << R"("ph" : "X",)";
-    profile_stream_ << R"("name" :")" << rec.name << "\",";
+    profile_stream_ << R"("name" :")" << EscapeJsonString(rec.name) << "\",";
     profile_stream_ << "\"args\" : {";
     bool is_first_arg = true;
     for (std::pair<std::string, std::string> event_arg : rec.args) {
       if (!is_first_arg) profile_stream_ << ",";
       if (!event_arg.second.empty() && event_arg.second[0] == '{') {
-        profile_stream_ << "\"" << event_arg.first << "\" : " << event_arg.second << "";
+        profile_stream_ << "\"" << EscapeJsonString(event_arg.first) << "\" : " << event_arg.second << "";
       } else {
-        profile_stream_ << "\"" << event_arg.first << "\" : \"" << event_arg.second << "\"";
+        profile_stream_ << "\"" << EscapeJsonString(event_arg.first) << "\" : \""
+                        << EscapeJsonString(event_arg.second) << "\"";
       }
       is_first_arg = false;
     }
@@ -302,5 +328,40 @@ std::string Profiler::EndProfiling() {
   return profile_stream_file_;
 }
 
+std::string EscapeJsonString(const std::string& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (const char c : value) {
+    switch (c) {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      case '\r':
+        escaped += "\\r";
+        break;
+      case '\t':
+        escaped += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          static const char hex_digits[] = "0123456789abcdef";
+          escaped += "\\u00";
+          escaped += hex_digits[(c >> 4) & 0xF];
+          escaped += hex_digits[c & 0xF];
+        } else {
+          escaped += c;
+        }
+        break;
+    }
+  }
+  return escaped;
+}
+
 }  // namespace profiling
 }  // namespace onnxruntime
@@ -26,6 +26,12 @@ namespace profiling {
  */
 class Profiler {
  public:
+  struct InitializationPhase {
+    std::string name;
+    std::string graph;  // the "graph" event arg of the phase, empty if it was not recorded for a specific graph
+    long long duration_us;
+  };
+
   /// turned off by default.
   /// Even this function is marked as noexcept, the code inside it may throw exceptions
   Profiler() noexcept {};  //NOLINT
@@ -84,6 +90,21 @@ class Profiler {
                              const std::initializer_list<std::pair<std::string, std::string>>& event_args = {},
                              bool sync_gpu = false);
 
+  /*
+  Record the duration of a phase of the session initialization, measured till the call of this function from
+  the start_time. The phases are kept whether or not profiling is enabled, so they can be retrieved with
+  GetInitializationPhases. The "graph" event arg, if any, is kept with the phase to tell apart the phases of
+  the subgraphs. If profiling is enabled a SESSION_EVENT is recorded for the phase as well.
+  */
+  void RecordInitializationPhase(const std::string& phase_name,
+                                 const TimePoint& start_time,
+                                 const std::initializer_list<std::pair<std::string, std::string>>& event_args = {});
+
+  /*
+  Get the name, graph and duration in microseconds of the initialization phases, in the order they were recorded.
+  */
+  std::vector<InitializationPhase> GetInitializationPhases() const;
+
   /*
   Write profile data to the given stream in chrome format defined below.
   https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU/preview#
@@ -144,10 +165,19 @@ class Profiler {
   bool profile_with_logger_{false};
   const size_t max_num_events_{global_max_num_events_.load()};
 
+  // Mutex controlling access to the initialization phases, which may be recorded from the intra-op threads
+  mutable OrtMutex initialization_phases_mutex_;
+  std::vector<InitializationPhase> initialization_phases_;
+
 #ifdef ENABLE_STATIC_PROFILER_INSTANCE
   static Profiler* instance_;
 #endif
 };
 
+/*
+Escape the quotes, backslashes and control characters of a name so it can be written in a JSON string.
+*/
+std::string EscapeJsonString(const std::string& value);
+
 }  // namespace profiling
 }  // namespace onnxruntime
@@ -0,0 +1,240 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/sampling_profiler.h"
+
+#include <algorithm>
+
+namespace onnxruntime {
+namespace profiling {
+
+namespace {
+
+// Ids are never reused, so a thread local cache entry of a destroyed sampler can never match a live one.
+std::atomic<uint64_t> next_sampler_id{1};
+
+struct ThreadRingBufferCache {
+  uint64_t sampler_id{0};
+  std::shared_ptr<void> ring_buffer;
+};
+
+thread_local ThreadRingBufferCache ring_buffer_cache;
+thread_local SamplingProfiler* active_sampler = nullptr;
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+  size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+int MostSignificantBit(uint64_t value) {
+  int msb = 0;
+  while ((value >> (msb + 1)) != 0) {
+    ++msb;
+  }
+  return msb;
+}
+
+}  // namespace
+
+SamplingProfiler::RunScope::RunScope(SamplingProfiler& sampler)
+    : sampler_(sampler.SampleRun() ? &sampler : nullptr), previous_sampler_(active_sampler) {
+  // Always replace the active sampler so a run nested in a kernel of another session's sampled run does not
+  // record into the outer session's sampler.
+  active_sampler = sampler_;
+}
+
+SamplingProfiler::RunScope::~RunScope() {
+  active_sampler = previous_sampler_;
+  if (sampler_ != nullptr) {
+    sampler_->EndRun();
+  }
+}
+
+SamplingProfiler::RingBuffer::RingBuffer(size_t capacity)
+    : events_(new Event[capacity]), mask_(capacity - 1) {
+}
+
+bool SamplingProfiler::RingBuffer::TryPush(const Event& event) noexcept {
+  const uint64_t head = head_.load(std::memory_order_relaxed);
+  const uint64_t tail = tail_.load(std::memory_order_acquire);
+  if (head - tail > mask_) {
+    return false;
+  }
+  events_[head & mask_] = event;
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename Fn>
+void SamplingProfiler::RingBuffer::Drain(Fn&& fn) {
+  const uint64_t head = head_.load(std::memory_order_acquire);
+  uint64_t tail = tail_.load(std::memory_order_relaxed);
+  for (; tail != head; ++tail) {
+    fn(events_[tail & mask_]);
+  }
+  tail_.store(tail, std::memory_order_release);
+}
+
+void SamplingProfiler::Histogram::Add(const Event& event) {
+  const uint64_t value = event.duration_ns;
+  size_t index;
+  if (value < (uint64_t{1} << kSubBucketBits)) {
+    index = static_cast<size_t>(value);
+  } else {
+    const int msb = MostSignificantBit(value);
+    const uint64_t sub_bucket = (value >> (msb - kSubBucketBits)) & ((uint64_t{1} << kSubBucketBits) - 1);
+    index = (static_cast<size_t>(msb - kSubBucketBits + 1) << kSubBucketBits) + static_cast<size_t>(sub_bucket);
+  }
+  buckets[index]++;
+  count++;
+  total_ns += value;
+  max_ns = std::max(max_ns, value);
+  total_output_bytes += event.output_bytes;
+}
+
+uint64_t SamplingProfiler::Histogram::Percentile(double fraction) const {
+  const uint64_t rank = static_cast<uint64_t>(fraction * static_cast<double>(count - 1)) + 1;
+  uint64_t seen = 0;
+  for (size_t index = 0; index < buckets.size(); index++) {
+    seen += buckets[index];
+    if (seen >= rank) {
+      // Report the middle of the bucket, which is exact for the small linear buckets.
+      uint64_t value;
+      if (index < (size_t{1} << kSubBucketBits)) {
+        value = index;
+      } else {
+        const int shift = static_cast<int>(index >> kSubBucketBits) - 1;
+        const uint64_t sub_bucket = index & ((size_t{1} << kSubBucketBits) - 1);
+        const uint64_t lower = ((uint64_t{1} << kSubBucketBits) + sub_bucket) << shift;
+        value = lower + (uint64_t{1} << shift) / 2;
+      }
+      return std::min(value, max_ns);
+    }
+  }
+  return max_ns;
+}
+
+SamplingProfiler::SamplingProfiler() noexcept : id_(next_sampler_id.fetch_add(1)) {
+}
+
+SamplingProfiler::~SamplingProfiler() = default;
+
+void SamplingProfiler::Enable(uint32_t sample_rate, size_t ring_buffer_size) {
+  ORT_ENFORCE(ring_buffer_size > 0, "Sampling profiler ring buffer size must be positive");
+  sample_rate_ = sample_rate;
+  ring_buffer_size_ = RoundUpToPowerOfTwo(ring_buffer_size);
+}
+
+SamplingProfiler* SamplingProfiler::ActiveSampler() noexcept {
+  return active_sampler;
+}
+
+bool SamplingProfiler::SampleRun() noexcept {
+  if (sample_rate_ == 0) {
+    return false;
+  }
+  if (total_runs_.fetch_add(1, std::memory_order_relaxed) % sample_rate_ != 0) {
+    return false;
+  }
+  sampled_runs_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void SamplingProfiler::EndRun() {
+  // Opportunistically fold the buffered events into the histograms so the ring buffers do not fill up between
+  // snapshots. Skip it if another run is already draining.
+  if (!draining_.test_and_set(std::memory_order_acquire)) {
+    {
+      std::lock_guard<OrtMutex> lock(drain_mutex_);
+      DrainLocked();
+    }
+    draining_.clear(std::memory_order_release);
+  }
+}
+
+SamplingProfiler::RingBuffer* SamplingProfiler::GetThreadRingBuffer() {
+  if (ring_buffer_cache.sampler_id == id_) {
+    return static_cast<RingBuffer*>(ring_buffer_cache.ring_buffer.get());
+  }
+
+  std::shared_ptr<RingBuffer> ring_buffer;
+  {
+    std::lock_guard<OrtMutex> lock(buffers_mutex_);
+    auto& entry = buffers_[std::this_thread::get_id()];
+    if (entry == nullptr) {
+      entry = std::make_shared<RingBuffer>(ring_buffer_size_);
+    }
+    ring_buffer = entry;
+  }
+
+  // Replacing the cached buffer releases this thread's reference to the buffer of the previous sampler.
+  ring_buffer_cache.sampler_id = id_;
+  ring_buffer_cache.ring_buffer = ring_buffer;
+  return ring_buffer.get();
+}
+
+void SamplingProfiler::RecordEvent(const void* kernel, const TimePoint& start_time, const TimePoint& end_time,
+                                   size_t output_bytes) {
+  Event event;
+  event.kernel = kernel;
+  event.duration_ns = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count());
+  event.output_bytes = static_cast<uint64_t>(output_bytes);
+
+  if (!GetThreadRingBuffer()->TryPush(event)) {
+    dropped_events_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void SamplingProfiler::DrainLocked() {
+  std::lock_guard<OrtMutex> lock(buffers_mutex_);
+  for (auto it = buffers_.begin(); it != buffers_.end();) {
+    // If the sampler holds the only reference the writing thread has exited or moved on to another sampler, and
+    // can only get the buffer back through buffers_, so it can be released once drained. The fence orders the
+    // last events written by that thread before the drain.
+    const bool released = it->second.use_count() == 1;
+    if (released) {
+      std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    it->second->Drain([this](const Event& event) {
+      histograms_[event.kernel].Add(event);
+    });
+    if (released) {
+      it = buffers_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+SamplingProfiler::Snapshot SamplingProfiler::GetSnapshot() {
+  Snapshot snapshot;
+  snapshot.total_runs = total_runs_.load(std::memory_order_relaxed);
+  snapshot.sampled_runs = sampled_runs_.load(std::memory_order_relaxed);
+  snapshot.dropped_events = dropped_events_.load(std::memory_order_relaxed);
+
+  std::lock_guard<OrtMutex> lock(drain_mutex_);
+  DrainLocked();
+
+  snapshot.kernels.reserve(histograms_.size());
+  for (const auto& entry : histograms_) {
+    const Histogram& histogram = entry.second;
+    KernelStats stats;
+    stats.kernel = entry.first;
+    stats.count = histogram.count;
+    stats.total_ns = histogram.total_ns;
+    stats.max_ns = histogram.max_ns;
+    stats.p50_ns = histogram.Percentile(0.50);
+    stats.p99_ns = histogram.Percentile(0.99);
+    stats.total_output_bytes = histogram.total_output_bytes;
+    snapshot.kernels.push_back(stats);
+  }
+
+  return snapshot;
+}
+
+}  // namespace profiling
+}  // namespace onnxruntime
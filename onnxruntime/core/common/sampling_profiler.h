@@ -0,0 +1,164 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+namespace profiling {
+
+/**
+ * Low overhead profiler intended to be left on in production. Unlike Profiler, which records every event of
+ * every run into one vector, it only samples 1 in N runs. Each thread that executes kernels of a sampled run
+ * writes fixed-size binary events into its own single-producer/single-consumer ring buffer without taking a
+ * lock. The events are periodically drained into per-kernel latency histograms that can be read as a snapshot
+ * at any time, so nothing needs to be written to disk.
+ */
+class SamplingProfiler {
+ public:
+  // Fixed-size event written by the thread that ran the kernel.
+  struct Event {
+    const void* kernel;     // opaque key identifying the kernel, resolved to a name by the snapshot consumer
+    uint64_t duration_ns;   // time spent in Compute
+    uint64_t output_bytes;  // bytes of the output tensors allocated by the kernel
+  };
+
+  // Aggregated statistics of one kernel over all sampled runs.
+  struct KernelStats {
+    const void* kernel;
+    uint64_t count;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t p50_ns;
+    uint64_t p99_ns;
+    uint64_t total_output_bytes;
+  };
+
+  struct Snapshot {
+    uint64_t total_runs;
+    uint64_t sampled_runs;
+    uint64_t dropped_events;
+    std::vector<KernelStats> kernels;
+  };
+
+  /**
+   * Makes the sampler the active one for the calling thread for the duration of a run if the run is selected
+   * for sampling.
+   */
+  class RunScope {
+   public:
+    explicit RunScope(SamplingProfiler& sampler);
+    ~RunScope();
+
+   private:
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(RunScope);
+    SamplingProfiler* const sampler_;
+    SamplingProfiler* const previous_sampler_;
+  };
+
+  SamplingProfiler() noexcept;
+  ~SamplingProfiler();
+
+  /*
+  Enables sampling of 1 in every sample_rate runs. Each thread buffers up to ring_buffer_size events between
+  drains; events that do not fit are dropped and counted.
+  */
+  void Enable(uint32_t sample_rate, size_t ring_buffer_size);
+
+  bool IsEnabled() const {
+    return sample_rate_ != 0;
+  }
+
+  /*
+  Returns the sampler of the sampled run being executed by the calling thread, or nullptr if the calling thread
+  is not executing a sampled run.
+  */
+  static SamplingProfiler* ActiveSampler() noexcept;
+
+  /*
+  Records a kernel execution. Lock-free unless this is the first event recorded by the calling thread.
+  */
+  void RecordEvent(const void* kernel, const TimePoint& start_time, const TimePoint& end_time,
+                   size_t output_bytes);
+
+  /*
+  Drains the ring buffers of all threads and returns the aggregated statistics collected since the sampler was
+  enabled.
+  */
+  Snapshot GetSnapshot();
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SamplingProfiler);
+
+  // Latency histogram with 8 linear sub-buckets per power of two of nanoseconds, so a percentile is reported
+  // within about 6% of the recorded value.
+  static constexpr int kSubBucketBits = 3;
+  static constexpr int kNumBuckets = 64 << kSubBucketBits;
+
+  struct Histogram {
+    std::array<uint64_t, kNumBuckets> buckets{};
+    uint64_t count{0};
+    uint64_t total_ns{0};
+    uint64_t max_ns{0};
+    uint64_t total_output_bytes{0};
+
+    void Add(const Event& event);
+    uint64_t Percentile(double fraction) const;
+  };
+
+  class RingBuffer {
+   public:
+    explicit RingBuffer(size_t capacity);
+
+    // Called only by the owning thread.
+    bool TryPush(const Event& event) noexcept;
+
+    // Called only with the drain mutex held.
+    template <typename Fn>
+    void Drain(Fn&& fn);
+
+   private:
+    std::unique_ptr<Event[]> events_;
+    const size_t mask_;
+    std::atomic<uint64_t> head_{0};
+    // keep the producer and consumer indices on separate cache lines
+    char padding_[64] ORT_ATTRIBUTE_UNUSED;
+    std::atomic<uint64_t> tail_{0};
+  };
+
+  bool SampleRun() noexcept;
+  void EndRun();
+  RingBuffer* GetThreadRingBuffer();
+  void DrainLocked();
+
+  const uint64_t id_;
+  uint32_t sample_rate_{0};
+  size_t ring_buffer_size_{0};
+  std::atomic<uint64_t> total_runs_{0};
+  std::atomic<uint64_t> sampled_runs_{0};
+  std::atomic<uint64_t> dropped_events_{0};
+
+  // Guards registration of the per-thread ring buffers. A buffer is shared with a thread local cache of the
+  // thread that writes it, and is released once drained after that thread exits or switches to another sampler,
+  // so the number of buffers stays bounded by the number of threads recording into this sampler.
+  OrtMutex buffers_mutex_;
+  std::unordered_map<std::thread::id, std::shared_ptr<RingBuffer>> buffers_;
+
+  // Guards draining the ring buffers into the histograms.
+  OrtMutex drain_mutex_;
+  std::atomic_flag draining_ = ATOMIC_FLAG_INIT;
+  std::unordered_map<const void*, Histogram> histograms_;
+};
+
+}  // namespace profiling
+}  // namespace onnxruntime
@@ -224,12 +224,43 @@ void ThreadPoolProfiler::LogRun(int thread_idx) {
   }
 }
 
+void ThreadPoolProfiler::LogSpin(int thread_idx, uint64_t spin_ns, bool found_work, int spin_limit) {
+  if (enabled_) {
+    auto& stat = child_thread_stats_[thread_idx];
+    stat.spin_ns_ += spin_ns;
+    if (found_work) {
+      stat.num_spin_hit_++;
+    } else {
+      stat.num_spin_miss_++;
+    }
+    stat.spin_limit_ = spin_limit;
+  }
+}
+
+void ThreadPoolProfiler::LogWake(int thread_idx, uint64_t wake_latency_ns) {
+  if (enabled_) {
+    auto& stat = child_thread_stats_[thread_idx];
+    stat.num_wake_++;
+    stat.wake_latency_ns_ += wake_latency_ns;
+    stat.max_wake_latency_ns_ = std::max(stat.max_wake_latency_ns_, wake_latency_ns);
+  }
+}
+
 std::string ThreadPoolProfiler::DumpChildThreadStat() {
   std::stringstream ss;
   for (int i = 0; i < num_threads_; ++i) {
-    ss << "\"" << child_thread_stats_[i].thread_id_ << "\": {"
-       << "\"num_run\": " << child_thread_stats_[i].num_run_ << ", "
-       << "\"core\": " << child_thread_stats_[i].core_ << "}"
+    const auto& stat = child_thread_stats_[i];
+    ss << "\"" << stat.thread_id_ << "\": {"
+       << "\"num_run\": " << stat.num_run_ << ", "
+       << "\"core\": " << stat.core_ << ", "
+       << "\"spin_us\": " << stat.spin_ns_ / 1000 << ", "
+       << "\"num_spin_hit\": " << stat.num_spin_hit_ << ", "
+       << "\"num_spin_miss\": " << stat.num_spin_miss_ << ", "
+       << "\"spin_limit\": " << stat.spin_limit_ << ", "
+       << "\"num_wake\": " << stat.num_wake_ << ", "
+       << "\"mean_wake_latency_us\": "
+       << (stat.num_wake_ == 0 ? 0 : stat.wake_latency_ns_ / stat.num_wake_ / 1000) << ", "
+       << "\"max_wake_latency_us\": " << stat.max_wake_latency_ns_ / 1000 << "}"
        << (i == num_threads_ - 1 ? "" : ",");
   }
   return ss.str();
@@ -460,6 +491,21 @@ std::string ThreadPool::StopProfiling() {
 
 thread_local ThreadPool::ParallelSection* ThreadPool::ParallelSection::current_parallel_section{nullptr};
 
+thread_local ThreadPool::RunSettings ThreadPool::current_run_settings{};
+
+ThreadPool::ScopedRunSettings::ScopedRunSettings(const RunSettings& settings)
+    : saved_settings_(current_run_settings) {
+  current_run_settings = settings;
+}
+
+ThreadPool::ScopedRunSettings::~ScopedRunSettings() {
+  current_run_settings = saved_settings_;
+}
+
+ThreadPool::RunSettings ThreadPool::CurrentRunSettings() {
+  return current_run_settings;
+}
+
 ThreadPool::ParallelSection::ParallelSection(ThreadPool* tp) {
 #ifdef _OPENMP
   // Nothing
@@ -470,6 +516,7 @@ ThreadPool::ParallelSection::ParallelSection(ThreadPool* tp) {
   tp_ = tp;
   if (tp && tp->underlying_threadpool_) {
     ps_ = tp->underlying_threadpool_->AllocateParallelSection();
+    ps_->high_priority = current_run_settings.priority == Priority::High;
     tp_->underlying_threadpool_->StartParallelSection(*ps_.get());
     current_parallel_section = this;
   }
@@ -496,7 +543,8 @@ void ThreadPool::RunInParallel(std::function<void(unsigned idx)> fn, unsigned n,
                                                    n, block_size);
     } else {
       underlying_threadpool_->RunInParallel(std::move(fn),
-                                            n, block_size);
+                                            n, block_size,
+                                            current_run_settings.priority == Priority::High);
     }
   } else {
     fn(0);
@@ -618,12 +666,20 @@ int ThreadPool::DegreeOfParallelism(const concurrency::ThreadPool* tp) {
   return (omp_get_num_threads() == 1) ? omp_get_max_threads() : 1;
 #else
   // When not using OpenMP, we parallelise over the N threads created by the pool
-  // tp, plus 1 for the thread entering a loop.
+  // tp, plus 1 for the thread entering a loop, unless the current run has been
+  // given a smaller budget.
   if (tp) {
+    const int num_threads = tp->NumThreads() + 1;
+    const int max_degree_of_parallelism = current_run_settings.max_degree_of_parallelism;
+    if (max_degree_of_parallelism > 0 && max_degree_of_parallelism < num_threads) {
+      // Each unit of parallelism may be handed to a different worker, so do not
+      // over-shard for hybrid cores when the run has a budget.
+      return max_degree_of_parallelism;
+    }
     if (CPUIDInfo::GetCPUIDInfo().IsHybrid()) {
-      return ((tp->NumThreads() + 1)) * TaskGranularityFactor;
+      return num_threads * TaskGranularityFactor;
     } else {
-      return ((tp->NumThreads() + 1));
+      return num_threads;
     }
   } else {
     return 1;
@@ -3,6 +3,7 @@
 
 #include "core/framework/allocation_planner.h"
 #include <list>
+#include <set>
 #include <unordered_map>
 #include <algorithm>
 #include <sstream>
@@ -83,6 +84,8 @@ std::ostream& operator<<(std::ostream& out, std::pair<const SequentialExecutionP
   }
 
   out << "\nExecution Plan:\n";
+  out << "Estimated peak activation size: " << plan.estimated_peak_activation_size
+      << " bytes (symbolic dimensions counted as 1)\n";
   for (size_t i = 0; i < plan.execution_plan.size(); ++i) {
     auto& step = plan.execution_plan[i];
     auto node = graph.GetNode(step.node_index);
@@ -348,6 +351,207 @@ class PlannerImpl {
     return elt_type->Size();
   }
 
+  // Estimated size and liveness of a value produced by a node of the graph, used to order the nodes.
+  struct ActivationInfo {
+    size_t size = 0;       // estimated size in bytes
+    int consumers = 0;     // number of nodes of the graph that have not consumed the value yet
+    bool is_graph_output = false;
+  };
+  using ActivationInfoMap = std::unordered_map<const NodeArg*, ActivationInfo>;
+
+  /*! \brief Estimate the size of a tensor from its inferred shape, counting symbolic dimensions as 1.
+  Values that are not tensors, or whose type is not known, are counted as 0.
+  */
+  size_t EstimateTensorSize(const NodeArg& node_arg) const {
+    const TypeProto* type_proto = node_arg.TypeAsProto();
+    if (type_proto == nullptr || !type_proto->has_tensor_type() ||
+        type_proto->tensor_type().elem_type() == TensorProto_DataType_UNDEFINED) {
+      return 0;
+    }
+
+    size_t size = DataTypeImpl::TensorTypeFromONNXEnum(type_proto->tensor_type().elem_type())->GetElementType()->Size();
+    const auto* shape = context_.GetShape(node_arg);
+    if (shape != nullptr) {
+      for (const auto& dim : shape->dim()) {
+        if (dim.has_dim_value() && dim.dim_value() >= 0) {
+          size *= static_cast<size_t>(dim.dim_value());
+        }
+      }
+    }
+    return size;
+  }
+
+  template <typename Fn>
+  static void ForEachDistinctInput(const Node& node, Fn&& fn) {
+    std::vector<const NodeArg*> seen;
+    auto visit = [&seen, &fn](const ConstPointerContainer<std::vector<NodeArg*>>& defs) {
+      for (const NodeArg* def : defs) {
+        if (std::find(seen.cbegin(), seen.cend(), def) == seen.cend()) {
+          seen.push_back(def);
+          fn(*def);
+        }
+      }
+    };
+    visit(node.InputDefs());
+    visit(node.ImplicitInputDefs());
+  }
+
+  ActivationInfoMap GetActivationInfo(const std::vector<NodeIndex>& nodes) const {
+    ActivationInfoMap activations;
+    for (NodeIndex node_index : nodes) {
+      const Node* node = graph_viewer_.GetNode(node_index);
+      for (const NodeArg* def : node->OutputDefs()) {
+        if (def->Exists()) {
+          activations[def].size = EstimateTensorSize(*def);
+        }
+      }
+    }
+
+    for (const NodeArg* graph_output : graph_viewer_.GetOutputs()) {
+      auto entry = activations.find(graph_output);
+      if (entry != activations.end()) {
+        entry->second.is_graph_output = true;
+      }
+    }
+
+    for (NodeIndex node_index : nodes) {
+      ForEachDistinctInput(*graph_viewer_.GetNode(node_index), [&activations](const NodeArg& def) {
+        auto entry = activations.find(&def);
+        if (entry != activations.end()) {
+          entry->second.consumers++;
+        }
+      });
+    }
+
+    return activations;
+  }
+
+  /*! \brief Run a node in the liveness simulation of EstimatePeakActivationSize and ComputeMemoryEfficientOrder.
+  Releases the inputs consumed for the last time and the outputs that have no consumer, and returns the size of
+  the live values while the node runs.
+  */
+  static size_t SimulateNode(const Node& node, ActivationInfoMap& activations, size_t& live_size) {
+    for (const NodeArg* def : node.OutputDefs()) {
+      auto entry = activations.find(def);
+      if (entry != activations.end()) {
+        live_size += entry->second.size;
+      }
+    }
+    const size_t node_peak = live_size;
+
+    auto release = [&live_size](const ActivationInfo& info) {
+      if (info.consumers == 0 && !info.is_graph_output) {
+        live_size -= info.size;
+      }
+    };
+    ForEachDistinctInput(node, [&activations, &release](const NodeArg& def) {
+      auto entry = activations.find(&def);
+      if (entry != activations.end()) {
+        entry->second.consumers--;
+        release(entry->second);
+      }
+    });
+    for (const NodeArg* def : node.OutputDefs()) {
+      auto entry = activations.find(def);
+      if (entry != activations.end()) {
+        release(entry->second);
+      }
+    }
+
+    return node_peak;
+  }
+
+  size_t EstimatePeakActivationSize(const std::vector<NodeIndex>& order, ActivationInfoMap activations) const {
+    size_t live_size = 0;
+    size_t peak = 0;
+    for (NodeIndex node_index : order) {
+      peak = std::max(peak, SimulateNode(*graph_viewer_.GetNode(node_index), activations, live_size));
+    }
+    return peak;
+  }
+
+  /*! \brief Reorder the nodes of a topological order to reduce the peak size of the live intermediate values.
+  This is a greedy list scheduler: of the nodes whose producers have all run, it runs the one that grows the
+  live size the least, i.e. the size of its outputs minus the size of the inputs it is the last consumer of.
+  Ties are broken by the position in the original order. To bound the planning time on wide graphs, only the
+  first kMaxCandidates ready nodes (in the original order) are considered at each step.
+  */
+  std::vector<NodeIndex> ComputeMemoryEfficientOrder(const std::vector<NodeIndex>& topological_order,
+                                                     ActivationInfoMap activations) const {
+    constexpr size_t kMaxCandidates = 64;
+
+    const size_t num_nodes = topological_order.size();
+    std::unordered_map<NodeIndex, size_t> position;
+    for (size_t i = 0; i < num_nodes; ++i) {
+      position[topological_order[i]] = i;
+    }
+
+    // number of input edges (including control edges) from nodes that have not run yet
+    std::vector<size_t> pending_inputs(num_nodes, 0);
+    std::set<size_t> ready;
+    for (size_t i = 0; i < num_nodes; ++i) {
+      const Node* node = graph_viewer_.GetNode(topological_order[i]);
+      for (auto edge = node->InputEdgesBegin(), end = node->InputEdgesEnd(); edge != end; ++edge) {
+        if (position.find(edge->GetNode().Index()) != position.end()) {
+          pending_inputs[i]++;
+        }
+      }
+      if (pending_inputs[i] == 0) {
+        ready.insert(i);
+      }
+    }
+
+    auto live_size_delta = [&activations](const Node& node) {
+      int64_t delta = 0;
+      for (const NodeArg* def : node.OutputDefs()) {
+        auto entry = activations.find(def);
+        if (entry != activations.end() && (entry->second.consumers > 0 || entry->second.is_graph_output)) {
+          delta += static_cast<int64_t>(entry->second.size);
+        }
+      }
+      ForEachDistinctInput(node, [&activations, &delta](const NodeArg& def) {
+        auto entry = activations.find(&def);
+        if (entry != activations.end() && entry->second.consumers == 1 && !entry->second.is_graph_output) {
+          delta -= static_cast<int64_t>(entry->second.size);
+        }
+      });
+      return delta;
+    };
+
+    std::vector<NodeIndex> order;
+    order.reserve(num_nodes);
+    size_t live_size = 0;
+    while (!ready.empty()) {
+      auto best = ready.cbegin();
+      int64_t best_delta = live_size_delta(*graph_viewer_.GetNode(topological_order[*best]));
+      size_t num_candidates = 1;
+      for (auto candidate = std::next(best); candidate != ready.cend() && num_candidates < kMaxCandidates;
+           ++candidate, ++num_candidates) {
+        const int64_t delta = live_size_delta(*graph_viewer_.GetNode(topological_order[*candidate]));
+        if (delta < best_delta) {
+          best = candidate;
+          best_delta = delta;
+        }
+      }
+
+      const NodeIndex node_index = topological_order[*best];
+      ready.erase(best);
+      order.push_back(node_index);
+
+      const Node& node = *graph_viewer_.GetNode(node_index);
+      SimulateNode(node, activations, live_size);
+      for (auto edge = node.OutputEdgesBegin(), end = node.OutputEdgesEnd(); edge != end; ++edge) {
+        auto entry = position.find(edge->GetNode().Index());
+        if (entry != position.end() && --pending_inputs[entry->second] == 0) {
+          ready.insert(entry->second);
+        }
+      }
+    }
+
+    ORT_ENFORCE(order.size() == num_nodes, "Failed to compute a memory efficient execution order.");
+    return order;
+  }
+
   static bool SameSize(const TensorShapeProto& shape1, const onnxruntime::NodeArg& arg1,
                        const TensorShapeProto& shape2, const onnxruntime::NodeArg& arg2) {
     const auto& ptype1 = arg1.Type();
@@ -1000,15 +1204,32 @@ class PlannerImpl {
 };  // namespace onnxruntime
 
 Status PlannerImpl::CreatePlan() {
-  auto& p_graph_nodes = graph_viewer_.GetNodesInTopologicalOrder(context_.GetExecutionOrder());
+  const ExecutionOrder execution_order = context_.GetExecutionOrder();
+  auto& p_graph_nodes = graph_viewer_.GetNodesInTopologicalOrder(execution_order);
 
   int num_ml_values = ort_value_name_idx_map_.MaxIdx() + 1;
 
   Initialize(p_graph_nodes.size(), static_cast<size_t>(num_ml_values));
 
-  // Determine execution order: we use the default topological sort order for now. We can later
-  // explore more efficient orderings (from a memory usage perspective).
-  for (auto n : p_graph_nodes) {
+  // Determine execution order: the topological sort order requested by the context. For the memory efficient
+  // order, the default topological order is reordered and kept only if its estimated peak is lower.
+  const ActivationInfoMap activations = GetActivationInfo(p_graph_nodes);
+  size_t peak_activation_size = EstimatePeakActivationSize(p_graph_nodes, activations);
+  std::vector<NodeIndex> memory_efficient_order;
+  if (execution_order == ExecutionOrder::MEMORY_EFFICIENT) {
+    memory_efficient_order = ComputeMemoryEfficientOrder(p_graph_nodes, activations);
+    const size_t reordered_peak_activation_size = EstimatePeakActivationSize(memory_efficient_order, activations);
+    if (reordered_peak_activation_size < peak_activation_size) {
+      peak_activation_size = reordered_peak_activation_size;
+    } else {
+      memory_efficient_order.clear();
+    }
+  }
+
+  plan_.estimated_peak_activation_size = peak_activation_size;
+  const std::vector<NodeIndex>& execution_order_nodes =
+      memory_efficient_order.empty() ? p_graph_nodes : memory_efficient_order;
+  for (auto n : execution_order_nodes) {
     plan_.execution_plan.emplace_back(n);
   }
 
@@ -340,7 +340,9 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
       mem_patterns_ = session_state.GetMemoryPatternGroup(input_shapes, feed_mlvalue_idxs, inferred_shapes_);
       // if no existing patterns, generate one in this executionframe
       if (!mem_patterns_) {
-        planner_ = std::make_unique<OrtValuePatternPlanner>(*session_state.GetExecutionPlan());
+        planner_ = std::make_unique<OrtValuePatternPlanner>(*session_state.GetExecutionPlan(),
+                                                            /*trace_using_counters*/ false,
+                                                            session_state.GetMemPatternPlannerType());
       } else {
         // pre-allocate the big chunk requested in memory pattern.
         // all the internal kernel's input/output tensors will be allocated on these buffer.
@@ -760,7 +762,16 @@ Status ExecutionFrame::GeneratePatterns(MemoryPatternGroup* out) const {
     return Status(ONNXRUNTIME, FAIL, "Memory pattern planner is not enabled on this execution framework.");
   }
 
-  return planner_->GeneratePatterns(out);
+  ORT_RETURN_IF_ERROR(planner_->GeneratePatterns(out));
+
+  for (size_t i = 0; i < out->locations.size(); i++) {
+    LOGS(session_state_.Logger(), INFO) << "[Memory] Memory pattern for " << out->locations[i].ToString()
+                                        << " plans " << out->patterns[i].PeakSize()
+                                        << " bytes. Lower bound from the peak live size is "
+                                        << out->patterns[i].LowerBoundSize() << " bytes.";
+  }
+
+  return Status::OK();
 }
 
 bool ExecutionFrame::TryGetInferredShape(int index, TensorShape& shape) const {
@@ -54,6 +54,23 @@ void KernelRegistryManager::RegisterKernelRegistry(std::shared_ptr<KernelRegistr
 }
 #endif
 
+bool KernelRegistryManager::IsCustomKernel(const onnxruntime::Node& node,
+                                           const KernelCreateInfo& kernel_create_info) const {
+#if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD) || defined(ORT_MINIMAL_BUILD_CUSTOM_OPS)
+  const uint64_t kernel_def_hash = kernel_create_info.kernel_def->GetHash();
+  for (auto& registry : custom_kernel_registries_) {
+    const KernelCreateInfo* found = nullptr;
+    if (registry->TryFindKernel(node, std::string(), kernel_def_hash, &found).IsOK() && found == &kernel_create_info) {
+      return true;
+    }
+  }
+#else
+  ORT_UNUSED_PARAMETER(node);
+  ORT_UNUSED_PARAMETER(kernel_create_info);
+#endif
+  return false;
+}
+
 #if !defined(ORT_MINIMAL_BUILD)
 bool KernelRegistryManager::HasImplementationOf(const KernelRegistryManager& r, const Node& node, const std::string& provider_type) {
   std::vector<const KernelRegistry*> kernel_registries = r.GetKernelRegistriesByProviderType(provider_type);
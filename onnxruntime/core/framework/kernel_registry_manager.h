@@ -75,6 +75,10 @@ class KernelRegistryManager {
                               uint64_t kernel_def_hash,
                               /*out*/ const KernelCreateInfo** kernel_create_info) const;
 
+  // Whether the kernel create info found for the node came from one of the registries added with
+  // RegisterKernelRegistry (custom ops and custom kernel registries) rather than from an execution provider.
+  bool IsCustomKernel(const onnxruntime::Node& node, const KernelCreateInfo& kernel_create_info) const;
+
   std::unique_ptr<OpKernel> CreateKernel(const onnxruntime::Node& node,
                                          const IExecutionProvider& execution_provider,
                                          const SessionState& session_state,
@@ -6,6 +6,17 @@
 #include "core/framework/allocation_planner.h"
 
 namespace onnxruntime {
+// How MemPatternPlanner assigns offsets to the traced allocations.
+enum class MemPatternPlannerType {
+  // Online first-fit: each allocation is placed in the best fitting gap between the blocks live at the time it is
+  // traced, in trace order.
+  kFirstFit,
+  // Offline greedy-by-size: only the lifetimes are recorded while tracing. When the pattern is generated the
+  // allocations are placed largest first at the lowest offset that does not overlap a placed block with an
+  // overlapping lifetime, which leaves less fragmentation than the trace order.
+  kGreedyBySize,
+};
+
 struct MemoryBlock {
   size_t offset_{0};
   size_t size_{0};
@@ -25,11 +36,13 @@ class MemoryPattern {
 
   MemoryPattern(MemoryPattern&& rhs) noexcept
       : patterns_{std::move(rhs.patterns_)},
-        peak_size_{std::move(rhs.peak_size_)} {}
+        peak_size_{std::move(rhs.peak_size_)},
+        lower_bound_size_{std::move(rhs.lower_bound_size_)} {}
 
   MemoryPattern& operator=(MemoryPattern&& rhs) noexcept {
     patterns_ = std::move(rhs.patterns_);
     peak_size_ = std::move(rhs.peak_size_);
+    lower_bound_size_ = std::move(rhs.lower_bound_size_);
     return *this;
   }
 
@@ -37,6 +50,12 @@ class MemoryPattern {
     return peak_size_;
   }
 
+  // The maximum total size of the blocks that were live at the same time while tracing. No assignment of offsets
+  // can have a smaller PeakSize().
+  size_t LowerBoundSize() const {
+    return lower_bound_size_;
+  }
+
   const MemoryBlock* GetBlock(int ml_value_idx) const {
     auto it = patterns_.find(ml_value_idx);
     if (it == patterns_.end())
@@ -55,6 +74,7 @@ class MemoryPattern {
 
   std::unordered_map<int, MemoryBlock> patterns_;
   size_t peak_size_{0};
+  size_t lower_bound_size_{0};
 };
 
 struct MemoryPatternGroup {
@@ -16,7 +16,10 @@ limitations under the License.
 // Licensed under the MIT License.
 
 #pragma once
+#include <algorithm>
 #include <list>
+#include <tuple>
+#include <unordered_map>
 #include "core/common/safeint.h"
 #include "core/framework/mem_pattern.h"
 #include "core/framework/allocation_planner.h"
@@ -30,7 +33,11 @@ namespace onnxruntime {
 class MemPatternPlanner {
  public:
   // only the Training code currently uses the program counter based logic
-  MemPatternPlanner(bool using_counters) : using_counters_{using_counters} {}
+  MemPatternPlanner(bool using_counters, MemPatternPlannerType planner_type = MemPatternPlannerType::kFirstFit)
+      : using_counters_{using_counters}, planner_type_{planner_type} {
+    ORT_ENFORCE(!using_counters_ || planner_type_ == MemPatternPlannerType::kFirstFit,
+                "Only the first-fit planner supports tracing with program counters");
+  }
 
 #ifdef ENABLE_TRAINING
   // TODO: OverlappingTimeSchedules should be private
@@ -75,6 +82,9 @@ class MemPatternPlanner {
       return;
     }
 
+    // the blocks are not freed while tracing with counters, so the lower bound is computed from the counters in
+    // GenerateMemPattern
+
     size_t current = 0;
     size_t waste_bytes = std::numeric_limits<size_t>::max();
     size_t best_offset = 0;
@@ -137,6 +147,20 @@ class MemPatternPlanner {
 
     if (size == 0) {
       allocs_.emplace_back(ml_value_idx, MemoryBlock(0, 0));
+      if (planner_type_ == MemPatternPlannerType::kGreedyBySize) {
+        lifetimes_.push_back({0, 0});
+      }
+      return;
+    }
+
+    live_size_ += size;
+    lower_bound_size_ = std::max(lower_bound_size_, live_size_);
+
+    if (planner_type_ == MemPatternPlannerType::kGreedyBySize) {
+      // offsets are assigned in GenerateMemPattern once all the lifetimes are known
+      live_allocs_[ml_value_idx] = allocs_.size();
+      allocs_.emplace_back(ml_value_idx, MemoryBlock(0, size));
+      lifetimes_.push_back({clock_++, std::numeric_limits<size_t>::max()});
       return;
     }
 
@@ -192,8 +216,19 @@ class MemPatternPlanner {
   void TraceFree(int ml_value_index) {
     std::lock_guard<OrtMutex> lock(lock_);
 
+    if (planner_type_ == MemPatternPlannerType::kGreedyBySize) {
+      auto it = live_allocs_.find(ml_value_index);
+      if (it != live_allocs_.end()) {
+        live_size_ -= allocs_[it->second].block_.size_;
+        lifetimes_[it->second].end = clock_++;
+        live_allocs_.erase(it);
+      }
+      return;
+    }
+
     for (auto it = blocks_.begin(); it != blocks_.end(); it++) {
       if (allocs_[*it].index_ == ml_value_index) {
+        live_size_ -= allocs_[*it].block_.size_;
         blocks_.erase(it);
         break;
       }
@@ -234,6 +269,18 @@ class MemPatternPlanner {
 #endif
 
     MemoryPattern pattern;
+    pattern.lower_bound_size_ = lower_bound_size_;
+#ifdef ENABLE_TRAINING
+    if (using_counters_) {
+      pattern.lower_bound_size_ = CounterLowerBoundSize();
+    }
+#endif
+
+    if (planner_type_ == MemPatternPlannerType::kGreedyBySize) {
+      GenerateGreedyBySizePattern(pattern);
+      return pattern;
+    }
+
     pattern.peak_size_ = buffer_size_;
     for (auto& alloc : allocs_) {
       pattern.patterns_[alloc.index_] = alloc.block_;
@@ -243,6 +290,115 @@ class MemPatternPlanner {
   }
 
  private:
+#ifdef ENABLE_TRAINING
+  // The maximum total size of the blocks that are live at the same program counter.
+  size_t CounterLowerBoundSize() const {
+    // +size at the start of each interval of a block and -size after its end. The intervals are inclusive, so at
+    // the same program counter the starts are applied before the ends.
+    std::vector<std::tuple<size_t, bool, size_t>> events;
+    for (const auto& alloc : allocs_) {
+      if (!alloc.reuse_) {
+        continue;
+      }
+      const auto& starts = alloc.counter_->Starts();
+      const auto& ends = alloc.counter_->Ends();
+      for (size_t i = 0; i < starts.size(); i++) {
+        events.emplace_back(starts[i], false, alloc.block_.size_);
+        events.emplace_back(ends[i], true, alloc.block_.size_);
+      }
+    }
+    std::sort(events.begin(), events.end());
+
+    SafeInt<size_t> live_size = 0;
+    size_t lower_bound_size = 0;
+    for (const auto& event : events) {
+      if (std::get<1>(event)) {
+        live_size -= std::get<2>(event);
+      } else {
+        live_size += std::get<2>(event);
+        lower_bound_size = std::max(lower_bound_size, static_cast<size_t>(live_size));
+      }
+    }
+    return lower_bound_size;
+  }
+#endif
+
+  // Interval of the trace clock during which a block is live. Both ends are inclusive.
+  struct Lifetime {
+    size_t start;
+    size_t end;
+
+    bool Overlaps(const Lifetime& other) const {
+      return start <= other.end && other.start <= end;
+    }
+  };
+
+  void GenerateGreedyBySizePattern(MemoryPattern& pattern) const {
+    // zero sized allocations have no lifetime and are placed at offset 0
+    std::vector<size_t> order;
+    order.reserve(allocs_.size());
+    for (size_t i = 0; i < allocs_.size(); i++) {
+      if (allocs_[i].block_.size_ == 0) {
+        pattern.patterns_[allocs_[i].index_] = allocs_[i].block_;
+      } else {
+        order.push_back(i);
+      }
+    }
+
+    // largest first. ties are broken by trace order so the result is deterministic.
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+      return allocs_[a].block_.size_ > allocs_[b].block_.size_;
+    });
+
+    // the blocks placed so far, sorted by offset
+    std::vector<std::pair<MemoryBlock, const Lifetime*>> placed;
+    placed.reserve(order.size());
+    SafeInt<size_t> peak_size = 0;
+
+    for (size_t i : order) {
+      const size_t size = allocs_[i].block_.size_;
+      const Lifetime& lifetime = lifetimes_[i];
+
+      // find the smallest gap that fits between the placed blocks whose lifetimes overlap this one
+      size_t current = 0;
+      size_t waste_bytes = std::numeric_limits<size_t>::max();
+      size_t best_offset = 0;
+      bool best_offset_found = false;
+      for (const auto& entry : placed) {
+        if (!lifetime.Overlaps(*entry.second)) {
+          continue;
+        }
+
+        if (entry.first.offset_ >= current) {
+          auto gap = entry.first.offset_ - current;
+          if (gap >= size && (gap - size) < waste_bytes) {
+            waste_bytes = gap - size;
+            best_offset = current;
+            best_offset_found = true;
+          }
+        }
+
+        current = std::max(current, entry.first.offset_ + entry.first.size_);
+      }
+
+      if (!best_offset_found) {
+        best_offset = current;
+      }
+
+      peak_size = std::max(peak_size, SafeInt<size_t>(best_offset) + size);
+
+      MemoryBlock block(best_offset, size);
+      auto insert_it = std::upper_bound(placed.begin(), placed.end(), block,
+                                        [](const MemoryBlock& b, const std::pair<MemoryBlock, const Lifetime*>& e) {
+                                          return b.offset_ < e.first.offset_;
+                                        });
+      placed.emplace(insert_it, block, &lifetime);
+      pattern.patterns_[allocs_[i].index_] = block;
+    }
+
+    pattern.peak_size_ = peak_size;
+  }
+
   struct OrtValueAllocationBlock {
     int index_{-1};
     MemoryBlock block_;
@@ -256,10 +412,19 @@ class MemPatternPlanner {
   };
 
   std::vector<OrtValueAllocationBlock> allocs_;
+  // kGreedyBySize: the lifetime of each entry in allocs_, and the index in allocs_ of each live OrtValue
+  std::vector<Lifetime> lifetimes_;
+  std::unordered_map<int, size_t> live_allocs_;
+  size_t clock_{0};
   // blocks_ the list of currently allocated memory blocks, sorted in order of their offset
   std::list<int> blocks_;
   SafeInt<size_t> buffer_size_{0};
+  // total size of the live blocks, and its maximum which is a lower bound for the size of any pattern.
+  // not tracked when tracing with counters.
+  size_t live_size_{0};
+  size_t lower_bound_size_{0};
   bool using_counters_;
+  MemPatternPlannerType planner_type_;
   mutable OrtMutex lock_;
 };
 
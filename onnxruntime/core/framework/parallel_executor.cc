@@ -19,7 +19,11 @@
 namespace onnxruntime {
 
 ParallelExecutor::ParallelExecutor(const SessionState& session_state, const bool& terminate_flag)
-    : out_standings_(0), terminate_flag_(terminate_flag), executor_pool_(session_state.GetInterOpThreadPool()) {
+    : out_standings_(0),
+      terminate_flag_(terminate_flag),
+      sampler_(profiling::SamplingProfiler::ActiveSampler()),
+      run_settings_(concurrency::ThreadPool::CurrentRunSettings()),
+      executor_pool_(session_state.GetInterOpThreadPool()) {
   const auto& graph_viewer = session_state.GetGraphViewer();
   node_refs_.resize(graph_viewer.MaxNodeIndex());
   for (auto& node : graph_viewer.Nodes()) {
@@ -112,6 +116,8 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
                                       const logging::Logger& logger) {
   LOGS(logger, INFO) << "Begin execution";
 
+  concurrency::ThreadPool::ScopedRunSettings run_settings_scope(run_settings_);
+
   Status status = Status::OK();
 
   size_t node_index = p_node_index;
@@ -119,6 +125,7 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
   const auto& graph_viewer = session_state.GetGraphViewer();
   TimePoint sync_time_begin;
   TimePoint kernel_begin_time, kernel_end_time;
+  TimePoint sampled_kernel_begin_time;
   const bool f_profiler_enabled = session_state.Profiler().IsEnabled();
   const SequentialExecutionPlan& exec_plan = *session_state.GetExecutionPlan();
 
@@ -186,6 +193,10 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
       kernel_begin_time = session_state.Profiler().Now();
     }
 
+    if (sampler_ != nullptr) {
+      sampled_kernel_begin_time = std::chrono::high_resolution_clock::now();
+    }
+
     // call compute on the kernel
     VLOGS(logger, 1) << "Computing kernel: " << node.Name();
 
@@ -215,6 +226,18 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
       break;
     }
 
+    if (sampler_ != nullptr) {
+      const TimePoint sampled_kernel_end_time = std::chrono::high_resolution_clock::now();
+      size_t output_sizes = 0;
+      for (int output_index = 0; output_index < op_kernel_context.OutputCount(); ++output_index) {
+        const OrtValue* p_output = op_kernel_context.GetOutputMLValue(output_index);
+        if (p_output != nullptr && p_output->IsTensor()) {
+          output_sizes += p_output->Get<Tensor>().SizeInBytes();
+        }
+      }
+      sampler_->RecordEvent(p_op_kernel, sampled_kernel_begin_time, sampled_kernel_end_time, output_sizes);
+    }
+
     if (f_profiler_enabled) {
       kernel_end_time = session_state.Profiler().Now();
       session_state.Profiler().EndTimeAndRecordEvent(profiling::NODE_EVENT,
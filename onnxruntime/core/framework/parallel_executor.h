@@ -7,12 +7,14 @@
 #include "core/common/common.h"
 #include "core/common/status.h"
 #include "core/common/logging/logging.h"
+#include "core/common/sampling_profiler.h"
 #include "core/framework/iexecutor.h"
 #include "core/framework/framework_common.h"
 #include "core/framework/ml_value.h"
 #include "core/framework/session_state.h"
 #include "core/graph/graph_viewer.h"
 #include "core/platform/ort_mutex.h"
+#include "core/platform/threadpool.h"
 
 namespace onnxruntime {
 
@@ -60,6 +62,11 @@ class ParallelExecutor : public IExecutor {
   std::vector<Status> errors_;
 
   const bool& terminate_flag_;
+  // Sampler of the run that created this executor, if the run was selected by the sampling profiler. Captured
+  // here because the nodes are executed on inter-op threads.
+  profiling::SamplingProfiler* const sampler_;
+  // Intra-op thread budget and priority of the run that created this executor, for the same reason.
+  const concurrency::ThreadPool::RunSettings run_settings_;
   // TODO: Temporary threadpool for the executor.  This is a costly way to handle the problem.
   onnxruntime::concurrency::ThreadPool* const executor_pool_{};
 };
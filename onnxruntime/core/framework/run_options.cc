@@ -53,3 +53,27 @@ ORT_API_STATUS_IMPL(OrtApis::RunOptionsUnsetTerminate, _Inout_ OrtRunOptions* op
   options->terminate = false;
   return nullptr;
 }
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsSetMaxDegreeOfParallelism, _Inout_ OrtRunOptions* options, int value) {
+  if (value < 0)
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "max degree of parallelism must be non-negative");
+  options->max_degree_of_parallelism = value;
+  return nullptr;
+}
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsGetMaxDegreeOfParallelism, _In_ const OrtRunOptions* options, _Out_ int* out) {
+  *out = options->max_degree_of_parallelism;
+  return nullptr;
+}
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsSetPriority, _Inout_ OrtRunOptions* options, OrtRunPriority priority) {
+  if (priority != ORT_RUN_PRIORITY_NORMAL && priority != ORT_RUN_PRIORITY_HIGH)
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "invalid run priority");
+  options->priority = priority;
+  return nullptr;
+}
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsGetPriority, _In_ const OrtRunOptions* options, _Out_ OrtRunPriority* out) {
+  *out = options->priority;
+  return nullptr;
+}
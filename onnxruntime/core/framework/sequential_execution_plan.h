@@ -118,6 +118,11 @@ struct SequentialExecutionPlan : public ExecutionPlanBase {
   // to_be_freed: vector elements represent indices of ml-values to be freed (as described above)
   std::vector<OrtValueIndex> to_be_freed;
 
+  // Peak of the total size in bytes of the live intermediate tensors when the nodes run in the order of
+  // execution_plan, estimated from the inferred shapes with symbolic dimensions counted as 1.
+  // Graph inputs, initializers and outer scope values are not included.
+  size_t estimated_peak_activation_size = 0;
+
   const OrtMemoryInfo& GetLocation(size_t ort_value_index) const override {
     return allocation_plan[ort_value_index].location;
   }
@@ -9,6 +9,7 @@
 #include <sstream>
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
+#include "core/common/sampling_profiler.h"
 #include "core/framework/allocation_planner.h"
 #include "core/framework/execution_frame.h"
 #include "core/framework/session_state.h"
@@ -128,9 +129,11 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
                                    const std::unordered_map<size_t, CustomAllocator>& fetch_allocators,
                                    const logging::Logger& logger) {
   const bool is_profiler_enabled = session_state.Profiler().IsEnabled();
+  profiling::SamplingProfiler* const sampler = profiling::SamplingProfiler::ActiveSampler();
   TimePoint tp;
   TimePoint sync_time_begin;
   TimePoint kernel_begin_time, kernel_end_time;
+  TimePoint sampled_kernel_begin_time;
   size_t input_activation_sizes = 0;
   size_t input_parameter_sizes = 0;
   size_t total_output_sizes = 0;
@@ -295,6 +298,10 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
       kernel_begin_time = session_state.Profiler().Now();
     }
 
+    if (sampler != nullptr) {
+      sampled_kernel_begin_time = std::chrono::high_resolution_clock::now();
+    }
+
     Status compute_status;
     {
 #ifdef CONCURRENCY_VISUALIZER
@@ -339,6 +346,13 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
       return Status(compute_status.Category(), compute_status.Code(), msg_string);
     }
 
+    if (sampler != nullptr) {
+      const TimePoint sampled_kernel_end_time = std::chrono::high_resolution_clock::now();
+      size_t sampled_output_sizes = 0;
+      CalculateTotalOutputSizes(&op_kernel_context, sampled_output_sizes, node.Name());
+      sampler->RecordEvent(p_op_kernel, sampled_kernel_begin_time, sampled_kernel_end_time, sampled_output_sizes);
+    }
+
     if (is_profiler_enabled) {
       kernel_end_time = session_state.Profiler().Now();
       // Calculate total output sizes for this operation.
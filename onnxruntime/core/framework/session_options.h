@@ -12,8 +12,9 @@
 namespace onnxruntime {
 
 enum class ExecutionOrder {
-  DEFAULT = 0,        // default topological sort
-  PRIORITY_BASED = 1  // priority-based topological sort
+  DEFAULT = 0,          // default topological sort
+  PRIORITY_BASED = 1,   // priority-based topological sort
+  MEMORY_EFFICIENT = 2  // topological sort that reduces the peak size of the live intermediate tensors
 };
 
 enum class FreeDimensionOverrideType {
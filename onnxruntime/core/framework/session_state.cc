@@ -165,7 +165,8 @@ const KernelCreateInfo& SessionState::GetNodeKernelCreateInfo(NodeIndex node_ind
   return *entry->second;
 }
 
-Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_manager) {
+Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_manager,
+                                  concurrency::ThreadPool* thread_pool) {
   const auto& nodes = graph_viewer_->Nodes();
   if (!nodes.empty()) {
     size_t max_nodeid = 0;
@@ -174,7 +175,8 @@ Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_
     }
     session_kernels_.clear();
     session_kernels_.resize(max_nodeid + 1, nullptr);
-    for (const auto& node : nodes) {
+
+    auto create_kernel = [this, &kernel_registry_manager](const Node& node) {
       // construct and save the kernels
       const KernelCreateInfo& kci = GetNodeKernelCreateInfo(node.Index());
 
@@ -184,9 +186,28 @@ Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_
 
       auto op_kernel = kernel_registry_manager.CreateKernel(node, exec_provider, *this, kci);
 
-      // assumes vector is already resize()'ed to the number of nodes in the graph
+      // assumes vector is already resize()'ed to the number of nodes in the graph.
+      // each node writes its own slot, so the result doesn't depend on the order the kernels are created in.
       session_kernels_[node.Index()] = op_kernel.release();
+      return Status::OK();
+    };
+
+    // the kernels of other execution providers may use resources of the provider that aren't thread safe,
+    // and custom op kernels make no thread safety guarantees, so only the built-in CPU kernels are created
+    // in parallel.
+    std::vector<const Node*> cpu_nodes;
+    for (const auto& node : nodes) {
+      if (node.GetExecutionProviderType() == kCpuExecutionProvider &&
+          !kernel_registry_manager.IsCustomKernel(node, GetNodeKernelCreateInfo(node.Index()))) {
+        cpu_nodes.push_back(&node);
+      } else {
+        ORT_RETURN_IF_ERROR(create_kernel(node));
+      }
     }
+
+    ORT_RETURN_IF_ERROR(session_state_utils::ParallelForWithStatus(thread_pool, cpu_nodes.size(), [&](size_t i) {
+      return create_kernel(*cpu_nodes[i]);
+    }));
   }
   node_index_info_ = std::make_unique<NodeIndexInfo>(*graph_viewer_, ort_value_name_idx_map_);
   return Status::OK();
@@ -258,9 +279,25 @@ void SessionState::CleanInitializedTensorsFromGraph() {
   graph_.CleanAllInitializedTensors();
 }
 
-Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::string, size_t>& constant_initializers_use_count) {
+Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::string, size_t>& constant_initializers_use_count,
+                                                       const KernelRegistryManager& kernel_registry_manager,
+                                                       concurrency::ThreadPool* thread_pool) {
+  // a constant initialized tensor consumed by a node, from this graph or an outer scope graph
+  struct PrepackInput {
+    SessionState* session_state;
+    int ort_value_idx;
+    int input_idx;
+    bool is_packed;
+  };
+
+  struct NodeToPrepack {
+    const Node* node;
+    std::vector<PrepackInput> inputs;
+  };
+
+  std::vector<NodeToPrepack> nodes_to_prepack;
   for (auto& node : GetGraphViewer().Nodes()) {
-    auto kernel = GetMutableKernel(node.Index());
+    NodeToPrepack node_to_prepack{&node, {}};
     int input_idx = 0;
     for (auto& input_def : node.InputDefs()) {
       if (input_def->Exists()) {
@@ -271,16 +308,8 @@ Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::s
         do {
           int ort_value_idx;
           if (st->GetOrtValueNameIdxMap().GetIdx(input_name, ort_value_idx).IsOK()) {
-            std::unordered_map<int, OrtValue>& constant_initialized_tensors = st->constant_initialized_tensors_;
-            if (constant_initialized_tensors.count(ort_value_idx)) {
-              bool is_packed = false;
-              const Tensor& const_initialized_tensor = constant_initialized_tensors[ort_value_idx].Get<Tensor>();
-              ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx, is_packed));
-              if (is_packed && constant_initializers_use_count.count(input_name) && --constant_initializers_use_count[input_name] == 0) {
-                // release the constant initialized tensor
-                st->initialized_tensors_.erase(ort_value_idx);
-                constant_initialized_tensors.erase(ort_value_idx);
-              }
+            if (st->constant_initialized_tensors_.count(ort_value_idx)) {
+              node_to_prepack.inputs.push_back({st, ort_value_idx, input_idx, false});
             }
             // stop searching in 2 cases:
             // 1. value is not from OuterScope
@@ -294,6 +323,49 @@ Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::s
       }
       input_idx++;
     }
+
+    if (!node_to_prepack.inputs.empty()) {
+      nodes_to_prepack.push_back(std::move(node_to_prepack));
+    }
+  }
+
+  // the constant initialized tensors are only read while prepacking, so the kernels can prepack concurrently.
+  // the inputs of a kernel are prepacked in order by a single thread as PrePack updates the state of the kernel.
+  auto prepack = [this](NodeToPrepack& node_to_prepack) {
+    auto kernel = GetMutableKernel(node_to_prepack.node->Index());
+    for (auto& input : node_to_prepack.inputs) {
+      const Tensor& const_initialized_tensor =
+          input.session_state->constant_initialized_tensors_.at(input.ort_value_idx).Get<Tensor>();
+      ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input.input_idx, input.is_packed));
+    }
+    return Status::OK();
+  };
+
+  // as with kernel creation, custom op kernels make no thread safety guarantees, so they are prepacked sequentially.
+  std::vector<NodeToPrepack*> cpu_nodes_to_prepack;
+  for (auto& node_to_prepack : nodes_to_prepack) {
+    const Node& node = *node_to_prepack.node;
+    if (node.GetExecutionProviderType() == kCpuExecutionProvider &&
+        !kernel_registry_manager.IsCustomKernel(node, GetNodeKernelCreateInfo(node.Index()))) {
+      cpu_nodes_to_prepack.push_back(&node_to_prepack);
+    } else {
+      ORT_RETURN_IF_ERROR(prepack(node_to_prepack));
+    }
+  }
+
+  ORT_RETURN_IF_ERROR(session_state_utils::ParallelForWithStatus(
+      thread_pool, cpu_nodes_to_prepack.size(), [&](size_t i) { return prepack(*cpu_nodes_to_prepack[i]); }));
+
+  // release the constant initialized tensors that all their consumers have packed, in node order
+  for (const auto& node_to_prepack : nodes_to_prepack) {
+    for (const auto& input : node_to_prepack.inputs) {
+      const std::string& input_name = node_to_prepack.node->InputDefs()[input.input_idx]->Name();
+      if (input.is_packed && constant_initializers_use_count.count(input_name) &&
+          --constant_initializers_use_count[input_name] == 0) {
+        input.session_state->initialized_tensors_.erase(input.ort_value_idx);
+        input.session_state->constant_initialized_tensors_.erase(input.ort_value_idx);
+      }
+    }
   }
 
   return Status::OK();
@@ -309,74 +381,6 @@ static int64_t CalculateMemoryPatternsKey(const std::vector<std::reference_wrapp
 
 #ifdef ENABLE_TRAINING
 namespace {
-Status ResolveDimParams(const GraphViewer& graph,
-                        const std::map<std::string, TensorShape>& feeds,
-                        std::unordered_map<std::string, int64_t>& out) {
-  for (const auto* input : graph.GetInputs()) {
-    auto* shape = input->Shape();
-    auto it = feeds.find(input->Name());
-    if (it == feeds.end()) {
-      return Status(ONNXRUNTIME, FAIL,
-                    "Graph input " + input->Name() +
-                        " is not found in the feed list, unable to resolve the value for dynamic shape.");
-    }
-    if (it->second.NumDimensions() == 0 && !shape) {
-      // This is a scalar, which has nothing to do with symbolic shapes.
-      continue;
-    }
-    if (!shape || shape->dim_size() != static_cast<int>(it->second.NumDimensions())) {
-      return Status(ONNXRUNTIME, FAIL, "Graph input " + input->Name() +
-                                           "'s shape is not present or its shape doesn't match feed's shape."
-                                           "Unable to resolve the value for dynamic shape");
-    }
-    for (int k = 0, end = shape->dim_size(); k < end; ++k) {
-      if (shape->dim()[k].has_dim_param()) {
-        out.insert({shape->dim()[k].dim_param(), it->second.GetDims()[k]});
-      }
-    }
-  }
-  return Status::OK();
-}
-
-Status TryResolveShape(
-    const NodeArg* arg,
-    const std::unordered_map<std::string, int64_t>& symbolic_dimensions,
-    size_t& is_resolved,  // indicate whether resolve successfully or not.
-    std::vector<int64_t>& resolved_shape) {
-  if (!arg->Shape()) {
-    is_resolved = 0;
-    return Status::OK();
-  }
-
-  std::vector<int64_t> shape;
-
-  SafeInt<size_t> safe_size = 1;
-  for (auto& dim : arg->Shape()->dim()) {
-    if (dim.has_dim_param()) {
-      auto it = symbolic_dimensions.find(dim.dim_param());
-      if (it == symbolic_dimensions.end()) {
-        return Status(ONNXRUNTIME, FAIL, "Unknown symbolic dimension, " + dim.dim_param() + ", found in memory pattern compute.");
-      }
-      safe_size *= it->second;
-      shape.push_back(it->second);
-    } else if (dim.has_dim_value() && dim.dim_value() > 0) {
-      safe_size *= dim.dim_value();
-      shape.push_back(dim.dim_value());
-    } else {
-      // tensor shape is unknown.
-      safe_size = 0;
-    }
-  }
-
-  is_resolved = safe_size;
-  // Only assign shape if all symbolic dimensions are resolved.
-  if (is_resolved != 0) {
-    resolved_shape = std::move(shape);
-  }
-
-  return Status::OK();
-}
-
 void TryCalculateSizeFromResolvedShape(int ml_value_idx, std::unordered_map<int, TensorShape>& resolved_shapes, size_t& size) {
   size = 0;
   auto shape = resolved_shapes.find(ml_value_idx);
@@ -394,52 +398,16 @@ Status SessionState::GeneratePatternGroupCache(const std::vector<std::reference_
                                                const std::vector<int>& feed_mlvalue_idxs,
                                                MemoryPatternGroup* output,
                                                std::unordered_map<int, TensorShape>& resolved_shapes) const {
-  std::map<std::string, TensorShape> feeds;
-  for (size_t i = 0, end = feed_mlvalue_idxs.size(); i < end; ++i) {
-    std::string name;
-    ORT_RETURN_IF_ERROR(this->ort_value_name_idx_map_.GetName(feed_mlvalue_idxs[i], name));
-    feeds.insert({name, input_shape[i]});
-  }
-  std::unordered_map<std::string, int64_t> map;
-  ORT_RETURN_IF_ERROR(ResolveDimParams(*graph_viewer_, feeds, map));
+  ORT_RETURN_IF_NOT(symbolic_memory_planner_, "Memory patterns are disabled");
   auto* exe_plan = GetExecutionPlan();
   ORT_ENFORCE(exe_plan);
   OrtValuePatternPlanner mem_planner(*exe_plan, /*using counters*/ true);
 
-  // Try to resolve shapes for activations.
+  // Resolve shapes for activations. Tensors whose shape cannot be resolved statically will be allocated at runtime.
+  // Store all valid resolved shapes. They will be queried in, for example, Recv operator to bypass the dependency
+  // of output shapes on inputs.
+  ORT_RETURN_IF_ERROR(symbolic_memory_planner_->ResolveShapes(feed_mlvalue_idxs, input_shape, resolved_shapes));
   auto& node_index_info = GetNodeIndexInfo();
-  for (auto& node_plan : exe_plan->execution_plan) {
-    int node_index = node_index_info.GetNodeOffset(node_plan.node_index);
-    auto* node = graph_viewer_->GetNode(node_plan.node_index);
-    int output_start = node_index + static_cast<int>(node->InputDefs().size()) +
-                       static_cast<int>(node->ImplicitInputDefs().size());
-
-    for (int i = 0, end = static_cast<int>(node->OutputDefs().size()); i < end; ++i) {
-      const auto ml_value_idx = node_index_info.GetMLValueIndex(output_start + i);
-      if (ml_value_idx == NodeIndexInfo::kInvalidEntry)
-        continue;
-
-      const auto* ml_type = exe_plan->allocation_plan[ml_value_idx].value_type;
-      if (!ml_type->IsTensorType())
-        continue;
-
-      auto* arg = node->OutputDefs()[i];
-      size_t is_resolved = 0;
-      std::vector<int64_t> resolved_shape;
-
-      // Tensors whose shape cannot be resolved statically will be allocated at runtime.
-      if (TryResolveShape(arg, map, is_resolved, resolved_shape).IsOK()) {
-        // Store all valid resolved shapes. They will be queried in, for example,
-        // Recv operator to bypass the dependency of output shapes on inputs.
-        if (is_resolved != 0) {
-          resolved_shapes[ml_value_idx] = resolved_shape;
-        }
-      } else {
-        LOGS(logger_, INFO) << "[Static memory planning] Could not resolve shape for tensor with ML index "
-                            << ml_value_idx << ", will allocate dynamically.";
-      }
-    }
-  }
 
   // Allocate activations that want to be laid out contiguously in memory.
   for (auto ml_value_idx : exe_plan->activation_allocation_order) {
@@ -545,7 +513,24 @@ const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(const std::vector<
     }
     return nullptr;
 #else
-    ORT_UNUSED_PARAMETER(feed_mlvalue_idxs);
+    ORT_UNUSED_PARAMETER(inferred_shapes);
+    if (symbolic_memory_planner_) {
+      auto mem_patterns = std::make_unique<MemoryPatternGroup>();
+      std::unordered_map<int, TensorShape> resolved_shapes;
+      auto status = symbolic_memory_planner_->ResolveShapes(feed_mlvalue_idxs, input_shapes, resolved_shapes);
+      if (status.IsOK()) {
+        status = symbolic_memory_planner_->GeneratePatterns(resolved_shapes, mem_pattern_planner_type_,
+                                                            *mem_patterns);
+      }
+      if (status.IsOK()) {
+        auto ptr = mem_patterns.get();
+        mem_patterns_[key] = std::move(mem_patterns);
+        return ptr;
+      }
+      // e.g. an optional input with symbolic dimensions is not fed. trace the pattern from the run instead.
+      LOGS(logger_, VERBOSE) << "Memory pattern could not be generated from the inferred shapes: "
+                             << status.ErrorMessage();
+    }
     return nullptr;
 #endif
   }
@@ -1000,10 +985,40 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
                   });
   }
 
+  const auto mem_pattern_planner =
+      session_options.GetConfigOrDefault(kOrtSessionOptionsConfigMemoryPatternPlanner, "first_fit");
+  if (mem_pattern_planner == "first_fit") {
+    mem_pattern_planner_type_ = MemPatternPlannerType::kFirstFit;
+  } else if (mem_pattern_planner == "greedy_by_size") {
+    mem_pattern_planner_type_ = MemPatternPlannerType::kGreedyBySize;
+  } else {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid value for ",
+                           kOrtSessionOptionsConfigMemoryPatternPlanner, ": ", mem_pattern_planner);
+  }
+
+  // the phases of the main graph and of each subgraph are recorded separately, tagged with the name of the graph
+  const std::string& graph_name = graph_viewer_->Name();
+  TimePoint tp = std::chrono::high_resolution_clock::now();
+
   SequentialPlannerContext context(session_options.execution_mode, session_options.execution_order, session_options.enable_mem_reuse);
   ORT_RETURN_IF_ERROR(SequentialPlanner::CreatePlan(parent_node, *graph_viewer_, valid_outer_scope_node_args,
                                                     execution_providers_, kernel_create_info_map_,
                                                     ort_value_name_idx_map_, context, p_seq_exec_plan_));
+
+  if (enable_mem_pattern_) {
+    auto symbolic_memory_planner = std::make_unique<SymbolicMemoryPlanner>(*graph_viewer_, *p_seq_exec_plan_,
+                                                                           ort_value_name_idx_map_);
+#ifdef ENABLE_TRAINING
+    // training resolves the shapes of the activations with it, and plans the ones it can
+    symbolic_memory_planner_ = std::move(symbolic_memory_planner);
+#else
+    if (session_options.GetConfigOrDefault(kOrtSessionOptionsConfigSymbolicMemoryPlanning, "1") == "1" &&
+        symbolic_memory_planner->IsComplete()) {
+      symbolic_memory_planner_ = std::move(symbolic_memory_planner);
+    }
+#endif
+  }
+  profiler_.RecordInitializationPhase("execution_planning", tp, {{"graph", graph_name}});
   //Record the allocation plan
 
   // Uncomment the below to dump the allocation plan to std::cout
@@ -1036,7 +1051,15 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
 
   const auto& initializer_allocation_order = p_seq_exec_plan_->initializer_allocation_order;
 
+  // deserializing the initializers, creating the kernels and prepacking are independent per initializer and per
+  // node, so they run on the intra-op thread pool unless disabled.
+  concurrency::ThreadPool* initialization_thread_pool =
+      session_options.GetConfigOrDefault(kOrtSessionOptionsConfigDisableParallelInitialization, "0") == "1"
+          ? nullptr
+          : thread_pool_;
+
   // move initializers from TensorProto instances in Graph to OrtValue instances in SessionState
+  tp = std::chrono::high_resolution_clock::now();
   ORT_RETURN_IF_ERROR(
       session_state_utils::SaveInitializedTensors(
           Env::Default(), graph_location, *graph_viewer_,
@@ -1045,7 +1068,8 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
           [this](int idx, const OrtValue& value, const OrtCallback& d, bool constant) -> Status {
             return AddInitializedTensor(idx, value, &d, constant);
           },
-          logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options));
+          logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options, initialization_thread_pool));
+  profiler_.RecordInitializationPhase("initializers_loading", tp, {{"graph", graph_name}});
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   //Record Weight allocation info on device
   MemoryInfo::RecordInitializerAllocInfo(GetInitializedTensors());
@@ -1058,14 +1082,20 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
     CleanInitializedTensorsFromGraph();
   }
 
-  ORT_RETURN_IF_ERROR(CreateKernels(kernel_registry_manager));
+  tp = std::chrono::high_resolution_clock::now();
+  ORT_RETURN_IF_ERROR(CreateKernels(kernel_registry_manager, initialization_thread_pool));
+  profiler_.RecordInitializationPhase("kernel_creation", tp, {{"graph", graph_name}});
 
 #ifndef ENABLE_TRAINING
   const auto disable_prepacking =
       session_options.GetConfigOrDefault(kOrtSessionOptionsConfigDisablePrepacking, "0");
 
   if (disable_prepacking != "1") {
-    ORT_RETURN_IF_ERROR(PrepackConstantInitializedTensors(constant_initializers_use_count));
+    tp = std::chrono::high_resolution_clock::now();
+    ORT_RETURN_IF_ERROR(PrepackConstantInitializedTensors(constant_initializers_use_count,
+                                                          kernel_registry_manager,
+                                                          initialization_thread_pool));
+    profiler_.RecordInitializationPhase("prepacking", tp, {{"graph", graph_name}});
   }
 #endif
 
@@ -26,6 +26,7 @@
 #include "core/framework/node_index_info.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/ort_value_name_idx_map.h"
+#include "core/framework/symbolic_memory_planner.h"
 #include "core/graph/graph_viewer.h"
 #include "core/graph/onnx_protobuf.h"
 #include "core/platform/ort_mutex.h"
@@ -193,7 +194,8 @@ class SessionState {
   profiling::Profiler& Profiler() const noexcept { return profiler_; }
 
   /**
-  Get cached memory pattern based on input shapes
+  Get cached memory pattern based on input shapes.
+  If there is none, it is generated from the shapes inferred for the activations if possible.
   */
   const MemoryPatternGroup* GetMemoryPatternGroup(
       const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
@@ -220,6 +222,11 @@ class SessionState {
 
   bool GetEnableMemoryReuse() const;
 
+  /**
+  Get how the offsets of the memory patterns are planned.
+  */
+  MemPatternPlannerType GetMemPatternPlannerType() const { return mem_pattern_planner_type_; }
+
   /**
   Update enable_mem_pattern_ flag according to the presence of graph inputs' shape
   If any one of the graph input is shapeless, enable_mem_pattern_ will be set to false
@@ -310,8 +317,9 @@ class SessionState {
   // Populate OrtValueNameIdxMap and create the graph viewer.
   void CreateGraphInfo();
 
-  // create kernels using info in kernel_create_info_map_
-  Status CreateKernels(const KernelRegistryManager& custom_registry_manager);
+  // create kernels using info in kernel_create_info_map_.
+  // the kernels of the CPU execution provider are created in parallel if thread_pool is not null.
+  Status CreateKernels(const KernelRegistryManager& custom_registry_manager, concurrency::ThreadPool* thread_pool);
 
   // remove TensorProto versions of initializers from Graph instance
   // (replaced byOrtValue instances in initialized_tensors_)
@@ -320,8 +328,11 @@ class SessionState {
   /**
   * Prepack the constant initialized tensors for better performance.
   * The original constant initialized tensors will be removed to save memory.
+  * The built-in kernels of the CPU execution provider are prepacked in parallel if thread_pool is not null.
   */
-  Status PrepackConstantInitializedTensors(std::unordered_map<std::string, size_t>& constant_initializers_use_count);
+  Status PrepackConstantInitializedTensors(std::unordered_map<std::string, size_t>& constant_initializers_use_count,
+                                           const KernelRegistryManager& kernel_registry_manager,
+                                           concurrency::ThreadPool* thread_pool);
 
   SessionState* GetMutableSubgraphSessionState(onnxruntime::NodeIndex index, const std::string& attribute_name);
 
@@ -420,6 +431,12 @@ class SessionState {
 
   // switch for enable memory pattern optimization or not.
   bool enable_mem_pattern_;
+  MemPatternPlannerType mem_pattern_planner_type_{MemPatternPlannerType::kFirstFit};
+
+  // generates the memory patterns of new input shapes from the inferred shapes of the activations.
+  // nullptr if memory patterns are disabled, or if in an inference build some activation sizes can't be inferred
+  // from the input shapes, in which case the patterns are traced from the first run with each input shape.
+  std::unique_ptr<SymbolicMemoryPlanner> symbolic_memory_planner_;
 
   // lock for the mem_patterns_
   mutable OrtMutex mem_patterns_lock_;
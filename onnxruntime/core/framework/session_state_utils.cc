@@ -25,6 +25,7 @@
 #include "core/session/onnxruntime_session_options_config_keys.h"
 #include "core/framework/mem_buffer.h"
 #include "core/framework/tensor_allocator.h"
+#include "core/platform/threadpool.h"
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
 #include "core/framework/memory_info.h"
 #endif
@@ -129,6 +130,36 @@ static common::Status DeserializeTensorProto(const Env& env, const std::basic_st
   return common::Status::OK();
 }
 
+common::Status ParallelForWithStatus(concurrency::ThreadPool* thread_pool, size_t n,
+                                     const std::function<common::Status(size_t)>& func) {
+  std::vector<Status> statuses(n);
+  auto run = [&func, &statuses](std::ptrdiff_t i) {
+    ORT_TRY {
+      statuses[i] = func(static_cast<size_t>(i));
+    }
+    ORT_CATCH(const std::exception& ex) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        statuses[i] = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, ex.what());
+      });
+    }
+  };
+
+  // TrySimpleParallelFor runs in parallel on OpenMP even without a thread pool, so loop explicitly instead
+  if (thread_pool == nullptr || n < 2) {
+    for (size_t i = 0; i < n; ++i) {
+      run(static_cast<std::ptrdiff_t>(i));
+    }
+  } else {
+    concurrency::ThreadPool::TrySimpleParallelFor(thread_pool, static_cast<std::ptrdiff_t>(n), run);
+  }
+
+  for (auto& status : statuses) {
+    ORT_RETURN_IF_ERROR(status);
+  }
+
+  return Status::OK();
+}
+
 common::Status SaveInitializedTensors(
     const Env& env, const std::basic_string<PATH_CHAR_TYPE>& graph_loc,
     const GraphViewer& graph, const AllocatorPtr& default_cpu_alloc,
@@ -138,7 +169,8 @@ common::Status SaveInitializedTensors(
     const std::function<Status(int idx, const OrtValue& value, const OrtCallback& d, bool constant)>& save_tensor_func,
     const logging::Logger& logger, const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
-    const SessionOptions& session_options) {
+    const SessionOptions& session_options,
+    concurrency::ThreadPool* thread_pool) {
   LOGS(logger, INFO) << "Saving initialized tensors.";
   ORT_ENFORCE(ort_value_name_idx_map.MaxIdx() > -1, "OrtValue indexes should have been populated.");
 
@@ -225,38 +257,82 @@ common::Status SaveInitializedTensors(
   OrtCallback deleter{nullptr, nullptr};
 
   //3. create weight tensors based on weights buffer
-  for (const auto& entry : id_to_initialized_tensor) {
-    int ort_value_index = entry.first;
-    const char* name = (entry.second->name().empty()) ? "" : entry.second->name().c_str();
+  struct InitializerToLoad {
+    int ort_value_index;
+    const char* name;
+    const ONNX_NAMESPACE::TensorProto* tensor_proto;
+    std::unique_ptr<MemBuffer> m;
+    AllocatorPtr alloc;
     OrtValue ort_value;
+    bool is_user_supplied = false;
+  };
+
+  const bool use_device_allocator_for_initializers =
+      session_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
+
+  // get the buffers in the order of the map as the planner isn't thread safe
+  std::vector<InitializerToLoad> initializers;
+  initializers.reserve(id_to_initialized_tensor.size());
+  for (const auto& entry : id_to_initialized_tensor) {
+    InitializerToLoad initializer;
+    initializer.ort_value_index = entry.first;
+    initializer.name = (entry.second->name().empty()) ? "" : entry.second->name().c_str();
+    initializer.tensor_proto = entry.second;
 
     if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
-      ort_value = *(session_options.initializers_to_share_map.at(name));
-      LOGS(logger, INFO) << "Using user supplied initializer with name (" << name << ").";
+      initializer.ort_value = *(session_options.initializers_to_share_map.at(initializer.name));
+      initializer.is_user_supplied = true;
+      LOGS(logger, INFO) << "Using user supplied initializer with name (" << initializer.name << ").";
     } else {
-      const ONNX_NAMESPACE::TensorProto& tensor_proto = *(entry.second);
-
-      std::unique_ptr<MemBuffer> m;
-      AllocatorPtr alloc;
       // TODO: if the tensor need be copied, does it have enough room?
-      ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, m, alloc));
-      bool use_device_allocator_for_initializers = session_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
-
-      Status st = DeserializeTensorProto(env, graph_loc, tensor_proto, m.get(), alloc, default_cpu_alloc, ort_value,
-                                         data_transfer_mgr, use_device_allocator_for_initializers);
-      if (!st.IsOK()) {
-        std::ostringstream oss;
-        oss << "Deserialize tensor " << name << " failed." << st.ErrorMessage();
-        return Status(st.Category(), st.Code(), oss.str());
-      }
+      ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(entry.first, initializer.name, initializer.m,
+                                                        initializer.alloc));
     }
 
+    initializers.push_back(std::move(initializer));
+  }
+
+  // deserializing a tensor is independent of the others, so the ones on CPU are deserialized in parallel.
+  // the ones on other devices are copied sequentially as not all the data transfers are thread safe.
+  auto deserialize = [&](InitializerToLoad& initializer) -> Status {
+    Status st = DeserializeTensorProto(env, graph_loc, *initializer.tensor_proto, initializer.m.get(),
+                                       initializer.alloc, default_cpu_alloc, initializer.ort_value,
+                                       data_transfer_mgr, use_device_allocator_for_initializers);
+    if (!st.IsOK()) {
+      std::ostringstream oss;
+      oss << "Deserialize tensor " << initializer.name << " failed." << st.ErrorMessage();
+      return Status(st.Category(), st.Code(), oss.str());
+    }
+
+    return Status::OK();
+  };
+
+  std::vector<InitializerToLoad*> cpu_initializers;
+  for (auto& initializer : initializers) {
+    if (initializer.is_user_supplied) {
+      continue;
+    }
+
+    const auto& location = initializer.m ? initializer.m->GetAllocInfo() : initializer.alloc->Info();
+    if (strcmp(location.name, CPU) == 0) {
+      cpu_initializers.push_back(&initializer);
+    } else {
+      ORT_RETURN_IF_ERROR(deserialize(initializer));
+    }
+  }
+
+  ORT_RETURN_IF_ERROR(ParallelForWithStatus(thread_pool, cpu_initializers.size(), [&](size_t i) {
+    return deserialize(*cpu_initializers[i]);
+  }));
+
+  for (const auto& initializer : initializers) {
     // any outer scope value is shadowed by a local value and can't override it.
     // due to that check_outer_scope is false
-    bool constant = graph.IsConstantInitializer(name, /* check_outer_scope */ false);
-    ORT_RETURN_IF_ERROR(save_tensor_func(ort_value_index, ort_value, deleter, constant));
+    bool constant = graph.IsConstantInitializer(initializer.name, /* check_outer_scope */ false);
+    ORT_RETURN_IF_ERROR(save_tensor_func(initializer.ort_value_index, initializer.ort_value, deleter, constant));
 
-    VLOGS(logger, 1) << "Added weight with name : " << name << " with index: " << ort_value_index;
+    VLOGS(logger, 1) << "Added weight with name : " << initializer.name
+                     << " with index: " << initializer.ort_value_index;
   }
 
   LOGS(logger, INFO) << "Done saving initialized tensors";
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <functional>
 #include <map>
 
 #include "core/common/const_pointer_container.h"
@@ -29,6 +30,10 @@ namespace logging {
 class Logger;
 }
 
+namespace concurrency {
+class ThreadPool;
+}
+
 namespace session_state_utils {
 common::Status SaveInitializedTensors(
     const Env& env, const std::basic_string<PATH_CHAR_TYPE>& graph_loc,
@@ -39,7 +44,14 @@ common::Status SaveInitializedTensors(
     const logging::Logger& logger,
     const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
-    const SessionOptions& session_options);
+    const SessionOptions& session_options,
+    concurrency::ThreadPool* thread_pool = nullptr);
+// Run func for each index in [0, n) on the thread pool, or sequentially if it is null.
+// Exceptions are converted to a failed status, and the status of the lowest failing index is returned so that
+// the result doesn't depend on the scheduling.
+common::Status ParallelForWithStatus(concurrency::ThreadPool* thread_pool, size_t n,
+                                     const std::function<common::Status(size_t)>& func);
+
 common::Status SaveInputOutputNamesToNodeMapping(const GraphViewer& graph,
                                                  SessionState& session_state,
                                                  const std::vector<const NodeArg*>& implicit_inputs);
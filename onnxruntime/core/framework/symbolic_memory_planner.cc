@@ -0,0 +1,180 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/symbolic_memory_planner.h"
+
+#include <string>
+
+#include "core/framework/data_types.h"
+#include "core/framework/data_types_internal.h"
+#include "core/framework/ort_value_name_idx_map.h"
+#include "core/framework/ort_value_pattern_planner.h"
+#include "core/framework/sequential_execution_plan.h"
+#include "core/graph/graph_viewer.h"
+
+namespace onnxruntime {
+
+SymbolicMemoryPlanner::SymbolicMemoryPlanner(const GraphViewer& graph_viewer,
+                                             const SequentialExecutionPlan& execution_plan,
+                                             const OrtValueNameIdxMap& ort_value_name_idx_map)
+    : execution_plan_(execution_plan) {
+  // symbolic dimensions can only be bound from the graph inputs
+  std::unordered_map<std::string, int> symbols;
+  for (const NodeArg* input : graph_viewer.GetInputs()) {
+    const auto* shape = input->Shape();
+    int ort_value_idx;
+    if (shape == nullptr || !ort_value_name_idx_map.GetIdx(input->Name(), ort_value_idx).IsOK()) {
+      continue;
+    }
+
+    const size_t rank = static_cast<size_t>(shape->dim_size());
+    for (size_t axis = 0; axis < rank; ++axis) {
+      const auto& dim = shape->dim(static_cast<int>(axis));
+      if (dim.has_dim_param()) {
+        auto symbol = symbols.emplace(dim.dim_param(), static_cast<int>(symbols.size())).first->second;
+        input_dims_.push_back({ort_value_idx, rank, axis, symbol});
+      }
+    }
+  }
+  num_symbols_ = symbols.size();
+
+  step_activations_end_.reserve(execution_plan_.execution_plan.size());
+  for (const auto& step : execution_plan_.execution_plan) {
+    const Node* node = graph_viewer.GetNode(step.node_index);
+    for (const NodeArg* output : node->OutputDefs()) {
+      int ort_value_idx;
+      if (!output->Exists() || !ort_value_name_idx_map.GetIdx(output->Name(), ort_value_idx).IsOK()) {
+        continue;
+      }
+
+      const auto& alloc_plan = execution_plan_.allocation_plan[ort_value_idx];
+      if (alloc_plan.value_type == nullptr || !alloc_plan.value_type->IsTensorType()) {
+        continue;
+      }
+
+      const auto* element_type = static_cast<const TensorTypeBase*>(alloc_plan.value_type)->GetElementType();
+      // string tensors are never allocated in the memory pattern as they need placement new
+      const bool is_planned = alloc_plan.alloc_kind == AllocKind::kAllocate &&
+                              !utils::IsDataTypeString(element_type);
+
+      const auto* shape = output->Shape();
+      bool is_resolvable = shape != nullptr;
+      const size_t dims_begin = dims_.size();
+      if (is_resolvable) {
+        for (const auto& dim : shape->dim()) {
+          if (dim.has_dim_param()) {
+            auto symbol = symbols.find(dim.dim_param());
+            if (symbol == symbols.end()) {
+              is_resolvable = false;
+              break;
+            }
+            dims_.push_back({0, symbol->second});
+          } else if (dim.has_dim_value() && dim.dim_value() > 0) {
+            dims_.push_back({dim.dim_value(), kConstantDim});
+          } else {
+            is_resolvable = false;
+            break;
+          }
+        }
+      }
+
+      if (!is_resolvable) {
+        dims_.resize(dims_begin);
+        is_complete_ = is_complete_ && !is_planned;
+        continue;
+      }
+
+      activations_.push_back({ort_value_idx, dims_begin, dims_.size(), is_planned, element_type->Size()});
+    }
+    step_activations_end_.push_back(activations_.size());
+  }
+}
+
+Status SymbolicMemoryPlanner::ResolveShapes(const std::vector<int>& feed_mlvalue_idxs,
+                                            const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
+                                            std::unordered_map<int, TensorShape>& resolved_shapes) const {
+  ORT_RETURN_IF_NOT(feed_mlvalue_idxs.size() == input_shapes.size(), "Feeds and input shapes mismatch");
+
+  std::unordered_map<int, const TensorShape*> feed_shapes;
+  for (size_t i = 0, end = feed_mlvalue_idxs.size(); i < end; ++i) {
+    feed_shapes.emplace(feed_mlvalue_idxs[i], &input_shapes[i].get());
+  }
+
+  // bind each symbol to the first input dimension it appears in
+  std::vector<int64_t> symbol_values(num_symbols_, -1);
+  for (const auto& input_dim : input_dims_) {
+    auto feed_shape = feed_shapes.find(input_dim.ort_value_idx);
+    if (feed_shape == feed_shapes.end()) {
+      continue;
+    }
+    ORT_RETURN_IF_NOT(feed_shape->second->NumDimensions() == input_dim.rank,
+                      "Rank of the feed doesn't match the shape of the graph input");
+    if (symbol_values[input_dim.symbol] < 0) {
+      symbol_values[input_dim.symbol] = (*feed_shape->second)[input_dim.axis];
+    }
+  }
+
+  std::vector<int64_t> shape;
+  for (const auto& activation : activations_) {
+    shape.clear();
+    bool is_resolved = true;
+    for (size_t i = activation.dims_begin; i < activation.dims_end; ++i) {
+      const auto& dim = dims_[i];
+      const int64_t value = dim.symbol == kConstantDim ? dim.value : symbol_values[dim.symbol];
+      // like the inferred dimensions, a symbolic dimension bound to 0 is treated as unknown
+      if (value <= 0) {
+        is_resolved = false;
+        break;
+      }
+      shape.push_back(value);
+    }
+    if (is_resolved) {
+      resolved_shapes[activation.ort_value_idx] = TensorShape(shape);
+    }
+  }
+
+  return Status::OK();
+}
+
+Status SymbolicMemoryPlanner::GeneratePatterns(const std::unordered_map<int, TensorShape>& resolved_shapes,
+                                               MemPatternPlannerType planner_type,
+                                               MemoryPatternGroup& output) const {
+  OrtValuePatternPlanner mem_planner(execution_plan_, /*trace_using_counters*/ false, planner_type);
+
+  size_t activation_index = 0;
+  for (size_t step_index = 0, end = execution_plan_.execution_plan.size(); step_index < end; ++step_index) {
+    for (; activation_index < step_activations_end_[step_index]; ++activation_index) {
+      const auto& activation = activations_[activation_index];
+      if (!activation.is_planned) {
+        continue;
+      }
+
+      auto shape = resolved_shapes.find(activation.ort_value_idx);
+      ORT_RETURN_IF(shape == resolved_shapes.end(), "Shape of the activation with OrtValue index ",
+                    activation.ort_value_idx, " is not resolved");
+      const int64_t num_elements = shape->second.Size();
+      ORT_RETURN_IF(num_elements < 0, "Invalid shape of the activation with OrtValue index ",
+                    activation.ort_value_idx);
+
+      size_t size = 0;
+      ORT_RETURN_IF_NOT(IAllocator::CalcMemSizeForArrayWithAlignment<kAllocAlignment>(
+                            static_cast<size_t>(num_elements), activation.element_size, &size),
+                        "Size overflow");
+      ORT_RETURN_IF_ERROR(mem_planner.TraceAllocation(activation.ort_value_idx, size));
+    }
+
+    const auto& step = execution_plan_.execution_plan[step_index];
+    for (int index = step.free_from_index; index <= step.free_to_index; ++index) {
+      const auto ort_value_idx = execution_plan_.to_be_freed[index];
+      const auto* value_type = execution_plan_.allocation_plan[ort_value_idx].value_type;
+      if (value_type != nullptr && value_type->IsTensorType() &&
+          !utils::IsDataTypeString(static_cast<const TensorTypeBase*>(value_type)->GetElementType())) {
+        ORT_RETURN_IF_ERROR(mem_planner.TraceFree(ort_value_idx));
+      }
+    }
+  }
+
+  return mem_planner.GeneratePatterns(&output);
+}
+
+}  // namespace onnxruntime
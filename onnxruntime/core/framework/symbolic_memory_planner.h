@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/framework/mem_pattern.h"
+#include "core/framework/tensor_shape.h"
+
+namespace onnxruntime {
+class GraphViewer;
+class OrtValueNameIdxMap;
+struct SequentialExecutionPlan;
+
+/*
+SymbolicMemoryPlanner generates the memory pattern for a set of input shapes before the first run with them.
+
+At construction, the inferred shapes of the node outputs are compiled into lists of dimensions. Each dimension
+is either a constant or a symbolic dimension of a graph input. For each new set of input shapes, the symbolic
+dimensions are bound from the feeds and the activation shapes are evaluated in O(values). The allocations and
+frees of the execution plan are then replayed into a pattern planner, in the order a sequential run performs them.
+*/
+class SymbolicMemoryPlanner {
+ public:
+  SymbolicMemoryPlanner(const GraphViewer& graph_viewer, const SequentialExecutionPlan& execution_plan,
+                        const OrtValueNameIdxMap& ort_value_name_idx_map);
+
+  /*
+  Whether the size of every activation planned to be allocated can be evaluated from the input shapes.
+  If not, e.g. for the output of NonZero, the pattern must be traced from a run instead.
+  */
+  bool IsComplete() const { return is_complete_; }
+
+  /*
+  Resolves the shapes of the activations for the given feeds. Activations whose shapes depend on a dimension that
+  is unknown, or on a symbolic dimension of an input that is not fed, are not resolved.
+  */
+  Status ResolveShapes(const std::vector<int>& feed_mlvalue_idxs,
+                       const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
+                       std::unordered_map<int, TensorShape>& resolved_shapes) const;
+
+  /*
+  Replays the allocations and frees of the execution plan with the resolved shapes and generates the memory
+  pattern. Fails if the shape of an activation planned to be allocated is not resolved.
+  */
+  Status GeneratePatterns(const std::unordered_map<int, TensorShape>& resolved_shapes,
+                          MemPatternPlannerType planner_type, MemoryPatternGroup& output) const;
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SymbolicMemoryPlanner);
+
+  static constexpr int kConstantDim = -1;
+
+  // a dimension of an activation, either a constant value or the index of a symbolic dimension
+  struct Dim {
+    int64_t value;
+    int symbol;
+  };
+
+  // a symbolic dimension of a graph input
+  struct InputDim {
+    int ort_value_idx;
+    size_t rank;
+    size_t axis;
+    int symbol;
+  };
+
+  struct Activation {
+    int ort_value_idx;
+    size_t dims_begin;
+    size_t dims_end;
+    bool is_planned;  // allocated by the execution frame, and part of the memory pattern
+    size_t element_size;
+  };
+
+  const SequentialExecutionPlan& execution_plan_;
+  bool is_complete_{true};
+  size_t num_symbols_{0};
+  std::vector<InputDim> input_dims_;
+  std::vector<Dim> dims_;
+  // activations in the order they are produced. the activations of execution_plan_.execution_plan[i] are
+  // activations_[step_activations_end_[i - 1]] to activations_[step_activations_end_[i] - 1].
+  std::vector<Activation> activations_;
+  std::vector<size_t> step_activations_end_;
+};
+
+}  // namespace onnxruntime
@@ -1657,6 +1657,46 @@ Matrix product that behaves like numpy.matmul: https://docs.scipy.org/doc/numpy-
         FusedMatMulShapeInference(ctx);
       });
 
+  static const char* SparseMatMul_doc = R"DOC(
+Matrix product Y = alpha * A * B + beta * bias, where A behaves like the first input of numpy.matmul and B is a
+constant 2-D matrix that is mostly zeros. The CPU kernel packs B into a block compressed sparse row format and
+only multiplies the non-zero elements. This op is produced by the SparseMatMulTransformer from MatMul, FusedMatMul
+and Gemm nodes. An infinity or NaN in B propagates to Y like it does for MatMul, but the blocks of B that are entirely
+zero are not stored, so an infinity or NaN in A only propagates through the non-zero elements of B.
+)DOC";
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(SparseMatMul)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .Input(0, "A", "N-dimensional matrix A", "T")
+      .Input(1, "B", "2-dimensional constant matrix B", "T")
+      .Input(2, "bias", "Optional scalar or 1-dimensional bias of size N added to each row of the product", "T",
+             OpSchema::Optional)
+      .Attr(
+          "alpha",
+          "Scalar multiplier for the product of the input tensors.",
+          AttributeProto::FLOAT,
+          1.0f)
+      .Attr(
+          "beta",
+          "Scalar multiplier for the bias.",
+          AttributeProto::FLOAT,
+          1.0f)
+      .Attr(
+          "transB",
+          "Whether B should be transposed before doing multiplication",
+          AttributeProto::INT,
+          static_cast<int64_t>(0))
+      .Output(0, "Y", "Matrix multiply results", "T")
+      .TypeConstraint(
+          "T",
+          {"tensor(float)"},
+          "Constrain input and output types to float tensors.")
+      .SetDoc(SparseMatMul_doc)
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        FusedMatMulShapeInference(ctx);
+      });
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(MurmurHash3)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
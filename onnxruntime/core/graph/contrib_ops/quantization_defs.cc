@@ -428,6 +428,68 @@ C (int32) = (A - A_zero_point) * (B - B_zero_point)
         ONNX_NAMESPACE::matmulShapeInference(ctx, 0, 1);
       });
 
+  static const char* MatMulNBits_ver1_doc = R"DOC(
+MatMulNBits computes Y = A * dequantize(B) + bias, where A is a float tensor that behaves like the first input of
+numpy.matmul, and B is a constant K x N weight that is quantized to 'bits' bit integers in blocks of 'block_size'
+elements along the K dimension. Each block has its own scale and zero point:
+
+  dequantize(B)[k, n] = (B_quant[n, k] - zero_point[n, k / block_size]) * scales[n, k / block_size]
+
+B is stored column by column as [N, k_blocks, blob_size], where k_blocks = (K + block_size - 1) / block_size and
+blob_size = block_size * bits / 8. With 4 bits, the low nibble of each byte holds the even element. The weight is
+only dequantized on the fly, so the memory traffic for B is the size of the quantized data.
+)DOC";
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(MatMulNBits)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(MatMulNBits_ver1_doc)
+      .Attr("K", "Number of rows of the dequantized weight B.", AttributeProto::INT)
+      .Attr("N", "Number of columns of the dequantized weight B.", AttributeProto::INT)
+      .Attr("bits", "Number of bits of each quantized element of B. It must be 4 or 8.", AttributeProto::INT,
+            static_cast<int64_t>(4))
+      .Attr("block_size",
+            "Number of elements along the K dimension that share a scale and a zero point. "
+            "It must be a power of 2 between 16 and 256.",
+            AttributeProto::INT, static_cast<int64_t>(32))
+      .Input(0, "A", "N-dimensional matrix A with K as its last dimension", "T1")
+      .Input(1, "B", "Quantized weight of shape [N, k_blocks, blob_size]", "T2")
+      .Input(2, "scales", "Scale of each block, of shape [N * k_blocks]", "T1")
+      .Input(
+          3,
+          "zero_points",
+          "Zero point of each block, of shape [N * ((k_blocks * bits + 7) / 8)]. 4-bit zero points are packed like "
+          "the weight. It's optional and default value is 2^(bits - 1).",
+          "T2",
+          OpSchema::Optional)
+      .Input(4, "bias", "1D input tensor of N elements", "T1", OpSchema::Optional)
+      .Output(0, "Y", "Matrix multiply results of shape [..., N]", "T1")
+      .TypeConstraint("T1", {"tensor(float)"}, "Constrain input A, scales, bias and output Y to float tensors.")
+      .TypeConstraint("T2", {"tensor(uint8)"}, "Constrain the quantized weight and zero points to uint8 tensors.")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        propagateElemTypeFromInputToOutput(ctx, 0, 0);
+        if (!hasInputShape(ctx, 0)) {
+          return;
+        }
+
+        const int64_t N = getAttribute(ctx, "N", static_cast<int64_t>(-1));
+        if (N <= 0) {
+          fail_shape_inference("Attribute N must be positive.");
+        }
+
+        const auto& a_shape = getInputShape(ctx, 0);
+        if (a_shape.dim_size() == 0) {
+          fail_shape_inference("Input A must have at least one dimension.");
+        }
+
+        ONNX_NAMESPACE::TensorShapeProto y_shape;
+        for (int i = 0; i < a_shape.dim_size() - 1; ++i) {
+          *y_shape.add_dim() = a_shape.dim(i);
+        }
+        y_shape.add_dim()->set_dim_value(N);
+        updateOutputShape(ctx, 0, y_shape);
+      });
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(QLinearAdd)
       .SetDomain(kMSDomain)
       .SinceVersion(1)
@@ -6,6 +6,7 @@
 #pragma warning(disable : 4244)
 #endif
 
+#include <atomic>
 #include <cassert>
 #include <fstream>
 #include <iostream>
@@ -135,8 +136,15 @@ static TypeProto TypeProtoFromTensorProto(const TensorProto& tensor) {
 }
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
+// versions are unique across all the NodeArg instances so that replacing an input of a node with another NodeArg
+// changes the versions recorded for the node too.
+static uint64_t NextNodeArgVersion() noexcept {
+  static std::atomic<uint64_t> next_version{0};
+  return ++next_version;
+}
+
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
-NodeArg::NodeArg(const std::string& name, const TypeProto* p_node_arg_type) {
+NodeArg::NodeArg(const std::string& name, const TypeProto* p_node_arg_type) : version_(NextNodeArgVersion()) {
   node_arg_info_.set_name(name);
   // If the name is empty, it means the arg does not exist.
   exists_ = !(name.empty());
@@ -154,7 +162,7 @@ NodeArg::NodeArg(const std::string& name, const TypeProto* p_node_arg_type) {
 }
 #endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 
-NodeArg::NodeArg(NodeArgInfo&& node_arg_info) {
+NodeArg::NodeArg(NodeArgInfo&& node_arg_info) : version_(NextNodeArgVersion()) {
   node_arg_info_ = std::move(node_arg_info);
 
   exists_ = !node_arg_info_.name().empty();
@@ -227,14 +235,52 @@ bool NodeArg::HasTensorOrScalarShape() const {
 }
 
 #if !defined(ORT_MINIMAL_BUILD)
+static bool ShapesEqual(const TensorShapeProto& shape1, const TensorShapeProto& shape2) {
+  if (shape1.dim_size() != shape2.dim_size()) {
+    return false;
+  }
+
+  for (int i = 0, end = shape1.dim_size(); i < end; ++i) {
+    const auto& dim1 = shape1.dim(i);
+    const auto& dim2 = shape2.dim(i);
+    if (dim1.value_case() != dim2.value_case() ||
+        (utils::HasDimValue(dim1) && dim1.dim_value() != dim2.dim_value()) ||
+        (utils::HasDimParam(dim1) && dim1.dim_param() != dim2.dim_param())) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// compare the info that type/shape inferencing depends on. other kinds of types are always treated as different.
+static bool TypesAndShapesEqual(const TypeProto& type1, const TypeProto& type2) {
+  if (utils::HasTensorType(type1) && utils::HasTensorType(type2)) {
+    const auto& tensor1 = type1.tensor_type();
+    const auto& tensor2 = type2.tensor_type();
+    return tensor1.elem_type() == tensor2.elem_type() &&
+           utils::HasShape(tensor1) == utils::HasShape(tensor2) &&
+           (!utils::HasShape(tensor1) || ShapesEqual(tensor1.shape(), tensor2.shape()));
+  }
+
+  return false;
+}
+
 void NodeArg::SetShape(const TensorShapeProto& shape) {
   const auto type_case = node_arg_info_.type().value_case();
+  const auto* current_shape = Shape();
+  if (current_shape != nullptr && ShapesEqual(*current_shape, shape)) {
+    return;
+  }
+
   switch (type_case) {
     case TypeProto::kTensorType:
       *(node_arg_info_.mutable_type()->mutable_tensor_type()->mutable_shape()) = shape;
+      MarkChanged();
       break;
     case TypeProto::kSparseTensorType:
       *(node_arg_info_.mutable_type()->mutable_sparse_tensor_type()->mutable_shape()) = shape;
+      MarkChanged();
       break;
     case TypeProto::kSequenceType:
     case TypeProto::kMapType:
@@ -246,6 +292,11 @@ void NodeArg::SetShape(const TensorShapeProto& shape) {
 }
 
 void NodeArg::ClearShape() {
+  if (Shape() == nullptr) {
+    return;
+  }
+
+  MarkChanged();
   const auto type_case = node_arg_info_.type().value_case();
   switch (type_case) {
     case TypeProto::kTensorType:
@@ -268,9 +319,11 @@ common::Status NodeArg::UpdateTypeAndShape(const ONNX_NAMESPACE::TypeProto& inpu
   if (!utils::HasType(node_arg_info_)) {
     *node_arg_info_.mutable_type() = input_type;
     type_ = DataTypeUtils::ToType(node_arg_info_.type());
+    MarkChanged();
     return Status::OK();
   }
 
+  const TypeProto previous_type = node_arg_info_.type();
   auto& current_type = *node_arg_info_.mutable_type();
   const auto current_type_case = current_type.value_case();
   const auto input_type_case = input_type.value_case();
@@ -355,6 +408,10 @@ common::Status NodeArg::UpdateTypeAndShape(const ONNX_NAMESPACE::TypeProto& inpu
       break;
   }
 
+  if (!TypesAndShapesEqual(previous_type, current_type)) {
+    MarkChanged();
+  }
+
   return Status::OK();
 }
 
@@ -375,11 +432,13 @@ void NodeArg::SetType(DataType p_type) {
 
   type_ = p_type;
   *(node_arg_info_.mutable_type()) = DataTypeUtils::ToTypeProto(p_type);
+  MarkChanged();
 }
 
 void NodeArg::SetType(const TypeProto& type_proto) {
   type_ = DataTypeUtils::ToType(type_proto);
   *(node_arg_info_.mutable_type()) = type_proto;
+  MarkChanged();
 }
 
 #endif  // !defined(ORT_MINIMAL_BUILD)
@@ -388,6 +447,10 @@ bool NodeArg::Exists() const noexcept {
   return exists_;
 }
 
+void NodeArg::MarkChanged() noexcept {
+  version_ = NextNodeArgVersion();
+}
+
 Node::EdgeEnd::EdgeEnd(const Node& node, int src_arg_index, int dst_arg_index) noexcept
     : node_(&node),
       src_arg_index_(src_arg_index),
@@ -740,6 +803,7 @@ void Node::CreateSubgraph(const std::string& attr_name) {
 void Node::AddAttribute(const std::string& attr_name, const AttributeProto& value) {
   graph_->SetGraphResolveNeeded();
   graph_->SetGraphProtoSyncNeeded();
+  ResetTypeAndShapeInferenceState();
   attributes_[attr_name] = value;
 }
 
@@ -747,6 +811,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
   void Node::AddAttribute(const std::string& attr_name, const type& value) { \
     graph_->SetGraphResolveNeeded();                                         \
     graph_->SetGraphProtoSyncNeeded();                                       \
+    ResetTypeAndShapeInferenceState();                                       \
     AttributeProto a;                                                        \
     a.set_name(attr_name);                                                   \
     a.set_type(enumType);                                                    \
@@ -758,6 +823,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
   void Node::AddAttribute(const std::string& attr_name, const type& value) { \
     graph_->SetGraphResolveNeeded();                                         \
     graph_->SetGraphProtoSyncNeeded();                                       \
+    ResetTypeAndShapeInferenceState();                                       \
     AttributeProto a;                                                        \
     a.set_name(attr_name);                                                   \
     a.set_type(enumType);                                                    \
@@ -770,6 +836,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
                           const std::vector<type>& values) { \
     graph_->SetGraphResolveNeeded();                         \
     graph_->SetGraphProtoSyncNeeded();                       \
+    ResetTypeAndShapeInferenceState();                       \
     AttributeProto a;                                        \
     a.set_name(attr_name);                                   \
     a.set_type(enumType);                                    \
@@ -782,6 +849,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
 void Node::AddAttribute(const std::string& attr_name, const GraphProto& value) {
   graph_->SetGraphResolveNeeded();
   graph_->SetGraphProtoSyncNeeded();
+  ResetTypeAndShapeInferenceState();
   AttributeProto a;
   a.set_name(attr_name);
   a.set_type(AttributeProto_AttributeType::AttributeProto_AttributeType_GRAPH);
@@ -810,6 +878,7 @@ ADD_LIST_ATTR_IMPL(SparseTensorProto, AttributeProto_AttributeType::AttributePro
 bool Node::ClearAttribute(const std::string& attr_name) {
   graph_->SetGraphResolveNeeded();
   graph_->SetGraphProtoSyncNeeded();
+  ResetTypeAndShapeInferenceState();
   return attributes_.erase(attr_name) > 0;
 }
 
@@ -869,6 +938,51 @@ Status Node::UpdateInputArgCount() {
   return Status::OK();
 }
 
+bool Node::IsTypeAndShapeInferenceUpToDate() const {
+  // the type/shape inferencing of a subgraph depends on the outer scope values it implicitly consumes,
+  // so nodes containing subgraphs are always inferred again.
+  if (inferred_arg_versions_.empty() || !subgraphs_.empty()) {
+    return false;
+  }
+
+  const auto& input_defs = definitions_.input_defs;
+  const auto& output_defs = definitions_.output_defs;
+  if (inferred_arg_versions_.size() != input_defs.size() + output_defs.size() + 1 ||
+      inferred_arg_versions_[0] != input_defs.size()) {
+    return false;
+  }
+
+  size_t i = 1;
+  for (const auto* input_def : input_defs) {
+    if (inferred_arg_versions_[i++] != input_def->version_) {
+      return false;
+    }
+  }
+
+  for (const auto* output_def : output_defs) {
+    if (inferred_arg_versions_[i++] != output_def->version_) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void Node::SetTypeAndShapeInferenceUpToDate() {
+  const auto& input_defs = definitions_.input_defs;
+  const auto& output_defs = definitions_.output_defs;
+  inferred_arg_versions_.clear();
+  inferred_arg_versions_.reserve(input_defs.size() + output_defs.size() + 1);
+  inferred_arg_versions_.push_back(input_defs.size());
+  for (const auto* input_def : input_defs) {
+    inferred_arg_versions_.push_back(input_def->version_);
+  }
+
+  for (const auto* output_def : output_defs) {
+    inferred_arg_versions_.push_back(output_def->version_);
+  }
+}
+
 Graph* Node::GetMutableGraphAttribute(const std::string& attr_name) {
   Graph* subgraph = nullptr;
 
@@ -2288,13 +2402,13 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
     // Node verification.
     auto& node = *GetNode(node_index);
 
-    NodeProto node_proto;
-    node.ToProto(node_proto);
     auto& node_name = node.Name();
     auto& domain = node.Domain();
 
     if (!node.Op()) {
       {
+        NodeProto node_proto;
+        node.ToProto(node_proto);
         auto status = Status::OK();
         ORT_TRY {
           checker::check_node(node_proto, ctx, lsc);
@@ -2354,11 +2468,18 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
       }
     }
 
-    NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *p_op, options)));
+    // the type/shape inferencing only needs to run again if the node or one of its inputs changed since it last
+    // ran, which is usually true for a small part of the graph when resolving after a graph transformer.
+    // as the nodes are visited in topological order, a change to the type/shape of an output is picked up by the
+    // nodes downstream of it.
+    if (!node.IsTypeAndShapeInferenceUpToDate()) {
+      NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *p_op, options)));
+      node.SetTypeAndShapeInferenceUpToDate();
+    }
 
     // Accumulate output names of the iterated Node
-    for (auto& output_name : node_proto.output()) {
-      lsc.output_names.insert(output_name);
+    for (const auto* output_def : node.OutputDefs()) {
+      lsc.output_names.insert(output_def->Name());
     }
   }
 
@@ -2566,6 +2687,7 @@ void Graph::AddInitializedTensor(const TensorProto& tensor) {
   *(tensor_added) = tensor;
   name_to_initial_tensor_[tensor.name()] = tensor_added;
   SetGraphResolveNeeded();
+  MarkInitializerChanged(tensor.name());
   if (!is_loaded_from_model_file_ && GetNodeArg(tensor.name()) == nullptr) {
     // make sure there is a NodeArg for the initializer as SetGraphInputsOutputs may add it to the graph inputs.
     // the shape will be set to the correct value in TypeCheckInputsAndInitializers as we don't yet know whether there
@@ -2614,6 +2736,13 @@ static void RemoveRepeatedFieldEntry(T& repeated_field, const TIter& entry_to_re
   }
 }
 
+void Graph::MarkInitializerChanged(const std::string& name) {
+  auto* node_arg = GetNodeArg(name);
+  if (node_arg != nullptr) {
+    node_arg->MarkChanged();
+  }
+}
+
 bool Graph::IsInitializedTensor(const std::string& name) const {
   return name_to_initial_tensor_.count(name) > 0;
 }
@@ -2626,6 +2755,7 @@ void Graph::RemoveInitializedTensor(const std::string& tensor_name) {
     name_to_initial_tensor_.erase(iter);
     sparse_tensor_names_.erase(tensor_name);
     SetGraphResolveNeeded();
+    MarkInitializerChanged(tensor_name);
   } else {
     ORT_ENFORCE(sparse_tensor_names_.count(tensor_name) == 0, "sparse_tensor_names_ not in sync with name_to_initial_tensor_");
   }
@@ -2677,6 +2807,10 @@ Status Graph::ReplaceInitializedTensor(const ONNX_NAMESPACE::TensorProto& new_in
 
   **existing_entry = new_initializer;
 
+  // shape inferencing may read the values of constant initializers
+  MarkInitializerChanged(initializer_name);
+  SetGraphResolveNeeded();
+
   return Status::OK();
 }
 #endif  // !defined(ORT_MINIMAL_BUILD)
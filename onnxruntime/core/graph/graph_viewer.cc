@@ -225,6 +225,8 @@ int GraphViewer::MaxNodeIndex() const noexcept {
 const std::vector<NodeIndex>& GraphViewer::GetNodesInTopologicalOrder(ExecutionOrder order) const {
   switch (order) {
     case ExecutionOrder::DEFAULT:
+    // the memory efficient order is derived from the default order by the allocation planner
+    case ExecutionOrder::MEMORY_EFFICIENT:
       return nodes_in_topological_order_;
 #if !defined(ORT_MINIMAL_BUILD)
     case ExecutionOrder::PRIORITY_BASED:
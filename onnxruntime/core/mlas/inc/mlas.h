@@ -118,6 +118,7 @@ enum MLAS_ACTIVATION_KIND {
     MlasTanhActivation,
     MlasLogisticActivation,
     MlasClipActivation,
+    MlasGeluActivation,
 };
 
 struct MLAS_ACTIVATION {
@@ -151,6 +152,62 @@ MlasActivation(
 // op(X) = X or op(X) = transpose(X) or op(X) = conjg(transpose(X))
 //
 
+/**
+ * @brief Epilogue applied in place to each tile of the single precision gemm
+ *        output once the tile is complete, while it is still in the cache.
+ */
+class MLAS_SGEMM_OUTPUT_PROCESSOR {
+public:
+    virtual
+    void
+    Process(
+        float*,         // Supplies the address of the tile of the output matrix
+        size_t,         // Supplies the start row index of the tile
+        size_t,         // Supplies the start col index of the tile
+        size_t,         // Supplies the element count per row to process
+        size_t,         // Supplies the element count per col to process
+        size_t          // Supplies the leading dimension of the output matrix
+        ) const = 0;
+
+    virtual ~MLAS_SGEMM_OUTPUT_PROCESSOR() {}
+};
+
+/**
+ * @brief Epilogue computing C := Activation(C + Bias) + Residual, where Bias
+ *        is a row vector broadcast over the rows of C, and Residual is a
+ *        matrix with the shape of C. Each of them is optional.
+ */
+class MLAS_SGEMM_BIAS_ACTIVATION_OUTPUT_PROCESSOR : public MLAS_SGEMM_OUTPUT_PROCESSOR {
+public:
+    MLAS_SGEMM_BIAS_ACTIVATION_OUTPUT_PROCESSOR(
+        const float* Bias,
+        const MLAS_ACTIVATION* Activation,
+        const float* Residual = nullptr,
+        size_t LeadingDimensionResidual = 0) :
+            Bias_(Bias),
+            Activation_(Activation),
+            Residual_(Residual),
+            LeadingDimensionResidual_(LeadingDimensionResidual)
+    {
+    }
+
+    void
+    Process(
+        float* C,
+        size_t StartM,
+        size_t StartN,
+        size_t CountM,
+        size_t CountN,
+        size_t ldc
+        ) const override;
+
+private:
+    const float* Bias_;
+    const MLAS_ACTIVATION* Activation_;
+    const float* Residual_;
+    size_t LeadingDimensionResidual_;
+};
+
 /**
  * @brief Supply matrices data information to single precision gemm functions
  */
@@ -164,6 +221,7 @@ struct MLAS_SGEMM_DATA_PARAMS {
     float alpha = 1.0f;       /**< Supplies the scalar alpha multiplier (see SGEMM definition) */
     float beta = 0.0f;        /**< Supplies the scalar beta multiplier (see SGEMM definition) */
     bool BIsPacked = false;   /**< Whether B is pre-packed */
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor = nullptr; /**< Optional epilogue applied to the output tiles */
 };
 
 /**
@@ -522,10 +580,16 @@ private:
     MLAS_QUANTIZATION_GRANULARITY QuantGran_;
 };
 
+//
+// Matrix A is unsigned unless AIsSigned is set, in which case the A buffer
+// and ZeroPointA hold int8_t data reinterpreted as uint8_t.
+//
+
 struct MLAS_GEMM_U8X8_SHAPE_PARAMS {
     size_t M = 0;
     size_t N = 0;
     size_t K = 0;
+    bool AIsSigned = false;
     bool BIsSigned = false;
 };
 
@@ -613,6 +677,125 @@ MlasGemmPackB(
     void* PackedB
     );
 
+//
+// The packed format of matrix B depends on the signedness of matrix A, so
+// matrices multiplied by signed matrix A are packed with these variants.
+//
+
+size_t
+MLASCALL
+MlasGemmPackBSize(
+    size_t N,
+    size_t K,
+    bool AIsSigned,
+    bool BIsSigned
+    );
+
+void
+MLASCALL
+MlasGemmPackB(
+    size_t N,
+    size_t K,
+    const uint8_t* B,
+    size_t ldb,
+    bool AIsSigned,
+    bool BIsSigned,
+    void* PackedB
+    );
+
+//
+// Sparse matrix/matrix multiply routines.
+// C := alpha * A * B + beta * C
+//
+// Matrix B is packed into a block compressed sparse row format that holds
+// only the non-zero runs of each row. The block width is selected from the
+// sparsity pattern of matrix B at packing time.
+//
+
+size_t
+MLASCALL
+MlasSparseGemmPackBSize(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb
+    );
+
+void
+MLASCALL
+MlasSparseGemmPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    void* PackedB
+    );
+
+void
+MLASCALL
+MlasSparseGemm(
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    const void* PackedB,
+    float beta,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+//
+// Blockwise quantized matrix/matrix multiply routines.
+// C := A * B + Bias
+//
+// Matrix B is quantized to 4-bit or 8-bit integers in blocks of BlockSize
+// elements along the K dimension, each with its own scale and zero point.
+// The blocks are dequantized on the fly, so matrix A stays in single
+// precision.
+//
+
+size_t
+MLASCALL
+MlasBlkQGemmPackBSize(
+    size_t N,
+    size_t K,
+    size_t BlockSize,
+    size_t Bits
+    );
+
+void
+MLASCALL
+MlasBlkQGemmPackB(
+    size_t N,
+    size_t K,
+    size_t BlockSize,
+    size_t Bits,
+    const uint8_t* QuantData,
+    const float* Scales,
+    const uint8_t* ZeroPoints,
+    void* PackedB
+    );
+
+void
+MLASCALL
+MlasBlkQGemm(
+    size_t M,
+    size_t N,
+    size_t K,
+    const float* A,
+    size_t lda,
+    const void* PackedB,
+    const float* Bias,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Convolution routines.
 //
@@ -621,6 +804,7 @@ enum MLAS_CONV_ALGORITHM {
     MlasConvAlgorithmGemmDirect,
     MlasConvAlgorithmExpandThenGemm,
     MlasConvAlgorithmExpandThenGemmSegmented,
+    MlasConvAlgorithmWinograd,
 #if defined(MLAS_TARGET_WASM)
     MlasConvAlgorithmDepthwise,
 #endif
@@ -652,6 +836,12 @@ struct MLAS_CONV_PARAMETERS {
         struct {
             size_t ThreadStrideN;
         } ExpandThenGemmSegmented;
+        struct {
+            size_t TileSize;
+            size_t TileCountH;
+            size_t TileCountW;
+            size_t TileBlockW;
+        } Winograd;
     } u;
 };
 
@@ -672,7 +862,8 @@ MlasConvPrepare(
     size_t FilterCount,
     const MLAS_ACTIVATION* Activation,
     size_t* WorkingBufferSize,
-    MLAS_THREADPOOL* ThreadPool
+    MLAS_THREADPOOL* ThreadPool,
+    bool AllowWinograd = false
     );
 
 void
@@ -687,6 +878,44 @@ MlasConv(
     MLAS_THREADPOOL* ThreadPool
     );
 
+bool
+MLASCALL
+MlasConvWinogradIsSelected(
+    size_t Dimensions,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape,
+    size_t InputChannels,
+    size_t FilterCount
+    );
+
+//
+// Winograd convolution filter packing routines. If MlasConvPrepare selects
+// MlasConvAlgorithmWinograd, then the filter passed to MlasConv must be packed
+// by MlasConvWinogradPackFilter using the TileSize from the parameters.
+//
+
+size_t
+MLASCALL
+MlasConvWinogradPackFilterSize(
+    size_t TileSize,
+    size_t GroupCount,
+    size_t FilterCount,
+    size_t InputChannels
+    );
+
+void
+MLASCALL
+MlasConvWinogradPackFilter(
+    size_t TileSize,
+    size_t GroupCount,
+    size_t FilterCount,
+    size_t InputChannels,
+    const float* Filter,
+    float* PackedFilter
+    );
+
 void
 MLASCALL
 MlasConvDepthwise(
@@ -784,6 +1013,110 @@ MlasComputeTanh(
     size_t N
     );
 
+//
+// Reduction routines.
+//
+// The input tensor is viewed as [OuterCount, ReduceCount, InnerCount] and the
+// middle dimension is reduced to produce an output tensor of [OuterCount,
+// InnerCount]. An InnerCount of one reduces contiguous elements, otherwise the
+// elements are reduced with a stride of InnerCount.
+//
+
+enum MLAS_REDUCTION_KIND {
+    MlasSumReduction,
+    MlasSumSquareReduction,
+    MlasMeanReduction,
+    MlasMaximumReduction,
+    MlasMinimumReduction,
+    MlasLogSumExpReduction,
+    MlasReductionKindCount,
+};
+
+void
+MLASCALL
+MlasReduce(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    float* Output,
+    size_t OuterCount,
+    size_t ReduceCount,
+    size_t InnerCount,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasArgMaximum(
+    const float* Input,
+    int64_t* Output,
+    size_t OuterCount,
+    size_t ReduceCount,
+    size_t InnerCount,
+    bool SelectLastIndex,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+//
+// Layer normalization routines.
+//
+// Each of the Rows rows of Columns elements is normalized independently. The
+// optional Skip and Bias inputs are added to the input before normalization;
+// Skip has the same shape as the input while Bias, Scale, and Shift supply
+// Columns elements. The optional Mean and InvStdDev outputs receive one value
+// per row. A simplified (RMS) normalization does not subtract the mean.
+//
+
+void
+MLASCALL
+MlasLayerNormalization(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    const float* Scale,
+    const float* Shift,
+    float* Output,
+    float* Mean,
+    float* InvStdDev,
+    size_t Rows,
+    size_t Columns,
+    float Epsilon,
+    bool Simplified,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+//
+// Binary element-wise routines.
+//
+// The output is viewed as [Rows, Columns]. Row r of an input starts at
+// Input + r * InputRowStride, so a row stride of zero broadcasts a single row
+// to every output row. If IsScalar is true, the first element of each input
+// row is broadcast across all columns, otherwise the input row supplies
+// Columns elements. Supported types are float, int32_t, and int64_t.
+//
+
+enum MLAS_ELTWISE_BINARY_KIND {
+    MlasEltwiseAdd,
+    MlasEltwiseSubtract,
+    MlasEltwiseMultiply,
+    MlasEltwiseDivide,
+};
+
+template<typename T>
+void
+MLASCALL
+MlasEltwiseBinary(
+    MLAS_ELTWISE_BINARY_KIND Kind,
+    const T* InputA,
+    size_t InputARowStride,
+    bool IsScalarA,
+    const T* InputB,
+    size_t InputBRowStride,
+    bool IsScalarB,
+    T* Output,
+    size_t Rows,
+    size_t Columns
+    );
+
 //
 // Half-precision floating-point routines.
 //
@@ -797,6 +1130,15 @@ MlasConvertHalfToFloatBuffer(
     size_t Count
     );
 
+extern "C"
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
 //
 // Transpose routines.
 //
@@ -883,6 +1225,60 @@ MlasReorderFilterOIHWBo(
     float* D
     );
 
+void
+MLASCALL
+MlasReorderInputNchw(
+    const uint8_t* S,
+    uint8_t* D,
+    size_t InputChannels,
+    size_t InputSize
+    );
+
+void
+MLASCALL
+MlasReorderInputNhwc(
+    const uint8_t* S,
+    uint8_t* D,
+    size_t InputChannels,
+    size_t RowCount,
+    size_t FullRowCount
+    );
+
+void
+MLASCALL
+MlasReorderOutputNchw(
+    const int64_t* OutputShape,
+    const uint8_t* S,
+    uint8_t* D
+    );
+
+void
+MLASCALL
+MlasReorderOutputNhwc(
+    const int64_t* OutputShape,
+    const uint8_t* S,
+    uint8_t* D
+    );
+
+void
+MLASCALL
+MlasReorderFilterHWIO(
+    const int64_t* FilterShape,
+    size_t GroupCount,
+    const uint8_t* S,
+    uint8_t* D,
+    uint8_t FilterZeroPoint
+    );
+
+void
+MLASCALL
+MlasReorderFilterOIHWBo(
+    const int64_t* FilterShape,
+    const uint8_t* S,
+    uint8_t* D,
+    uint8_t FilterZeroPoint
+    );
+
 //
 // Single precision NCHWc routines.
 //
@@ -936,6 +1332,67 @@ MlasNchwcUpsample(
     float* Output
     );
 
+//
+// Quantized NCHWc routines.
+//
+
+void
+MLASCALL
+MlasNchwcConv(
+    const int64_t* InputShape,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* Padding,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape,
+    size_t GroupCount,
+    const uint8_t* Input,
+    uint8_t InputZeroPoint,
+    const void* Filter,
+    uint8_t FilterZeroPoint,
+    bool FilterIsSigned,
+    bool FilterIsPacked,
+    const int32_t* Bias,
+    const float* Scale,
+    bool PerChannelScale,
+    uint8_t OutputZeroPoint,
+    uint8_t* Output,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+size_t
+MLASCALL
+MlasNchwcPackFilterSize(
+    const int64_t* FilterShape,
+    size_t GroupCount,
+    bool FilterIsSigned
+    );
+
+void
+MLASCALL
+MlasNchwcPackFilter(
+    const int64_t* FilterShape,
+    size_t GroupCount,
+    const uint8_t* Filter,
+    bool FilterIsSigned,
+    void* PackedFilter
+    );
+
+void
+MLASCALL
+MlasNchwcPool(
+    MLAS_POOLING_KIND PoolingKind,
+    const int64_t* InputShape,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* Padding,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape,
+    const uint8_t* Input,
+    uint8_t* Output,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Linear quantization routines.
 //
@@ -193,6 +193,54 @@ struct MLAS_ACTIVATION_FUNCTION<MlasClipActivation>
     }
 };
 
+void
+MlasGeluKernel(
+    float* Buffer,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine applies the Gelu activation, x * 0.5 * (1 + erf(x / sqrt(2))),
+    to a row of the output matrix.
+
+Arguments:
+
+    Buffer - Supplies the row of the output matrix.
+
+    N - Supplies the number of elements of the row.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    constexpr size_t BlockSize = 256;
+    constexpr float SqrtHalf = 0.70710678118654752440f;
+
+    float ErfBuffer[BlockSize];
+
+    while (N > 0) {
+
+        const size_t CountN = std::min(N, BlockSize);
+
+        for (size_t n = 0; n < CountN; n++) {
+            ErfBuffer[n] = Buffer[n] * SqrtHalf;
+        }
+
+        MlasComputeErf(ErfBuffer, ErfBuffer, CountN);
+
+        for (size_t n = 0; n < CountN; n++) {
+            Buffer[n] = 0.5f * Buffer[n] * (1.0f + ErfBuffer[n]);
+        }
+
+        Buffer += CountN;
+        N -= CountN;
+    }
+}
+
 template<MLAS_ACTIVATION_KIND ActivationKind, bool AddBias>
 void
 MlasActivationKernel(
@@ -464,5 +512,115 @@ Return Value:
             MlasActivationKernel<MlasClipActivation>(Activation, Buffer, Bias, M, N, ldc);
             break;
         }
+
+        case MlasGeluActivation:
+        {
+            if (Bias != nullptr) {
+                MlasActivationKernel<MlasIdentityActivation, true>(Activation, Buffer, Bias, M, N, ldc);
+            }
+
+            if (N == ldc) {
+                MlasGeluKernel(Buffer, M * N);
+            } else {
+                while (M-- > 0) {
+                    MlasGeluKernel(Buffer, N);
+                    Buffer += ldc;
+                }
+            }
+
+            break;
+        }
+    }
+}
+
+void
+MLAS_SGEMM_BIAS_ACTIVATION_OUTPUT_PROCESSOR::Process(
+    float* C,
+    size_t StartM,
+    size_t StartN,
+    size_t CountM,
+    size_t CountN,
+    size_t ldc
+    ) const
+/*++
+
+Routine Description:
+
+    This routine computes C := Activation(C + Bias) + Residual for a tile of
+    the output matrix of a single precision matrix/matrix multiply.
+
+Arguments:
+
+    C - Supplies the address of the tile of the output matrix.
+
+    StartM - Supplies the start row index of the tile.
+
+    StartN - Supplies the start column index of the tile.
+
+    CountM - Supplies the number of rows of the tile.
+
+    CountN - Supplies the number of columns of the tile.
+
+    ldc - Supplies the first dimension of the output matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    //
+    // Add the bias vector, which is broadcast over the rows of the tile.
+    //
+
+    if (Bias_ != nullptr) {
+
+        const float* Bias = Bias_ + StartN;
+        float* c = C;
+
+        for (size_t m = 0; m < CountM; m++) {
+
+            size_t n = 0;
+
+            for (; n + 4 <= CountN; n += 4) {
+                MlasStoreFloat32x4(c + n, MlasAddFloat32x4(MlasLoadFloat32x4(c + n), MlasLoadFloat32x4(Bias + n)));
+            }
+
+            for (; n < CountN; n++) {
+                c[n] += Bias[n];
+            }
+
+            c += ldc;
+        }
+    }
+
+    if (Activation_ != nullptr) {
+        MlasActivation(Activation_, C, nullptr, CountM, CountN, ldc);
+    }
+
+    //
+    // Add the residual matrix.
+    //
+
+    if (Residual_ != nullptr) {
+
+        const float* Residual = Residual_ + StartM * LeadingDimensionResidual_ + StartN;
+        float* c = C;
+
+        for (size_t m = 0; m < CountM; m++) {
+
+            size_t n = 0;
+
+            for (; n + 4 <= CountN; n += 4) {
+                MlasStoreFloat32x4(c + n, MlasAddFloat32x4(MlasLoadFloat32x4(c + n), MlasLoadFloat32x4(Residual + n)));
+            }
+
+            for (; n < CountN; n++) {
+                c[n] += Residual[n];
+            }
+
+            c += ldc;
+            Residual += LeadingDimensionResidual_;
+        }
     }
 }
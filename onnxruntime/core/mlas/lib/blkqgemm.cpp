@@ -0,0 +1,633 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    blkqgemm.cpp
+
+Abstract:
+
+    This module implements the single precision matrix/matrix multiply
+    operation where matrix B is a constant that has been quantized to 4-bit or
+    8-bit integers in blocks of BlockSize elements along the K dimension. Each
+    block has its own scale and zero point.
+
+    Matrix B is never expanded in memory: each block is dequantized right
+    before it is consumed, so the memory traffic for matrix B is the size of
+    the quantized data. This is the bottleneck for the matrix/vector products
+    of token generation in decoder models.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the supported range of the block size.
+//
+
+#define MLAS_BLKQGEMM_MINIMUM_BLOCK_SIZE            16
+#define MLAS_BLKQGEMM_MAXIMUM_BLOCK_SIZE            256
+
+//
+// Define the maximum number of rows of matrix A that are multiplied by the
+// matrix/vector kernel. Larger products dequantize tiles of matrix B and use
+// the single precision GEMM kernels.
+//
+
+#define MLAS_BLKQGEMM_GEMV_MAXIMUM_M                4
+
+//
+// Define the size of the tiles of matrix B that are dequantized for the
+// matrix/matrix product.
+//
+
+#define MLAS_BLKQGEMM_STRIDEN                       128
+#define MLAS_BLKQGEMM_STRIDEK                       128
+
+//
+// Define the layout of the header at the start of the packed matrix B buffer.
+//
+// The header is followed, aligned to the preferred buffer alignment, by one
+// record per block in column major order: the scale and the zero point as
+// floats, followed by the BlockSize * Bits / 8 bytes of quantized data. For
+// 4-bit data, the low nibble of each byte holds the even element.
+//
+
+struct MLAS_BLKQGEMM_PACKED_HEADER {
+    size_t N;
+    size_t K;
+    size_t BlockSize;
+    size_t Bits;
+    size_t BlockCount;
+    size_t RecordSize;
+};
+
+MLAS_FORCEINLINE
+size_t
+MlasBlkQGemmAlignSize(
+    size_t Size
+    )
+{
+    const size_t BufferAlignment = MlasGetPreferredBufferAlignment();
+
+    return (Size + BufferAlignment - 1) & ~(BufferAlignment - 1);
+}
+
+MLAS_FORCEINLINE
+size_t
+MlasBlkQGemmRecordSize(
+    size_t BlockSize,
+    size_t Bits
+    )
+{
+    return 2 * sizeof(float) + BlockSize * Bits / 8;
+}
+
+MLAS_FORCEINLINE
+const uint8_t*
+MlasBlkQGemmGetRecord(
+    const MLAS_BLKQGEMM_PACKED_HEADER* Header,
+    size_t n,
+    size_t Block
+    )
+{
+    const uint8_t* Records = reinterpret_cast<const uint8_t*>(Header) +
+        MlasBlkQGemmAlignSize(sizeof(MLAS_BLKQGEMM_PACKED_HEADER));
+
+    return Records + (n * Header->BlockCount + Block) * Header->RecordSize;
+}
+
+void
+MlasBlkQGemmDequantizeBlock(
+    const MLAS_BLKQGEMM_PACKED_HEADER* Header,
+    const uint8_t* Record,
+    size_t StartK,
+    size_t CountK,
+    float* Output
+    )
+/*++
+
+Routine Description:
+
+    This routine dequantizes a range of elements from one block of packed
+    matrix B.
+
+Arguments:
+
+    Header - Supplies the header of the packed matrix B buffer.
+
+    Record - Supplies the address of the record of the block.
+
+    StartK - Supplies the index of the first element within the block.
+
+    CountK - Supplies the number of elements to dequantize.
+
+    Output - Supplies the address of the dequantized elements.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const float Scale = reinterpret_cast<const float*>(Record)[0];
+    const float ZeroPoint = reinterpret_cast<const float*>(Record)[1];
+    const uint8_t* Data = Record + 2 * sizeof(float);
+
+    if (Header->Bits == 4) {
+
+        //
+        // Dequantize the 16 possible values once, so that each element is
+        // a table lookup.
+        //
+
+        float Table[16];
+
+        for (size_t i = 0; i < 16; i++) {
+            Table[i] = (float(i) - ZeroPoint) * Scale;
+        }
+
+        for (size_t k = StartK; k < StartK + CountK; k++) {
+            *Output++ = Table[(Data[k / 2] >> ((k & 1) * 4)) & 0x0F];
+        }
+
+    } else {
+
+        for (size_t k = StartK; k < StartK + CountK; k++) {
+            *Output++ = (float(Data[k]) - ZeroPoint) * Scale;
+        }
+    }
+}
+
+void
+MlasBlkQGemvOperation(
+    const MLAS_BLKQGEMM_PACKED_HEADER* Header,
+    size_t M,
+    size_t StartN,
+    size_t CountN,
+    const float* A,
+    size_t lda,
+    const float* Bias,
+    float* C,
+    size_t ldc
+    )
+/*++
+
+Routine Description:
+
+    This routine computes a range of columns of matrix C for up to
+    MLAS_BLKQGEMM_GEMV_MAXIMUM_M rows of matrix A. Each block of matrix B is
+    dequantized to a buffer that stays in the L1 cache and is then multiplied
+    by every row of matrix A.
+
+Arguments:
+
+    Header - Supplies the header of the packed matrix B buffer.
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    StartN - Supplies the first column of matrix B and matrix C.
+
+    CountN - Supplies the number of columns of matrix B and matrix C.
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    Bias - Supplies the optional address of the bias vector.
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t K = Header->K;
+    const size_t BlockSize = Header->BlockSize;
+
+    MLAS_DECLSPEC_ALIGN(float BlockB[MLAS_BLKQGEMM_MAXIMUM_BLOCK_SIZE], 16 * sizeof(float));
+
+    for (size_t n = StartN; n < StartN + CountN; n++) {
+
+        MLAS_FLOAT32X4 Accumulators[MLAS_BLKQGEMM_GEMV_MAXIMUM_M];
+        float Sums[MLAS_BLKQGEMM_GEMV_MAXIMUM_M];
+
+        for (size_t m = 0; m < M; m++) {
+            Accumulators[m] = MlasZeroFloat32x4();
+            Sums[m] = 0.0f;
+        }
+
+        for (size_t k = 0, Block = 0; k < K; k += BlockSize, Block++) {
+
+            const size_t CountK = std::min(BlockSize, K - k);
+
+            MlasBlkQGemmDequantizeBlock(Header, MlasBlkQGemmGetRecord(Header, n, Block),
+                0, CountK, BlockB);
+
+            for (size_t m = 0; m < M; m++) {
+
+                const float* a = A + m * lda + k;
+                MLAS_FLOAT32X4 Accumulator = Accumulators[m];
+                size_t kk = 0;
+
+                for (; kk + 4 <= CountK; kk += 4) {
+                    Accumulator = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(a + kk),
+                        MlasLoadFloat32x4(BlockB + kk), Accumulator);
+                }
+
+                for (; kk < CountK; kk++) {
+                    Sums[m] += a[kk] * BlockB[kk];
+                }
+
+                Accumulators[m] = Accumulator;
+            }
+        }
+
+        const float BiasValue = (Bias != nullptr) ? Bias[n] : 0.0f;
+
+        for (size_t m = 0; m < M; m++) {
+            C[m * ldc + n] = MlasReduceAddFloat32x4(Accumulators[m]) + Sums[m] + BiasValue;
+        }
+    }
+}
+
+void
+MlasBlkQGemmOperation(
+    const MLAS_BLKQGEMM_PACKED_HEADER* Header,
+    size_t CountM,
+    size_t StartN,
+    size_t CountN,
+    const float* A,
+    size_t lda,
+    const float* Bias,
+    float* C,
+    size_t ldc
+    )
+/*++
+
+Routine Description:
+
+    This routine computes a range of columns of matrix C for a range of rows
+    of matrix A. Tiles of matrix B are dequantized and multiplied by the
+    single precision GEMM kernels.
+
+Arguments:
+
+    Header - Supplies the header of the packed matrix B buffer.
+
+    CountM - Supplies the number of rows of matrix A and matrix C.
+
+    StartN - Supplies the first column of matrix B and matrix C.
+
+    CountN - Supplies the number of columns of matrix B and matrix C, which
+        is at most MLAS_BLKQGEMM_STRIDEN.
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    Bias - Supplies the optional address of the bias vector.
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t K = Header->K;
+    const size_t BlockSize = Header->BlockSize;
+
+    MLAS_DECLSPEC_ALIGN(float TileB[MLAS_BLKQGEMM_STRIDEN * MLAS_BLKQGEMM_STRIDEK], 16 * sizeof(float));
+
+    for (size_t k = 0; k < K; k += MLAS_BLKQGEMM_STRIDEK) {
+
+        const size_t CountK = std::min(K - k, size_t(MLAS_BLKQGEMM_STRIDEK));
+
+        //
+        // Dequantize the tile of matrix B with each column stored
+        // contiguously, which is the transposed layout of the tile.
+        //
+
+        for (size_t n = 0; n < CountN; n++) {
+
+            float* b = TileB + n * CountK;
+            size_t kk = k;
+
+            while (kk < k + CountK) {
+
+                const size_t Block = kk / BlockSize;
+                const size_t BlockStartK = kk % BlockSize;
+                const size_t BlockCountK = std::min(BlockSize - BlockStartK, k + CountK - kk);
+
+                MlasBlkQGemmDequantizeBlock(Header, MlasBlkQGemmGetRecord(Header, StartN + n, Block),
+                    BlockStartK, BlockCountK, b);
+
+                b += BlockCountK;
+                kk += BlockCountK;
+            }
+        }
+
+        MlasSgemmOperation(CblasNoTrans, CblasTrans, CountM, CountN, CountK, 1.0f, A + k, lda,
+            TileB, CountK, (k == 0) ? 0.0f : 1.0f, C + StartN, ldc);
+    }
+
+    if (Bias != nullptr) {
+        for (size_t m = 0; m < CountM; m++) {
+            float* c = C + m * ldc;
+            for (size_t n = StartN; n < StartN + CountN; n++) {
+                c[n] += Bias[n];
+            }
+        }
+    }
+}
+
+size_t
+MLASCALL
+MlasBlkQGemmPackBSize(
+    size_t N,
+    size_t K,
+    size_t BlockSize,
+    size_t Bits
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the length in bytes for the packed blockwise
+    quantized matrix B buffer.
+
+Arguments:
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    BlockSize - Supplies the number of elements along the K dimension that
+        share a scale and a zero point. This must be a power of two between
+        16 and 256.
+
+    Bits - Supplies the number of bits of each quantized element, either 4
+        or 8.
+
+Return Value:
+
+    Returns the size in bytes for the packed matrix B buffer, or zero if the
+    block size or the number of bits is not supported.
+
+--*/
+{
+    if (N == 0 || K == 0) {
+        return 0;
+    }
+
+    if (Bits != 4 && Bits != 8) {
+        return 0;
+    }
+
+    if (BlockSize < MLAS_BLKQGEMM_MINIMUM_BLOCK_SIZE || BlockSize > MLAS_BLKQGEMM_MAXIMUM_BLOCK_SIZE ||
+        (BlockSize & (BlockSize - 1)) != 0) {
+        return 0;
+    }
+
+    const size_t BlockCount = (K + BlockSize - 1) / BlockSize;
+
+    return MlasBlkQGemmAlignSize(sizeof(MLAS_BLKQGEMM_PACKED_HEADER)) +
+        MlasBlkQGemmAlignSize(N * BlockCount * MlasBlkQGemmRecordSize(BlockSize, Bits));
+}
+
+void
+MLASCALL
+MlasBlkQGemmPackB(
+    size_t N,
+    size_t K,
+    size_t BlockSize,
+    size_t Bits,
+    const uint8_t* QuantData,
+    const float* Scales,
+    const uint8_t* ZeroPoints,
+    void* PackedB
+    )
+/*++
+
+Routine Description:
+
+    This routine packs the blockwise quantized matrix B to the destination
+    buffer. The destination buffer should be sized based on
+    MlasBlkQGemmPackBSize().
+
+Arguments:
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    BlockSize - Supplies the number of elements along the K dimension that
+        share a scale and a zero point.
+
+    Bits - Supplies the number of bits of each quantized element.
+
+    QuantData - Supplies the address of the quantized data, laid out as
+        [N, BlockCount, BlockSize * Bits / 8]. For 4-bit data, the low nibble
+        of each byte holds the even element.
+
+    Scales - Supplies the address of the scales, laid out as [N, BlockCount].
+
+    ZeroPoints - Supplies the optional address of the zero points, laid out
+        as [N, (BlockCount * Bits + 7) / 8] with 4-bit zero points packed
+        like the data. If nullptr, the zero point is 2^(Bits - 1).
+
+    PackedB - Supplies the address of packed matrix B.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockCount = (K + BlockSize - 1) / BlockSize;
+    const size_t BlobSize = BlockSize * Bits / 8;
+    const size_t ZeroPointStride = (BlockCount * Bits + 7) / 8;
+
+    auto* Header = static_cast<MLAS_BLKQGEMM_PACKED_HEADER*>(PackedB);
+
+    Header->N = N;
+    Header->K = K;
+    Header->BlockSize = BlockSize;
+    Header->Bits = Bits;
+    Header->BlockCount = BlockCount;
+    Header->RecordSize = MlasBlkQGemmRecordSize(BlockSize, Bits);
+
+    for (size_t n = 0; n < N; n++) {
+
+        for (size_t Block = 0; Block < BlockCount; Block++) {
+
+            uint8_t* Record = const_cast<uint8_t*>(MlasBlkQGemmGetRecord(Header, n, Block));
+
+            uint32_t ZeroPoint = uint32_t(1) << (Bits - 1);
+
+            if (ZeroPoints != nullptr) {
+                const uint8_t* zp = ZeroPoints + n * ZeroPointStride;
+                ZeroPoint = (Bits == 4) ? (zp[Block / 2] >> ((Block & 1) * 4)) & 0x0F : zp[Block];
+            }
+
+            reinterpret_cast<float*>(Record)[0] = Scales[n * BlockCount + Block];
+            reinterpret_cast<float*>(Record)[1] = float(ZeroPoint);
+
+            std::copy_n(QuantData + (n * BlockCount + Block) * BlobSize, BlobSize,
+                Record + 2 * sizeof(float));
+        }
+    }
+}
+
+void
+MLASCALL
+MlasBlkQGemm(
+    size_t M,
+    size_t N,
+    size_t K,
+    const float* A,
+    size_t lda,
+    const void* PackedB,
+    const float* Bias,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the single precision matrix/matrix multiply
+    operation C := A * B + Bias, where matrix B has been packed by
+    MlasBlkQGemmPackB.
+
+Arguments:
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix A and the number of rows of
+        matrix B.
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    PackedB - Supplies the address of packed matrix B.
+
+    Bias - Supplies the optional address of the bias vector of N elements.
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* Header = static_cast<const MLAS_BLKQGEMM_PACKED_HEADER*>(PackedB);
+
+    MLAS_UNREFERENCED_PARAMETER(K);
+
+    if (M == 0 || N == 0) {
+        return;
+    }
+
+    //
+    // Compute the number of target threads given the complexity of the
+    // operation.
+    //
+
+    const double Complexity = double(M) * double(N) * double(Header->K);
+
+    ptrdiff_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MlasPlatform.MaximumThreadCount)) {
+        TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MlasPlatform.MaximumThreadCount;
+    }
+
+    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    if (M <= MLAS_BLKQGEMM_GEMV_MAXIMUM_M) {
+
+        //
+        // Each thread computes a contiguous range of columns, so that every
+        // block of matrix B is read and dequantized exactly once.
+        //
+
+        if (size_t(TargetThreadCount) > N) {
+            TargetThreadCount = ptrdiff_t(N);
+        }
+
+        MlasTrySimpleParallel(ThreadPool, TargetThreadCount, [&](ptrdiff_t ThreadId) {
+
+            size_t StartN;
+            size_t CountN;
+
+            MlasPartitionWork(ThreadId, TargetThreadCount, N, &StartN, &CountN);
+
+            MlasBlkQGemvOperation(Header, M, StartN, CountN, A, lda, Bias, C, ldc);
+        });
+
+        return;
+    }
+
+    //
+    // Each thread computes a contiguous range of rows from a panel of
+    // columns, so that a dequantized tile of matrix B is reused by all of the
+    // rows.
+    //
+
+    const size_t PanelCount = (N + MLAS_BLKQGEMM_STRIDEN - 1) / MLAS_BLKQGEMM_STRIDEN;
+    const size_t WorkItems = M * PanelCount;
+
+    if (size_t(TargetThreadCount) > WorkItems) {
+        TargetThreadCount = ptrdiff_t(WorkItems);
+    }
+
+    MlasTrySimpleParallel(ThreadPool, TargetThreadCount, [&](ptrdiff_t ThreadId) {
+
+        size_t WorkIndex;
+        size_t WorkRemaining;
+
+        MlasPartitionWork(ThreadId, TargetThreadCount, WorkItems, &WorkIndex, &WorkRemaining);
+
+        while (WorkRemaining > 0) {
+
+            const size_t Panel = WorkIndex / M;
+            const size_t StartM = WorkIndex % M;
+            const size_t CountM = std::min(M - StartM, WorkRemaining);
+            const size_t StartN = Panel * MLAS_BLKQGEMM_STRIDEN;
+            const size_t CountN = std::min(N - StartN, size_t(MLAS_BLKQGEMM_STRIDEN));
+
+            MlasBlkQGemmOperation(Header, CountM, StartN, CountN, A + StartM * lda, lda,
+                Bias, C + StartM * ldc, ldc);
+
+            WorkIndex += CountM;
+            WorkRemaining -= CountM;
+        }
+    });
+}
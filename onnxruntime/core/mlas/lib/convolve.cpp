@@ -818,6 +818,599 @@ Return Value:
     return true;
 }
 
+//
+// Define the minimum number of input channels and filters per group for the
+// Winograd algorithm to be profitable. The transforms add a fixed cost per
+// channel and per filter for each tile, which is only amortized when the
+// per-transform GEMMs are large enough.
+//
+
+#define MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS     16
+
+//
+// Define the maximum number of tiles along a row of the output image that are
+// processed by a single work item of the Winograd algorithm.
+//
+
+#define MLAS_CONV_WINOGRAD_MAXIMUM_TILE_BLOCK   32
+
+MLAS_FORCEINLINE
+bool
+MlasConvWinogradIsProfitable(
+    size_t InputChannels,
+    size_t FilterCount
+    )
+{
+    return InputChannels >= MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS &&
+        FilterCount >= MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS;
+}
+
+MLAS_FORCEINLINE
+bool
+MlasConvWinogradIsEligible(
+    size_t KernelHeight,
+    size_t KernelWidth,
+    size_t OutputHeight,
+    size_t OutputWidth,
+    size_t InputChannels,
+    size_t FilterCount
+    )
+{
+    return KernelHeight == 3 && KernelWidth == 3 && OutputHeight >= 4 && OutputWidth >= 4 &&
+        MlasConvWinogradIsProfitable(InputChannels, FilterCount);
+}
+
+bool
+MLASCALL
+MlasConvWinogradIsSelected(
+    size_t Dimensions,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape,
+    size_t InputChannels,
+    size_t FilterCount
+    )
+/*++
+
+Routine Description:
+
+    This routine determines whether MlasConvPrepare selects the Winograd
+    algorithm for a convolution when the algorithm is allowed. This lets
+    graph transformers avoid rewriting such a convolution to a format that
+    does not implement the algorithm.
+
+Arguments:
+
+    Dimensions - Supplies the number of dimensions.
+
+    KernelShape - Supplies the shape of the kernel transform.
+
+    DilationShape - Supplies the shape of the dilation.
+
+    StrideShape - Supplies the shape of the stride.
+
+    OutputShape - Supplies the shape of the output tensor.
+
+    InputChannels - Supplies the number of input channels per group.
+
+    FilterCount - Supplies the number of output channels per group.
+
+Return Value:
+
+    Returns true if the Winograd algorithm is selected.
+
+--*/
+{
+    if (Dimensions != 2) {
+        return false;
+    }
+
+    for (size_t dim = 0; dim < Dimensions; dim++) {
+        if (StrideShape[dim] != 1 || DilationShape[dim] != 1) {
+            return false;
+        }
+    }
+
+    return MlasConvWinogradIsEligible(size_t(KernelShape[0]), size_t(KernelShape[1]),
+        size_t(OutputShape[0]), size_t(OutputShape[1]), InputChannels, FilterCount);
+}
+
+//
+// Winograd minimal filtering transforms for F(2x2, 3x3) and F(4x4, 3x3).
+//
+// Each structure supplies the one dimensional input (B^T), filter (G) and
+// output (A^T) transforms. The two dimensional transforms are built by
+// applying these to the columns and then the rows of a tile.
+//
+
+template<size_t TileSize>
+struct MLAS_CONV_WINOGRAD_TRANSFORM;
+
+template<>
+struct MLAS_CONV_WINOGRAD_TRANSFORM<2>
+{
+    static constexpr size_t Alpha = 4;
+
+    MLAS_FORCEINLINE
+    static
+    void
+    Input(
+        const float* d,
+        size_t ldd,
+        float* r,
+        size_t ldr
+        )
+    {
+        const float d0 = d[0 * ldd];
+        const float d1 = d[1 * ldd];
+        const float d2 = d[2 * ldd];
+        const float d3 = d[3 * ldd];
+
+        r[0 * ldr] = d0 - d2;
+        r[1 * ldr] = d1 + d2;
+        r[2 * ldr] = d2 - d1;
+        r[3 * ldr] = d1 - d3;
+    }
+
+    MLAS_FORCEINLINE
+    static
+    void
+    Filter(
+        const float* g,
+        size_t ldg,
+        float* u,
+        size_t ldu
+        )
+    {
+        const float g0 = g[0 * ldg];
+        const float g1 = g[1 * ldg];
+        const float g2 = g[2 * ldg];
+
+        u[0 * ldu] = g0;
+        u[1 * ldu] = 0.5f * (g0 + g1 + g2);
+        u[2 * ldu] = 0.5f * (g0 - g1 + g2);
+        u[3 * ldu] = g2;
+    }
+
+    MLAS_FORCEINLINE
+    static
+    void
+    Output(
+        const float* m,
+        size_t ldm,
+        float* y,
+        size_t ldy
+        )
+    {
+        const float m0 = m[0 * ldm];
+        const float m1 = m[1 * ldm];
+        const float m2 = m[2 * ldm];
+        const float m3 = m[3 * ldm];
+
+        y[0 * ldy] = m0 + m1 + m2;
+        y[1 * ldy] = m1 - m2 - m3;
+    }
+};
+
+template<>
+struct MLAS_CONV_WINOGRAD_TRANSFORM<4>
+{
+    static constexpr size_t Alpha = 6;
+
+    MLAS_FORCEINLINE
+    static
+    void
+    Input(
+        const float* d,
+        size_t ldd,
+        float* r,
+        size_t ldr
+        )
+    {
+        const float d0 = d[0 * ldd];
+        const float d1 = d[1 * ldd];
+        const float d2 = d[2 * ldd];
+        const float d3 = d[3 * ldd];
+        const float d4 = d[4 * ldd];
+        const float d5 = d[5 * ldd];
+
+        const float t0 = d4 - 4.0f * d2;
+        const float t1 = d3 - 4.0f * d1;
+        const float t2 = d4 - d2;
+        const float t3 = 2.0f * (d3 - d1);
+
+        r[0 * ldr] = 4.0f * d0 - 5.0f * d2 + d4;
+        r[1 * ldr] = t0 + t1;
+        r[2 * ldr] = t0 - t1;
+        r[3 * ldr] = t2 + t3;
+        r[4 * ldr] = t2 - t3;
+        r[5 * ldr] = 4.0f * d1 - 5.0f * d3 + d5;
+    }
+
+    MLAS_FORCEINLINE
+    static
+    void
+    Filter(
+        const float* g,
+        size_t ldg,
+        float* u,
+        size_t ldu
+        )
+    {
+        const float g0 = g[0 * ldg];
+        const float g1 = g[1 * ldg];
+        const float g2 = g[2 * ldg];
+
+        u[0 * ldu] = g0 * (1.0f / 4.0f);
+        u[1 * ldu] = (g0 + g1 + g2) * (-1.0f / 6.0f);
+        u[2 * ldu] = (g0 - g1 + g2) * (-1.0f / 6.0f);
+        u[3 * ldu] = g0 * (1.0f / 24.0f) + g1 * (1.0f / 12.0f) + g2 * (1.0f / 6.0f);
+        u[4 * ldu] = g0 * (1.0f / 24.0f) - g1 * (1.0f / 12.0f) + g2 * (1.0f / 6.0f);
+        u[5 * ldu] = g2;
+    }
+
+    MLAS_FORCEINLINE
+    static
+    void
+    Output(
+        const float* m,
+        size_t ldm,
+        float* y,
+        size_t ldy
+        )
+    {
+        const float m0 = m[0 * ldm];
+        const float m1 = m[1 * ldm];
+        const float m2 = m[2 * ldm];
+        const float m3 = m[3 * ldm];
+        const float m4 = m[4 * ldm];
+        const float m5 = m[5 * ldm];
+
+        const float s12 = m1 + m2;
+        const float d12 = m1 - m2;
+        const float s34 = m3 + m4;
+        const float d34 = m3 - m4;
+
+        y[0 * ldy] = m0 + s12 + s34;
+        y[1 * ldy] = d12 + 2.0f * d34;
+        y[2 * ldy] = s12 + 4.0f * s34;
+        y[3 * ldy] = d12 + 8.0f * d34 + m5;
+    }
+};
+
+template<size_t TileSize>
+void
+MlasConvWinogradPackFilterGroup(
+    size_t FilterCount,
+    size_t InputChannels,
+    const float* Filter,
+    float* PackedFilter
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms the 3x3 filters of a single group to the Winograd
+    domain.
+
+Arguments:
+
+    FilterCount - Supplies the number of filters of the group.
+
+    InputChannels - Supplies the number of input channels of the group.
+
+    Filter - Supplies the filter tensor of the group.
+
+    PackedFilter - Supplies the buffer that receives the transformed filters,
+        stored as Alpha*Alpha matrices of FilterCount rows by InputChannels
+        columns.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    using Transform = MLAS_CONV_WINOGRAD_TRANSFORM<TileSize>;
+    constexpr size_t Alpha = Transform::Alpha;
+
+    const size_t Stride = FilterCount * InputChannels;
+
+    for (size_t f = 0; f < FilterCount; f++) {
+
+        for (size_t c = 0; c < InputChannels; c++) {
+
+            const float* g = Filter + (f * InputChannels + c) * 9;
+            float* u = PackedFilter + f * InputChannels + c;
+
+            //
+            // Compute U = G * g * G^T.
+            //
+
+            float Temp[Alpha * 3];
+
+            for (size_t j = 0; j < 3; j++) {
+                Transform::Filter(g + j, 3, Temp + j, 3);
+            }
+
+            for (size_t i = 0; i < Alpha; i++) {
+                Transform::Filter(Temp + i * 3, 1, u + i * Alpha * Stride, Stride);
+            }
+        }
+    }
+}
+
+template<size_t TileSize>
+void
+MlasConvWinogradOperation(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* PackedFilter,
+    const float* Bias,
+    float* WorkingBuffer,
+    float* Output,
+    size_t TileRow,
+    size_t TileColumnStart,
+    size_t TileColumnCount
+    )
+/*++
+
+Routine Description:
+
+    This routine computes a strip of output tiles for a single batch and group
+    of a convolution using the Winograd algorithm.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input tensor of the batch and group.
+
+    PackedFilter - Supplies the filters of the group packed by
+        MlasConvWinogradPackFilter.
+
+    Bias - Optionally supplies the bias vector of the group.
+
+    WorkingBuffer - Supplies a working buffer for the transformed input and
+        output tiles.
+
+    Output - Supplies the output tensor of the batch and group.
+
+    TileRow - Supplies the row of output tiles to compute.
+
+    TileColumnStart - Supplies the first column of output tiles to compute.
+
+    TileColumnCount - Supplies the number of columns of output tiles to
+        compute.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    using Transform = MLAS_CONV_WINOGRAD_TRANSFORM<TileSize>;
+    constexpr size_t Alpha = Transform::Alpha;
+
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t InputHeight = Parameters->InputShape[0];
+    const size_t InputWidth = Parameters->InputShape[1];
+    const size_t OutputHeight = Parameters->OutputShape[0];
+    const size_t OutputWidth = Parameters->OutputShape[1];
+    const size_t InputSize = Parameters->InputSize;
+    const size_t OutputSize = Parameters->OutputSize;
+
+    const size_t InputStride = InputChannels * TileColumnCount;
+    const size_t OutputStride = FilterCount * TileColumnCount;
+
+    float* TransformedInput = WorkingBuffer;
+    float* TransformedOutput = WorkingBuffer + Alpha * Alpha * InputStride;
+
+    //
+    // Transform the input tiles: V = B^T * d * B. Tiles that overlap the
+    // padding are first copied to a local buffer.
+    //
+
+    const size_t ih = TileRow * TileSize - Parameters->Padding[0];
+
+    for (size_t c = 0; c < InputChannels; c++) {
+
+        const float* input = Input + c * InputSize;
+
+        for (size_t t = 0; t < TileColumnCount; t++) {
+
+            const size_t iw = (TileColumnStart + t) * TileSize - Parameters->Padding[1];
+
+            const float* d;
+            size_t ldd;
+            float Patch[Alpha * Alpha];
+
+            if (ih < InputHeight && ih + Alpha <= InputHeight &&
+                iw < InputWidth && iw + Alpha <= InputWidth) {
+
+                d = input + ih * InputWidth + iw;
+                ldd = InputWidth;
+
+            } else {
+
+                for (size_t i = 0; i < Alpha; i++) {
+                    for (size_t j = 0; j < Alpha; j++) {
+                        Patch[i * Alpha + j] = ((ih + i) < InputHeight && (iw + j) < InputWidth) ?
+                            input[(ih + i) * InputWidth + (iw + j)] : 0.0f;
+                    }
+                }
+
+                d = Patch;
+                ldd = Alpha;
+            }
+
+            float Temp[Alpha * Alpha];
+
+            for (size_t j = 0; j < Alpha; j++) {
+                Transform::Input(d + j, ldd, Temp + j, Alpha);
+            }
+
+            float* v = TransformedInput + c * TileColumnCount + t;
+
+            for (size_t i = 0; i < Alpha; i++) {
+                Transform::Input(Temp + i * Alpha, 1, v + i * Alpha * InputStride, InputStride);
+            }
+        }
+    }
+
+    //
+    // Multiply each transformed filter matrix by the matching transformed
+    // input matrix.
+    //
+
+    for (size_t e = 0; e < Alpha * Alpha; e++) {
+
+        MlasSgemmOperation(CblasNoTrans, CblasNoTrans, FilterCount, TileColumnCount,
+            InputChannels, 1.0f, PackedFilter + e * FilterCount * InputChannels,
+            InputChannels, TransformedInput + e * InputStride, TileColumnCount, 0.0f,
+            TransformedOutput + e * OutputStride, TileColumnCount);
+    }
+
+    //
+    // Transform the output tiles: Y = A^T * M * A, clipping the tiles at the
+    // edges of the output image.
+    //
+
+    const size_t oh = TileRow * TileSize;
+    const size_t ow = TileColumnStart * TileSize;
+    const size_t CountH = std::min(TileSize, OutputHeight - oh);
+    const size_t CountW = std::min(TileColumnCount * TileSize, OutputWidth - ow);
+
+    for (size_t f = 0; f < FilterCount; f++) {
+
+        float* output = Output + f * OutputSize + oh * OutputWidth + ow;
+
+        for (size_t t = 0; t < TileColumnCount; t++) {
+
+            const float* m = TransformedOutput + f * TileColumnCount + t;
+
+            float Temp[TileSize * Alpha];
+            float y[TileSize * TileSize];
+
+            for (size_t j = 0; j < Alpha; j++) {
+                Transform::Output(m + j * OutputStride, Alpha * OutputStride, Temp + j, Alpha);
+            }
+
+            for (size_t i = 0; i < TileSize; i++) {
+                Transform::Output(Temp + i * Alpha, 1, y + i * TileSize, 1);
+            }
+
+            const size_t TileCountW = std::min(TileSize, CountW - t * TileSize);
+
+            for (size_t i = 0; i < CountH; i++) {
+                for (size_t j = 0; j < TileCountW; j++) {
+                    output[i * OutputWidth + t * TileSize + j] = y[i * TileSize + j];
+                }
+            }
+        }
+    }
+
+    //
+    // Apply the activation with optional bias to each row of the strip.
+    //
+
+    for (size_t i = 0; i < CountH; i++) {
+        MlasActivation(Parameters->Activation, Output + (oh + i) * OutputWidth + ow,
+            Bias, FilterCount, CountW, OutputSize);
+    }
+}
+
+void
+MlasConvWinogradThreaded(
+    void* Context,
+    ptrdiff_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    convolution operation using the Winograd algorithm.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    Index - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_CONV_WORK_BLOCK* WorkBlock = (MLAS_CONV_WORK_BLOCK*)Context;
+
+    const MLAS_CONV_PARAMETERS* Parameters = WorkBlock->Parameters;
+
+    const size_t TileSize = Parameters->u.Winograd.TileSize;
+    const size_t TileCountH = Parameters->u.Winograd.TileCountH;
+    const size_t TileCountW = Parameters->u.Winograd.TileCountW;
+    const size_t TileBlockW = Parameters->u.Winograd.TileBlockW;
+    const size_t BlockCountW = (TileCountW + TileBlockW - 1) / TileBlockW;
+    const size_t Alpha = TileSize + 2;
+
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t GroupCount = Parameters->GroupCount;
+
+    const size_t InputGroupSize = InputChannels * Parameters->InputSize;
+    const size_t OutputGroupSize = FilterCount * Parameters->OutputSize;
+    const size_t FilterGroupSize = Alpha * Alpha * FilterCount * InputChannels;
+
+    //
+    // Compute the range of work items to use for this thread. Each work item
+    // is a strip of up to TileBlockW tiles along a row of tiles.
+    //
+
+    const size_t WorkItemsPerImage = TileCountH * BlockCountW;
+    const size_t TotalWorkItems = Parameters->BatchCount * GroupCount * WorkItemsPerImage;
+
+    size_t WorkItemStart;
+    size_t WorkItemRemaining;
+
+    MlasPartitionWork(Index, WorkBlock->TargetThreadCount, TotalWorkItems,
+        &WorkItemStart, &WorkItemRemaining);
+
+    float* WorkingBuffer = WorkBlock->WorkingBuffer +
+        Index * Alpha * Alpha * (InputChannels + FilterCount) * TileBlockW;
+
+    for (size_t WorkItem = WorkItemStart; WorkItem < WorkItemStart + WorkItemRemaining; WorkItem++) {
+
+        const size_t bg = WorkItem / WorkItemsPerImage;
+        const size_t group = bg % GroupCount;
+        const size_t TileRow = (WorkItem % WorkItemsPerImage) / BlockCountW;
+        const size_t TileColumnStart = ((WorkItem % WorkItemsPerImage) % BlockCountW) * TileBlockW;
+        const size_t TileColumnCount = std::min(TileBlockW, TileCountW - TileColumnStart);
+
+        const float* input = WorkBlock->Input + bg * InputGroupSize;
+        const float* filter = WorkBlock->Filter + group * FilterGroupSize;
+        float* output = WorkBlock->Output + bg * OutputGroupSize;
+
+        const float* bias = WorkBlock->Bias;
+
+        if (bias != nullptr) {
+            bias += group * FilterCount;
+        }
+
+        if (TileSize == 4) {
+            MlasConvWinogradOperation<4>(Parameters, input, filter, bias, WorkingBuffer,
+                output, TileRow, TileColumnStart, TileColumnCount);
+        } else {
+            MlasConvWinogradOperation<2>(Parameters, input, filter, bias, WorkingBuffer,
+                output, TileRow, TileColumnStart, TileColumnCount);
+        }
+    }
+}
+
 void
 MLASCALL
 MlasConv(
@@ -842,7 +1435,8 @@ Arguments:
 
     Input - Supplies the input tensor.
 
-    Filter - Supplies the filter tensor.
+    Filter - Supplies the filter tensor. For MlasConvAlgorithmWinograd, this
+        is the filter tensor packed by MlasConvWinogradPackFilter.
 
     Bias - Optionally supplies the bias vector.
 
@@ -873,6 +1467,27 @@ Return Value:
 
     const MLAS_CONV_ALGORITHM Algorithm = Parameters->Algorithm;
 
+    //
+    // Schedule strips of Winograd tiles across multiple threads.
+    //
+
+    if (Algorithm == MlasConvAlgorithmWinograd) {
+
+        MLAS_CONV_WORK_BLOCK WorkBlock;
+
+        WorkBlock.Parameters = Parameters;
+        WorkBlock.Input = Input;
+        WorkBlock.Filter = Filter;
+        WorkBlock.Bias = Bias;
+        WorkBlock.WorkingBuffer = WorkingBuffer;
+        WorkBlock.Output = Output;
+        WorkBlock.TargetThreadCount = Parameters->ThreadCount;
+
+        MlasExecuteThreaded(MlasConvWinogradThreaded, &WorkBlock, Parameters->ThreadCount, ThreadPool);
+
+        return;
+    }
+
     //
     // Schedule batches of GEMMs across multiple threads.
     //
@@ -1000,6 +1615,15 @@ Return Value:
 
                     break;
                 }
+
+                case MlasConvAlgorithmWinograd:
+                {
+                    //
+                    // Handled above for all batches and groups.
+                    //
+
+                    break;
+                }
             }
 
             //
@@ -1034,7 +1658,8 @@ MlasConvPrepare(
     size_t FilterCount,
     const MLAS_ACTIVATION* Activation,
     size_t* WorkingBufferSize,
-    MLAS_THREADPOOL* ThreadPool
+    MLAS_THREADPOOL* ThreadPool,
+    bool AllowWinograd
     )
 /*++
 
@@ -1081,6 +1706,11 @@ Arguments:
     ThreadPool - Supplies the thread pool object to use, else nullptr if the
         base library threading support should be used.
 
+    AllowWinograd - Supplies true if the Winograd algorithm may be selected.
+        The caller must then pack the filter with MlasConvWinogradPackFilter
+        if the algorithm is selected. The Winograd algorithm does not produce
+        results that are bitwise identical to the other algorithms.
+
 Return Value:
 
     None.
@@ -1203,6 +1833,66 @@ Return Value:
         }
     }
 
+    //
+    // Use the Winograd algorithm for 3x3 convolutions with unit strides and
+    // dilations if the channel counts are large enough to amortize the cost of
+    // the transforms.
+    //
+
+    if (AllowWinograd && Dimensions == 2 && AllStridesAreOne && AllDilationsAreOne &&
+        MlasConvWinogradIsEligible(Parameters->KernelShape[0], Parameters->KernelShape[1],
+            Parameters->OutputShape[0], Parameters->OutputShape[1], InputChannels, FilterCount)) {
+
+        //
+        // Use the larger F(4x4, 3x3) tiles unless the output image is too
+        // small to fill them.
+        //
+
+        const size_t TileSize =
+            (Parameters->OutputShape[0] >= 8 && Parameters->OutputShape[1] >= 8) ? 4 : 2;
+        const size_t Alpha = TileSize + 2;
+
+        const size_t TileCountH = (Parameters->OutputShape[0] + TileSize - 1) / TileSize;
+        const size_t TileCountW = (Parameters->OutputShape[1] + TileSize - 1) / TileSize;
+        const size_t BlockCountW = (TileCountW + MLAS_CONV_WINOGRAD_MAXIMUM_TILE_BLOCK - 1) /
+            MLAS_CONV_WINOGRAD_MAXIMUM_TILE_BLOCK;
+        const size_t TileBlockW = (TileCountW + BlockCountW - 1) / BlockCountW;
+
+        const size_t TotalWorkItems = BatchCount * GroupCount * TileCountH * BlockCountW;
+
+        ptrdiff_t TargetThreadCount;
+        double Complexity = double(BatchCount * GroupCount) * double(FilterCount) *
+            double(OutputSize) * double(K);
+
+        if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MLAS_MAXIMUM_THREAD_COUNT)) {
+            TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+        } else {
+            TargetThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
+        }
+
+        ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+        if (TargetThreadCount >= MaximumThreadCount) {
+            TargetThreadCount = MaximumThreadCount;
+        }
+
+        if (size_t(TargetThreadCount) > TotalWorkItems) {
+            TargetThreadCount = ptrdiff_t(TotalWorkItems);
+        }
+
+        Parameters->ThreadCount = TargetThreadCount;
+
+        Parameters->Algorithm = MlasConvAlgorithmWinograd;
+        Parameters->u.Winograd.TileSize = TileSize;
+        Parameters->u.Winograd.TileCountH = TileCountH;
+        Parameters->u.Winograd.TileCountW = TileCountW;
+        Parameters->u.Winograd.TileBlockW = TileBlockW;
+
+        *WorkingBufferSize = TargetThreadCount * Alpha * Alpha * (InputChannels + FilterCount) * TileBlockW;
+
+        return;
+    }
+
     if (FilterCount > OutputSize) {
 
         //
@@ -1289,3 +1979,101 @@ Return Value:
         *WorkingBufferSize = TargetThreadCount * MLAS_CONV_WORKING_BUFFER_SIZE_PER_THREAD;
     }
 }
+
+size_t
+MLASCALL
+MlasConvWinogradPackFilterSize(
+    size_t TileSize,
+    size_t GroupCount,
+    size_t FilterCount,
+    size_t InputChannels
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the number of elements required to pack the 3x3
+    filters of a convolution for the Winograd algorithm.
+
+Arguments:
+
+    TileSize - Supplies the output tile size of the Winograd algorithm, which
+        is the TileSize computed by MlasConvPrepare.
+
+    GroupCount - Supplies the number of channel groups.
+
+    FilterCount - Supplies the number of filters per group.
+
+    InputChannels - Supplies the number of input channels per group.
+
+Return Value:
+
+    Returns the number of elements required to pack the filters, else zero
+    if the Winograd algorithm is not used for these parameters.
+
+--*/
+{
+    if ((TileSize != 2 && TileSize != 4) ||
+        !MlasConvWinogradIsProfitable(InputChannels, FilterCount)) {
+        return 0;
+    }
+
+    const size_t Alpha = TileSize + 2;
+
+    return GroupCount * Alpha * Alpha * FilterCount * InputChannels;
+}
+
+void
+MLASCALL
+MlasConvWinogradPackFilter(
+    size_t TileSize,
+    size_t GroupCount,
+    size_t FilterCount,
+    size_t InputChannels,
+    const float* Filter,
+    float* PackedFilter
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms the 3x3 filters of a convolution to the Winograd
+    domain for use by MlasConv.
+
+Arguments:
+
+    TileSize - Supplies the output tile size of the Winograd algorithm, which
+        is the TileSize computed by MlasConvPrepare.
+
+    GroupCount - Supplies the number of channel groups.
+
+    FilterCount - Supplies the number of filters per group.
+
+    InputChannels - Supplies the number of input channels per group.
+
+    Filter - Supplies the filter tensor.
+
+    PackedFilter - Supplies the buffer that receives the packed filters. The
+        buffer must hold the number of elements returned by
+        MlasConvWinogradPackFilterSize.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t Alpha = TileSize + 2;
+
+    for (size_t group = 0; group < GroupCount; group++) {
+
+        if (TileSize == 4) {
+            MlasConvWinogradPackFilterGroup<4>(FilterCount, InputChannels, Filter, PackedFilter);
+        } else {
+            MlasConvWinogradPackFilterGroup<2>(FilterCount, InputChannels, Filter, PackedFilter);
+        }
+
+        Filter += FilterCount * InputChannels * 9;
+        PackedFilter += Alpha * Alpha * FilterCount * InputChannels;
+    }
+}
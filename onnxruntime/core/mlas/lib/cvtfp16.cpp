@@ -0,0 +1,287 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    cvtfp16.cpp
+
+Abstract:
+
+    This module implements routines to convert between buffers of half
+    precision and single precision floating point values.
+
+    The portable kernels operate on the IEEE bit patterns directly and round
+    to nearest even, matching the behavior of the F16C instructions.
+
+--*/
+
+#include "mlasi.h"
+
+MLAS_FORCEINLINE
+float
+MlasHalfToFloat(
+    unsigned short HalfValue
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a half precision value to single precision.
+
+Arguments:
+
+    HalfValue - Supplies the bit pattern of the half precision value.
+
+Return Value:
+
+    Returns the single precision value.
+
+--*/
+{
+    const uint32_t ShiftedExponent = 0x7C00 << 13;
+
+    uint32_t Bits = (uint32_t(HalfValue) & 0x7FFF) << 13;
+    const uint32_t Exponent = Bits & ShiftedExponent;
+
+    Bits += (127 - 15) << 23;
+
+    float FloatValue;
+
+    if (Exponent == ShiftedExponent) {
+
+        //
+        // Infinity or NaN: extend the exponent to all ones.
+        //
+
+        FloatValue = MlasFp32FromBits(Bits + ((128 - 16) << 23));
+
+    } else if (Exponent == 0) {
+
+        //
+        // Zero or denormal: renormalize using the floating point unit.
+        //
+
+        FloatValue = MlasFp32FromBits(Bits + (1 << 23)) - MlasFp32FromBits(113 << 23);
+
+    } else {
+
+        FloatValue = MlasFp32FromBits(Bits);
+    }
+
+    return MlasFp32FromBits(MlasBitsOfFp32(FloatValue) | ((uint32_t(HalfValue) & 0x8000) << 16));
+}
+
+MLAS_FORCEINLINE
+unsigned short
+MlasFloatToHalf(
+    float FloatValue
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a single precision value to half precision using
+    round to nearest even.
+
+Arguments:
+
+    FloatValue - Supplies the single precision value.
+
+Return Value:
+
+    Returns the bit pattern of the half precision value.
+
+--*/
+{
+    const uint32_t Float32Infinity = 255 << 23;
+    const uint32_t Float16Maximum = (127 + 16) << 23;
+    const uint32_t DenormalMagic = ((127 - 15) + (23 - 10) + 1) << 23;
+
+    uint32_t Bits = MlasBitsOfFp32(FloatValue);
+    const uint32_t Sign = Bits & 0x80000000;
+
+    Bits ^= Sign;
+
+    uint32_t HalfValue;
+
+    if (Bits >= Float16Maximum) {
+
+        //
+        // Overflow to infinity, or propagate NaN as a quiet NaN.
+        //
+
+        HalfValue = (Bits > Float32Infinity) ? 0x7E00 : 0x7C00;
+
+    } else if (Bits < (113 << 23)) {
+
+        //
+        // Denormal or zero: let the floating point unit align and round the
+        // mantissa.
+        //
+
+        float Value = MlasFp32FromBits(Bits) + MlasFp32FromBits(DenormalMagic);
+        HalfValue = MlasBitsOfFp32(Value) - DenormalMagic;
+
+    } else {
+
+        const uint32_t MantissaOdd = (Bits >> 13) & 1;
+
+        Bits -= (127 - 15) << 23;
+        Bits += 0xFFF;
+        Bits += MantissaOdd;
+        HalfValue = Bits >> 13;
+    }
+
+    return (unsigned short)(HalfValue | (Sign >> 16));
+}
+
+void
+MLASCALL
+MlasConvertHalfToFloatKernel(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the generic kernel to convert a buffer of half
+    precision values to single precision.
+
+Arguments:
+
+    Source - Supplies the address of the half precision buffer.
+
+    Destination - Supplies the address of the single precision buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    for (size_t i = 0; i < Count; i++) {
+        Destination[i] = MlasHalfToFloat(Source[i]);
+    }
+}
+
+void
+MLASCALL
+MlasConvertFloatToHalfKernel(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the generic kernel to convert a buffer of single
+    precision values to half precision.
+
+Arguments:
+
+    Source - Supplies the address of the single precision buffer.
+
+    Destination - Supplies the address of the half precision buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    for (size_t i = 0; i < Count; i++) {
+        Destination[i] = MlasFloatToHalf(Source[i]);
+    }
+}
+
+//
+// The Windows x64 build supplies an assembly implementation of this routine.
+//
+
+#if !(defined(_WIN32) && defined(MLAS_TARGET_AMD64))
+
+void
+MLASCALL
+MlasConvertHalfToFloatBuffer(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of half precision floats to the
+    destination buffer of single precision floats.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer of half precision
+        floats.
+
+    Destination - Supplies the address of the destination buffer of single
+        precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_TARGET_AMD64)
+    MlasPlatform.ConvertHalfToFloatKernel(Source, Destination, Count);
+#else
+    MlasConvertHalfToFloatKernel(Source, Destination, Count);
+#endif
+}
+
+#endif
+
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of single precision floats to the
+    destination buffer of half precision floats using round to nearest even.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer of single precision
+        floats.
+
+    Destination - Supplies the address of the destination buffer of half
+        precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_TARGET_AMD64)
+    MlasPlatform.ConvertFloatToHalfKernel(Source, Destination, Count);
+#else
+    MlasConvertFloatToHalfKernel(Source, Destination, Count);
+#endif
+}
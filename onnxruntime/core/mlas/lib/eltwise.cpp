@@ -0,0 +1,427 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    eltwise.cpp
+
+Abstract:
+
+    This module implements routines to compute binary element-wise operations
+    with broadcasting.
+
+    The caller describes the broadcast as a sequence of output rows where each
+    input row is either a vector or a single broadcast value and successive
+    input rows advance by a fixed stride. This covers element-wise, scalar,
+    row broadcast, and column broadcast patterns with a single call, so the
+    kernels process long contiguous runs instead of being dispatched per span.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the vector access helpers for each element type. Element types
+// without vector support use a vector width of one so that the kernels below
+// reduce to a scalar loop that the compiler is free to vectorize.
+//
+
+struct MLAS_ELTWISE_FLOAT32_VECTOR {
+
+    typedef float ElementType;
+    typedef MLAS_FLOAT32X4 VectorType;
+
+    static constexpr size_t VectorWidth = 4;
+
+    static VectorType Load(const float* Buffer) { return MlasLoadFloat32x4(Buffer); }
+
+    static void Store(float* Buffer, VectorType Vector) { MlasStoreFloat32x4(Buffer, Vector); }
+
+    static VectorType Broadcast(float Value) { return MlasBroadcastFloat32x4(Value); }
+};
+
+struct MLAS_ELTWISE_INT32_VECTOR {
+
+    typedef int32_t ElementType;
+    typedef MLAS_INT32X4 VectorType;
+
+    static constexpr size_t VectorWidth = 4;
+
+    static VectorType Load(const int32_t* Buffer) { return MlasLoadInt32x4(Buffer); }
+
+    static void Store(int32_t* Buffer, VectorType Vector) { MlasStoreInt32x4(Buffer, Vector); }
+
+    static VectorType Broadcast(int32_t Value) { return MlasBroadcastInt32x4(Value); }
+};
+
+template<typename T>
+struct MLAS_ELTWISE_SCALAR_VECTOR {
+
+    typedef T ElementType;
+    typedef T VectorType;
+
+    static constexpr size_t VectorWidth = 1;
+
+    static VectorType Load(const T* Buffer) { return *Buffer; }
+
+    static void Store(T* Buffer, VectorType Vector) { *Buffer = Vector; }
+
+    static VectorType Broadcast(T Value) { return Value; }
+};
+
+//
+// Define the binary operations.
+//
+
+template<typename T>
+struct MLAS_ELTWISE_SCALAR_ADD : MLAS_ELTWISE_SCALAR_VECTOR<T> {
+    static T Apply(T a, T b) { return a + b; }
+};
+
+template<typename T>
+struct MLAS_ELTWISE_SCALAR_SUBTRACT : MLAS_ELTWISE_SCALAR_VECTOR<T> {
+    static T Apply(T a, T b) { return a - b; }
+};
+
+template<typename T>
+struct MLAS_ELTWISE_SCALAR_MULTIPLY : MLAS_ELTWISE_SCALAR_VECTOR<T> {
+    static T Apply(T a, T b) { return a * b; }
+};
+
+template<typename T>
+struct MLAS_ELTWISE_SCALAR_DIVIDE : MLAS_ELTWISE_SCALAR_VECTOR<T> {
+    static T Apply(T a, T b) { return a / b; }
+};
+
+struct MLAS_ELTWISE_FLOAT32_ADD : MLAS_ELTWISE_FLOAT32_VECTOR {
+    static float Apply(float a, float b) { return a + b; }
+    static MLAS_FLOAT32X4 Apply(MLAS_FLOAT32X4 a, MLAS_FLOAT32X4 b) { return MlasAddFloat32x4(a, b); }
+};
+
+struct MLAS_ELTWISE_FLOAT32_SUBTRACT : MLAS_ELTWISE_FLOAT32_VECTOR {
+    static float Apply(float a, float b) { return a - b; }
+    static MLAS_FLOAT32X4 Apply(MLAS_FLOAT32X4 a, MLAS_FLOAT32X4 b) { return MlasSubtractFloat32x4(a, b); }
+};
+
+struct MLAS_ELTWISE_FLOAT32_MULTIPLY : MLAS_ELTWISE_FLOAT32_VECTOR {
+    static float Apply(float a, float b) { return a * b; }
+    static MLAS_FLOAT32X4 Apply(MLAS_FLOAT32X4 a, MLAS_FLOAT32X4 b) { return MlasMultiplyFloat32x4(a, b); }
+};
+
+struct MLAS_ELTWISE_FLOAT32_DIVIDE : MLAS_ELTWISE_FLOAT32_VECTOR {
+    static float Apply(float a, float b) { return a / b; }
+    static MLAS_FLOAT32X4 Apply(MLAS_FLOAT32X4 a, MLAS_FLOAT32X4 b) { return MlasDivideFloat32x4(a, b); }
+};
+
+struct MLAS_ELTWISE_INT32_ADD : MLAS_ELTWISE_INT32_VECTOR {
+    static int32_t Apply(int32_t a, int32_t b) { return a + b; }
+    static MLAS_INT32X4 Apply(MLAS_INT32X4 a, MLAS_INT32X4 b) { return MlasAddInt32x4(a, b); }
+};
+
+struct MLAS_ELTWISE_INT32_SUBTRACT : MLAS_ELTWISE_INT32_VECTOR {
+    static int32_t Apply(int32_t a, int32_t b) { return a - b; }
+    static MLAS_INT32X4 Apply(MLAS_INT32X4 a, MLAS_INT32X4 b) { return MlasSubtractInt32x4(a, b); }
+};
+
+template<typename Operation, bool IsScalarA, bool IsScalarB>
+void
+MlasEltwiseBinaryRowKernel(
+    const typename Operation::ElementType* InputA,
+    const typename Operation::ElementType* InputB,
+    typename Operation::ElementType* Output,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the generic kernel to compute a binary operation
+    for a single row.
+
+Arguments:
+
+    InputA - Supplies the first input row.
+
+    InputB - Supplies the second input row.
+
+    Output - Supplies the output row.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    typedef typename Operation::VectorType VectorType;
+
+    constexpr size_t VectorWidth = Operation::VectorWidth;
+
+    const auto ScalarA = IsScalarA ? *InputA : typename Operation::ElementType();
+    const auto ScalarB = IsScalarB ? *InputB : typename Operation::ElementType();
+
+    const VectorType BroadcastA = Operation::Broadcast(ScalarA);
+    const VectorType BroadcastB = Operation::Broadcast(ScalarB);
+
+    while (N >= VectorWidth * 4) {
+
+        for (size_t i = 0; i < 4; i++) {
+
+            VectorType VectorA = IsScalarA ? BroadcastA : Operation::Load(InputA + i * VectorWidth);
+            VectorType VectorB = IsScalarB ? BroadcastB : Operation::Load(InputB + i * VectorWidth);
+
+            Operation::Store(Output + i * VectorWidth, Operation::Apply(VectorA, VectorB));
+        }
+
+        if (!IsScalarA) {
+            InputA += VectorWidth * 4;
+        }
+
+        if (!IsScalarB) {
+            InputB += VectorWidth * 4;
+        }
+
+        Output += VectorWidth * 4;
+        N -= VectorWidth * 4;
+    }
+
+    while (N >= VectorWidth) {
+
+        VectorType VectorA = IsScalarA ? BroadcastA : Operation::Load(InputA);
+        VectorType VectorB = IsScalarB ? BroadcastB : Operation::Load(InputB);
+
+        Operation::Store(Output, Operation::Apply(VectorA, VectorB));
+
+        if (!IsScalarA) {
+            InputA += VectorWidth;
+        }
+
+        if (!IsScalarB) {
+            InputB += VectorWidth;
+        }
+
+        Output += VectorWidth;
+        N -= VectorWidth;
+    }
+
+    while (N > 0) {
+
+        *Output = Operation::Apply(IsScalarA ? ScalarA : *InputA++, IsScalarB ? ScalarB : *InputB++);
+
+        Output += 1;
+        N -= 1;
+    }
+}
+
+template<typename Operation, bool IsScalarA, bool IsScalarB>
+void
+MlasEltwiseBinaryKernel(
+    const typename Operation::ElementType* InputA,
+    size_t InputARowStride,
+    const typename Operation::ElementType* InputB,
+    size_t InputBRowStride,
+    typename Operation::ElementType* Output,
+    size_t Rows,
+    size_t Columns
+    )
+{
+    for (size_t r = 0; r < Rows; r++) {
+
+        MlasEltwiseBinaryRowKernel<Operation, IsScalarA, IsScalarB>(InputA, InputB, Output, Columns);
+
+        InputA += InputARowStride;
+        InputB += InputBRowStride;
+        Output += Columns;
+    }
+}
+
+template<typename Operation>
+void
+MlasEltwiseBinaryOperation(
+    const typename Operation::ElementType* InputA,
+    size_t InputARowStride,
+    bool IsScalarA,
+    const typename Operation::ElementType* InputB,
+    size_t InputBRowStride,
+    bool IsScalarB,
+    typename Operation::ElementType* Output,
+    size_t Rows,
+    size_t Columns
+    )
+/*++
+
+Routine Description:
+
+    This routine selects the kernel for the broadcast form of each input.
+
+Arguments:
+
+    See MlasEltwiseBinary.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (IsScalarA) {
+        if (IsScalarB) {
+            MlasEltwiseBinaryKernel<Operation, true, true>(InputA, InputARowStride,
+                InputB, InputBRowStride, Output, Rows, Columns);
+        } else {
+            MlasEltwiseBinaryKernel<Operation, true, false>(InputA, InputARowStride,
+                InputB, InputBRowStride, Output, Rows, Columns);
+        }
+    } else {
+        if (IsScalarB) {
+            MlasEltwiseBinaryKernel<Operation, false, true>(InputA, InputARowStride,
+                InputB, InputBRowStride, Output, Rows, Columns);
+        } else {
+            MlasEltwiseBinaryKernel<Operation, false, false>(InputA, InputARowStride,
+                InputB, InputBRowStride, Output, Rows, Columns);
+        }
+    }
+}
+
+template<typename AddOperation, typename SubtractOperation, typename MultiplyOperation, typename DivideOperation>
+void
+MlasEltwiseBinaryDispatch(
+    MLAS_ELTWISE_BINARY_KIND Kind,
+    const typename AddOperation::ElementType* InputA,
+    size_t InputARowStride,
+    bool IsScalarA,
+    const typename AddOperation::ElementType* InputB,
+    size_t InputBRowStride,
+    bool IsScalarB,
+    typename AddOperation::ElementType* Output,
+    size_t Rows,
+    size_t Columns
+    )
+{
+    switch (Kind) {
+
+        case MlasEltwiseAdd:
+            MlasEltwiseBinaryOperation<AddOperation>(InputA, InputARowStride, IsScalarA,
+                InputB, InputBRowStride, IsScalarB, Output, Rows, Columns);
+            break;
+
+        case MlasEltwiseSubtract:
+            MlasEltwiseBinaryOperation<SubtractOperation>(InputA, InputARowStride, IsScalarA,
+                InputB, InputBRowStride, IsScalarB, Output, Rows, Columns);
+            break;
+
+        case MlasEltwiseMultiply:
+            MlasEltwiseBinaryOperation<MultiplyOperation>(InputA, InputARowStride, IsScalarA,
+                InputB, InputBRowStride, IsScalarB, Output, Rows, Columns);
+            break;
+
+        case MlasEltwiseDivide:
+            MlasEltwiseBinaryOperation<DivideOperation>(InputA, InputARowStride, IsScalarA,
+                InputB, InputBRowStride, IsScalarB, Output, Rows, Columns);
+            break;
+    }
+}
+
+template<>
+void
+MLASCALL
+MlasEltwiseBinary<float>(
+    MLAS_ELTWISE_BINARY_KIND Kind,
+    const float* InputA,
+    size_t InputARowStride,
+    bool IsScalarA,
+    const float* InputB,
+    size_t InputBRowStride,
+    bool IsScalarB,
+    float* Output,
+    size_t Rows,
+    size_t Columns
+    )
+/*++
+
+Routine Description:
+
+    This routine computes a binary element-wise operation with broadcasting.
+
+Arguments:
+
+    Kind - Supplies the binary operation.
+
+    InputA - Supplies the first input tensor.
+
+    InputARowStride - Supplies the number of elements between rows of the
+        first input tensor.
+
+    IsScalarA - Supplies true if the first element of each row of the first
+        input tensor is broadcast across the row.
+
+    InputB - Supplies the second input tensor.
+
+    InputBRowStride - Supplies the number of elements between rows of the
+        second input tensor.
+
+    IsScalarB - Supplies true if the first element of each row of the second
+        input tensor is broadcast across the row.
+
+    Output - Supplies the output tensor of Rows * Columns elements.
+
+    Rows - Supplies the number of output rows.
+
+    Columns - Supplies the number of elements of each output row.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MlasEltwiseBinaryDispatch<MLAS_ELTWISE_FLOAT32_ADD, MLAS_ELTWISE_FLOAT32_SUBTRACT,
+        MLAS_ELTWISE_FLOAT32_MULTIPLY, MLAS_ELTWISE_FLOAT32_DIVIDE>(Kind, InputA, InputARowStride,
+        IsScalarA, InputB, InputBRowStride, IsScalarB, Output, Rows, Columns);
+}
+
+template<>
+void
+MLASCALL
+MlasEltwiseBinary<int32_t>(
+    MLAS_ELTWISE_BINARY_KIND Kind,
+    const int32_t* InputA,
+    size_t InputARowStride,
+    bool IsScalarA,
+    const int32_t* InputB,
+    size_t InputBRowStride,
+    bool IsScalarB,
+    int32_t* Output,
+    size_t Rows,
+    size_t Columns
+    )
+{
+    MlasEltwiseBinaryDispatch<MLAS_ELTWISE_INT32_ADD, MLAS_ELTWISE_INT32_SUBTRACT,
+        MLAS_ELTWISE_SCALAR_MULTIPLY<int32_t>, MLAS_ELTWISE_SCALAR_DIVIDE<int32_t>>(Kind, InputA,
+        InputARowStride, IsScalarA, InputB, InputBRowStride, IsScalarB, Output, Rows, Columns);
+}
+
+template<>
+void
+MLASCALL
+MlasEltwiseBinary<int64_t>(
+    MLAS_ELTWISE_BINARY_KIND Kind,
+    const int64_t* InputA,
+    size_t InputARowStride,
+    bool IsScalarA,
+    const int64_t* InputB,
+    size_t InputBRowStride,
+    bool IsScalarB,
+    int64_t* Output,
+    size_t Rows,
+    size_t Columns
+    )
+{
+    MlasEltwiseBinaryDispatch<MLAS_ELTWISE_SCALAR_ADD<int64_t>, MLAS_ELTWISE_SCALAR_SUBTRACT<int64_t>,
+        MLAS_ELTWISE_SCALAR_MULTIPLY<int64_t>, MLAS_ELTWISE_SCALAR_DIVIDE<int64_t>>(Kind, InputA,
+        InputARowStride, IsScalarA, InputB, InputBRowStride, IsScalarB, Output, Rows, Columns);
+}
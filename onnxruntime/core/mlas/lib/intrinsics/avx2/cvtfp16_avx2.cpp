@@ -0,0 +1,141 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    cvtfp16_avx2.cpp
+
+Abstract:
+
+    This module implements the kernels to convert between half precision and
+    single precision buffers using F16C intrinsics.
+
+--*/
+
+#include "../../mlasi.h"
+
+void
+MLASCALL
+MlasConvertHalfToFloatKernelF16C(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the kernel to convert a buffer of half precision
+    values to single precision.
+
+Arguments:
+
+    Source - Supplies the address of the half precision buffer.
+
+    Destination - Supplies the address of the single precision buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Count >= 16) {
+
+        __m256 Vector0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)Source));
+        __m256 Vector1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(Source + 8)));
+
+        _mm256_storeu_ps(Destination, Vector0);
+        _mm256_storeu_ps(Destination + 8, Vector1);
+
+        Source += 16;
+        Destination += 16;
+        Count -= 16;
+    }
+
+    if (Count >= 8) {
+
+        _mm256_storeu_ps(Destination, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)Source)));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+    if (Count > 0) {
+
+        unsigned short Buffer[8] = {};
+        float Output[8];
+
+        std::copy_n(Source, Count, Buffer);
+        _mm256_storeu_ps(Output, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)Buffer)));
+        std::copy_n(Output, Count, Destination);
+    }
+}
+
+void
+MLASCALL
+MlasConvertFloatToHalfKernelF16C(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the kernel to convert a buffer of single precision
+    values to half precision using round to nearest even.
+
+Arguments:
+
+    Source - Supplies the address of the single precision buffer.
+
+    Destination - Supplies the address of the half precision buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Count >= 16) {
+
+        __m128i Vector0 = _mm256_cvtps_ph(_mm256_loadu_ps(Source), _MM_FROUND_TO_NEAREST_INT);
+        __m128i Vector1 = _mm256_cvtps_ph(_mm256_loadu_ps(Source + 8), _MM_FROUND_TO_NEAREST_INT);
+
+        _mm_storeu_si128((__m128i*)Destination, Vector0);
+        _mm_storeu_si128((__m128i*)(Destination + 8), Vector1);
+
+        Source += 16;
+        Destination += 16;
+        Count -= 16;
+    }
+
+    if (Count >= 8) {
+
+        _mm_storeu_si128((__m128i*)Destination,
+            _mm256_cvtps_ph(_mm256_loadu_ps(Source), _MM_FROUND_TO_NEAREST_INT));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+    if (Count > 0) {
+
+        float Buffer[8] = {};
+        unsigned short Output[8];
+
+        std::copy_n(Source, Count, Buffer);
+        _mm_storeu_si128((__m128i*)Output, _mm256_cvtps_ph(_mm256_loadu_ps(Buffer), _MM_FROUND_TO_NEAREST_INT));
+        std::copy_n(Output, Count, Destination);
+    }
+}
@@ -0,0 +1,303 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    reduce_avx2.cpp
+
+Abstract:
+
+    This module implements the kernels for the reduction routines using AVX2
+    and FMA3 intrinsics.
+
+--*/
+
+#include "../../mlasi.h"
+
+struct MLAS_REDUCTION_SUM_OPERATION_AVX2 {
+
+    static float InitialValue() { return 0.0f; }
+
+    static __m256 Accumulate(__m256 Accumulator, __m256 Vector)
+    {
+        return _mm256_add_ps(Accumulator, Vector);
+    }
+
+    static float Accumulate(float Accumulator, float Value) { return Accumulator + Value; }
+
+    static __m256 Combine(__m256 Vector1, __m256 Vector2)
+    {
+        return _mm256_add_ps(Vector1, Vector2);
+    }
+
+    static __m128 Combine(__m128 Vector1, __m128 Vector2)
+    {
+        return _mm_add_ps(Vector1, Vector2);
+    }
+};
+
+struct MLAS_REDUCTION_SUM_SQUARE_OPERATION_AVX2 : MLAS_REDUCTION_SUM_OPERATION_AVX2 {
+
+    static __m256 Accumulate(__m256 Accumulator, __m256 Vector)
+    {
+        return _mm256_fmadd_ps(Vector, Vector, Accumulator);
+    }
+
+    static float Accumulate(float Accumulator, float Value) { return Accumulator + Value * Value; }
+};
+
+struct MLAS_REDUCTION_MAXIMUM_OPERATION_AVX2 {
+
+    static float InitialValue() { return -std::numeric_limits<float>::infinity(); }
+
+    static __m256 Accumulate(__m256 Accumulator, __m256 Vector)
+    {
+        return _mm256_max_ps(Accumulator, Vector);
+    }
+
+    static float Accumulate(float Accumulator, float Value) { return std::max(Accumulator, Value); }
+
+    static __m256 Combine(__m256 Vector1, __m256 Vector2)
+    {
+        return _mm256_max_ps(Vector1, Vector2);
+    }
+
+    static __m128 Combine(__m128 Vector1, __m128 Vector2)
+    {
+        return _mm_max_ps(Vector1, Vector2);
+    }
+};
+
+struct MLAS_REDUCTION_MINIMUM_OPERATION_AVX2 {
+
+    static float InitialValue() { return std::numeric_limits<float>::infinity(); }
+
+    static __m256 Accumulate(__m256 Accumulator, __m256 Vector)
+    {
+        return _mm256_min_ps(Accumulator, Vector);
+    }
+
+    static float Accumulate(float Accumulator, float Value) { return std::min(Accumulator, Value); }
+
+    static __m256 Combine(__m256 Vector1, __m256 Vector2)
+    {
+        return _mm256_min_ps(Vector1, Vector2);
+    }
+
+    static __m128 Combine(__m128 Vector1, __m128 Vector2)
+    {
+        return _mm_min_ps(Vector1, Vector2);
+    }
+};
+
+template<typename ReductionOperation>
+MLAS_FORCEINLINE
+float
+MlasReduceHorizontalAvx2(
+    __m256 Vector
+    )
+{
+    __m128 Reduce = ReductionOperation::Combine(_mm256_castps256_ps128(Vector),
+        _mm256_extractf128_ps(Vector, 1));
+    Reduce = ReductionOperation::Combine(Reduce, _mm_movehl_ps(Reduce, Reduce));
+    Reduce = ReductionOperation::Combine(Reduce, _mm_shuffle_ps(Reduce, Reduce, 1));
+
+    return _mm_cvtss_f32(Reduce);
+}
+
+template<typename ReductionOperation>
+float
+MlasReduceF32KernelAvx2Impl(
+    const float* Input,
+    size_t N
+    )
+{
+    float Accumulator = ReductionOperation::InitialValue();
+
+    if (N >= 8) {
+
+        __m256 AccumulatorVector0 = _mm256_set1_ps(Accumulator);
+
+        if (N >= 32) {
+
+            __m256 AccumulatorVector1 = AccumulatorVector0;
+            __m256 AccumulatorVector2 = AccumulatorVector0;
+            __m256 AccumulatorVector3 = AccumulatorVector0;
+
+            while (N >= 32) {
+
+                AccumulatorVector0 = ReductionOperation::Accumulate(AccumulatorVector0, _mm256_loadu_ps(Input));
+                AccumulatorVector1 = ReductionOperation::Accumulate(AccumulatorVector1, _mm256_loadu_ps(Input + 8));
+                AccumulatorVector2 = ReductionOperation::Accumulate(AccumulatorVector2, _mm256_loadu_ps(Input + 16));
+                AccumulatorVector3 = ReductionOperation::Accumulate(AccumulatorVector3, _mm256_loadu_ps(Input + 24));
+
+                Input += 32;
+                N -= 32;
+            }
+
+            AccumulatorVector0 = ReductionOperation::Combine(AccumulatorVector0, AccumulatorVector1);
+            AccumulatorVector2 = ReductionOperation::Combine(AccumulatorVector2, AccumulatorVector3);
+            AccumulatorVector0 = ReductionOperation::Combine(AccumulatorVector0, AccumulatorVector2);
+        }
+
+        while (N >= 8) {
+
+            AccumulatorVector0 = ReductionOperation::Accumulate(AccumulatorVector0, _mm256_loadu_ps(Input));
+
+            Input += 8;
+            N -= 8;
+        }
+
+        Accumulator = MlasReduceHorizontalAvx2<ReductionOperation>(AccumulatorVector0);
+    }
+
+    while (N > 0) {
+
+        Accumulator = ReductionOperation::Accumulate(Accumulator, *Input);
+
+        Input += 1;
+        N -= 1;
+    }
+
+    return Accumulator;
+}
+
+template<typename ReductionOperation>
+void
+MlasReduceStridedF32KernelAvx2Impl(
+    const float* Input,
+    float* Output,
+    size_t ReduceCount,
+    size_t InnerCount,
+    size_t InputStride
+    )
+{
+    const __m256 InitialVector = _mm256_set1_ps(ReductionOperation::InitialValue());
+
+    while (InnerCount >= 32) {
+
+        __m256 AccumulatorVector0 = InitialVector;
+        __m256 AccumulatorVector1 = InitialVector;
+        __m256 AccumulatorVector2 = InitialVector;
+        __m256 AccumulatorVector3 = InitialVector;
+
+        const float* input = Input;
+
+        for (size_t r = 0; r < ReduceCount; r++) {
+
+            AccumulatorVector0 = ReductionOperation::Accumulate(AccumulatorVector0, _mm256_loadu_ps(input));
+            AccumulatorVector1 = ReductionOperation::Accumulate(AccumulatorVector1, _mm256_loadu_ps(input + 8));
+            AccumulatorVector2 = ReductionOperation::Accumulate(AccumulatorVector2, _mm256_loadu_ps(input + 16));
+            AccumulatorVector3 = ReductionOperation::Accumulate(AccumulatorVector3, _mm256_loadu_ps(input + 24));
+
+            input += InputStride;
+        }
+
+        _mm256_storeu_ps(Output, AccumulatorVector0);
+        _mm256_storeu_ps(Output + 8, AccumulatorVector1);
+        _mm256_storeu_ps(Output + 16, AccumulatorVector2);
+        _mm256_storeu_ps(Output + 24, AccumulatorVector3);
+
+        Input += 32;
+        Output += 32;
+        InnerCount -= 32;
+    }
+
+    while (InnerCount >= 8) {
+
+        __m256 AccumulatorVector = InitialVector;
+
+        const float* input = Input;
+
+        for (size_t r = 0; r < ReduceCount; r++) {
+            AccumulatorVector = ReductionOperation::Accumulate(AccumulatorVector, _mm256_loadu_ps(input));
+            input += InputStride;
+        }
+
+        _mm256_storeu_ps(Output, AccumulatorVector);
+
+        Input += 8;
+        Output += 8;
+        InnerCount -= 8;
+    }
+
+    while (InnerCount > 0) {
+
+        float Accumulator = ReductionOperation::InitialValue();
+
+        const float* input = Input;
+
+        for (size_t r = 0; r < ReduceCount; r++) {
+            Accumulator = ReductionOperation::Accumulate(Accumulator, *input);
+            input += InputStride;
+        }
+
+        *Output = Accumulator;
+
+        Input += 1;
+        Output += 1;
+        InnerCount -= 1;
+    }
+}
+
+float
+MLASCALL
+MlasReduceF32KernelAvx2(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    size_t N
+    )
+{
+    switch (ReductionKind) {
+
+        case MlasSumReduction:
+            return MlasReduceF32KernelAvx2Impl<MLAS_REDUCTION_SUM_OPERATION_AVX2>(Input, N);
+
+        case MlasSumSquareReduction:
+            return MlasReduceF32KernelAvx2Impl<MLAS_REDUCTION_SUM_SQUARE_OPERATION_AVX2>(Input, N);
+
+        case MlasMaximumReduction:
+            return MlasReduceF32KernelAvx2Impl<MLAS_REDUCTION_MAXIMUM_OPERATION_AVX2>(Input, N);
+
+        default:
+            return MlasReduceF32KernelAvx2Impl<MLAS_REDUCTION_MINIMUM_OPERATION_AVX2>(Input, N);
+    }
+}
+
+void
+MLASCALL
+MlasReduceStridedF32KernelAvx2(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    float* Output,
+    size_t ReduceCount,
+    size_t InnerCount,
+    size_t InputStride
+    )
+{
+    switch (ReductionKind) {
+
+        case MlasSumReduction:
+            MlasReduceStridedF32KernelAvx2Impl<MLAS_REDUCTION_SUM_OPERATION_AVX2>(
+                Input, Output, ReduceCount, InnerCount, InputStride);
+            break;
+
+        case MlasSumSquareReduction:
+            MlasReduceStridedF32KernelAvx2Impl<MLAS_REDUCTION_SUM_SQUARE_OPERATION_AVX2>(
+                Input, Output, ReduceCount, InnerCount, InputStride);
+            break;
+
+        case MlasMaximumReduction:
+            MlasReduceStridedF32KernelAvx2Impl<MLAS_REDUCTION_MAXIMUM_OPERATION_AVX2>(
+                Input, Output, ReduceCount, InnerCount, InputStride);
+            break;
+
+        default:
+            MlasReduceStridedF32KernelAvx2Impl<MLAS_REDUCTION_MINIMUM_OPERATION_AVX2>(
+                Input, Output, ReduceCount, InnerCount, InputStride);
+            break;
+    }
+}
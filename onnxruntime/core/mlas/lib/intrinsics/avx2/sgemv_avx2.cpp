@@ -0,0 +1,200 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    sgemv_avx2.cpp
+
+Abstract:
+
+    This module implements the kernel to multiply a row vector by a packed
+    matrix using AVX2 and FMA3 intrinsics.
+
+--*/
+
+#include "../../mlasi.h"
+
+//
+// Number of elements of each packed column panel stream to prefetch ahead.
+//
+
+#define MLAS_SGEMV_PREFETCH_DISTANCE        (16 * 8)
+
+template<size_t PanelCount>
+MLAS_FORCEINLINE
+void
+MlasSgemvPackedPanelsAvx2(
+    const float* A,
+    const float* PackedB,
+    float* C,
+    size_t CountK,
+    size_t CountN,
+    float alpha,
+    bool ZeroMode
+    )
+/*++
+
+Routine Description:
+
+    This routine multiplies a row vector by one to four column panels of a
+    slice of a packed matrix B.
+
+Arguments:
+
+    A - Supplies the address of the row vector A.
+
+    PackedB - Supplies the address of the first column panel.
+
+    C - Supplies the address of the row vector C.
+
+    CountK - Supplies the number of rows of the slice of matrix B.
+
+    CountN - Supplies the number of columns to store, up to 16 * PanelCount.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    ZeroMode - Supplies true if the output vector must be zero initialized,
+        else false if the output vector is accumulated into.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    __m256 Accumulators[PanelCount][2];
+
+    for (size_t p = 0; p < PanelCount; p++) {
+        Accumulators[p][0] = _mm256_setzero_ps();
+        Accumulators[p][1] = _mm256_setzero_ps();
+    }
+
+    const size_t PanelStride = CountK * 16;
+
+    for (size_t k = 0; k < CountK; k++) {
+
+        __m256 ABroadcast = _mm256_broadcast_ss(&A[k]);
+
+        for (size_t p = 0; p < PanelCount; p++) {
+
+            const float* b = PackedB + p * PanelStride;
+
+            _mm_prefetch((const char*)(b + MLAS_SGEMV_PREFETCH_DISTANCE), _MM_HINT_T0);
+
+            Accumulators[p][0] = _mm256_fmadd_ps(ABroadcast, _mm256_loadu_ps(b), Accumulators[p][0]);
+            Accumulators[p][1] = _mm256_fmadd_ps(ABroadcast, _mm256_loadu_ps(b + 8), Accumulators[p][1]);
+        }
+
+        PackedB += 16;
+    }
+
+    //
+    // Store the accumulators to the output vector. A partial panel is staged
+    // through a local buffer.
+    //
+
+    const __m256 AlphaBroadcast = _mm256_set1_ps(alpha);
+
+    float Buffer[16 * PanelCount];
+    float* c = (CountN == 16 * PanelCount) ? C : Buffer;
+
+    if (c == Buffer && !ZeroMode) {
+        std::copy_n(C, CountN, Buffer);
+    }
+
+    for (size_t p = 0; p < PanelCount; p++) {
+
+        for (size_t i = 0; i < 2; i++) {
+
+            float* cc = c + p * 16 + i * 8;
+
+            __m256 Vector = _mm256_mul_ps(Accumulators[p][i], AlphaBroadcast);
+
+            if (!ZeroMode) {
+                Vector = _mm256_add_ps(Vector, _mm256_loadu_ps(cc));
+            }
+
+            _mm256_storeu_ps(cc, Vector);
+        }
+    }
+
+    if (c == Buffer) {
+        std::copy_n(Buffer, CountN, C);
+    }
+}
+
+void
+MLASCALL
+MlasSgemvPackedF32KernelAvx2(
+    const float* A,
+    const float* PackedB,
+    float* C,
+    size_t CountK,
+    size_t CountN,
+    float alpha,
+    bool ZeroMode
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the kernel to multiply a row vector by a slice of
+    a packed matrix B.
+
+    Four column panels of the packed matrix are processed together so that
+    eight independent accumulators hide the latency of the FMA instructions.
+    Each panel is a separate sequential stream, so the streams are prefetched
+    explicitly ahead of the loads.
+
+Arguments:
+
+    A - Supplies the address of the row vector A.
+
+    PackedB - Supplies the address of the slice of packed matrix B.
+
+    C - Supplies the address of the row vector C.
+
+    CountK - Supplies the number of elements of vector A and the number of rows
+        of the slice of matrix B.
+
+    CountN - Supplies the number of columns of the slice of matrix B and the
+        number of elements of vector C.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    ZeroMode - Supplies true if the output vector must be zero initialized,
+        else false if the output vector is accumulated into.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t PanelStride = CountK * 16;
+
+    while (CountN >= 64) {
+
+        MlasSgemvPackedPanelsAvx2<4>(A, PackedB, C, CountK, 64, alpha, ZeroMode);
+
+        PackedB += PanelStride * 4;
+        C += 64;
+        CountN -= 64;
+    }
+
+    if (CountN > 32) {
+
+        MlasSgemvPackedPanelsAvx2<3>(A, PackedB, C, CountK, CountN, alpha, ZeroMode);
+
+    } else if (CountN > 16) {
+
+        MlasSgemvPackedPanelsAvx2<2>(A, PackedB, C, CountK, CountN, alpha, ZeroMode);
+
+    } else if (CountN > 0) {
+
+        MlasSgemvPackedPanelsAvx2<1>(A, PackedB, C, CountK, CountN, alpha, ZeroMode);
+    }
+}
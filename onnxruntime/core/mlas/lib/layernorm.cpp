@@ -0,0 +1,431 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    layernorm.cpp
+
+Abstract:
+
+    This module implements routines to compute layer normalization, including
+    the variants with a fused residual and bias add (skip layer normalization)
+    and without mean subtraction (simplified or RMS layer normalization).
+
+    Each row is processed in two passes over the data: the first pass forms
+    the (optionally residual added) input and accumulates the sum and sum of
+    squares together, and the second pass applies the normalization, scale,
+    and shift.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the parameters to execute segments of a layer normalization
+// operation on worker threads.
+//
+
+struct MLAS_LAYERNORM_WORK_BLOCK {
+    ptrdiff_t ThreadCount;
+    const float* Input;
+    const float* Skip;
+    const float* Bias;
+    const float* Scale;
+    const float* Shift;
+    float* Output;
+    float* Mean;
+    float* InvStdDev;
+    size_t Rows;
+    size_t Columns;
+    float Epsilon;
+    bool Simplified;
+};
+
+template<bool HasSkip>
+void
+MlasLayerNormalizationAccumulate(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    float* Output,
+    size_t N,
+    float* Sum,
+    float* SumSquare
+    )
+/*++
+
+Routine Description:
+
+    This routine accumulates the sum and sum of squares of a row.
+
+    If a skip row is supplied, the input row, skip row, and optional bias are
+    added together and the result is stored to the output row.
+
+Arguments:
+
+    Input - Supplies the input row.
+
+    Skip - Supplies the skip row, else nullptr.
+
+    Bias - Supplies the bias row, else nullptr. This is only used if a skip
+        row is supplied.
+
+    Output - Supplies the output row. This is only used if a skip row is
+        supplied.
+
+    N - Supplies the number of elements to process.
+
+    Sum - Receives the sum of the row.
+
+    SumSquare - Receives the sum of squares of the row.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_FLOAT32X4 SumVector0 = MlasZeroFloat32x4();
+    MLAS_FLOAT32X4 SumVector1 = MlasZeroFloat32x4();
+    MLAS_FLOAT32X4 SumSquareVector0 = MlasZeroFloat32x4();
+    MLAS_FLOAT32X4 SumSquareVector1 = MlasZeroFloat32x4();
+
+    while (N >= 8) {
+
+        MLAS_FLOAT32X4 Vector0 = MlasLoadFloat32x4(Input);
+        MLAS_FLOAT32X4 Vector1 = MlasLoadFloat32x4(Input + 4);
+
+        if (HasSkip) {
+
+            Vector0 = MlasAddFloat32x4(Vector0, MlasLoadFloat32x4(Skip));
+            Vector1 = MlasAddFloat32x4(Vector1, MlasLoadFloat32x4(Skip + 4));
+
+            if (Bias != nullptr) {
+                Vector0 = MlasAddFloat32x4(Vector0, MlasLoadFloat32x4(Bias));
+                Vector1 = MlasAddFloat32x4(Vector1, MlasLoadFloat32x4(Bias + 4));
+                Bias += 8;
+            }
+
+            MlasStoreFloat32x4(Output, Vector0);
+            MlasStoreFloat32x4(Output + 4, Vector1);
+
+            Skip += 8;
+            Output += 8;
+        }
+
+        SumVector0 = MlasAddFloat32x4(SumVector0, Vector0);
+        SumVector1 = MlasAddFloat32x4(SumVector1, Vector1);
+        SumSquareVector0 = MlasMultiplyAddFloat32x4(Vector0, Vector0, SumSquareVector0);
+        SumSquareVector1 = MlasMultiplyAddFloat32x4(Vector1, Vector1, SumSquareVector1);
+
+        Input += 8;
+        N -= 8;
+    }
+
+    float SumValue = MlasReduceAddFloat32x4(MlasAddFloat32x4(SumVector0, SumVector1));
+    float SumSquareValue = MlasReduceAddFloat32x4(MlasAddFloat32x4(SumSquareVector0, SumSquareVector1));
+
+    while (N > 0) {
+
+        float Value = *Input++;
+
+        if (HasSkip) {
+
+            Value += *Skip++;
+
+            if (Bias != nullptr) {
+                Value += *Bias++;
+            }
+
+            *Output++ = Value;
+        }
+
+        SumValue += Value;
+        SumSquareValue += Value * Value;
+
+        N -= 1;
+    }
+
+    *Sum = SumValue;
+    *SumSquare = SumSquareValue;
+}
+
+template<bool HasShift>
+void
+MlasLayerNormalizationApply(
+    const float* Input,
+    const float* Scale,
+    const float* Shift,
+    float* Output,
+    size_t N,
+    float Mean,
+    float InvStdDev
+    )
+/*++
+
+Routine Description:
+
+    This routine normalizes a row and applies the scale and optional shift.
+
+Arguments:
+
+    Input - Supplies the input row.
+
+    Scale - Supplies the scale row.
+
+    Shift - Supplies the shift row. This is only used if HasShift is true.
+
+    Output - Supplies the output row. This may alias the input row.
+
+    N - Supplies the number of elements to process.
+
+    Mean - Supplies the value to subtract from each element.
+
+    InvStdDev - Supplies the value to multiply each centered element by.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const MLAS_FLOAT32X4 MeanBroadcast = MlasBroadcastFloat32x4(Mean);
+    const MLAS_FLOAT32X4 InvStdDevBroadcast = MlasBroadcastFloat32x4(InvStdDev);
+
+    while (N >= 4) {
+
+        MLAS_FLOAT32X4 Vector = MlasSubtractFloat32x4(MlasLoadFloat32x4(Input), MeanBroadcast);
+        Vector = MlasMultiplyFloat32x4(Vector, InvStdDevBroadcast);
+
+        if (HasShift) {
+            Vector = MlasMultiplyAddFloat32x4(Vector, MlasLoadFloat32x4(Scale), MlasLoadFloat32x4(Shift));
+            Shift += 4;
+        } else {
+            Vector = MlasMultiplyFloat32x4(Vector, MlasLoadFloat32x4(Scale));
+        }
+
+        MlasStoreFloat32x4(Output, Vector);
+
+        Input += 4;
+        Scale += 4;
+        Output += 4;
+        N -= 4;
+    }
+
+    while (N > 0) {
+
+        float Value = (*Input++ - Mean) * InvStdDev * *Scale++;
+
+        if (HasShift) {
+            Value += *Shift++;
+        }
+
+        *Output++ = Value;
+
+        N -= 1;
+    }
+}
+
+void
+MlasLayerNormalizationThreaded(
+    void* Context,
+    ptrdiff_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    layer normalization operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    Index - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_LAYERNORM_WORK_BLOCK*)Context;
+
+    const size_t Columns = WorkBlock->Columns;
+
+    size_t RowIndex;
+    size_t RowRemaining;
+
+    MlasPartitionWork(Index, WorkBlock->ThreadCount, WorkBlock->Rows, &RowIndex, &RowRemaining);
+
+    while (RowRemaining > 0) {
+
+        const float* Input = WorkBlock->Input + RowIndex * Columns;
+        float* Output = WorkBlock->Output + RowIndex * Columns;
+
+        float Sum;
+        float SumSquare;
+
+        if (WorkBlock->Skip != nullptr) {
+
+            //
+            // Store the residual added input to the output buffer and then
+            // normalize the output buffer in place.
+            //
+
+            MlasLayerNormalizationAccumulate<true>(Input, WorkBlock->Skip + RowIndex * Columns,
+                WorkBlock->Bias, Output, Columns, &Sum, &SumSquare);
+
+            Input = Output;
+
+        } else {
+
+            MlasLayerNormalizationAccumulate<false>(Input, nullptr, nullptr, nullptr, Columns,
+                &Sum, &SumSquare);
+        }
+
+        float Mean = 0.0f;
+        float Variance = SumSquare / float(Columns);
+
+        if (!WorkBlock->Simplified) {
+            Mean = Sum / float(Columns);
+            Variance = std::max(Variance - Mean * Mean, 0.0f);
+        }
+
+        const float InvStdDev = 1.0f / std::sqrt(Variance + WorkBlock->Epsilon);
+
+        if (WorkBlock->Shift != nullptr) {
+            MlasLayerNormalizationApply<true>(Input, WorkBlock->Scale, WorkBlock->Shift, Output,
+                Columns, Mean, InvStdDev);
+        } else {
+            MlasLayerNormalizationApply<false>(Input, WorkBlock->Scale, nullptr, Output,
+                Columns, Mean, InvStdDev);
+        }
+
+        if (WorkBlock->Mean != nullptr) {
+            WorkBlock->Mean[RowIndex] = Mean;
+        }
+
+        if (WorkBlock->InvStdDev != nullptr) {
+            WorkBlock->InvStdDev[RowIndex] = InvStdDev;
+        }
+
+        RowIndex++;
+        RowRemaining--;
+    }
+}
+
+void
+MLASCALL
+MlasLayerNormalization(
+    const float* Input,
+    const float* Skip,
+    const float* Bias,
+    const float* Scale,
+    const float* Shift,
+    float* Output,
+    float* Mean,
+    float* InvStdDev,
+    size_t Rows,
+    size_t Columns,
+    float Epsilon,
+    bool Simplified,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine computes layer normalization over the rows of a matrix.
+
+    N.B. This implementation supports in place updates of the output buffer.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Skip - Supplies the optional residual buffer that is added to the input
+        buffer, else nullptr.
+
+    Bias - Supplies the optional bias row that is added to the input buffer,
+        else nullptr. This is only used if a residual buffer is supplied.
+
+    Scale - Supplies the scale row.
+
+    Shift - Supplies the optional shift row, else nullptr.
+
+    Output - Supplies the output buffer.
+
+    Mean - Supplies the optional buffer to receive the mean of each row, else
+        nullptr. The mean is zero for a simplified normalization.
+
+    InvStdDev - Supplies the optional buffer to receive the inverse standard
+        deviation of each row, else nullptr.
+
+    Rows - Supplies the number of rows to process.
+
+    Columns - Supplies the number of columns per row to process.
+
+    Epsilon - Supplies the value added to the variance to avoid dividing by
+        zero.
+
+    Simplified - Supplies true if the mean is not subtracted from the input,
+        else false.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_LAYERNORM_WORK_BLOCK WorkBlock;
+
+    //
+    // Capture the layer normalization parameters to the work block.
+    //
+
+    WorkBlock.Input = Input;
+    WorkBlock.Skip = Skip;
+    WorkBlock.Bias = Bias;
+    WorkBlock.Scale = Scale;
+    WorkBlock.Shift = Shift;
+    WorkBlock.Output = Output;
+    WorkBlock.Mean = Mean;
+    WorkBlock.InvStdDev = InvStdDev;
+    WorkBlock.Rows = Rows;
+    WorkBlock.Columns = Columns;
+    WorkBlock.Epsilon = Epsilon;
+    WorkBlock.Simplified = Simplified;
+
+    //
+    // Compute the number of target threads given the complexity of the
+    // operation. Limit the number of threads to the number of rows and try to
+    // keep each thread processing a minimum number of elements before using
+    // another thread.
+    //
+
+    ptrdiff_t ThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (size_t(ThreadCount) > Rows) {
+        ThreadCount = ptrdiff_t(Rows);
+    }
+
+    constexpr size_t MinimumElementsPerThread = 16384;
+
+    size_t BlockCount = ((Rows * Columns) / MinimumElementsPerThread) + 1;
+
+    if (size_t(ThreadCount) > BlockCount) {
+        ThreadCount = ptrdiff_t(BlockCount);
+    }
+
+    WorkBlock.ThreadCount = ThreadCount;
+
+    MlasExecuteThreaded(MlasLayerNormalizationThreaded, &WorkBlock, ThreadCount, ThreadPool);
+}
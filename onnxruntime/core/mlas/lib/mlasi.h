@@ -413,6 +413,53 @@ void
     size_t N
     );
 
+typedef
+float
+(MLASCALL MLAS_REDUCE_FLOAT_KERNEL)(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    size_t N
+    );
+
+typedef
+void
+(MLASCALL MLAS_REDUCE_STRIDED_FLOAT_KERNEL)(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    float* Output,
+    size_t ReduceCount,
+    size_t InnerCount,
+    size_t InputStride
+    );
+
+typedef
+void
+(MLASCALL MLAS_SGEMV_PACKED_FLOAT_KERNEL)(
+    const float* A,
+    const float* PackedB,
+    float* C,
+    size_t CountK,
+    size_t CountN,
+    float alpha,
+    bool ZeroMode
+    );
+
+typedef
+void
+(MLASCALL MLAS_CONVERT_HALF_TO_FLOAT_KERNEL)(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    );
+
+typedef
+void
+(MLASCALL MLAS_CONVERT_FLOAT_TO_HALF_KERNEL)(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
 typedef
 void
 (MLASCALL MLAS_QLINEAR_BINARY_OP_S8_KERNEL)(
@@ -594,9 +641,21 @@ extern "C" {
 
     MLAS_REDUCE_MAXIMUM_FLOAT_KERNEL MlasReduceMaximumF32Kernel;
     MLAS_REDUCE_MINIMUM_MAXIMUM_FLOAT_KERNEL MlasReduceMinimumMaximumF32Kernel;
+    MLAS_REDUCE_FLOAT_KERNEL MlasReduceF32Kernel;
+    MLAS_REDUCE_STRIDED_FLOAT_KERNEL MlasReduceStridedF32Kernel;
+    MLAS_CONVERT_HALF_TO_FLOAT_KERNEL MlasConvertHalfToFloatKernel;
+    MLAS_CONVERT_FLOAT_TO_HALF_KERNEL MlasConvertFloatToHalfKernel;
+#if !defined(MLAS_TARGET_WASM_SCALAR)
+    MLAS_SGEMV_PACKED_FLOAT_KERNEL MlasSgemvPackedF32Kernel;
+#endif
 #if defined(MLAS_TARGET_AMD64)
     MLAS_REDUCE_MAXIMUM_FLOAT_KERNEL MlasReduceMaximumF32KernelAvx;
     MLAS_REDUCE_MINIMUM_MAXIMUM_FLOAT_KERNEL MlasReduceMinimumMaximumF32KernelAvx;
+    MLAS_REDUCE_FLOAT_KERNEL MlasReduceF32KernelAvx2;
+    MLAS_REDUCE_STRIDED_FLOAT_KERNEL MlasReduceStridedF32KernelAvx2;
+    MLAS_SGEMV_PACKED_FLOAT_KERNEL MlasSgemvPackedF32KernelAvx2;
+    MLAS_CONVERT_HALF_TO_FLOAT_KERNEL MlasConvertHalfToFloatKernelF16C;
+    MLAS_CONVERT_FLOAT_TO_HALF_KERNEL MlasConvertFloatToHalfKernelF16C;
 #endif
 
 }
@@ -645,7 +704,10 @@ MlasSgemmOperation(
     size_t ldb,
     float beta,
     float* C,
-    size_t ldc
+    size_t ldc,
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor = nullptr,
+    size_t StartM = 0,
+    size_t StartN = 0
     );
 
 //
@@ -734,6 +796,11 @@ struct MLAS_PLATFORM {
     MLAS_COMPUTE_LOGSOFTMAX_OUTPUT_FLOAT_KERNEL* ComputeLogSoftmaxOutputF32Kernel;
     MLAS_REDUCE_MAXIMUM_FLOAT_KERNEL* ReduceMaximumF32Kernel;
     MLAS_REDUCE_MINIMUM_MAXIMUM_FLOAT_KERNEL* ReduceMinimumMaximumF32Kernel;
+    MLAS_REDUCE_FLOAT_KERNEL* ReduceF32Kernel;
+    MLAS_REDUCE_STRIDED_FLOAT_KERNEL* ReduceStridedF32Kernel;
+    MLAS_SGEMV_PACKED_FLOAT_KERNEL* SgemvPackedF32Kernel;
+    MLAS_CONVERT_HALF_TO_FLOAT_KERNEL* ConvertHalfToFloatKernel;
+    MLAS_CONVERT_FLOAT_TO_HALF_KERNEL* ConvertFloatToHalfKernel;
     MLAS_QUANTIZE_LINEAR_S8_KERNEL* QuantizeLinearS8Kernel;
     MLAS_QUANTIZE_LINEAR_U8_KERNEL* QuantizeLinearU8Kernel;
     uint32_t NchwcBlockSize;
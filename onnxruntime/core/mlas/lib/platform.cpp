@@ -149,6 +149,11 @@ Return Value:
     this->ComputeLogSoftmaxOutputF32Kernel = MlasComputeLogSoftmaxOutputF32Kernel;
     this->ReduceMaximumF32Kernel = MlasReduceMaximumF32Kernel;
     this->ReduceMinimumMaximumF32Kernel = MlasReduceMinimumMaximumF32Kernel;
+    this->ReduceF32Kernel = MlasReduceF32Kernel;
+    this->ReduceStridedF32Kernel = MlasReduceStridedF32Kernel;
+    this->SgemvPackedF32Kernel = MlasSgemvPackedF32Kernel;
+    this->ConvertHalfToFloatKernel = MlasConvertHalfToFloatKernel;
+    this->ConvertFloatToHalfKernel = MlasConvertFloatToHalfKernel;
     this->QLinearAddS8Kernel = MlasQLinearAddS8Kernel;
     this->QLinearAddU8Kernel = MlasQLinearAddU8Kernel;
     this->QuantizeLinearS8Kernel = MlasQuantizeLinearS8Kernel;
@@ -250,6 +255,19 @@ Return Value:
                 this->ConvDepthwiseU8S8Kernel = MlasConvDepthwiseKernelAvx2<int8_t>;
                 this->ConvDepthwiseU8U8Kernel = MlasConvDepthwiseKernelAvx2<uint8_t>;
                 this->ComputeSumExpF32Kernel = MlasComputeSumExpF32KernelFma3;
+                this->ReduceF32Kernel = MlasReduceF32KernelAvx2;
+                this->ReduceStridedF32Kernel = MlasReduceStridedF32KernelAvx2;
+                this->SgemvPackedF32Kernel = MlasSgemvPackedF32KernelAvx2;
+
+                //
+                // Check if the processor supports the F16C half-precision
+                // conversion instructions.
+                //
+
+                if ((Cpuid1[2] & 0x20000000) != 0) {
+                    this->ConvertHalfToFloatKernel = MlasConvertHalfToFloatKernelF16C;
+                    this->ConvertFloatToHalfKernel = MlasConvertFloatToHalfKernelF16C;
+                }
 
                 //
                 // Check if the processor supports Hybrid core architecture.
@@ -54,15 +54,25 @@ struct MLAS_GEMM_U8X8_DISPATCH {
 
 const MLAS_GEMM_U8X8_DISPATCH*
 MlasGemmU8X8GetDispatch(
+    bool AIsSigned,
     bool BIsSigned
     )
 {
     const MLAS_GEMM_U8X8_DISPATCH* GemmU8X8Dispatch;
 
+    MLAS_UNREFERENCED_PARAMETER(AIsSigned);
     MLAS_UNREFERENCED_PARAMETER(BIsSigned);
 
 #if defined(MLAS_TARGET_AMD64)
-    if (BIsSigned) {
+    //
+    // Signed matrix A is converted to unsigned data, which can exceed the
+    // 16-bit intermediate range of the U8S8 kernels that are not VNNI based.
+    // Route signed matrix A to the U8U8 kernels, which flip the sign bit of
+    // signed matrix B and are exact. With VNNI, the U8U8 dispatch is the U8S8
+    // dispatch.
+    //
+
+    if (BIsSigned && !AIsSigned) {
         GemmU8X8Dispatch = MlasPlatform.GemmU8S8Dispatch;
     } else {
         GemmU8X8Dispatch = MlasPlatform.GemmU8U8Dispatch;
@@ -232,6 +242,99 @@ MlasGemmU8X8Kernel(
     bool ZeroMode
     );
 
+MLAS_FORCEINLINE
+int32_t
+MlasGemmU8X8FixupZeroPointA(
+    uint8_t ZeroPointA,
+    bool AIsSigned
+    )
+{
+    //
+    // Signed matrix A is converted to unsigned data by flipping the sign bit
+    // of each element as panels of matrix A are copied, so flip the zero
+    // point offset to match. This preserves (A[i] - ZeroPointA).
+    //
+
+    return AIsSigned ? int32_t(uint8_t(ZeroPointA ^ 0x80)) : int32_t(ZeroPointA);
+}
+
+MLAS_FORCEINLINE
+const uint8_t*
+MlasGemmU8X8ConvertSignedA(
+    uint8_t* D,
+    const uint8_t* A,
+    size_t* lda,
+    size_t CountM,
+    size_t CountK,
+    bool AIsSigned
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a panel of signed matrix A to unsigned data in a
+    local buffer by flipping the sign bit of each element. The buffer is then
+    packed by the CopyPackA routine of the kernel, so the kernels only need to
+    support unsigned matrix A.
+
+Arguments:
+
+    D - Supplies the address of the local buffer, which holds at least
+        CountM * CountK elements.
+
+    A - Supplies the address of the panel of matrix A.
+
+    lda - Supplies the first dimension of matrix A and receives the first
+        dimension of the returned panel.
+
+    CountM - Supplies the number of rows of the panel.
+
+    CountK - Supplies the number of columns of the panel.
+
+    AIsSigned - Supplies true if matrix A is signed data.
+
+Return Value:
+
+    Returns the address of the unsigned panel of matrix A, which is A itself
+    if matrix A is already unsigned.
+
+--*/
+{
+    if (!AIsSigned) {
+        return A;
+    }
+
+    for (size_t m = 0; m < CountM; m++) {
+
+        const uint8_t* a = A + m * (*lda);
+        uint8_t* d = D + m * CountK;
+        size_t k = 0;
+
+#if defined(MLAS_SSE2_INTRINSICS)
+        const __m128i BitFlipVector = _mm_set1_epi32(0x80808080);
+
+        for (; k + 16 <= CountK; k += 16) {
+            __m128i Bytes = _mm_loadu_si128((const __m128i*)&a[k]);
+            _mm_storeu_si128((__m128i*)&d[k], _mm_xor_si128(Bytes, BitFlipVector));
+        }
+#elif defined(MLAS_NEON_INTRINSICS)
+        const uint8x16_t BitFlipVector = vdupq_n_u8(0x80);
+
+        for (; k + 16 <= CountK; k += 16) {
+            vst1q_u8(&d[k], veorq_u8(vld1q_u8(&a[k]), BitFlipVector));
+        }
+#endif
+
+        for (; k < CountK; k++) {
+            d[k] = uint8_t(a[k] ^ 0x80);
+        }
+    }
+
+    *lda = CountK;
+
+    return D;
+}
+
 template<typename KernelType>
 void
 MlasGemmU8X8Operation(
@@ -272,6 +375,7 @@ Return Value:
     constexpr MLAS_GEMM_U8X8_STRIDES Strides = KernelType::Strides;
 
     MLAS_DECLSPEC_ALIGN(typename KernelType::PackedAType PanelA[Strides.M * Strides.K], 64);
+    MLAS_DECLSPEC_ALIGN(uint8_t PanelASigned[Strides.M * Strides.K], 64);
     MLAS_DECLSPEC_ALIGN(typename KernelType::PackedBType PanelB[Strides.N * Strides.K], 64);
 
     MLAS_DECLSPEC_ALIGN(int32_t RowSumBuffer[Strides.M], 64);
@@ -290,14 +394,14 @@ Return Value:
     const uint8_t* PackedZeroPointB = Data->PerColumnZeroPoints ?
         Data->ZeroPointB + RangeStartN : nullptr;
 
-    int32_t ZeroPointA = Data->ZeroPointA;
+    int32_t ZeroPointA = MlasGemmU8X8FixupZeroPointA(Data->ZeroPointA, Shape->AIsSigned);
     int32_t ZeroPointB = typename KernelType::OffsetBType(*Data->ZeroPointB);
 
     //
     // Try to use a GEMV kernel if supported by this kernel type.
     //
 
-    if ((RangeCountM == 1) &&
+    if ((RangeCountM == 1) && !Shape->AIsSigned &&
         (ZeroPointA == 0) && (PackedZeroPointB == nullptr) && (ZeroPointB == 0) &&
         (Data->OutputProcessor == nullptr)) {
         if (MlasGemmU8X8TryGemvKernel<KernelType>(A, B, ldb, C, K, RangeCountN, Shape->BIsSigned)) {
@@ -378,10 +482,14 @@ Return Value:
                 // Copy a panel of matrix A to a local packed buffer.
                 //
 
+                size_t ldPanelA = lda;
+                const uint8_t* UnsignedA = MlasGemmU8X8ConvertSignedA(
+                    PanelASigned, A + m * lda, &ldPanelA, CountM, CountK, Shape->AIsSigned);
+
                 MlasGemmU8X8CopyPackA<KernelType>(
                     PanelA,
-                    A + m * lda,
-                    lda,
+                    UnsignedA,
+                    ldPanelA,
                     CountM,
                     CountK,
                     RowSumBuffer);
@@ -498,6 +606,7 @@ Return Value:
     constexpr MLAS_GEMM_U8X8_STRIDES Strides = KernelType::PackedStrides;
 
     MLAS_DECLSPEC_ALIGN(typename KernelType::PackedAType PanelA[Strides.M * Strides.K], 64);
+    MLAS_DECLSPEC_ALIGN(uint8_t PanelASigned[Strides.M * Strides.K], 64);
 
     MLAS_DECLSPEC_ALIGN(int32_t RowSumBuffer[Strides.M], 64);
     MLAS_DECLSPEC_ALIGN(int32_t ColumnSumBuffer[Strides.N], 64);
@@ -514,7 +623,7 @@ Return Value:
     const uint8_t* PackedZeroPointB = Data->PerColumnZeroPoints ?
         Data->ZeroPointB + RangeStartN : nullptr;
 
-    int32_t ZeroPointA = Data->ZeroPointA;
+    int32_t ZeroPointA = MlasGemmU8X8FixupZeroPointA(Data->ZeroPointA, Shape->AIsSigned);
     int32_t ZeroPointB = typename KernelType::OffsetBType(*Data->ZeroPointB);
 
     //
@@ -596,10 +705,14 @@ Return Value:
                 // Copy a panel of matrix A to a local packed buffer.
                 //
 
+                size_t ldPanelA = lda;
+                const uint8_t* UnsignedA = MlasGemmU8X8ConvertSignedA(
+                    PanelASigned, A + m * lda, &ldPanelA, CountM, CountK, Shape->AIsSigned);
+
                 MlasGemmU8X8CopyPackA<KernelType>(
                     PanelA,
-                    A + m * lda,
-                    lda,
+                    UnsignedA,
+                    ldPanelA,
                     CountM,
                     CountK,
                     RowSumBuffer);
@@ -1768,6 +1881,21 @@ constexpr size_t MLAS_GEMM_U8U8_KERNEL_AVX2::PackedK;
 constexpr MLAS_GEMM_U8X8_STRIDES MLAS_GEMM_U8U8_KERNEL_AVX2::Strides;
 constexpr MLAS_GEMM_U8X8_STRIDES MLAS_GEMM_U8U8_KERNEL_AVX2::PackedStrides;
 
+template<>
+MLAS_FORCEINLINE
+int32_t
+MlasGemmU8X8FixupZeroPointB<MLAS_GEMM_U8U8_KERNEL_AVX2>(
+    int32_t ZeroPointB,
+    bool BIsSigned
+    )
+{
+    if (BIsSigned) {
+        ZeroPointB = MLAS_GEMM_U8U8_KERNEL_AVX2::OffsetBType(ZeroPointB ^ 0x80);
+    }
+
+    return ZeroPointB;
+}
+
 template<>
 MLAS_FORCEINLINE
 void
@@ -1796,9 +1924,50 @@ MlasGemmU8X8CopyPackB<MLAS_GEMM_U8U8_KERNEL_AVX2>(
     bool BIsSigned
     )
 {
-    MLAS_UNREFERENCED_PARAMETER(BIsSigned);
+    if (!BIsSigned) {
+        MlasGemmU8U8CopyPackBAvx2(D, B, ldb, CountN, CountK, ColumnSumBuffer);
+        return;
+    }
+
+    //
+    // Convert signed matrix B to unsigned data by flipping the sign bit of
+    // each element as panels of 16 columns are copied to a local buffer. The
+    // zero point offset is flipped to match by MlasGemmU8X8FixupZeroPointB.
+    //
+
+    constexpr size_t PanelN = 16;
+    constexpr size_t PackedK = MLAS_GEMM_U8U8_KERNEL_AVX2::PackedK;
+    MLAS_DECLSPEC_ALIGN(uint8_t PanelB[PanelN * MLAS_GEMM_U8U8_KERNEL_AVX2::PackedStrides.K], 64);
 
-    MlasGemmU8U8CopyPackBAvx2(D, B, ldb, CountN, CountK, ColumnSumBuffer);
+    const size_t AlignedCountK = (CountK + PackedK - 1) & ~(PackedK - 1);
+    const __m128i BitFlipVector = _mm_set1_epi32(0x80808080);
+
+    while (CountN > 0) {
+
+        const size_t CountPanelN = std::min(CountN, PanelN);
+
+        for (size_t k = 0; k < CountK; k++) {
+
+            const uint8_t* b = B + k * ldb;
+            uint8_t* d = PanelB + k * PanelN;
+
+            if (CountPanelN == PanelN) {
+                __m128i Bytes = _mm_loadu_si128((const __m128i*)b);
+                _mm_storeu_si128((__m128i*)d, _mm_xor_si128(Bytes, BitFlipVector));
+            } else {
+                for (size_t n = 0; n < CountPanelN; n++) {
+                    d[n] = uint8_t(b[n] ^ 0x80);
+                }
+            }
+        }
+
+        MlasGemmU8U8CopyPackBAvx2(D, PanelB, PanelN, CountPanelN, CountK, ColumnSumBuffer);
+
+        D += PanelN * AlignedCountK;
+        B += CountPanelN;
+        ColumnSumBuffer += CountPanelN;
+        CountN -= CountPanelN;
+    }
 }
 
 template<>
@@ -3151,7 +3320,7 @@ Return Value:
     // Dispatch the partitioned operation.
     //
 
-    const auto* GemmU8X8Dispatch = MlasGemmU8X8GetDispatch(Shape->BIsSigned);
+    const auto* GemmU8X8Dispatch = MlasGemmU8X8GetDispatch(Shape->AIsSigned, Shape->BIsSigned);
     MLAS_GEMM_U8X8_OPERATION* GemmU8X8Operation;
 
     if (Data->BIsPacked) {
@@ -3278,6 +3447,7 @@ MLASCALL
 MlasGemmPackBSize(
     size_t N,
     size_t K,
+    bool AIsSigned,
     bool BIsSigned
     )
 /*++
@@ -3293,6 +3463,9 @@ Arguments:
 
     K - Supplies the the number of rows of matrix B.
 
+    AIsSigned - Supplies true if the packed matrix will be multiplied by signed
+        matrix A, else false if matrix A is unsigned data.
+
     BIsSigned - Supplies true if matrix B is signed data, else false if matrix
         B is unsigned data.
 
@@ -3307,7 +3480,7 @@ Return Value:
     // Retrieve the packing parameters.
     //
 
-    const auto* GemmU8X8Dispatch = MlasGemmU8X8GetDispatch(BIsSigned);
+    const auto* GemmU8X8Dispatch = MlasGemmU8X8GetDispatch(AIsSigned, BIsSigned);
 
     size_t PackedK = GemmU8X8Dispatch->PackedK;
     size_t PackedStrideK = GemmU8X8Dispatch->PackedStrideK;
@@ -3333,6 +3506,39 @@ Return Value:
     return AlignedBytesRequired;
 }
 
+size_t
+MLASCALL
+MlasGemmPackBSize(
+    size_t N,
+    size_t K,
+    bool BIsSigned
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the number of bytes required to pack a matrix with
+    the supplied shape and type for use with unsigned matrix A.
+
+Arguments:
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the the number of rows of matrix B.
+
+    BIsSigned - Supplies true if matrix B is signed data, else false if matrix
+        B is unsigned data.
+
+Return Value:
+
+    Returns the number of bytes required to pack the matrix, else zero if the
+        current implementation does not support packing.
+
+--*/
+{
+    return MlasGemmPackBSize(N, K, false, BIsSigned);
+}
+
 void
 MLASCALL
 MlasGemmPackB(
@@ -3340,6 +3546,7 @@ MlasGemmPackB(
     size_t K,
     const uint8_t* B,
     size_t ldb,
+    bool AIsSigned,
     bool BIsSigned,
     void* PackedB
     )
@@ -3360,6 +3567,10 @@ Arguments:
 
     ldb - Supplies the first dimension of matrix B.
 
+    AIsSigned - Supplies true if the packed matrix will be multiplied by signed
+        matrix A, else false if matrix A is unsigned data. The packed format
+        depends on the kernel selected for the pair of types.
+
     BIsSigned - Supplies true if matrix B is signed data, else false if matrix
         B is unsigned data.
 
@@ -3375,7 +3586,7 @@ Return Value:
     // Retrieve the packing parameters.
     //
 
-    const auto* GemmU8X8Dispatch = MlasGemmU8X8GetDispatch(BIsSigned);
+    const auto* GemmU8X8Dispatch = MlasGemmU8X8GetDispatch(AIsSigned, BIsSigned);
 
     size_t PackedK = GemmU8X8Dispatch->PackedK;
     size_t PackedStrideK = GemmU8X8Dispatch->PackedStrideK;
@@ -3435,3 +3646,44 @@ Return Value:
         B += ldb * CountK;
     }
 }
+
+void
+MLASCALL
+MlasGemmPackB(
+    size_t N,
+    size_t K,
+    const uint8_t* B,
+    size_t ldb,
+    bool BIsSigned,
+    void* PackedB
+    )
+/*++
+
+Routine Description:
+
+    This routine packs the supplied matrix B for use with unsigned matrix A.
+    The size of the packed buffer was obtained from MlasGemmPackBSize.
+
+Arguments:
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the the number of rows of matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    BIsSigned - Supplies true if matrix B is signed data, else false if matrix
+        B is unsigned data.
+
+    PackedB - Supplies the address of packed matrix B.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MlasGemmPackB(N, K, B, ldb, false, BIsSigned, PackedB);
+}
@@ -0,0 +1,1167 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    reduce.cpp
+
+Abstract:
+
+    This module implements routines to reduce a tensor along a single axis.
+
+    The reduced axis is either contiguous in memory or strided by the product
+    of the inner dimensions. Contiguous reductions accumulate each row with
+    vector accumulators and then reduce across the vector lanes. Strided
+    reductions vectorize across the inner dimension so that each load consumes
+    adjacent elements.
+
+    Our usage requires building platform specific versions of the algorithm to
+    target different instruction sets. The implementation below targets the
+    base instruction set (typically SSE2 or NEON) while intrinsic
+    implementations target newer instruction sets (such as AVX2).
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the number of inner elements processed by a single work item of a
+// strided reduction. This also sizes the stack buffers used by the log sum
+// exponent and argmax reductions.
+//
+
+#define MLAS_REDUCTION_INNER_BLOCK_SIZE 256
+
+//
+// Define the parameters to execute segments of a reduction operation on worker
+// threads.
+//
+
+struct MLAS_REDUCTION_WORK_BLOCK {
+    MLAS_REDUCTION_KIND ReductionKind;
+    const float* Input;
+    float* Output;
+    int64_t* Indices;
+    size_t OuterCount;
+    size_t ReduceCount;
+    size_t InnerCount;
+    size_t InnerBlockCount;
+    ptrdiff_t ThreadCount;
+    bool SelectLastIndex;
+    bool PartitionReduceCount;
+    float PartialValues[MLAS_MAXIMUM_THREAD_COUNT];
+    float PartialSums[MLAS_MAXIMUM_THREAD_COUNT];
+    int64_t PartialIndices[MLAS_MAXIMUM_THREAD_COUNT];
+};
+
+//
+// Define the operations used by the generic reduction kernels.
+//
+
+struct MLAS_REDUCTION_SUM_OPERATION {
+
+    static float InitialValue() { return 0.0f; }
+
+    static MLAS_FLOAT32X4 Accumulate(MLAS_FLOAT32X4 Accumulator, MLAS_FLOAT32X4 Vector)
+    {
+        return MlasAddFloat32x4(Accumulator, Vector);
+    }
+
+    static float Accumulate(float Accumulator, float Value) { return Accumulator + Value; }
+
+    static MLAS_FLOAT32X4 Combine(MLAS_FLOAT32X4 Vector1, MLAS_FLOAT32X4 Vector2)
+    {
+        return MlasAddFloat32x4(Vector1, Vector2);
+    }
+
+    static float Reduce(MLAS_FLOAT32X4 Vector) { return MlasReduceAddFloat32x4(Vector); }
+};
+
+struct MLAS_REDUCTION_SUM_SQUARE_OPERATION : MLAS_REDUCTION_SUM_OPERATION {
+
+    static MLAS_FLOAT32X4 Accumulate(MLAS_FLOAT32X4 Accumulator, MLAS_FLOAT32X4 Vector)
+    {
+        return MlasMultiplyAddFloat32x4(Vector, Vector, Accumulator);
+    }
+
+    static float Accumulate(float Accumulator, float Value) { return Accumulator + Value * Value; }
+};
+
+struct MLAS_REDUCTION_MAXIMUM_OPERATION {
+
+    static float InitialValue() { return -std::numeric_limits<float>::infinity(); }
+
+    static MLAS_FLOAT32X4 Accumulate(MLAS_FLOAT32X4 Accumulator, MLAS_FLOAT32X4 Vector)
+    {
+        return MlasMaximumFloat32x4(Accumulator, Vector);
+    }
+
+    static float Accumulate(float Accumulator, float Value) { return std::max(Accumulator, Value); }
+
+    static MLAS_FLOAT32X4 Combine(MLAS_FLOAT32X4 Vector1, MLAS_FLOAT32X4 Vector2)
+    {
+        return MlasMaximumFloat32x4(Vector1, Vector2);
+    }
+
+    static float Reduce(MLAS_FLOAT32X4 Vector) { return MlasReduceMaximumFloat32x4(Vector); }
+};
+
+struct MLAS_REDUCTION_MINIMUM_OPERATION {
+
+    static float InitialValue() { return std::numeric_limits<float>::infinity(); }
+
+    static MLAS_FLOAT32X4 Accumulate(MLAS_FLOAT32X4 Accumulator, MLAS_FLOAT32X4 Vector)
+    {
+        return MlasMinimumFloat32x4(Accumulator, Vector);
+    }
+
+    static float Accumulate(float Accumulator, float Value) { return std::min(Accumulator, Value); }
+
+    static MLAS_FLOAT32X4 Combine(MLAS_FLOAT32X4 Vector1, MLAS_FLOAT32X4 Vector2)
+    {
+        return MlasMinimumFloat32x4(Vector1, Vector2);
+    }
+
+    static float Reduce(MLAS_FLOAT32X4 Vector) { return MlasReduceMinimumFloat32x4(Vector); }
+};
+
+template<typename ReductionOperation>
+float
+MlasReduceF32KernelImpl(
+    const float* Input,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the generic kernel to reduce a contiguous buffer.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    Returns the reduced value of the supplied buffer.
+
+--*/
+{
+    float Accumulator = ReductionOperation::InitialValue();
+
+    if (N >= 4) {
+
+        MLAS_FLOAT32X4 AccumulatorVector0 = MlasBroadcastFloat32x4(Accumulator);
+
+        if (N >= 16) {
+
+            MLAS_FLOAT32X4 AccumulatorVector1 = AccumulatorVector0;
+            MLAS_FLOAT32X4 AccumulatorVector2 = AccumulatorVector0;
+            MLAS_FLOAT32X4 AccumulatorVector3 = AccumulatorVector0;
+
+            while (N >= 16) {
+
+                AccumulatorVector0 = ReductionOperation::Accumulate(AccumulatorVector0, MlasLoadFloat32x4(Input));
+                AccumulatorVector1 = ReductionOperation::Accumulate(AccumulatorVector1, MlasLoadFloat32x4(Input + 4));
+                AccumulatorVector2 = ReductionOperation::Accumulate(AccumulatorVector2, MlasLoadFloat32x4(Input + 8));
+                AccumulatorVector3 = ReductionOperation::Accumulate(AccumulatorVector3, MlasLoadFloat32x4(Input + 12));
+
+                Input += 16;
+                N -= 16;
+            }
+
+            AccumulatorVector0 = ReductionOperation::Combine(AccumulatorVector0, AccumulatorVector1);
+            AccumulatorVector2 = ReductionOperation::Combine(AccumulatorVector2, AccumulatorVector3);
+            AccumulatorVector0 = ReductionOperation::Combine(AccumulatorVector0, AccumulatorVector2);
+        }
+
+        while (N >= 4) {
+
+            AccumulatorVector0 = ReductionOperation::Accumulate(AccumulatorVector0, MlasLoadFloat32x4(Input));
+
+            Input += 4;
+            N -= 4;
+        }
+
+        Accumulator = ReductionOperation::Reduce(AccumulatorVector0);
+    }
+
+    while (N > 0) {
+
+        Accumulator = ReductionOperation::Accumulate(Accumulator, *Input);
+
+        Input += 1;
+        N -= 1;
+    }
+
+    return Accumulator;
+}
+
+template<typename ReductionOperation>
+void
+MlasReduceStridedF32KernelImpl(
+    const float* Input,
+    float* Output,
+    size_t ReduceCount,
+    size_t InnerCount,
+    size_t InputStride
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the generic kernel to reduce a set of rows to a
+    single output row.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    ReduceCount - Supplies the number of rows to reduce.
+
+    InnerCount - Supplies the number of elements of each row to process.
+
+    InputStride - Supplies the number of elements between rows of the input
+        buffer.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const MLAS_FLOAT32X4 InitialVector = MlasBroadcastFloat32x4(ReductionOperation::InitialValue());
+
+    while (InnerCount >= 16) {
+
+        MLAS_FLOAT32X4 AccumulatorVector0 = InitialVector;
+        MLAS_FLOAT32X4 AccumulatorVector1 = InitialVector;
+        MLAS_FLOAT32X4 AccumulatorVector2 = InitialVector;
+        MLAS_FLOAT32X4 AccumulatorVector3 = InitialVector;
+
+        const float* input = Input;
+
+        for (size_t r = 0; r < ReduceCount; r++) {
+
+            AccumulatorVector0 = ReductionOperation::Accumulate(AccumulatorVector0, MlasLoadFloat32x4(input));
+            AccumulatorVector1 = ReductionOperation::Accumulate(AccumulatorVector1, MlasLoadFloat32x4(input + 4));
+            AccumulatorVector2 = ReductionOperation::Accumulate(AccumulatorVector2, MlasLoadFloat32x4(input + 8));
+            AccumulatorVector3 = ReductionOperation::Accumulate(AccumulatorVector3, MlasLoadFloat32x4(input + 12));
+
+            input += InputStride;
+        }
+
+        MlasStoreFloat32x4(Output, AccumulatorVector0);
+        MlasStoreFloat32x4(Output + 4, AccumulatorVector1);
+        MlasStoreFloat32x4(Output + 8, AccumulatorVector2);
+        MlasStoreFloat32x4(Output + 12, AccumulatorVector3);
+
+        Input += 16;
+        Output += 16;
+        InnerCount -= 16;
+    }
+
+    while (InnerCount >= 4) {
+
+        MLAS_FLOAT32X4 AccumulatorVector = InitialVector;
+
+        const float* input = Input;
+
+        for (size_t r = 0; r < ReduceCount; r++) {
+            AccumulatorVector = ReductionOperation::Accumulate(AccumulatorVector, MlasLoadFloat32x4(input));
+            input += InputStride;
+        }
+
+        MlasStoreFloat32x4(Output, AccumulatorVector);
+
+        Input += 4;
+        Output += 4;
+        InnerCount -= 4;
+    }
+
+    while (InnerCount > 0) {
+
+        float Accumulator = ReductionOperation::InitialValue();
+
+        const float* input = Input;
+
+        for (size_t r = 0; r < ReduceCount; r++) {
+            Accumulator = ReductionOperation::Accumulate(Accumulator, *input);
+            input += InputStride;
+        }
+
+        *Output = Accumulator;
+
+        Input += 1;
+        Output += 1;
+        InnerCount -= 1;
+    }
+}
+
+float
+MLASCALL
+MlasReduceF32Kernel(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the generic kernel to reduce a contiguous buffer.
+
+Arguments:
+
+    ReductionKind - Supplies the kind of reduction operation. Only the sum,
+        sum square, maximum, and minimum reductions are supported.
+
+    Input - Supplies the input buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    Returns the reduced value of the supplied buffer.
+
+--*/
+{
+    switch (ReductionKind) {
+
+        case MlasSumReduction:
+            return MlasReduceF32KernelImpl<MLAS_REDUCTION_SUM_OPERATION>(Input, N);
+
+        case MlasSumSquareReduction:
+            return MlasReduceF32KernelImpl<MLAS_REDUCTION_SUM_SQUARE_OPERATION>(Input, N);
+
+        case MlasMaximumReduction:
+            return MlasReduceF32KernelImpl<MLAS_REDUCTION_MAXIMUM_OPERATION>(Input, N);
+
+        default:
+            return MlasReduceF32KernelImpl<MLAS_REDUCTION_MINIMUM_OPERATION>(Input, N);
+    }
+}
+
+void
+MLASCALL
+MlasReduceStridedF32Kernel(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    float* Output,
+    size_t ReduceCount,
+    size_t InnerCount,
+    size_t InputStride
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the generic kernel to reduce a set of rows to a
+    single output row.
+
+Arguments:
+
+    ReductionKind - Supplies the kind of reduction operation. Only the sum,
+        sum square, maximum, and minimum reductions are supported.
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    ReduceCount - Supplies the number of rows to reduce.
+
+    InnerCount - Supplies the number of elements of each row to process.
+
+    InputStride - Supplies the number of elements between rows of the input
+        buffer.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    switch (ReductionKind) {
+
+        case MlasSumReduction:
+            MlasReduceStridedF32KernelImpl<MLAS_REDUCTION_SUM_OPERATION>(
+                Input, Output, ReduceCount, InnerCount, InputStride);
+            break;
+
+        case MlasSumSquareReduction:
+            MlasReduceStridedF32KernelImpl<MLAS_REDUCTION_SUM_SQUARE_OPERATION>(
+                Input, Output, ReduceCount, InnerCount, InputStride);
+            break;
+
+        case MlasMaximumReduction:
+            MlasReduceStridedF32KernelImpl<MLAS_REDUCTION_MAXIMUM_OPERATION>(
+                Input, Output, ReduceCount, InnerCount, InputStride);
+            break;
+
+        default:
+            MlasReduceStridedF32KernelImpl<MLAS_REDUCTION_MINIMUM_OPERATION>(
+                Input, Output, ReduceCount, InnerCount, InputStride);
+            break;
+    }
+}
+
+MLAS_FORCEINLINE
+float
+MlasReduceContiguous(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    size_t N
+    )
+{
+#if defined(MLAS_TARGET_AMD64)
+    return MlasPlatform.ReduceF32Kernel(ReductionKind, Input, N);
+#else
+    return MlasReduceF32Kernel(ReductionKind, Input, N);
+#endif
+}
+
+MLAS_FORCEINLINE
+void
+MlasReduceStrided(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    float* Output,
+    size_t ReduceCount,
+    size_t InnerCount,
+    size_t InputStride
+    )
+{
+#if defined(MLAS_TARGET_AMD64)
+    MlasPlatform.ReduceStridedF32Kernel(ReductionKind, Input, Output, ReduceCount, InnerCount, InputStride);
+#else
+    MlasReduceStridedF32Kernel(ReductionKind, Input, Output, ReduceCount, InnerCount, InputStride);
+#endif
+}
+
+MLAS_FORCEINLINE
+float
+MlasComputeSumExpContiguous(
+    const float* Input,
+    size_t N,
+    float Maximum
+    )
+{
+    float NegativeMaximum = -Maximum;
+
+#if defined(MLAS_TARGET_AMD64)
+    return MlasPlatform.ComputeSumExpF32Kernel(Input, nullptr, N, &NegativeMaximum);
+#else
+    return MlasComputeSumExpF32Kernel(Input, nullptr, N, &NegativeMaximum);
+#endif
+}
+
+float
+MlasReduceRow(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    size_t ReduceCount
+    )
+/*++
+
+Routine Description:
+
+    This routine reduces a contiguous row of the input tensor.
+
+Arguments:
+
+    ReductionKind - Supplies the kind of reduction operation.
+
+    Input - Supplies the input buffer.
+
+    ReduceCount - Supplies the number of elements to reduce.
+
+Return Value:
+
+    Returns the reduced value of the row.
+
+--*/
+{
+    switch (ReductionKind) {
+
+        case MlasMeanReduction:
+        {
+            return MlasReduceContiguous(MlasSumReduction, Input, ReduceCount) / float(ReduceCount);
+        }
+
+        case MlasLogSumExpReduction:
+        {
+            //
+            // Shift the exponentials by the maximum value for numerical
+            // stability. An infinite maximum value is also the result.
+            //
+
+            float Maximum = MlasReduceContiguous(MlasMaximumReduction, Input, ReduceCount);
+
+            if (std::isinf(Maximum)) {
+                return Maximum;
+            }
+
+            return std::log(MlasComputeSumExpContiguous(Input, ReduceCount, Maximum)) + Maximum;
+        }
+
+        default:
+        {
+            return MlasReduceContiguous(ReductionKind, Input, ReduceCount);
+        }
+    }
+}
+
+void
+MlasReduceStridedBlock(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    float* Output,
+    size_t ReduceCount,
+    size_t CountJ,
+    size_t InnerCount
+    )
+/*++
+
+Routine Description:
+
+    This routine reduces a block of columns of the input tensor along a
+    strided axis.
+
+Arguments:
+
+    ReductionKind - Supplies the kind of reduction operation.
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    ReduceCount - Supplies the number of rows to reduce.
+
+    CountJ - Supplies the number of columns to process. This must be no larger
+        than MLAS_REDUCTION_INNER_BLOCK_SIZE.
+
+    InnerCount - Supplies the number of elements between rows of the input
+        buffer.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    switch (ReductionKind) {
+
+        case MlasMeanReduction:
+        {
+            MlasReduceStrided(MlasSumReduction, Input, Output, ReduceCount, CountJ, InnerCount);
+
+            for (size_t j = 0; j < CountJ; j++) {
+                Output[j] /= float(ReduceCount);
+            }
+            break;
+        }
+
+        case MlasLogSumExpReduction:
+        {
+            MlasReduceStrided(MlasMaximumReduction, Input, Output, ReduceCount, CountJ, InnerCount);
+
+            float Shift[MLAS_REDUCTION_INNER_BLOCK_SIZE];
+            float Sum[MLAS_REDUCTION_INNER_BLOCK_SIZE];
+            float Buffer[MLAS_REDUCTION_INNER_BLOCK_SIZE];
+
+            for (size_t j = 0; j < CountJ; j++) {
+                Shift[j] = std::isinf(Output[j]) ? 0.0f : Output[j];
+                Sum[j] = 0.0f;
+            }
+
+            for (size_t r = 0; r < ReduceCount; r++) {
+
+                const float* input = Input + r * InnerCount;
+
+                for (size_t j = 0; j < CountJ; j++) {
+                    Buffer[j] = input[j] - Shift[j];
+                }
+
+                MlasComputeExp(Buffer, Buffer, CountJ);
+
+                for (size_t j = 0; j < CountJ; j++) {
+                    Sum[j] += Buffer[j];
+                }
+            }
+
+            for (size_t j = 0; j < CountJ; j++) {
+                if (!std::isinf(Output[j])) {
+                    Output[j] = std::log(Sum[j]) + Shift[j];
+                }
+            }
+            break;
+        }
+
+        default:
+        {
+            MlasReduceStrided(ReductionKind, Input, Output, ReduceCount, CountJ, InnerCount);
+            break;
+        }
+    }
+}
+
+int64_t
+MlasArgMaximumRow(
+    const float* Input,
+    size_t ReduceCount,
+    bool SelectLastIndex,
+    float* MaximumValue
+    )
+/*++
+
+Routine Description:
+
+    This routine finds the index of the maximum value of a contiguous row of
+    the input tensor.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    ReduceCount - Supplies the number of elements to search.
+
+    SelectLastIndex - Supplies true if the last index of a repeated maximum
+        value is returned, else the first index is returned.
+
+    MaximumValue - Receives the maximum value of the row.
+
+Return Value:
+
+    Returns the index of the maximum value.
+
+--*/
+{
+    //
+    // Find the maximum value with the vectorized kernel and then search for
+    // the index of the value.
+    //
+
+    float Maximum = MlasReduceContiguous(MlasMaximumReduction, Input, ReduceCount);
+
+    if (SelectLastIndex) {
+        for (size_t i = ReduceCount; i > 0; i--) {
+            if (Input[i - 1] == Maximum) {
+                *MaximumValue = Maximum;
+                return int64_t(i - 1);
+            }
+        }
+    } else {
+        for (size_t i = 0; i < ReduceCount; i++) {
+            if (Input[i] == Maximum) {
+                *MaximumValue = Maximum;
+                return int64_t(i);
+            }
+        }
+    }
+
+    //
+    // The search fails if the row contains a NaN value, so fall back to an
+    // ordered scan of the row.
+    //
+
+    size_t Index = 0;
+    Maximum = Input[0];
+
+    for (size_t i = 1; i < ReduceCount; i++) {
+        if (Input[i] > Maximum || (SelectLastIndex && Input[i] == Maximum)) {
+            Maximum = Input[i];
+            Index = i;
+        }
+    }
+
+    *MaximumValue = Maximum;
+    return int64_t(Index);
+}
+
+void
+MlasArgMaximumStridedBlock(
+    const float* Input,
+    int64_t* Indices,
+    size_t ReduceCount,
+    size_t CountJ,
+    size_t InnerCount,
+    bool SelectLastIndex
+    )
+/*++
+
+Routine Description:
+
+    This routine finds the index of the maximum value for a block of columns
+    of the input tensor along a strided axis.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Indices - Supplies the output buffer.
+
+    ReduceCount - Supplies the number of rows to search.
+
+    CountJ - Supplies the number of columns to process. This must be no larger
+        than MLAS_REDUCTION_INNER_BLOCK_SIZE.
+
+    InnerCount - Supplies the number of elements between rows of the input
+        buffer.
+
+    SelectLastIndex - Supplies true if the last index of a repeated maximum
+        value is returned, else the first index is returned.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    float Maximum[MLAS_REDUCTION_INNER_BLOCK_SIZE];
+
+    for (size_t j = 0; j < CountJ; j++) {
+        Maximum[j] = Input[j];
+        Indices[j] = 0;
+    }
+
+    for (size_t r = 1; r < ReduceCount; r++) {
+
+        const float* input = Input + r * InnerCount;
+
+        for (size_t j = 0; j < CountJ; j++) {
+            if (input[j] > Maximum[j] || (SelectLastIndex && input[j] == Maximum[j])) {
+                Maximum[j] = input[j];
+                Indices[j] = int64_t(r);
+            }
+        }
+    }
+}
+
+void
+MlasReduceThreaded(
+    void* Context,
+    ptrdiff_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    reduction operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    Index - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    auto* WorkBlock = (MLAS_REDUCTION_WORK_BLOCK*)Context;
+
+    const MLAS_REDUCTION_KIND ReductionKind = WorkBlock->ReductionKind;
+    const size_t ReduceCount = WorkBlock->ReduceCount;
+    const size_t InnerCount = WorkBlock->InnerCount;
+
+    if (WorkBlock->PartitionReduceCount) {
+
+        //
+        // Partition the operation along the reduced dimension. Each thread
+        // produces a partial result that is combined after the threads have
+        // completed.
+        //
+
+        size_t r;
+        size_t CountR;
+
+        MlasPartitionWork(Index, WorkBlock->ThreadCount, ReduceCount, &r, &CountR);
+
+        const float* Input = WorkBlock->Input + r;
+
+        if (WorkBlock->Indices != nullptr) {
+
+            float Maximum;
+            int64_t PartialIndex = MlasArgMaximumRow(Input, CountR, WorkBlock->SelectLastIndex, &Maximum);
+
+            WorkBlock->PartialValues[Index] = Maximum;
+            WorkBlock->PartialIndices[Index] = int64_t(r) + PartialIndex;
+
+        } else if (ReductionKind == MlasLogSumExpReduction) {
+
+            float Maximum = MlasReduceContiguous(MlasMaximumReduction, Input, CountR);
+
+            WorkBlock->PartialValues[Index] = Maximum;
+            WorkBlock->PartialSums[Index] =
+                std::isinf(Maximum) ? 0.0f : MlasComputeSumExpContiguous(Input, CountR, Maximum);
+
+        } else {
+
+            MLAS_REDUCTION_KIND PartialKind =
+                (ReductionKind == MlasMeanReduction) ? MlasSumReduction : ReductionKind;
+
+            WorkBlock->PartialValues[Index] = MlasReduceContiguous(PartialKind, Input, CountR);
+        }
+
+        return;
+    }
+
+    //
+    // Partition the operation along the outer dimension and blocks of the
+    // inner dimension.
+    //
+
+    size_t WorkIndex;
+    size_t WorkRemaining;
+
+    MlasPartitionWork(Index, WorkBlock->ThreadCount, WorkBlock->OuterCount * WorkBlock->InnerBlockCount,
+        &WorkIndex, &WorkRemaining);
+
+    while (WorkRemaining > 0) {
+
+        const size_t o = WorkIndex / WorkBlock->InnerBlockCount;
+        const size_t j = (WorkIndex % WorkBlock->InnerBlockCount) * MLAS_REDUCTION_INNER_BLOCK_SIZE;
+        const size_t CountJ = std::min(InnerCount - j, size_t(MLAS_REDUCTION_INNER_BLOCK_SIZE));
+
+        const float* Input = WorkBlock->Input + o * ReduceCount * InnerCount + j;
+        const size_t OutputOffset = o * InnerCount + j;
+
+        if (WorkBlock->Indices != nullptr) {
+
+            if (InnerCount == 1) {
+                float Maximum;
+                WorkBlock->Indices[OutputOffset] =
+                    MlasArgMaximumRow(Input, ReduceCount, WorkBlock->SelectLastIndex, &Maximum);
+            } else {
+                MlasArgMaximumStridedBlock(Input, WorkBlock->Indices + OutputOffset, ReduceCount,
+                    CountJ, InnerCount, WorkBlock->SelectLastIndex);
+            }
+
+        } else {
+
+            if (InnerCount == 1) {
+                WorkBlock->Output[OutputOffset] = MlasReduceRow(ReductionKind, Input, ReduceCount);
+            } else {
+                MlasReduceStridedBlock(ReductionKind, Input, WorkBlock->Output + OutputOffset,
+                    ReduceCount, CountJ, InnerCount);
+            }
+        }
+
+        WorkIndex++;
+        WorkRemaining--;
+    }
+}
+
+void
+MlasReduceExecute(
+    MLAS_REDUCTION_WORK_BLOCK* WorkBlock,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine partitions a reduction operation across the thread pool and
+    combines any partial results.
+
+Arguments:
+
+    WorkBlock - Supplies the structure that contains the reduction parameters.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t OuterCount = WorkBlock->OuterCount;
+    const size_t ReduceCount = WorkBlock->ReduceCount;
+    const size_t InnerCount = WorkBlock->InnerCount;
+
+    WorkBlock->InnerBlockCount =
+        (InnerCount + MLAS_REDUCTION_INNER_BLOCK_SIZE - 1) / MLAS_REDUCTION_INNER_BLOCK_SIZE;
+    WorkBlock->PartitionReduceCount = false;
+
+    //
+    // Compute the number of target threads given the complexity of the
+    // reduction. Try to keep each thread processing a minimum number of
+    // elements before using another thread.
+    //
+
+    ptrdiff_t ThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    constexpr size_t MinimumElementsPerThread = 16384;
+
+    const size_t BlockCount = ((OuterCount * ReduceCount * InnerCount) / MinimumElementsPerThread) + 1;
+
+    if (size_t(ThreadCount) > BlockCount) {
+        ThreadCount = ptrdiff_t(BlockCount);
+    }
+
+    //
+    // Partition the kept dimensions across the threads. If there is a single
+    // contiguous row to reduce, then partition the reduced dimension instead.
+    //
+
+    const size_t WorkCount = OuterCount * WorkBlock->InnerBlockCount;
+
+    if (size_t(ThreadCount) > WorkCount) {
+
+        if (OuterCount == 1 && InnerCount == 1) {
+
+            if (ThreadCount > MLAS_MAXIMUM_THREAD_COUNT) {
+                ThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
+            }
+
+            WorkBlock->PartitionReduceCount = true;
+
+        } else {
+
+            ThreadCount = ptrdiff_t(WorkCount);
+        }
+    }
+
+    WorkBlock->ThreadCount = ThreadCount;
+
+    MlasExecuteThreaded(MlasReduceThreaded, WorkBlock, ThreadCount, ThreadPool);
+
+    if (!WorkBlock->PartitionReduceCount) {
+        return;
+    }
+
+    //
+    // Combine the partial results from each thread.
+    //
+
+    if (WorkBlock->Indices != nullptr) {
+
+        float Maximum = WorkBlock->PartialValues[0];
+        int64_t MaximumIndex = WorkBlock->PartialIndices[0];
+
+        for (ptrdiff_t tid = 1; tid < ThreadCount; tid++) {
+            float Value = WorkBlock->PartialValues[tid];
+            if (Value > Maximum || (WorkBlock->SelectLastIndex && Value == Maximum)) {
+                Maximum = Value;
+                MaximumIndex = WorkBlock->PartialIndices[tid];
+            }
+        }
+
+        *WorkBlock->Indices = MaximumIndex;
+        return;
+    }
+
+    float* Output = WorkBlock->Output;
+
+    switch (WorkBlock->ReductionKind) {
+
+        case MlasSumReduction:
+        case MlasSumSquareReduction:
+        case MlasMeanReduction:
+        {
+            float Sum = 0.0f;
+
+            for (ptrdiff_t tid = 0; tid < ThreadCount; tid++) {
+                Sum += WorkBlock->PartialValues[tid];
+            }
+
+            if (WorkBlock->ReductionKind == MlasMeanReduction) {
+                Sum /= float(ReduceCount);
+            }
+
+            *Output = Sum;
+            break;
+        }
+
+        case MlasMaximumReduction:
+        {
+            float Maximum = WorkBlock->PartialValues[0];
+
+            for (ptrdiff_t tid = 1; tid < ThreadCount; tid++) {
+                Maximum = std::max(Maximum, WorkBlock->PartialValues[tid]);
+            }
+
+            *Output = Maximum;
+            break;
+        }
+
+        case MlasMinimumReduction:
+        {
+            float Minimum = WorkBlock->PartialValues[0];
+
+            for (ptrdiff_t tid = 1; tid < ThreadCount; tid++) {
+                Minimum = std::min(Minimum, WorkBlock->PartialValues[tid]);
+            }
+
+            *Output = Minimum;
+            break;
+        }
+
+        default:
+        {
+            //
+            // Rescale the partial sums of exponentials to the overall maximum
+            // value.
+            //
+
+            float Maximum = WorkBlock->PartialValues[0];
+
+            for (ptrdiff_t tid = 1; tid < ThreadCount; tid++) {
+                Maximum = std::max(Maximum, WorkBlock->PartialValues[tid]);
+            }
+
+            if (std::isinf(Maximum)) {
+                *Output = Maximum;
+                break;
+            }
+
+            float Sum = 0.0f;
+
+            for (ptrdiff_t tid = 0; tid < ThreadCount; tid++) {
+                if (!std::isinf(WorkBlock->PartialValues[tid])) {
+                    Sum += WorkBlock->PartialSums[tid] * std::exp(WorkBlock->PartialValues[tid] - Maximum);
+                }
+            }
+
+            *Output = std::log(Sum) + Maximum;
+            break;
+        }
+    }
+}
+
+void
+MLASCALL
+MlasReduce(
+    MLAS_REDUCTION_KIND ReductionKind,
+    const float* Input,
+    float* Output,
+    size_t OuterCount,
+    size_t ReduceCount,
+    size_t InnerCount,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine reduces the middle dimension of a tensor viewed as
+    [OuterCount, ReduceCount, InnerCount].
+
+Arguments:
+
+    ReductionKind - Supplies the kind of reduction operation.
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer of OuterCount * InnerCount elements.
+
+    OuterCount - Supplies the product of the dimensions before the reduced
+        dimension.
+
+    ReduceCount - Supplies the number of elements to reduce. This must be
+        non-zero.
+
+    InnerCount - Supplies the product of the dimensions after the reduced
+        dimension.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (OuterCount == 0 || InnerCount == 0) {
+        return;
+    }
+
+    MLAS_REDUCTION_WORK_BLOCK WorkBlock;
+
+    WorkBlock.ReductionKind = ReductionKind;
+    WorkBlock.Input = Input;
+    WorkBlock.Output = Output;
+    WorkBlock.Indices = nullptr;
+    WorkBlock.OuterCount = OuterCount;
+    WorkBlock.ReduceCount = ReduceCount;
+    WorkBlock.InnerCount = InnerCount;
+    WorkBlock.SelectLastIndex = false;
+
+    MlasReduceExecute(&WorkBlock, ThreadPool);
+}
+
+void
+MLASCALL
+MlasArgMaximum(
+    const float* Input,
+    int64_t* Output,
+    size_t OuterCount,
+    size_t ReduceCount,
+    size_t InnerCount,
+    bool SelectLastIndex,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine finds the index of the maximum value along the middle
+    dimension of a tensor viewed as [OuterCount, ReduceCount, InnerCount].
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer of OuterCount * InnerCount indices.
+
+    OuterCount - Supplies the product of the dimensions before the reduced
+        dimension.
+
+    ReduceCount - Supplies the number of elements to search. This must be
+        non-zero.
+
+    InnerCount - Supplies the product of the dimensions after the reduced
+        dimension.
+
+    SelectLastIndex - Supplies true if the last index of a repeated maximum
+        value is returned, else the first index is returned.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (OuterCount == 0 || InnerCount == 0) {
+        return;
+    }
+
+    MLAS_REDUCTION_WORK_BLOCK WorkBlock;
+
+    WorkBlock.ReductionKind = MlasMaximumReduction;
+    WorkBlock.Input = Input;
+    WorkBlock.Output = nullptr;
+    WorkBlock.Indices = Output;
+    WorkBlock.OuterCount = OuterCount;
+    WorkBlock.ReduceCount = ReduceCount;
+    WorkBlock.InnerCount = InnerCount;
+    WorkBlock.SelectLastIndex = SelectLastIndex;
+
+    MlasReduceExecute(&WorkBlock, ThreadPool);
+}
@@ -852,3 +852,424 @@ Return Value:
         S += BlockSize * InputStride;
     }
 }
+
+void
+MLASCALL
+MlasReorderInputNchw(
+    const uint8_t* S,
+    uint8_t* D,
+    size_t InputChannels,
+    size_t InputSize
+    )
+/*++
+
+Routine Description:
+
+    This routine reorders a quantized input buffer from NCHW to NCHWc format.
+
+Arguments:
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+    InputChannels - Supplies the number of NCHW channels. Unlike the single
+        precision variant, this count does not need to be a multiple of 4.
+
+    InputSize - Supplies the spatial input size of the tensors.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    //
+    // Iterate over BlockSize batches of the input channels.
+    //
+
+    for (size_t i = InputChannels; i > 0;) {
+
+        const size_t InputChannelsThisIteration = std::min(i, BlockSize);
+        i -= InputChannelsThisIteration;
+
+        const uint8_t* s = S;
+        uint8_t* d = D;
+
+        for (size_t InputSizeRemaining = InputSize; InputSizeRemaining > 0; InputSizeRemaining--) {
+
+            const uint8_t* ss = s;
+            size_t bc = 0;
+
+            for (; bc < InputChannelsThisIteration; bc++) {
+                d[bc] = *ss;
+                ss += InputSize;
+            }
+
+            for (; bc < BlockSize; bc++) {
+                d[bc] = 0;
+            }
+
+            s += 1;
+            d += BlockSize;
+        }
+
+        S += BlockSize * InputSize;
+        D += BlockSize * InputSize;
+    }
+}
+
+void
+MLASCALL
+MlasReorderInputNhwc(
+    const uint8_t* S,
+    uint8_t* D,
+    size_t InputChannels,
+    size_t RowCount,
+    size_t FullRowCount
+    )
+/*++
+
+Routine Description:
+
+    This routine reorders a quantized input buffer from NHWC to NCHWc format.
+
+Arguments:
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+    InputChannels - Supplies the number of NHWC channels.
+
+    RowCount - Supplies the number of NHWC rows to process. This number may be
+        less than FullRowCount to support threaded operation.
+
+    FullRowCount - Supplies the total number of NHWC rows per image.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    //
+    // Iterate over BlockSize batches of the input channels.
+    //
+
+    for (size_t i = InputChannels; i > 0;) {
+
+        const size_t InputChannelsThisIteration = std::min(i, BlockSize);
+        const size_t BlockPadding = BlockSize - InputChannelsThisIteration;
+        i -= InputChannelsThisIteration;
+
+        const uint8_t* s = S;
+        uint8_t* d = D;
+
+        for (size_t RowCountRemaining = RowCount; RowCountRemaining > 0; RowCountRemaining--) {
+
+            std::copy_n(s, InputChannelsThisIteration, d);
+            std::fill_n(d + InputChannelsThisIteration, BlockPadding, uint8_t(0));
+
+            s += InputChannels;
+            d += BlockSize;
+        }
+
+        S += InputChannelsThisIteration;
+        D += BlockSize * FullRowCount;
+    }
+}
+
+void
+MLASCALL
+MlasReorderOutputNchw(
+    const int64_t* OutputShape,
+    const uint8_t* S,
+    uint8_t* D
+    )
+/*++
+
+Routine Description:
+
+    This routine reorders a quantized output buffer from NCHWc to NCHW format.
+
+Arguments:
+
+    OutputShape - Supplies the shape of the output tensor.
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t BatchCount = size_t(OutputShape[0]);
+    const size_t OutputChannels = size_t(OutputShape[1]);
+    const size_t OutputSize = size_t(OutputShape[2]) * size_t(OutputShape[3]);
+
+    //
+    // Transpose NCHWc blocks from the source buffer to the destination buffer.
+    //
+
+    for (size_t batch = 0; batch < BatchCount; batch++) {
+
+        for (size_t o = OutputChannels; o > 0;) {
+
+            const size_t OutputChannelsThisIteration = std::min(o, BlockSize);
+            o -= OutputChannelsThisIteration;
+
+            for (size_t bc = 0; bc < OutputChannelsThisIteration; bc++) {
+
+                const uint8_t* s = S + bc;
+                uint8_t* d = D + bc * OutputSize;
+
+                for (size_t OutputSizeRemaining = OutputSize; OutputSizeRemaining > 0; OutputSizeRemaining--) {
+                    *d++ = *s;
+                    s += BlockSize;
+                }
+            }
+
+            S += BlockSize * OutputSize;
+            D += OutputChannelsThisIteration * OutputSize;
+        }
+    }
+}
+
+void
+MLASCALL
+MlasReorderOutputNhwc(
+    const int64_t* OutputShape,
+    const uint8_t* S,
+    uint8_t* D
+    )
+/*++
+
+Routine Description:
+
+    This routine reorders a quantized output buffer from NCHWc to NHWC format.
+
+Arguments:
+
+    OutputShape - Supplies the shape of the output tensor.
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t BatchCount = size_t(OutputShape[0]);
+    const size_t OutputChannels = size_t(OutputShape[3]);
+    const size_t OutputSize = size_t(OutputShape[1]) * size_t(OutputShape[2]);
+
+    const size_t AlignedOutputChannels = (OutputChannels + BlockSize - 1) & ~(BlockSize - 1);
+
+    //
+    // Copy NCHWc blocks from the source buffer to the destination buffer.
+    //
+
+    for (size_t batch = 0; batch < BatchCount; batch++) {
+
+        const uint8_t* s = S;
+
+        for (size_t OutputSizeRemaining = OutputSize; OutputSizeRemaining > 0; OutputSizeRemaining--) {
+
+            const uint8_t* ss = s;
+
+            for (size_t o = OutputChannels; o > 0;) {
+
+                const size_t OutputChannelsThisIteration = std::min(o, BlockSize);
+                o -= OutputChannelsThisIteration;
+
+                std::copy_n(ss, OutputChannelsThisIteration, D);
+
+                ss += BlockSize * OutputSize;
+                D += OutputChannelsThisIteration;
+            }
+
+            s += BlockSize;
+        }
+
+        S += AlignedOutputChannels * OutputSize;
+    }
+}
+
+void
+MLASCALL
+MlasReorderFilterHWIO(
+    const int64_t* FilterShape,
+    size_t GroupCount,
+    const uint8_t* S,
+    uint8_t* D,
+    uint8_t FilterZeroPoint
+    )
+/*++
+
+Routine Description:
+
+    This routine reorders a quantized filter buffer from OIHW to HWIO format
+    for each group. The input and output channels of each group are padded
+    to the NCHWc block size, so each group is a row major matrix with
+    KernelSize times the aligned input channels rows and the aligned output
+    channels columns.
+
+Arguments:
+
+    FilterShape - Supplies the shape of the filter tensor.
+
+    GroupCount - Supplies the number of channel groups.
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+    FilterZeroPoint - Supplies the filter zero point value. Padding elements
+        are filled with this value so that they do not contribute to the
+        convolution output.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t OutputChannels = size_t(FilterShape[0]) / GroupCount;
+    const size_t InputChannels = size_t(FilterShape[1]);
+    const size_t KernelHeight = size_t(FilterShape[2]);
+    const size_t KernelWidth = size_t(FilterShape[3]);
+
+    const size_t KernelSize = KernelHeight * KernelWidth;
+    const size_t InputStride = InputChannels * KernelSize;
+
+    const size_t AlignedInputChannels = (InputChannels + BlockSize - 1) & ~(BlockSize - 1);
+    const size_t AlignedOutputChannels = (OutputChannels + BlockSize - 1) & ~(BlockSize - 1);
+
+    for (size_t g = 0; g < GroupCount; g++) {
+
+        for (size_t k = 0; k < KernelSize; k++) {
+
+            for (size_t i = 0; i < AlignedInputChannels; i++) {
+
+                if (i >= InputChannels) {
+                    std::fill_n(D, AlignedOutputChannels, FilterZeroPoint);
+                    D += AlignedOutputChannels;
+                    continue;
+                }
+
+                const uint8_t* s = S + i * KernelSize + k;
+                size_t o = 0;
+
+                for (; o < OutputChannels; o++) {
+                    *D++ = *s;
+                    s += InputStride;
+                }
+
+                for (; o < AlignedOutputChannels; o++) {
+                    *D++ = FilterZeroPoint;
+                }
+            }
+        }
+
+        S += OutputChannels * InputStride;
+    }
+}
+
+void
+MLASCALL
+MlasReorderFilterOIHWBo(
+    const int64_t* FilterShape,
+    const uint8_t* S,
+    uint8_t* D,
+    uint8_t FilterZeroPoint
+    )
+/*++
+
+Routine Description:
+
+    This routine reorders a quantized filter buffer from OIHW to OIHWBo format.
+
+Arguments:
+
+    FilterShape - Supplies the shape of the filter tensor.
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+    FilterZeroPoint - Supplies the filter zero point value. Padding elements
+        are filled with this value so that they do not contribute to the
+        convolution output.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t OutputChannels = size_t(FilterShape[0]);
+    const size_t InputChannels = size_t(FilterShape[1]);
+    const size_t KernelHeight = size_t(FilterShape[2]);
+    const size_t KernelWidth = size_t(FilterShape[3]);
+
+    const size_t KernelSize = KernelHeight * KernelWidth;
+    const size_t InputStride = InputChannels * KernelSize;
+
+    //
+    // Iterate over BlockSize batches of the output channels. The layout
+    // matches the single precision variant.
+    //
+
+    for (size_t o = OutputChannels; o > 0;) {
+
+        const size_t OutputChannelsThisIteration = std::min(o, BlockSize);
+        o -= OutputChannelsThisIteration;
+
+        const uint8_t* S_InputChannels = S;
+
+        for (size_t i = 0; i < InputChannels; i += 1) {
+
+            const uint8_t* S_KernelSize = S_InputChannels;
+
+            for (size_t k = 0; k < KernelSize; k++) {
+
+                const uint8_t* s = S_KernelSize;
+                size_t bo = 0;
+
+                for (; bo < OutputChannelsThisIteration; bo++) {
+                    *D++ = *s;
+                    s += InputStride;
+                }
+
+                for (; bo < BlockSize; bo++) {
+                    *D++ = FilterZeroPoint;
+                }
+
+                S_KernelSize += 1;
+            }
+
+            S_InputChannels += KernelSize;
+        }
+
+        S += BlockSize * InputStride;
+    }
+}
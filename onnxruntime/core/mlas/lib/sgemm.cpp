@@ -1015,7 +1015,10 @@ MlasSgemmKernelLoop(
     size_t lda,
     size_t ldc,
     float alpha,
-    bool ZeroMode
+    bool ZeroMode,
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor,
+    size_t StartM,
+    size_t StartN
     )
 /*++
 
@@ -1051,6 +1054,16 @@ Arguments:
     ZeroMode - Supplies true if the output matrix must be zero initialized,
         else false if the output matrix is accumulated into.
 
+    OutputProcessor - Supplies the optional epilogue to apply to the rows of
+        matrix C as they are produced. This is only supplied for the last slice
+        along the K dimension, when the rows are complete.
+
+    StartM - Supplies the row index of matrix C in the output matrix of the
+        operation, for the output processor.
+
+    StartN - Supplies the column index of matrix C in the output matrix of the
+        operation, for the output processor.
+
 Return Value:
 
     Returns the next address of matrix C.
@@ -1073,9 +1086,18 @@ Return Value:
         }
 #endif
 
+        //
+        // Apply the epilogue while the rows are still in the cache.
+        //
+
+        if (OutputProcessor != nullptr) {
+            OutputProcessor->Process(C, StartM, StartN, RowsHandled, CountN, ldc);
+        }
+
         C += ldc * RowsHandled;
         A += lda * RowsHandled;
         CountM -= RowsHandled;
+        StartM += RowsHandled;
     }
 
     return C;
@@ -1095,7 +1117,10 @@ MlasSgemmOperation(
     size_t ldb,
     float beta,
     float* C,
-    size_t ldc
+    size_t ldc,
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor,
+    size_t StartM,
+    size_t StartN
     )
 /*++
 
@@ -1133,6 +1158,14 @@ Arguments:
 
     ldc - Supplies the first dimension of matrix C.
 
+    OutputProcessor - Supplies the optional epilogue to apply to matrix C.
+
+    StartM - Supplies the row index of matrix C in the output matrix of the
+        operation, for the output processor.
+
+    StartN - Supplies the column index of matrix C in the output matrix of the
+        operation, for the output processor.
+
 Return Value:
 
     None.
@@ -1149,6 +1182,9 @@ Return Value:
 
     if (K == 0) {
         MlasSgemmMultiplyBeta(C, M, N, ldc, beta);
+        if (OutputProcessor != nullptr) {
+            OutputProcessor->Process(C, StartM, StartN, M, N, ldc);
+        }
         return;
     }
 
@@ -1172,6 +1208,9 @@ Return Value:
 
         if (SgemmKernelM1Routine != nullptr) {
             SgemmKernelM1Routine(A, B, C, K, N, ldb, beta);
+            if (OutputProcessor != nullptr) {
+                OutputProcessor->Process(C, StartM, StartN, 1, N, ldc);
+            }
             return;
         }
 
@@ -1179,6 +1218,9 @@ Return Value:
 
         if (TransB == CblasNoTrans) {
             MlasGemvFloatKernel(A, B, C, K, N, ldb, (beta == 0.0f));
+            if (OutputProcessor != nullptr) {
+                OutputProcessor->Process(C, StartM, StartN, 1, N, ldc);
+            }
             return;
         }
 
@@ -1207,6 +1249,9 @@ Return Value:
 
         if (SgemmKernelM1Routine != nullptr) {
             SgemmKernelM1Routine(B, A, C, K, M, lda, beta);
+            if (OutputProcessor != nullptr) {
+                OutputProcessor->Process(C, StartM, StartN, M, 1, ldc);
+            }
             return;
         }
 
@@ -1285,9 +1330,18 @@ Return Value:
 
             float* c = C + n;
 
+            //
+            // The rows of matrix C are complete once the last slice along the
+            // K dimension is accumulated, so the epilogue is applied then.
+            //
+
+            const MLAS_SGEMM_OUTPUT_PROCESSOR* SliceOutputProcessor =
+                (k + CountK == K) ? OutputProcessor : nullptr;
+
             if (TransA == CblasNoTrans) {
 
-                MlasSgemmKernelLoop(A + k, PanelB, c, CountK, M, CountN, lda, ldc, alpha, ZeroMode);
+                MlasSgemmKernelLoop(A + k, PanelB, c, CountK, M, CountN, lda, ldc, alpha, ZeroMode,
+                    SliceOutputProcessor, StartM, StartN + n);
 
             } else {
 
@@ -1304,6 +1358,8 @@ Return Value:
 
                     MlasSgemmTransposeA(PanelA, a, lda, RowsTransposed, CountK);
 
+                    const size_t RowsStartM = StartM + (M - RowsRemaining);
+
                     RowsRemaining -= RowsTransposed;
                     a += RowsTransposed;
 
@@ -1311,7 +1367,8 @@ Return Value:
                     // Step through the rows of the local buffer.
                     //
 
-                    c = MlasSgemmKernelLoop(PanelA, PanelB, c, CountK, RowsTransposed, CountN, CountK, ldc, alpha, ZeroMode);
+                    c = MlasSgemmKernelLoop(PanelA, PanelB, c, CountK, RowsTransposed, CountN, CountK, ldc, alpha, ZeroMode,
+                        SliceOutputProcessor, RowsStartM, StartN + n);
                 }
             }
 
@@ -1334,7 +1391,9 @@ MlasSgemmPackedOperation(
     size_t AlignedN,
     float beta,
     float* C,
-    size_t ldc
+    size_t ldc,
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor,
+    size_t StartM
     )
 /*++
 
@@ -1374,6 +1433,11 @@ Arguments:
 
     ldc - Supplies the first dimension of matrix C.
 
+    OutputProcessor - Supplies the optional epilogue to apply to matrix C.
+
+    StartM - Supplies the row index of matrix C in the output matrix of the
+        operation, for the output processor. The column index is RangeStartN.
+
 Return Value:
 
     None.
@@ -1420,9 +1484,18 @@ Return Value:
             const float* pb = (const float*)PackedB + AlignedN * k + CountK * SliceStartN;
             float* c = C + n;
 
+            //
+            // The rows of matrix C are complete once the last slice along the
+            // K dimension is accumulated, so the epilogue is applied then.
+            //
+
+            const MLAS_SGEMM_OUTPUT_PROCESSOR* SliceOutputProcessor =
+                (k + CountK == K) ? OutputProcessor : nullptr;
+
             if (TransA == CblasNoTrans) {
 
-                MlasSgemmKernelLoop(A + k, pb, c, CountK, M, CountN, lda, ldc, alpha, ZeroMode);
+                MlasSgemmKernelLoop(A + k, pb, c, CountK, M, CountN, lda, ldc, alpha, ZeroMode,
+                    SliceOutputProcessor, StartM, SliceStartN);
 
             } else {
 
@@ -1439,6 +1512,8 @@ Return Value:
 
                     MlasSgemmTransposeA(PanelA, a, lda, RowsTransposed, CountK);
 
+                    const size_t RowsStartM = StartM + (M - RowsRemaining);
+
                     RowsRemaining -= RowsTransposed;
                     a += RowsTransposed;
 
@@ -1446,7 +1521,8 @@ Return Value:
                     // Step through the rows of the local buffer.
                     //
 
-                    c = MlasSgemmKernelLoop(PanelA, pb, c, CountK, RowsTransposed, CountN, CountK, ldc, alpha, ZeroMode);
+                    c = MlasSgemmKernelLoop(PanelA, pb, c, CountK, RowsTransposed, CountN, CountK, ldc, alpha, ZeroMode,
+                        SliceOutputProcessor, RowsStartM, SliceStartN);
                 }
             }
 
@@ -1455,6 +1531,274 @@ Return Value:
     }
 }
 
+#if !defined(MLAS_TARGET_WASM_SCALAR)
+
+void
+MLASCALL
+MlasSgemvPackedF32Kernel(
+    const float* A,
+    const float* PackedB,
+    float* C,
+    size_t CountK,
+    size_t CountN,
+    float alpha,
+    bool ZeroMode
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the generic kernel to multiply a row vector by a
+    slice of a packed matrix B.
+
+    Two column panels of the packed matrix are processed together to provide
+    enough independent accumulators to hide the latency of the multiply and
+    add instructions.
+
+Arguments:
+
+    A - Supplies the address of the row vector A.
+
+    PackedB - Supplies the address of the slice of packed matrix B. The matrix
+        data has been packed using MlasSgemmCopyPackB or
+        MlasSgemmTransposePackB.
+
+    C - Supplies the address of the row vector C.
+
+    CountK - Supplies the number of elements of vector A and the number of rows
+        of the slice of matrix B.
+
+    CountN - Supplies the number of columns of the slice of matrix B and the
+        number of elements of vector C.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    ZeroMode - Supplies true if the output vector must be zero initialized,
+        else false if the output vector is accumulated into.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const MLAS_FLOAT32X4 AlphaBroadcast = MlasBroadcastFloat32x4(alpha);
+
+    while (CountN > 0) {
+
+        const bool TwoPanels = (CountN > 16);
+
+        MLAS_FLOAT32X4 Accumulators[8];
+
+        for (size_t i = 0; i < 8; i++) {
+            Accumulators[i] = MlasZeroFloat32x4();
+        }
+
+        const float* b0 = PackedB;
+        const float* b1 = PackedB + CountK * 16;
+
+        if (TwoPanels) {
+
+            for (size_t k = 0; k < CountK; k++) {
+
+                MLAS_FLOAT32X4 ABroadcast = MlasBroadcastFloat32x4(A[k]);
+
+                Accumulators[0] = MlasMultiplyAddFloat32x4(ABroadcast, MlasLoadFloat32x4(b0), Accumulators[0]);
+                Accumulators[1] = MlasMultiplyAddFloat32x4(ABroadcast, MlasLoadFloat32x4(b0 + 4), Accumulators[1]);
+                Accumulators[2] = MlasMultiplyAddFloat32x4(ABroadcast, MlasLoadFloat32x4(b0 + 8), Accumulators[2]);
+                Accumulators[3] = MlasMultiplyAddFloat32x4(ABroadcast, MlasLoadFloat32x4(b0 + 12), Accumulators[3]);
+                Accumulators[4] = MlasMultiplyAddFloat32x4(ABroadcast, MlasLoadFloat32x4(b1), Accumulators[4]);
+                Accumulators[5] = MlasMultiplyAddFloat32x4(ABroadcast, MlasLoadFloat32x4(b1 + 4), Accumulators[5]);
+                Accumulators[6] = MlasMultiplyAddFloat32x4(ABroadcast, MlasLoadFloat32x4(b1 + 8), Accumulators[6]);
+                Accumulators[7] = MlasMultiplyAddFloat32x4(ABroadcast, MlasLoadFloat32x4(b1 + 12), Accumulators[7]);
+
+                b0 += 16;
+                b1 += 16;
+            }
+
+        } else {
+
+            for (size_t k = 0; k < CountK; k++) {
+
+                MLAS_FLOAT32X4 ABroadcast = MlasBroadcastFloat32x4(A[k]);
+
+                Accumulators[0] = MlasMultiplyAddFloat32x4(ABroadcast, MlasLoadFloat32x4(b0), Accumulators[0]);
+                Accumulators[1] = MlasMultiplyAddFloat32x4(ABroadcast, MlasLoadFloat32x4(b0 + 4), Accumulators[1]);
+                Accumulators[2] = MlasMultiplyAddFloat32x4(ABroadcast, MlasLoadFloat32x4(b0 + 8), Accumulators[2]);
+                Accumulators[3] = MlasMultiplyAddFloat32x4(ABroadcast, MlasLoadFloat32x4(b0 + 12), Accumulators[3]);
+
+                b0 += 16;
+            }
+        }
+
+        //
+        // Store the accumulators to the output vector. A partial panel is
+        // staged through a local buffer.
+        //
+
+        const size_t CountColumns = std::min(CountN, size_t(TwoPanels ? 32 : 16));
+
+        float Buffer[32];
+        float* c = (CountColumns == (TwoPanels ? 32 : 16)) ? C : Buffer;
+
+        if (c == Buffer && !ZeroMode) {
+            std::copy_n(C, CountColumns, Buffer);
+        }
+
+        for (size_t i = 0; i < (TwoPanels ? 8 : 4); i++) {
+
+            MLAS_FLOAT32X4 Vector = MlasMultiplyFloat32x4(Accumulators[i], AlphaBroadcast);
+
+            if (!ZeroMode) {
+                Vector = MlasAddFloat32x4(Vector, MlasLoadFloat32x4(c + i * 4));
+            }
+
+            MlasStoreFloat32x4(c + i * 4, Vector);
+        }
+
+        if (c == Buffer) {
+            std::copy_n(Buffer, CountColumns, C);
+        }
+
+        PackedB += CountK * (TwoPanels ? 32 : 16);
+        C += CountColumns;
+        CountN -= CountColumns;
+    }
+}
+
+void
+MlasSgemmPackedGemvOperation(
+    CBLAS_TRANSPOSE TransA,
+    size_t RangeStartN,
+    size_t RangeCountN,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    const void* PackedB,
+    size_t AlignedN,
+    float beta,
+    float* C,
+    size_t ldc,
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor,
+    size_t StartM
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the single precision matrix/vector multiply
+    operation for a single row of matrix A and a packed matrix B.
+
+    Each block of output columns is accumulated across all slices of matrix B
+    along the K dimension before moving to the next block, so the output block
+    stays in the cache while matrix B is streamed exactly once.
+
+Arguments:
+
+    TransA - Supplies the transpose operation for matrix A.
+
+    RangeStartN - Supplies the starting column from packed matrix B.
+
+    RangeCountN - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix A and the number of rows of
+        matrix B.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    PackedB - Supplies the address of packed matrix B.
+
+    AlignedN - Supplies the total number of aligned columns for packed matrix B.
+
+    beta - Supplies the scalar beta multiplier (see SGEMM definition).
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    OutputProcessor - Supplies the optional epilogue to apply to matrix C.
+
+    StartM - Supplies the row index of matrix C in the output matrix of the
+        operation, for the output processor. The column index is RangeStartN.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    float PanelA[MLAS_SGEMM_PACKED_STRIDEK];
+
+    //
+    // Step through each block of matrix B along the N dimension.
+    //
+
+    size_t CountN;
+
+    for (size_t n = 0; n < RangeCountN; n += CountN) {
+
+        const size_t BlockStartN = RangeStartN + n;
+
+        CountN = std::min(RangeCountN - n, size_t(MLAS_SGEMM_PACKED_STRIDEN));
+
+        //
+        // Multiply the output vector by beta as needed.
+        //
+
+        if (beta != 0.0f && beta != 1.0f) {
+            MlasSgemmMultiplyBeta(C + n, 1, CountN, CountN, beta);
+        }
+
+        //
+        // Step through each slice of matrix B along the K dimension.
+        //
+
+        size_t CountK;
+        bool ZeroMode = (beta == 0.0f);
+
+        for (size_t k = 0; k < K; k += CountK) {
+
+            CountK = std::min(K - k, size_t(MLAS_SGEMM_PACKED_STRIDEK));
+
+            const float* a = A + k;
+
+            if (TransA != CblasNoTrans) {
+
+                for (size_t kk = 0; kk < CountK; kk++) {
+                    PanelA[kk] = A[(k + kk) * lda];
+                }
+
+                a = PanelA;
+            }
+
+            const float* pb = (const float*)PackedB + AlignedN * k + CountK * BlockStartN;
+
+#if defined(MLAS_TARGET_AMD64)
+            MlasPlatform.SgemvPackedF32Kernel(a, pb, C + n, CountK, CountN, alpha, ZeroMode);
+#else
+            MlasSgemvPackedF32Kernel(a, pb, C + n, CountK, CountN, alpha, ZeroMode);
+#endif
+
+            ZeroMode = false;
+        }
+
+        //
+        // Apply the epilogue while the block is still in the cache.
+        //
+
+        if (OutputProcessor != nullptr) {
+            OutputProcessor->Process(C + n, StartM, BlockStartN, 1, CountN, ldc);
+        }
+    }
+}
+
+#endif
+
 void
 MlasSgemmThreaded(
     const ptrdiff_t ThreadCountM,
@@ -1540,9 +1884,22 @@ Return Value:
 
     if (DataParams->BIsPacked) {
 
+#if !defined(MLAS_TARGET_WASM_SCALAR)
+        if (M == 1) {
+
+            MlasSgemmPackedGemvOperation(TransA, RangeStartN, RangeCountN, K,
+                DataParams->alpha, A, lda, DataParams->B,
+                BlockedN * MLAS_SGEMM_STRIDEN_THREAD_ALIGN, DataParams->beta, C, ldc,
+                DataParams->OutputProcessor, RangeStartM);
+
+            return;
+        }
+#endif
+
         MlasSgemmPackedOperation(TransA, RangeCountM, RangeStartN, RangeCountN,
             K, DataParams->alpha, A, lda, DataParams->B,
-            BlockedN * MLAS_SGEMM_STRIDEN_THREAD_ALIGN, DataParams->beta, C, ldc);
+            BlockedN * MLAS_SGEMM_STRIDEN_THREAD_ALIGN, DataParams->beta, C, ldc,
+            DataParams->OutputProcessor, RangeStartM);
 
     } else {
 
@@ -1551,7 +1908,8 @@ Return Value:
         const float* B = (const float*)DataParams->B + RangeStartN * ((TransB == CblasNoTrans) ? 1 : ldb);
 
         MlasSgemmOperation(TransA, TransB, RangeCountM, RangeCountN, K,
-            DataParams->alpha, A, lda, B, ldb, DataParams->beta, C, ldc);
+            DataParams->alpha, A, lda, B, ldb, DataParams->beta, C, ldc,
+            DataParams->OutputProcessor, RangeStartM, RangeStartN);
     }
 }
 
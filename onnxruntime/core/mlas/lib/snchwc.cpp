@@ -10,8 +10,8 @@ Module Name:
 
 Abstract:
 
-    This module implements the single precision operations using the NCHWc
-    blocking format.
+    This module implements the single precision and quantized operations using
+    the NCHWc blocking format.
 
 --*/
 
@@ -66,6 +66,37 @@ struct MLAS_NCHWC_POOL_WORK_BLOCK : MLAS_NCHWC_WORK_BLOCK
     MLAS_POOLING_KIND PoolingKind;
 };
 
+//
+// Define the worker thread context for a quantized NCHWc convolution operation.
+//
+
+struct MLAS_NCHWC_QCONV_WORK_BLOCK : MLAS_NCHWC_WORK_BLOCK
+{
+    const uint8_t* Input;
+    const uint8_t* Filter;
+    const int32_t* Bias;
+    const float* Scale;
+    uint8_t* Output;
+    size_t GroupCount;
+    size_t TileOutputCount;
+    uint8_t InputZeroPoint;
+    uint8_t FilterZeroPoint;
+    uint8_t OutputZeroPoint;
+    bool FilterIsSigned;
+    bool FilterIsPacked;
+    bool PerChannelScale;
+};
+
+//
+// Define the worker thread context for a quantized NCHWc pooling operation.
+//
+
+struct MLAS_NCHWC_QPOOL_WORK_BLOCK : MLAS_NCHWC_WORK_BLOCK
+{
+    const uint8_t* Input;
+    uint8_t* Output;
+};
+
 //
 // Define the convolution kernel flags.
 //
@@ -75,6 +106,23 @@ struct MLAS_NCHWC_POOL_WORK_BLOCK : MLAS_NCHWC_WORK_BLOCK
 #define MLAS_CONV_KERNEL_FLAG_RELU_ACTIVATION       0x00000004
 #define MLAS_CONV_KERNEL_FLAG_OTHER_ACTIVATION      0x00000008
 
+//
+// Define the maximum NCHWc block size, the maximum number of output positions,
+// output channels, and filter rows computed per step by the quantized
+// convolution kernels, and the size of the local indirection buffer and the
+// maximum number of output positions used by the quantized depthwise
+// convolution kernel. The filter set and slice sizes also define the layout
+// of a packed filter.
+//
+
+#define MLAS_NCHWC_MAXIMUM_BLOCK_SIZE               16
+#define MLAS_NCHWC_QCONV_OUTPUT_COUNT               32
+#define MLAS_NCHWC_QCONV_MINIMUM_OUTPUT_COUNT       8
+#define MLAS_NCHWC_QCONV_FILTER_SET_SIZE            256
+#define MLAS_NCHWC_QCONV_FILTER_SLICE_SIZE          2048
+#define MLAS_NCHWC_QCONV_INDIRECTION_COUNT          1024
+#define MLAS_NCHWC_QDWCONV_OUTPUT_COUNT             128
+
 size_t
 MLASCALL
 MlasNchwcGetBlockSize(
@@ -1511,6 +1559,986 @@ Return Value:
     }
 }
 
+//
+// Base implementation for quantized convolution algorithms.
+//
+// The quantized kernels compute a tile of output positions across a single
+// NCHWc output block into a local buffer of 32-bit integers and then
+// requantize the tile to the output tensor. The products are computed by the
+// QGEMM and quantized depthwise convolution kernels. Input padding elements
+// are equal to the input zero point, so these elements add nothing to the
+// accumulators.
+//
+
+struct MLAS_NCHWC_QCONV_ALGORITHM : MLAS_NCHWC_NN_ALGORITHM
+{
+    const MLAS_NCHWC_QCONV_WORK_BLOCK* WorkBlock;
+    const size_t GroupCount;
+
+    MLAS_NCHWC_QCONV_ALGORITHM(const MLAS_NCHWC_QCONV_WORK_BLOCK* WorkBlock) :
+        MLAS_NCHWC_NN_ALGORITHM(WorkBlock),
+        WorkBlock(WorkBlock),
+        GroupCount(WorkBlock->GroupCount)
+    {
+    }
+
+    const uint8_t*
+    GetInputVector(
+        const uint8_t* input,
+        const uint8_t* PaddingVector,
+        size_t ph,
+        size_t pw,
+        size_t kh,
+        size_t kw
+        )
+    {
+        //
+        // Return the address of the NCHWc input vector that is multiplied with
+        // the filter element at the kernel position to produce the output
+        // element at the output position, else the vector of padding values if
+        // the input element is outside of the input tensor.
+        //
+
+        const size_t ih = ph * StrideHeight + kh * DilationHeight - PaddingLeftY;
+        const size_t iw = pw * StrideWidth + kw * DilationWidth - PaddingLeftX;
+
+        if (ih >= InputHeight || iw >= InputWidth) {
+            return PaddingVector;
+        }
+
+        return input + (ih * InputWidth + iw) * BlockSize;
+    }
+
+    void
+    CopyVector(
+        uint8_t* Destination,
+        const uint8_t* Source
+        )
+    {
+        //
+        // Copy a vector of BlockSize elements. The common block size is a
+        // constant to allow the copy to be inlined.
+        //
+
+        if (BlockSize == 16) {
+            std::copy_n(Source, 16, Destination);
+        } else {
+            std::copy_n(Source, BlockSize, Destination);
+        }
+    }
+
+    void
+    AccumulateOutput(
+        int32_t* Accumulators,
+        const int32_t* Partial,
+        size_t Count
+        )
+    {
+        for (size_t i = 0; i < Count; i++) {
+            Accumulators[i] += Partial[i];
+        }
+    }
+
+    void
+    RequantizeOutput(
+        const int32_t* Accumulators,
+        uint8_t* output,
+        size_t OutputCount,
+        size_t ChannelCount,
+        size_t Channel
+        )
+    {
+        const int32_t* Bias = WorkBlock->Bias;
+
+        if (Bias != nullptr) {
+            Bias += Channel;
+        }
+
+        const float* Scale = WorkBlock->Scale;
+
+        if (WorkBlock->PerChannelScale) {
+            Scale += Channel;
+        }
+
+        MlasRequantizeOutput(Accumulators, output, Bias, OutputCount, ChannelCount,
+            Scale, WorkBlock->PerChannelScale, WorkBlock->OutputZeroPoint);
+    }
+};
+
+//
+// Returns the number of bytes required to pack a set of filters for the
+// quantized NCHWc convolution. Each slice of the filter rows is packed as an
+// independent QGEMM matrix.
+//
+
+size_t
+MlasNchwcQConvPackedFilterSetSize(
+    size_t FilterCount,
+    size_t FilterRowCount,
+    bool FilterIsSigned
+    )
+{
+    const size_t SliceRowCount = MLAS_NCHWC_QCONV_FILTER_SLICE_SIZE;
+    const size_t TailRowCount = FilterRowCount % SliceRowCount;
+
+    size_t BytesRequired = (FilterRowCount / SliceRowCount) *
+        MlasGemmPackBSize(FilterCount, SliceRowCount, FilterIsSigned);
+
+    if (TailRowCount > 0) {
+        BytesRequired += MlasGemmPackBSize(FilterCount, TailRowCount, FilterIsSigned);
+    }
+
+    return BytesRequired;
+}
+
+//
+// Returns the number of bytes required to pack the filters of a group for the
+// quantized NCHWc convolution. The output channels of the group are packed in
+// sets of filters.
+//
+
+size_t
+MlasNchwcQConvPackedFilterGroupSize(
+    size_t OutputChannels,
+    size_t FilterRowCount,
+    bool FilterIsSigned
+    )
+{
+    const size_t FilterSetSize = MLAS_NCHWC_QCONV_FILTER_SET_SIZE;
+    const size_t TailFilterCount = OutputChannels % FilterSetSize;
+
+    size_t BytesRequired = (OutputChannels / FilterSetSize) *
+        MlasNchwcQConvPackedFilterSetSize(FilterSetSize, FilterRowCount, FilterIsSigned);
+
+    if (TailFilterCount > 0) {
+        BytesRequired += MlasNchwcQConvPackedFilterSetSize(TailFilterCount, FilterRowCount, FilterIsSigned);
+    }
+
+    return BytesRequired;
+}
+
+//
+// Implementation of the direct quantized convolution algorithm where the input
+// buffer is in NCHWc format and the filter is in HWIO format or is packed by
+// MlasNchwcPackFilter.
+//
+// The filter of a group is a row major matrix with KernelSize times the group
+// input channels rows and the group output channels columns. The input vectors
+// for a tile of output positions are gathered to a column buffer in the same
+// row order, so the tile is computed by a QGEMM over a set of the output
+// channels. The column buffer holds a slice of the filter rows, so larger
+// filters are computed as the sum of several QGEMM operations.
+//
+
+struct MLAS_NCHWC_QCONV_NCHWC_ALGORITHM : MLAS_NCHWC_QCONV_ALGORITHM
+{
+    MLAS_NCHWC_QCONV_NCHWC_ALGORITHM(const MLAS_NCHWC_QCONV_WORK_BLOCK* WorkBlock) :
+        MLAS_NCHWC_QCONV_ALGORITHM(WorkBlock)
+    {
+    }
+
+    void Execute(ptrdiff_t Index)
+    {
+        const size_t InputBlockCount = InputChannels / BlockSize;
+        const size_t TileOutputCount = WorkBlock->TileOutputCount;
+        const size_t TileCount = (OutputSize + TileOutputCount - 1) / TileOutputCount;
+        const size_t FilterSetSize = MLAS_NCHWC_QCONV_FILTER_SET_SIZE;
+        const size_t FilterSetCount = (OutputChannels + FilterSetSize - 1) / FilterSetSize;
+
+        const size_t TotalWork = BatchCount * GroupCount * FilterSetCount * TileCount;
+
+        size_t WorkIndex;
+        size_t WorkRemaining;
+
+        MlasPartitionWork(Index, WorkBlock->tids, TotalWork, &WorkIndex, &WorkRemaining);
+
+        //
+        // Each row of the filter matrix holds the output channels for one
+        // input channel of one kernel element.
+        //
+
+        const size_t FilterRowCount = KernelSize * InputChannels;
+        const size_t SliceRowCount = MLAS_NCHWC_QCONV_FILTER_SLICE_SIZE;
+
+        const bool FilterIsSigned = WorkBlock->FilterIsSigned;
+        const bool FilterIsPacked = WorkBlock->FilterIsPacked;
+
+        size_t PackedGroupSize = 0;
+        size_t PackedFilterSetSize = 0;
+
+        if (FilterIsPacked) {
+            PackedGroupSize = MlasNchwcQConvPackedFilterGroupSize(OutputChannels,
+                FilterRowCount, FilterIsSigned);
+            PackedFilterSetSize = MlasNchwcQConvPackedFilterSetSize(FilterSetSize,
+                FilterRowCount, FilterIsSigned);
+        }
+
+        MLAS_DECLSPEC_ALIGN(uint8_t ColumnBuffer[MLAS_NCHWC_QCONV_OUTPUT_COUNT * MLAS_NCHWC_QCONV_FILTER_SLICE_SIZE], 64);
+        MLAS_DECLSPEC_ALIGN(uint8_t PaddingVector[MLAS_NCHWC_MAXIMUM_BLOCK_SIZE], 16);
+        MLAS_DECLSPEC_ALIGN(int32_t Accumulators[MLAS_NCHWC_QCONV_OUTPUT_COUNT * MLAS_NCHWC_QCONV_FILTER_SET_SIZE], 64);
+        MLAS_DECLSPEC_ALIGN(int32_t Partial[MLAS_NCHWC_QCONV_OUTPUT_COUNT * MLAS_NCHWC_QCONV_FILTER_SET_SIZE], 64);
+
+        std::fill_n(PaddingVector, BlockSize, WorkBlock->InputZeroPoint);
+
+        MLAS_GEMM_U8X8_SHAPE_PARAMS GemmShape;
+        GemmShape.BIsSigned = FilterIsSigned;
+
+        MLAS_GEMM_U8X8_DATA_PARAMS GemmData;
+        GemmData.A = ColumnBuffer;
+        GemmData.ZeroPointA = WorkBlock->InputZeroPoint;
+        GemmData.ldb = OutputChannels;
+        GemmData.ZeroPointB = &WorkBlock->FilterZeroPoint;
+        GemmData.BIsPacked = FilterIsPacked;
+
+        //
+        // Loop until all of the work has been completed.
+        //
+
+        while (WorkRemaining > 0) {
+
+            //
+            // Extract the current batch, group, filter set, and tile of output
+            // positions from the work index.
+            //
+
+            const size_t Tile = WorkIndex % TileCount;
+            const size_t BatchGroupFilterSet = WorkIndex / TileCount;
+            const size_t FilterSet = BatchGroupFilterSet % FilterSetCount;
+            const size_t BatchGroup = BatchGroupFilterSet / FilterSetCount;
+            const size_t Group = BatchGroup % GroupCount;
+
+            const size_t OutputIndex = Tile * TileOutputCount;
+            const size_t OutputCount = std::min(OutputSize - OutputIndex, TileOutputCount);
+
+            const size_t FilterIndex = FilterSet * FilterSetSize;
+            const size_t FilterCount = std::min(OutputChannels - FilterIndex, FilterSetSize);
+
+            const uint8_t* input = WorkBlock->Input + BatchGroup * InputChannels * InputSize;
+            uint8_t* output = WorkBlock->Output + (BatchGroup * OutputChannels + FilterIndex) * OutputSize;
+
+            const uint8_t* filter;
+            size_t FilterSliceStride;
+
+            if (FilterIsPacked) {
+                filter = WorkBlock->Filter + Group * PackedGroupSize + FilterSet * PackedFilterSetSize;
+                FilterSliceStride = MlasGemmPackBSize(FilterCount, SliceRowCount, FilterIsSigned);
+            } else {
+                filter = WorkBlock->Filter + Group * FilterRowCount * OutputChannels + FilterIndex;
+                FilterSliceStride = SliceRowCount * OutputChannels;
+            }
+
+            GemmShape.M = OutputCount;
+            GemmShape.N = FilterCount;
+
+            GemmData.ldc = FilterCount;
+
+            //
+            // Step through each slice of the filter rows.
+            //
+
+            for (size_t FilterRow = 0; FilterRow < FilterRowCount; FilterRow += SliceRowCount) {
+
+                const size_t RowCount = std::min(FilterRowCount - FilterRow, SliceRowCount);
+                const size_t FirstVector = FilterRow / BlockSize;
+
+                //
+                // Gather the input vectors for the slice of filter rows.
+                //
+
+                uint8_t* column = ColumnBuffer;
+
+                for (size_t o = 0; o < OutputCount; o++) {
+
+                    const size_t ph = (OutputIndex + o) / OutputWidth;
+                    const size_t pw = (OutputIndex + o) % OutputWidth;
+
+                    const size_t KernelIndex = FirstVector / InputBlockCount;
+
+                    size_t kh = KernelIndex / KernelWidth;
+                    size_t kw = KernelIndex % KernelWidth;
+                    size_t icb = FirstVector % InputBlockCount;
+
+                    const uint8_t* KernelVector = GetInputVector(input, PaddingVector, ph, pw, kh, kw);
+
+                    for (size_t v = 0; v < RowCount; v += BlockSize) {
+
+                        const uint8_t* InputVector = (KernelVector == PaddingVector) ?
+                            PaddingVector : KernelVector + icb * BlockSize * InputSize;
+
+                        CopyVector(column, InputVector);
+                        column += BlockSize;
+
+                        if (++icb == InputBlockCount) {
+
+                            icb = 0;
+
+                            if (++kw == KernelWidth) {
+                                kw = 0;
+                                kh++;
+                            }
+
+                            if (kh < KernelHeight) {
+                                KernelVector = GetInputVector(input, PaddingVector, ph, pw, kh, kw);
+                            }
+                        }
+                    }
+                }
+
+                GemmShape.K = RowCount;
+
+                GemmData.lda = RowCount;
+                GemmData.B = filter;
+                GemmData.C = (FilterRow == 0) ? Accumulators : Partial;
+
+                MlasGemm(GemmShape, GemmData, nullptr);
+
+                if (FilterRow != 0) {
+                    AccumulateOutput(Accumulators, Partial, OutputCount * FilterCount);
+                }
+
+                filter += FilterSliceStride;
+            }
+
+            //
+            // Requantize the tile to the column buffer and scatter the output
+            // blocks to the output tensor.
+            //
+
+            uint8_t* RequantizedOutput = ColumnBuffer;
+
+            RequantizeOutput(Accumulators, RequantizedOutput, OutputCount, FilterCount,
+                Group * OutputChannels + FilterIndex);
+
+            for (size_t o = 0; o < OutputCount; o++) {
+
+                const uint8_t* r = RequantizedOutput + o * FilterCount;
+                uint8_t* OutputBlock = output + (OutputIndex + o) * BlockSize;
+
+                for (size_t f = 0; f < FilterCount; f += BlockSize) {
+                    CopyVector(OutputBlock, r + f);
+                    OutputBlock += BlockSize * OutputSize;
+                }
+            }
+
+            WorkIndex += 1;
+            WorkRemaining -= 1;
+        }
+    }
+};
+
+//
+// Implementation of the direct quantized convolution algorithm where the input
+// buffer is in NCHWc format, the filter is in OIHWBo format, and the number of
+// input and output channels per group are one.
+//
+// The filter of a group block is in the HW1O format used by the quantized
+// depthwise convolution kernel, so the kernel consumes an indirection buffer
+// of input vectors for a tile of output positions. The group blocks for a tile
+// are computed in sequence so that the indirection buffer is built once and
+// then advanced to the next group block. Larger kernels are computed as the
+// sum of several slices of the kernel elements.
+//
+
+struct MLAS_NCHWC_QCONV_DEPTHWISE_ALGORITHM : MLAS_NCHWC_QCONV_ALGORITHM
+{
+    MLAS_NCHWC_QCONV_DEPTHWISE_ALGORITHM(const MLAS_NCHWC_QCONV_WORK_BLOCK* WorkBlock) :
+        MLAS_NCHWC_QCONV_ALGORITHM(WorkBlock)
+    {
+    }
+
+    void
+    BuildIndirection(
+        const uint8_t** IndirectionBuffer,
+        const uint8_t* input,
+        const uint8_t* PaddingVector,
+        size_t OutputIndex,
+        size_t OutputCount,
+        size_t KernelIndex,
+        size_t KernelCount
+        )
+    {
+        for (size_t o = 0; o < OutputCount; o++) {
+
+            const size_t ph = (OutputIndex + o) / OutputWidth;
+            const size_t pw = (OutputIndex + o) % OutputWidth;
+
+            size_t kh = KernelIndex / KernelWidth;
+            size_t kw = KernelIndex % KernelWidth;
+
+            for (size_t kk = 0; kk < KernelCount; kk++) {
+
+                *IndirectionBuffer++ = GetInputVector(input, PaddingVector, ph, pw, kh, kw);
+
+                if (++kw == KernelWidth) {
+                    kw = 0;
+                    kh++;
+                }
+            }
+        }
+    }
+
+    void Execute(ptrdiff_t Index)
+    {
+        const size_t GroupBlockCount = ((GroupCount + BlockSize - 1) / BlockSize);
+
+        //
+        // Size the tile of output positions and the slice of kernel elements
+        // to fit in the indirection buffer.
+        //
+
+        const size_t SliceKernelSize = std::min(KernelSize, size_t(MLAS_NCHWC_QCONV_INDIRECTION_COUNT));
+        const size_t TileOutputCount = std::min(size_t(MLAS_NCHWC_QDWCONV_OUTPUT_COUNT),
+            size_t(MLAS_NCHWC_QCONV_INDIRECTION_COUNT) / SliceKernelSize);
+        const size_t TileCount = (OutputSize + TileOutputCount - 1) / TileOutputCount;
+
+        const size_t TotalWork = BatchCount * TileCount * GroupBlockCount;
+
+        size_t WorkIndex;
+        size_t WorkRemaining;
+
+        MlasPartitionWork(Index, WorkBlock->tids, TotalWork, &WorkIndex, &WorkRemaining);
+
+        const uint8_t* IndirectionBuffer[MLAS_NCHWC_QCONV_INDIRECTION_COUNT];
+        MLAS_DECLSPEC_ALIGN(uint8_t PaddingVector[MLAS_NCHWC_MAXIMUM_BLOCK_SIZE], 16);
+        int32_t Accumulators[MLAS_NCHWC_QDWCONV_OUTPUT_COUNT * MLAS_NCHWC_MAXIMUM_BLOCK_SIZE];
+        int32_t Partial[MLAS_NCHWC_QDWCONV_OUTPUT_COUNT * MLAS_NCHWC_MAXIMUM_BLOCK_SIZE];
+
+        std::fill_n(PaddingVector, BlockSize, WorkBlock->InputZeroPoint);
+
+        //
+        // Track the input block and tile of output positions described by the
+        // indirection buffer. The buffer is only reused if the kernel is not
+        // sliced.
+        //
+
+        const uint8_t* IndirectionInput = nullptr;
+        size_t IndirectionBatchTile = 0;
+
+        //
+        // Loop until all of the work has been completed.
+        //
+
+        while (WorkRemaining > 0) {
+
+            //
+            // Extract the current batch, tile of output positions, and group
+            // block from the work index.
+            //
+
+            const size_t Group = WorkIndex % GroupBlockCount;
+            const size_t BatchTile = WorkIndex / GroupBlockCount;
+            const size_t Tile = BatchTile % TileCount;
+            const size_t BatchGroup = (BatchTile / TileCount) * GroupBlockCount + Group;
+
+            const size_t OutputIndex = Tile * TileOutputCount;
+            const size_t OutputCount = std::min(OutputSize - OutputIndex, TileOutputCount);
+
+            const uint8_t* input = WorkBlock->Input + BatchGroup * BlockSize * InputSize;
+            const uint8_t* filter = WorkBlock->Filter + Group * BlockSize * KernelSize;
+            uint8_t* output = WorkBlock->Output + (BatchGroup * OutputSize + OutputIndex) * BlockSize;
+
+            //
+            // Step through each slice of the kernel elements.
+            //
+
+            for (size_t k = 0; k < KernelSize; k += SliceKernelSize) {
+
+                const size_t KernelCount = std::min(KernelSize - k, SliceKernelSize);
+
+                if (KernelCount == KernelSize && IndirectionInput != nullptr &&
+                    IndirectionBatchTile == BatchTile) {
+
+                    //
+                    // Advance the input vectors of the previous group block
+                    // to this group block.
+                    //
+
+                    const ptrdiff_t InputDelta = input - IndirectionInput;
+
+                    for (size_t i = 0; i < OutputCount * KernelCount; i++) {
+                        if (IndirectionBuffer[i] != PaddingVector) {
+                            IndirectionBuffer[i] += InputDelta;
+                        }
+                    }
+
+                } else {
+
+                    BuildIndirection(IndirectionBuffer, input, PaddingVector, OutputIndex,
+                        OutputCount, k, KernelCount);
+                }
+
+                IndirectionInput = (KernelCount == KernelSize) ? input : nullptr;
+                IndirectionBatchTile = BatchTile;
+
+                MlasConvDepthwise(IndirectionBuffer, WorkBlock->InputZeroPoint,
+                    filter + k * BlockSize, WorkBlock->FilterZeroPoint,
+                    WorkBlock->FilterIsSigned, (k == 0) ? Accumulators : Partial,
+                    BlockSize, OutputCount, KernelCount);
+
+                if (k != 0) {
+                    AccumulateOutput(Accumulators, Partial, OutputCount * BlockSize);
+                }
+            }
+
+            RequantizeOutput(Accumulators, output, OutputCount, BlockSize, Group * BlockSize);
+
+            WorkIndex += 1;
+            WorkRemaining -= 1;
+        }
+    }
+};
+
+//
+// Implementation of the quantized maximum pooling algorithm.
+//
+
+struct MLAS_NCHWC_QPOOL_ALGORITHM : MLAS_NCHWC_NN_ALGORITHM
+{
+    const MLAS_NCHWC_QPOOL_WORK_BLOCK* WorkBlock;
+
+    MLAS_NCHWC_QPOOL_ALGORITHM(const MLAS_NCHWC_QPOOL_WORK_BLOCK* WorkBlock) :
+        MLAS_NCHWC_NN_ALGORITHM(WorkBlock),
+        WorkBlock(WorkBlock)
+    {
+    }
+
+    void Execute(ptrdiff_t Index)
+    {
+        const size_t TotalWork =
+            ((BatchCount * InputChannels + BlockSize - 1) / BlockSize) * OutputHeight;
+
+        size_t WorkIndex;
+        size_t WorkRemaining;
+
+        MlasPartitionWork(Index, WorkBlock->tids, TotalWork, &WorkIndex, &WorkRemaining);
+
+        //
+        // Loop until all of the work has been completed.
+        //
+
+        while (WorkRemaining > 0) {
+
+            const size_t ph = WorkIndex % OutputHeight;
+            const size_t BatchChannel = WorkIndex / OutputHeight;
+
+            const uint8_t* input = WorkBlock->Input + BatchChannel * BlockSize * InputSize;
+            uint8_t* output = WorkBlock->Output + WorkIndex * BlockSize * OutputWidth;
+
+            for (size_t pw = 0; pw < OutputWidth; pw++) {
+
+                //
+                // Padding elements are excluded from the maximum, so start
+                // from the smallest representable value.
+                //
+
+                std::fill_n(output, BlockSize, uint8_t(0));
+
+                for (size_t kh = 0; kh < KernelHeight; kh++) {
+
+                    const size_t ih = ph * StrideHeight + kh * DilationHeight - PaddingLeftY;
+
+                    if (ih >= InputHeight) {
+                        continue;
+                    }
+
+                    for (size_t kw = 0; kw < KernelWidth; kw++) {
+
+                        const size_t iw = pw * StrideWidth + kw * DilationWidth - PaddingLeftX;
+
+                        if (iw >= InputWidth) {
+                            continue;
+                        }
+
+                        const uint8_t* x = input + (ih * InputWidth + iw) * BlockSize;
+
+                        for (size_t bc = 0; bc < BlockSize; bc++) {
+                            output[bc] = std::max(output[bc], x[bc]);
+                        }
+                    }
+                }
+
+                output += BlockSize;
+            }
+
+            WorkIndex += 1;
+            WorkRemaining -= 1;
+        }
+    }
+};
+
+void
+MLASCALL
+MlasNchwcConv(
+    const int64_t* InputShape,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* Padding,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape,
+    size_t GroupCount,
+    const uint8_t* Input,
+    uint8_t InputZeroPoint,
+    const void* Filter,
+    uint8_t FilterZeroPoint,
+    bool FilterIsSigned,
+    bool FilterIsPacked,
+    const int32_t* Bias,
+    const float* Scale,
+    bool PerChannelScale,
+    uint8_t OutputZeroPoint,
+    uint8_t* Output,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the quantized NCHWc convolution operation.
+
+Arguments:
+
+    InputShape - Supplies the shape of the input tensor. The number of
+        channels must be aligned to the NCHWc block size.
+
+    KernelShape - Supplies the shape of the kernel transform.
+
+    DilationShape - Supplies the shape of the dilation.
+
+    Padding - Supplies the number of padding elements at the edge of the input
+        tensor.
+
+    StrideShape - Supplies the shape of the stride.
+
+    OutputShape - Supplies the shape of the output tensor. The number of
+        channels must be aligned to the NCHWc block size.
+
+    GroupCount - Supplies the number of channel groups. Either the number of
+        input and output channels per group are aligned to the NCHWc block
+        size or both are one (depthwise convolution).
+
+    Input - Supplies the input tensor.
+
+    InputZeroPoint - Supplies the input zero point value.
+
+    Filter - Supplies the filter tensor in the HWIO format produced by
+        MlasReorderFilterHWIO or packed by MlasNchwcPackFilter, or in OIHWBo
+        format for depthwise convolution.
+
+    FilterZeroPoint - Supplies the filter zero point value.
+
+    FilterIsSigned - Supplies true if the filter tensor contains signed data,
+        else false if the filter tensor contains unsigned data.
+
+    FilterIsPacked - Supplies true if the filter tensor was packed by
+        MlasNchwcPackFilter. Depthwise convolution filters are not packed.
+
+    Bias - Optionally supplies the bias vector. The vector is aligned to the
+        NCHWc output channel count.
+
+    Scale - Supplies the output scale. If PerChannelScale is true, the vector
+        is aligned to the NCHWc output channel count.
+
+    PerChannelScale - Supplies true if the output scale has per-channel
+        values, else false if a single scale applies to all channels.
+
+    OutputZeroPoint - Supplies the output zero point value.
+
+    Output - Supplies the output tensor.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_NCHWC_QCONV_WORK_BLOCK WorkBlock;
+
+    //
+    // Capture the convolution specific parameters to the work block.
+    //
+
+    WorkBlock.Input = Input;
+    WorkBlock.Filter = static_cast<const uint8_t*>(Filter);
+    WorkBlock.Bias = Bias;
+    WorkBlock.Scale = Scale;
+    WorkBlock.Output = Output;
+    WorkBlock.GroupCount = GroupCount;
+    WorkBlock.InputZeroPoint = InputZeroPoint;
+    WorkBlock.FilterZeroPoint = FilterZeroPoint;
+    WorkBlock.OutputZeroPoint = OutputZeroPoint;
+    WorkBlock.FilterIsSigned = FilterIsSigned;
+    WorkBlock.FilterIsPacked = FilterIsPacked;
+    WorkBlock.PerChannelScale = PerChannelScale;
+
+    //
+    // Capture the generic shape parameters to the work block.
+    //
+
+    MlasNchwcPrepareWorkBlock(&WorkBlock, InputShape, KernelShape,
+        DilationShape, Padding, StrideShape, OutputShape);
+
+    WorkBlock.InputChannels /= GroupCount;
+    WorkBlock.OutputChannels /= GroupCount;
+
+    //
+    // Determine the type of convolution to perform based on the shape
+    // parameters.
+    //
+    // N.B. The caller must be aware of the selection algorithm in order to
+    // reorder the filter tensor in the expected format for the given algorithm.
+    //
+
+    MLAS_THREADED_ROUTINE* ThreadedRoutine;
+
+    WorkBlock.tids = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (WorkBlock.InputChannels == 1 && WorkBlock.OutputChannels == 1) {
+
+        ThreadedRoutine = MlasNchwcThreaded<MLAS_NCHWC_QCONV_DEPTHWISE_ALGORITHM>;
+
+    } else {
+
+        //
+        // The output channels of a group are computed in fixed sets of filters
+        // to match the layout of a packed filter. Shrink the tile of output
+        // positions until there is a unit of work for each thread.
+        //
+
+        const size_t FilterSetCount = (WorkBlock.OutputChannels + MLAS_NCHWC_QCONV_FILTER_SET_SIZE - 1) /
+            MLAS_NCHWC_QCONV_FILTER_SET_SIZE;
+
+        size_t TileOutputCount = MLAS_NCHWC_QCONV_OUTPUT_COUNT;
+
+        while (TileOutputCount > MLAS_NCHWC_QCONV_MINIMUM_OUTPUT_COUNT) {
+
+            const size_t TileCount = (WorkBlock.OutputSize + TileOutputCount - 1) / TileOutputCount;
+
+            if (WorkBlock.BatchCount * GroupCount * FilterSetCount * TileCount >= size_t(WorkBlock.tids)) {
+                break;
+            }
+
+            TileOutputCount /= 2;
+        }
+
+        WorkBlock.TileOutputCount = TileOutputCount;
+
+        ThreadedRoutine = MlasNchwcThreaded<MLAS_NCHWC_QCONV_NCHWC_ALGORITHM>;
+    }
+
+    //
+    // Schedule the operation across a set of worker threads.
+    //
+
+    MlasExecuteThreaded(ThreadedRoutine, &WorkBlock, WorkBlock.tids, ThreadPool);
+}
+
+size_t
+MLASCALL
+MlasNchwcPackFilterSize(
+    const int64_t* FilterShape,
+    size_t GroupCount,
+    bool FilterIsSigned
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the number of bytes required to pack a quantized
+    filter tensor for the NCHWc convolution operation.
+
+Arguments:
+
+    FilterShape - Supplies the shape of the filter tensor in OIHW format.
+
+    GroupCount - Supplies the number of channel groups.
+
+    FilterIsSigned - Supplies true if the filter tensor contains signed data,
+        else false if the filter tensor contains unsigned data.
+
+Return Value:
+
+    Returns the number of bytes required to pack the filter tensor, else zero
+        if the current implementation does not support packing.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t OutputChannels = size_t(FilterShape[0]) / GroupCount;
+    const size_t InputChannels = size_t(FilterShape[1]);
+    const size_t KernelSize = size_t(FilterShape[2]) * size_t(FilterShape[3]);
+
+    if (MlasGemmPackBSize(BlockSize, BlockSize, FilterIsSigned) == 0) {
+        return 0;
+    }
+
+    const size_t AlignedInputChannels = (InputChannels + BlockSize - 1) & ~(BlockSize - 1);
+    const size_t AlignedOutputChannels = (OutputChannels + BlockSize - 1) & ~(BlockSize - 1);
+
+    return GroupCount * MlasNchwcQConvPackedFilterGroupSize(AlignedOutputChannels,
+        KernelSize * AlignedInputChannels, FilterIsSigned);
+}
+
+void
+MLASCALL
+MlasNchwcPackFilter(
+    const int64_t* FilterShape,
+    size_t GroupCount,
+    const uint8_t* Filter,
+    bool FilterIsSigned,
+    void* PackedFilter
+    )
+/*++
+
+Routine Description:
+
+    This routine packs a quantized filter tensor for the NCHWc convolution
+    operation. The size of the packed buffer was obtained from
+    MlasNchwcPackFilterSize.
+
+Arguments:
+
+    FilterShape - Supplies the shape of the filter tensor in OIHW format.
+
+    GroupCount - Supplies the number of channel groups.
+
+    Filter - Supplies the filter tensor in the HWIO format produced by
+        MlasReorderFilterHWIO.
+
+    FilterIsSigned - Supplies true if the filter tensor contains signed data,
+        else false if the filter tensor contains unsigned data.
+
+    PackedFilter - Supplies the address of the packed filter tensor.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t OutputChannels = size_t(FilterShape[0]) / GroupCount;
+    const size_t InputChannels = size_t(FilterShape[1]);
+    const size_t KernelSize = size_t(FilterShape[2]) * size_t(FilterShape[3]);
+
+    const size_t AlignedInputChannels = (InputChannels + BlockSize - 1) & ~(BlockSize - 1);
+    const size_t AlignedOutputChannels = (OutputChannels + BlockSize - 1) & ~(BlockSize - 1);
+
+    const size_t FilterRowCount = KernelSize * AlignedInputChannels;
+    const size_t FilterSetSize = MLAS_NCHWC_QCONV_FILTER_SET_SIZE;
+    const size_t SliceRowCount = MLAS_NCHWC_QCONV_FILTER_SLICE_SIZE;
+
+    uint8_t* D = static_cast<uint8_t*>(PackedFilter);
+
+    //
+    // Pack each slice of the filter rows of each set of filters as an
+    // independent matrix in the order consumed by MlasNchwcConv.
+    //
+
+    for (size_t g = 0; g < GroupCount; g++) {
+
+        for (size_t FilterIndex = 0; FilterIndex < AlignedOutputChannels; FilterIndex += FilterSetSize) {
+
+            const size_t FilterCount = std::min(AlignedOutputChannels - FilterIndex, FilterSetSize);
+
+            for (size_t FilterRow = 0; FilterRow < FilterRowCount; FilterRow += SliceRowCount) {
+
+                const size_t RowCount = std::min(FilterRowCount - FilterRow, SliceRowCount);
+
+                MlasGemmPackB(FilterCount, RowCount, Filter + FilterRow * AlignedOutputChannels + FilterIndex,
+                    AlignedOutputChannels, FilterIsSigned, D);
+
+                D += MlasGemmPackBSize(FilterCount, RowCount, FilterIsSigned);
+            }
+        }
+
+        Filter += FilterRowCount * AlignedOutputChannels;
+    }
+}
+
+void
+MLASCALL
+MlasNchwcPool(
+    MLAS_POOLING_KIND PoolingKind,
+    const int64_t* InputShape,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* Padding,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape,
+    const uint8_t* Input,
+    uint8_t* Output,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the quantized NCHWc pooling operation.
+
+Arguments:
+
+    PoolingKind - Supplies the kind of pooling operation to perform. Only
+        MlasMaximumPooling is supported for quantized data, because the
+        maximum commutes with the quantization transform.
+
+    InputShape - Supplies the shape of the input tensor.
+
+    KernelShape - Supplies the shape of the kernel transform.
+
+    DilationShape - Supplies the shape of the dilation.
+
+    Padding - Supplies the number of padding elements at the edge of the input
+        tensor.
+
+    StrideShape - Supplies the shape of the stride.
+
+    OutputShape - Supplies the shape of the output tensor.
+
+    Input - Supplies the input tensor.
+
+    Output - Supplies the output tensor.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_UNREFERENCED_PARAMETER(PoolingKind);
+
+    MLAS_NCHWC_QPOOL_WORK_BLOCK WorkBlock;
+
+    //
+    // Capture the pooling specific parameters to the work block.
+    //
+
+    WorkBlock.Input = Input;
+    WorkBlock.Output = Output;
+
+    //
+    // Capture the generic shape parameters to the work block.
+    //
+
+    MlasNchwcPrepareWorkBlock(&WorkBlock, InputShape, KernelShape,
+        DilationShape, Padding, StrideShape, OutputShape);
+
+    //
+    // Schedule the operation across a set of worker threads.
+    //
+
+    WorkBlock.tids = MlasGetMaximumThreadCount(ThreadPool);
+
+    MlasExecuteThreaded(MlasNchwcThreaded<MLAS_NCHWC_QPOOL_ALGORITHM>, &WorkBlock, WorkBlock.tids, ThreadPool);
+}
+
 #if !defined(MLAS_TARGET_AMD64)
 
 //
@@ -0,0 +1,763 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    spgemm.cpp
+
+Abstract:
+
+    This module implements the single precision sparse/dense matrix multiply
+    operation where matrix B is a constant that has been packed into a block
+    compressed sparse row (BCSR) format.
+
+    Each non-zero block holds a run of BlockWidth adjacent elements from a
+    single row of matrix B. A block width of one is plain compressed sparse
+    row (CSR) storage. The columns of matrix B are split into panels so that
+    the output tile for a panel stays resident in the cache and so that the
+    panels can be computed in parallel.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the number of columns of matrix B in each packed panel.
+//
+
+#define MLAS_SPARSE_SGEMM_STRIDEN                   256
+
+//
+// Define the block widths considered when packing matrix B.
+//
+
+#define MLAS_SPARSE_SGEMM_MAXIMUM_BLOCK_WIDTH       8
+
+//
+// Define the layout of the header at the start of the packed matrix B buffer.
+//
+// The header is followed by the panel row offsets (PanelCount * (K + 1)
+// entries), the starting column of each block (BlockCount entries) and then,
+// aligned to the preferred buffer alignment, BlockWidth values per block.
+//
+
+struct MLAS_SPARSE_SGEMM_PACKED_HEADER {
+    size_t N;
+    size_t K;
+    size_t BlockWidth;
+    size_t BlockCount;
+    size_t PanelCount;
+};
+
+struct MLAS_SPARSE_SGEMM_PACKED_LAYOUT {
+    const MLAS_SPARSE_SGEMM_PACKED_HEADER* Header;
+    const uint32_t* RowOffsets;
+    const uint32_t* BlockColumns;
+    const float* Values;
+};
+
+MLAS_FORCEINLINE
+size_t
+MlasSparseSgemmAlignSize(
+    size_t Size
+    )
+{
+    const size_t BufferAlignment = MlasGetPreferredBufferAlignment();
+
+    return (Size + BufferAlignment - 1) & ~(BufferAlignment - 1);
+}
+
+MLAS_FORCEINLINE
+size_t
+MlasSparseSgemmPanelCount(
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the number of column panels for matrix B. The last
+    panel absorbs any remainder columns so that every panel is at least as
+    wide as the widest block, which allows tail blocks to be shifted left
+    without crossing into a panel owned by another thread.
+
+Arguments:
+
+    N - Supplies the number of columns of matrix B.
+
+Return Value:
+
+    Returns the number of column panels.
+
+--*/
+{
+    return std::max(N / MLAS_SPARSE_SGEMM_STRIDEN, size_t(1));
+}
+
+MLAS_FORCEINLINE
+void
+MlasSparseSgemmPanelRange(
+    size_t N,
+    size_t PanelCount,
+    size_t Panel,
+    size_t* StartN,
+    size_t* CountN
+    )
+{
+    *StartN = Panel * MLAS_SPARSE_SGEMM_STRIDEN;
+    *CountN = (Panel + 1 == PanelCount) ? (N - *StartN) : MLAS_SPARSE_SGEMM_STRIDEN;
+}
+
+MLAS_FORCEINLINE
+float
+MlasSparseSgemmLoadB(
+    CBLAS_TRANSPOSE TransB,
+    const float* B,
+    size_t ldb,
+    size_t k,
+    size_t n
+    )
+{
+    return (TransB == CblasNoTrans) ? B[k * ldb + n] : B[n * ldb + k];
+}
+
+MLAS_FORCEINLINE
+size_t
+MlasSparseSgemmBlockStart(
+    size_t PanelStartN,
+    size_t PanelCountN,
+    size_t BlockWidth,
+    size_t n
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the starting column of the block that holds the
+    aligned run of columns beginning at n. A block that would extend past the
+    end of the panel is shifted left so that the kernel never stores past
+    the end of the output row; the overlapped columns are packed as zeros.
+
+--*/
+{
+    return std::min(n, PanelStartN + PanelCountN - BlockWidth);
+}
+
+template<typename Callback>
+void
+MlasSparseSgemmEnumerateBlocks(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    size_t BlockWidth,
+    Callback BlockCallback
+    )
+/*++
+
+Routine Description:
+
+    This routine enumerates the non-zero blocks of matrix B in packed order:
+    by panel, then by row, then by column.
+
+Arguments:
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    BlockWidth - Supplies the number of columns in each block.
+
+    BlockCallback - Supplies the routine invoked for each non-zero block with
+        the panel index, row index, aligned starting column and the packed
+        starting column of the block. The callback is also invoked with a
+        starting column of N at the end of every panel row.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t PanelCount = MlasSparseSgemmPanelCount(N);
+
+    for (size_t p = 0; p < PanelCount; p++) {
+
+        size_t PanelStartN;
+        size_t PanelCountN;
+
+        MlasSparseSgemmPanelRange(N, PanelCount, p, &PanelStartN, &PanelCountN);
+
+        const size_t PanelEndN = PanelStartN + PanelCountN;
+
+        for (size_t k = 0; k < K; k++) {
+
+            for (size_t n = PanelStartN; n < PanelEndN; n += BlockWidth) {
+
+                const size_t CountN = std::min(BlockWidth, PanelEndN - n);
+                bool NonZero = false;
+
+                for (size_t i = 0; i < CountN; i++) {
+                    if (MlasSparseSgemmLoadB(TransB, B, ldb, k, n + i) != 0.0f) {
+                        NonZero = true;
+                        break;
+                    }
+                }
+
+                if (NonZero) {
+                    BlockCallback(p, k, n,
+                        MlasSparseSgemmBlockStart(PanelStartN, PanelCountN, BlockWidth, n));
+                }
+            }
+
+            BlockCallback(p, k, N, N);
+        }
+    }
+}
+
+size_t
+MlasSparseSgemmCountBlocks(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    size_t BlockWidth
+    )
+{
+    size_t BlockCount = 0;
+
+    MlasSparseSgemmEnumerateBlocks(TransB, N, K, B, ldb, BlockWidth,
+        [&](size_t, size_t, size_t n, size_t) {
+            if (n != N) {
+                BlockCount++;
+            }
+        });
+
+    return BlockCount;
+}
+
+size_t
+MlasSparseSgemmSelectBlockWidth(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    size_t* BlockCount
+    )
+/*++
+
+Routine Description:
+
+    This routine selects the block width that minimizes the estimated cost of
+    the sparse multiply. A block of four elements is processed by a single
+    vector multiply-add, so the cost of a vector block is its width divided
+    by four while a scalar block costs one. Wider blocks are preferred on a
+    tie because they need fewer column indices.
+
+Arguments:
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    BlockCount - Receives the number of blocks for the selected block width.
+
+Return Value:
+
+    Returns the selected block width.
+
+--*/
+{
+    size_t SelectedBlockWidth = 1;
+    size_t SelectedBlockCount = MlasSparseSgemmCountBlocks(TransB, N, K, B, ldb, 1);
+    size_t SelectedCost = SelectedBlockCount * 4;
+
+    for (size_t BlockWidth = 4; BlockWidth <= MLAS_SPARSE_SGEMM_MAXIMUM_BLOCK_WIDTH; BlockWidth *= 2) {
+
+        if (BlockWidth > N) {
+            break;
+        }
+
+        const size_t Count = MlasSparseSgemmCountBlocks(TransB, N, K, B, ldb, BlockWidth);
+        const size_t Cost = Count * BlockWidth;
+
+        if (Cost <= SelectedCost) {
+            SelectedBlockWidth = BlockWidth;
+            SelectedBlockCount = Count;
+            SelectedCost = Cost;
+        }
+    }
+
+    *BlockCount = SelectedBlockCount;
+
+    return SelectedBlockWidth;
+}
+
+MLAS_FORCEINLINE
+size_t
+MlasSparseSgemmIndexBytes(
+    size_t N,
+    size_t K,
+    size_t BlockCount
+    )
+{
+    const size_t PanelCount = MlasSparseSgemmPanelCount(N);
+
+    return MlasSparseSgemmAlignSize(sizeof(MLAS_SPARSE_SGEMM_PACKED_HEADER) +
+        (PanelCount * (K + 1) + BlockCount) * sizeof(uint32_t));
+}
+
+MLAS_SPARSE_SGEMM_PACKED_LAYOUT
+MlasSparseSgemmGetPackedLayout(
+    const void* PackedB
+    )
+{
+    MLAS_SPARSE_SGEMM_PACKED_LAYOUT Layout;
+
+    Layout.Header = static_cast<const MLAS_SPARSE_SGEMM_PACKED_HEADER*>(PackedB);
+    Layout.RowOffsets = reinterpret_cast<const uint32_t*>(Layout.Header + 1);
+    Layout.BlockColumns = Layout.RowOffsets + Layout.Header->PanelCount * (Layout.Header->K + 1);
+    Layout.Values = reinterpret_cast<const float*>(static_cast<const uint8_t*>(PackedB) +
+        MlasSparseSgemmIndexBytes(Layout.Header->N, Layout.Header->K, Layout.Header->BlockCount));
+
+    return Layout;
+}
+
+template<size_t BlockWidth>
+MLAS_FORCEINLINE
+void
+MlasSparseSgemmKernel(
+    const MLAS_SPARSE_SGEMM_PACKED_LAYOUT& Layout,
+    size_t Panel,
+    const float* A,
+    float* C,
+    float alpha
+    )
+/*++
+
+Routine Description:
+
+    This routine accumulates the product of one row of matrix A and a panel
+    of packed matrix B into one row of matrix C.
+
+Arguments:
+
+    Layout - Supplies the layout of the packed matrix B buffer.
+
+    Panel - Supplies the index of the panel of matrix B.
+
+    A - Supplies the address of the row of matrix A.
+
+    C - Supplies the address of the row of matrix C. The block columns are
+        absolute, so this is the start of the row and not of the panel.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t K = Layout.Header->K;
+    const uint32_t* RowOffsets = Layout.RowOffsets + Panel * (K + 1);
+    const uint32_t* BlockColumns = Layout.BlockColumns;
+    const float* Values = Layout.Values;
+
+    for (size_t k = 0; k < K; k++) {
+
+        //
+        // Rows of matrix B are not skipped when the element of matrix A is
+        // zero, so an infinity or NaN in a stored block of matrix B propagates
+        // to the output like it does for the dense product. Only the blocks
+        // that are entirely zero are structurally absent.
+        //
+
+        const float Scale = A[k] * alpha;
+        const uint32_t BlockEnd = RowOffsets[k + 1];
+
+        if (BlockWidth == 1) {
+
+            for (uint32_t b = RowOffsets[k]; b < BlockEnd; b++) {
+                C[BlockColumns[b]] += Scale * Values[b];
+            }
+
+        } else {
+
+            const MLAS_FLOAT32X4 ScaleVector = MlasBroadcastFloat32x4(Scale);
+
+            for (uint32_t b = RowOffsets[k]; b < BlockEnd; b++) {
+
+                float* c = C + BlockColumns[b];
+                const float* v = Values + size_t(b) * BlockWidth;
+
+                for (size_t i = 0; i < BlockWidth; i += 4) {
+                    MLAS_FLOAT32X4 Accumulator = MlasLoadFloat32x4(c + i);
+                    Accumulator = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(v + i), ScaleVector, Accumulator);
+                    MlasStoreFloat32x4(c + i, Accumulator);
+                }
+            }
+        }
+    }
+}
+
+void
+MlasSparseSgemmOperation(
+    const MLAS_SPARSE_SGEMM_PACKED_LAYOUT& Layout,
+    size_t Panel,
+    size_t CountM,
+    float alpha,
+    const float* A,
+    size_t lda,
+    float beta,
+    float* C,
+    size_t ldc
+    )
+/*++
+
+Routine Description:
+
+    This routine computes one panel of matrix C for a range of rows.
+
+Arguments:
+
+    Layout - Supplies the layout of the packed matrix B buffer.
+
+    Panel - Supplies the index of the panel of matrix B.
+
+    CountM - Supplies the number of rows of matrix A and matrix C.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    beta - Supplies the scalar beta multiplier (see SGEMM definition).
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockWidth = Layout.Header->BlockWidth;
+
+    size_t PanelStartN;
+    size_t PanelCountN;
+
+    MlasSparseSgemmPanelRange(Layout.Header->N, Layout.Header->PanelCount, Panel,
+        &PanelStartN, &PanelCountN);
+
+    for (size_t m = 0; m < CountM; m++) {
+
+        float* c = C + m * ldc;
+
+        if (beta == 0.0f) {
+            std::fill_n(c + PanelStartN, PanelCountN, 0.0f);
+        } else if (beta != 1.0f) {
+            for (size_t n = PanelStartN; n < PanelStartN + PanelCountN; n++) {
+                c[n] *= beta;
+            }
+        }
+
+        const float* a = A + m * lda;
+
+        switch (BlockWidth) {
+            case 1:
+                MlasSparseSgemmKernel<1>(Layout, Panel, a, c, alpha);
+                break;
+            case 4:
+                MlasSparseSgemmKernel<4>(Layout, Panel, a, c, alpha);
+                break;
+            case 8:
+                MlasSparseSgemmKernel<8>(Layout, Panel, a, c, alpha);
+                break;
+        }
+    }
+}
+
+size_t
+MLASCALL
+MlasSparseGemmPackBSize(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the length in bytes for the sparse packed matrix B
+    buffer. The length depends on the values of matrix B.
+
+Arguments:
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+Return Value:
+
+    Returns the size in bytes for the packed matrix B buffer, or zero if
+    matrix B cannot be represented in the packed format.
+
+--*/
+{
+    if (N == 0 || K == 0) {
+        return 0;
+    }
+
+    size_t BlockCount;
+    const size_t BlockWidth = MlasSparseSgemmSelectBlockWidth(TransB, N, K, B, ldb, &BlockCount);
+
+    //
+    // The block offsets and columns are stored as 32-bit values.
+    //
+
+    if (BlockCount >= std::numeric_limits<uint32_t>::max() || N >= std::numeric_limits<uint32_t>::max()) {
+        return 0;
+    }
+
+    return MlasSparseSgemmIndexBytes(N, K, BlockCount) +
+        MlasSparseSgemmAlignSize(BlockCount * BlockWidth * sizeof(float));
+}
+
+void
+MLASCALL
+MlasSparseGemmPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    void* PackedB
+    )
+/*++
+
+Routine Description:
+
+    This routine packs the non-zero blocks of matrix B to the destination
+    buffer. The destination buffer should be sized based on
+    MlasSparseGemmPackBSize().
+
+Arguments:
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    PackedB - Supplies the address of packed matrix B.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    size_t BlockCount;
+    const size_t BlockWidth = MlasSparseSgemmSelectBlockWidth(TransB, N, K, B, ldb, &BlockCount);
+
+    auto* Header = static_cast<MLAS_SPARSE_SGEMM_PACKED_HEADER*>(PackedB);
+
+    Header->N = N;
+    Header->K = K;
+    Header->BlockWidth = BlockWidth;
+    Header->BlockCount = BlockCount;
+    Header->PanelCount = MlasSparseSgemmPanelCount(N);
+
+    const MLAS_SPARSE_SGEMM_PACKED_LAYOUT Layout = MlasSparseSgemmGetPackedLayout(PackedB);
+
+    uint32_t* RowOffsets = const_cast<uint32_t*>(Layout.RowOffsets);
+    uint32_t* BlockColumns = const_cast<uint32_t*>(Layout.BlockColumns);
+    float* Values = const_cast<float*>(Layout.Values);
+
+    uint32_t BlockIndex = 0;
+    size_t LastPanel = size_t(-1);
+
+    MlasSparseSgemmEnumerateBlocks(TransB, N, K, B, ldb, BlockWidth,
+        [&](size_t p, size_t k, size_t n, size_t PackedStartN) {
+
+            uint32_t* PanelRowOffsets = RowOffsets + p * (K + 1);
+
+            if (p != LastPanel) {
+                PanelRowOffsets[0] = BlockIndex;
+                LastPanel = p;
+            }
+
+            if (n == N) {
+                PanelRowOffsets[k + 1] = BlockIndex;
+                return;
+            }
+
+            //
+            // Copy the block values. Columns of a shifted tail block that
+            // precede the aligned column belong to the previous block and
+            // are packed as zeros.
+            //
+
+            float* v = Values + size_t(BlockIndex) * BlockWidth;
+            const size_t EndN = std::min(n + BlockWidth, N);
+
+            for (size_t i = 0; i < BlockWidth; i++) {
+                const size_t Column = PackedStartN + i;
+                v[i] = (Column >= n && Column < EndN) ? MlasSparseSgemmLoadB(TransB, B, ldb, k, Column) : 0.0f;
+            }
+
+            BlockColumns[BlockIndex] = uint32_t(PackedStartN);
+            BlockIndex++;
+        });
+}
+
+void
+MLASCALL
+MlasSparseGemm(
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    const void* PackedB,
+    float beta,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the single precision matrix/matrix multiply
+    operation C := alpha * A * B + beta * C, where matrix B has been packed
+    by MlasSparseGemmPackB.
+
+Arguments:
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix A and the number of rows of
+        matrix B.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    PackedB - Supplies the address of packed matrix B.
+
+    beta - Supplies the scalar beta multiplier (see SGEMM definition).
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const MLAS_SPARSE_SGEMM_PACKED_LAYOUT Layout = MlasSparseSgemmGetPackedLayout(PackedB);
+
+    MLAS_UNREFERENCED_PARAMETER(N);
+    MLAS_UNREFERENCED_PARAMETER(K);
+
+    if (M == 0) {
+        return;
+    }
+
+    //
+    // Compute the number of target threads given the number of multiply-add
+    // operations actually performed. Each thread computes a contiguous range
+    // of rows from a panel, so that the panel of packed matrix B is reused
+    // from the cache.
+    //
+
+    const size_t PanelCount = Layout.Header->PanelCount;
+    const size_t WorkItems = M * PanelCount;
+
+    const double Complexity = double(M) * double(Layout.Header->BlockCount) *
+        double(Layout.Header->BlockWidth);
+
+    ptrdiff_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MlasPlatform.MaximumThreadCount)) {
+        TargetThreadCount = ptrdiff_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MlasPlatform.MaximumThreadCount;
+    }
+
+    ptrdiff_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    if (size_t(TargetThreadCount) > WorkItems) {
+        TargetThreadCount = ptrdiff_t(WorkItems);
+    }
+
+    MlasTrySimpleParallel(ThreadPool, TargetThreadCount, [&](ptrdiff_t ThreadId) {
+
+        size_t WorkIndex;
+        size_t WorkRemaining;
+
+        MlasPartitionWork(ThreadId, TargetThreadCount, WorkItems, &WorkIndex, &WorkRemaining);
+
+        while (WorkRemaining > 0) {
+
+            const size_t Panel = WorkIndex / M;
+            const size_t StartM = WorkIndex % M;
+            const size_t CountM = std::min(M - StartM, WorkRemaining);
+
+            MlasSparseSgemmOperation(Layout, Panel, CountM, alpha, A + StartM * lda, lda,
+                beta, C + StartM * ldc, ldc);
+
+            WorkIndex += CountM;
+            WorkRemaining -= CountM;
+        }
+    });
+}
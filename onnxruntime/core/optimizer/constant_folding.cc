@@ -2,24 +2,271 @@
 // Licensed under the MIT License.
 
 #include "core/optimizer/constant_folding.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <map>
+#include <numeric>
+
 #include "core/optimizer/utils.h"
 #include "core/graph/graph_utils.h"
 #include "core/optimizer/optimizer_execution_frame.h"
+#include "core/framework/mldata_type_utils.h"
+#include "core/framework/murmurhash3.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/tensorprotoutils.h"
+#include "core/platform/ort_mutex.h"
+#include "core/platform/threadpool.h"
 
 using namespace onnxruntime::common;
 
 namespace onnxruntime {
 
+// A connected set of constant nodes, which is evaluated in a single execution frame.
+struct ConstantFolding::ConstantSubgraph {
+  std::vector<Node*> nodes;  // in topological order
+  InitializedTensorSet constant_inputs;
+};
+
+// The result of evaluating a constant subgraph. It is applied to the graph once all the subgraphs are evaluated.
+struct ConstantFolding::FoldedSubgraph {
+  std::vector<ONNX_NAMESPACE::TensorProto> initializers;
+  std::vector<NodeIndex> nodes_to_remove;  // in topological order
+};
+
+namespace {
+
+using SubgraphKey = std::array<uint32_t, 4>;
+
+struct SubgraphKeyHash {
+  size_t operator()(const SubgraphKey& key) const {
+    return static_cast<size_t>((uint64_t{key[0]} << 32 | key[1]) ^ (uint64_t{key[2]} << 32 | key[3]));
+  }
+};
+
+// The identity of a constant subgraph in the cache. The key is a 128 bit hash of the content of the subgraph. The
+// signature holds the same content except for the data of the constant inputs, i.e. the operators, attributes and
+// the types and shapes of the inputs, and is compared on a cache hit so that a hash collision can't reuse the values
+// of a different subgraph.
+struct SubgraphFingerprint {
+  SubgraphKey key{};
+  std::string signature;
+};
+
+// Incrementally computes the fingerprint of a constant subgraph.
+class SubgraphHasher {
+ public:
+  void Add(int64_t value) {
+    AddBytes(&value, sizeof(value));
+    fingerprint_.signature.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  void Add(const std::string& str) {
+    Add(static_cast<int64_t>(str.size()));
+    AddBytes(str.data(), str.size());
+    fingerprint_.signature.append(str);
+  }
+
+  void Add(const Tensor& tensor) {
+    Add(static_cast<int64_t>(tensor.GetElementType()));
+    const auto& dims = tensor.Shape().GetDims();
+    Add(static_cast<int64_t>(dims.size()));
+    for (int64_t dim : dims) {
+      Add(dim);
+    }
+
+    // the data is only hashed
+    if (tensor.IsDataTypeString()) {
+      const auto* strings = tensor.Data<std::string>();
+      for (int64_t i = 0, end = tensor.Shape().Size(); i < end; ++i) {
+        const int64_t length = static_cast<int64_t>(strings[i].size());
+        AddBytes(&length, sizeof(length));
+        AddBytes(strings[i].data(), strings[i].size());
+      }
+    } else {
+      AddBytes(tensor.DataRaw(), tensor.SizeInBytes());
+    }
+  }
+
+  const SubgraphFingerprint& Fingerprint() const { return fingerprint_; }
+
+ private:
+  // Hashes the bytes and folds the result into the full 128 bit state. MurmurHash3 only takes a 32 bit seed and an
+  // int length, so each chunk is hashed separately and then combined with the state by hashing both together.
+  void AddBytes(const void* data, size_t size) {
+    constexpr size_t kMaxChunkSize = size_t{1} << 30;
+    const char* bytes = static_cast<const char*>(data);
+    do {
+      const size_t chunk_size = std::min(size, kMaxChunkSize);
+      std::array<uint32_t, 8> state;
+      std::copy(fingerprint_.key.cbegin(), fingerprint_.key.cend(), state.begin());
+      MurmurHash3::x86_128(bytes, static_cast<int>(chunk_size), 0, state.data() + 4);
+      MurmurHash3::x86_128(state.data(), static_cast<int>(sizeof(state)), 0, fingerprint_.key.data());
+      bytes += chunk_size;
+      size -= chunk_size;
+    } while (size > 0);
+  }
+
+  SubgraphFingerprint fingerprint_;
+};
+
+// Fingerprints the operators, attributes and constant inputs of the nodes of a subgraph, which identify the values
+// they produce independently of the names in the graph.
+SubgraphFingerprint ComputeSubgraphFingerprint(const Graph& graph, const std::vector<Node*>& nodes,
+                                               const std::unordered_map<NodeIndex, size_t>& node_positions,
+                                               const OptimizerExecutionFrame::Info& info) {
+  SubgraphHasher hasher;
+  for (const Node* node : nodes) {
+    hasher.Add(node->Domain());
+    hasher.Add(node->OpType());
+    hasher.Add(static_cast<int64_t>(node->SinceVersion()));
+
+    // the attribute map is unordered, so hash the attributes in name order
+    std::map<std::string, const ONNX_NAMESPACE::AttributeProto*> attributes;
+    for (const auto& attribute : node->GetAttributes()) {
+      attributes.emplace(attribute.first, &attribute.second);
+    }
+    hasher.Add(static_cast<int64_t>(attributes.size()));
+    for (const auto& attribute : attributes) {
+      hasher.Add(attribute.first);
+      hasher.Add(attribute.second->SerializeAsString());
+    }
+
+    hasher.Add(static_cast<int64_t>(node->InputDefs().size()));
+    for (const NodeArg* input_def : node->InputDefs()) {
+      const Node* producer = graph.GetProducerNode(input_def->Name());
+      if (producer != nullptr) {
+        const auto& producer_outputs = producer->OutputDefs();
+        const auto output_index = std::find(producer_outputs.cbegin(), producer_outputs.cend(), input_def) -
+                                  producer_outputs.cbegin();
+        hasher.Add(int64_t{0});
+        hasher.Add(static_cast<int64_t>(node_positions.at(producer->Index())));
+        hasher.Add(static_cast<int64_t>(output_index));
+      } else {
+        hasher.Add(int64_t{1});
+        hasher.Add(info.GetInitializers().at(info.GetMLValueIndex(input_def->Name())).Get<Tensor>());
+      }
+    }
+  }
+
+  return hasher.Fingerprint();
+}
+
+struct CachedTensor {
+  ONNX_NAMESPACE::TensorProto tensor_proto;
+  size_t size_in_bytes;  // size of the tensor in memory, which the max folded tensor size applies to
+};
+
+// Process wide cache of the values produced by constant subgraphs, so that sessions loading the same model don't
+// evaluate them again. The values of a subgraph are keyed by their index in the list of node outputs.
+// Entries are evicted in insertion order once the cache exceeds the budget of the session inserting into it.
+class FoldedTensorCache {
+ public:
+  static FoldedTensorCache& Instance() {
+    static FoldedTensorCache cache;
+    return cache;
+  }
+
+  // Copies the cached values of the given outputs of a subgraph. Fails unless all of them are cached.
+  bool Lookup(const SubgraphFingerprint& fingerprint, const std::vector<size_t>& outputs,
+              std::vector<CachedTensor>& tensors) {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    auto entry = entries_.find(fingerprint.key);
+    if (entry == entries_.end() || entry->second.signature != fingerprint.signature) {
+      return false;
+    }
+
+    tensors.clear();
+    for (size_t output : outputs) {
+      auto tensor = entry->second.tensors.find(output);
+      if (tensor == entry->second.tensors.end()) {
+        return false;
+      }
+      tensors.push_back(tensor->second);
+    }
+    return true;
+  }
+
+  void Insert(const SubgraphFingerprint& fingerprint, std::unordered_map<size_t, CachedTensor>&& tensors,
+              size_t capacity) {
+    const SubgraphKey& key = fingerprint.key;
+    size_t size = fingerprint.signature.size();
+    for (const auto& tensor : tensors) {
+      size += tensor.second.tensor_proto.ByteSizeLong();
+    }
+    if (size > capacity) {
+      return;
+    }
+
+    std::lock_guard<OrtMutex> lock(mutex_);
+    // replace the existing entry, which may hold different outputs of the subgraph
+    Erase(key);
+    while (size_ + size > capacity && !insertion_order_.empty()) {
+      const SubgraphKey oldest_key = insertion_order_.front();
+      Erase(oldest_key);
+    }
+    entries_.emplace(key, Entry{std::move(tensors), fingerprint.signature, size});
+    insertion_order_.push_back(key);
+    size_ += size;
+  }
+
+ private:
+  struct Entry {
+    std::unordered_map<size_t, CachedTensor> tensors;
+    std::string signature;
+    size_t size;
+  };
+
+  void Erase(const SubgraphKey& key) {
+    auto entry = entries_.find(key);
+    if (entry != entries_.end()) {
+      size_ -= entry->second.size;
+      entries_.erase(entry);
+      insertion_order_.erase(std::find(insertion_order_.begin(), insertion_order_.end(), key));
+    }
+  }
+
+  OrtMutex mutex_;
+  std::unordered_map<SubgraphKey, Entry, SubgraphKeyHash> entries_;
+  std::deque<SubgraphKey> insertion_order_;
+  size_t size_{0};
+};
+
+// Returns the size in bytes of the tensor produced as node_arg if its shape is fully inferred, or -1.
+int64_t GetInferredTensorSize(const NodeArg& node_arg) {
+  const auto* shape = node_arg.Shape();
+  const auto* type = node_arg.Type() != nullptr ? utils::GetMLDataType(node_arg) : nullptr;
+  if (shape == nullptr || type == nullptr || !type->IsTensorType()) {
+    return -1;
+  }
+
+  int64_t size = static_cast<const TensorTypeBase*>(type)->GetElementType()->Size();
+  for (const auto& dim : shape->dim()) {
+    if (!utils::HasDimValue(dim) || dim.dim_value() < 0) {
+      return -1;
+    }
+    size *= dim.dim_value();
+  }
+  return size;
+}
+
+}  // namespace
+
 ConstantFolding::ConstantFolding(const IExecutionProvider& execution_provider,
                                  bool skip_dequantize_linear,
                                  const std::unordered_set<std::string>& compatible_execution_providers,
-                                 const std::unordered_set<std::string>& excluded_initializers) noexcept
+                                 const std::unordered_set<std::string>& excluded_initializers,
+                                 size_t max_folded_tensor_size,
+                                 concurrency::ThreadPool* thread_pool,
+                                 size_t cache_size) noexcept
     : GraphTransformer("ConstantFolding", compatible_execution_providers),
       skip_dequantize_linear_(skip_dequantize_linear),
       excluded_initializers_(excluded_initializers),
-      execution_provider_(execution_provider) {
+      execution_provider_(execution_provider),
+      max_folded_tensor_size_(max_folded_tensor_size),
+      thread_pool_(thread_pool),
+      cache_size_(cache_size) {
 }
 
 // We need to handle a Shape node separately as the input doesn't need to be a constant initializer for
@@ -57,11 +304,259 @@ static bool ConstantFoldShapeNode(Graph& graph, Node& node) {
   return is_concrete_shape;  // convert to constant if this is true
 }
 
+// Removes a node whose outputs were converted to initializers, along with the single-output node chains of its
+// inputs. Input nodes in nodes_to_keep are left in place.
+static void RemoveFoldedNode(Graph& graph, Node& node, const std::unordered_map<NodeIndex, size_t>& nodes_to_keep) {
+  auto p_ip_node = node.InputNodesBegin();
+  const auto p_ip_node_end = node.InputNodesEnd();
+  while (p_ip_node != p_ip_node_end) {
+    const auto& input_node = *p_ip_node;
+    // Update the node iterator before removing the corresponding node because removing
+    // the node will invalidate the node iterator
+    ++p_ip_node;
+    if (nodes_to_keep.find(input_node.Index()) == nodes_to_keep.end()) {
+      graph_utils::RemoveNodesWithOneOutputBottomUp(graph, input_node);
+    }
+  }
+
+  // Remove the output edges of the constant node and then remove the node itself.
+  graph_utils::RemoveNodeOutputEdges(graph, node);
+  graph.RemoveNode(node.Index());
+}
+
+bool ConstantFolding::CanFold(const Graph& graph, const Node& node,
+                              const std::unordered_map<NodeIndex, size_t>& constant_node_positions) const {
+  // we currently constant fold using the CPU EP only.
+  // if the node is assigned to a different EP we can run it if it's an ONNX op as we have CPU based
+  // implementations for all ONNX ops. If the node/op is from a different op domain or if the CPU implementation
+  // does not support the specific input type(s) required by the node (currently we only support a subset of
+  // types in some CPU kernels) then we can't proceed with constant folding for the node.
+  if (node.GetExecutionProviderType() != kCpuExecutionProvider && node.Domain() != kOnnxDomain) {
+    return false;
+  }
+
+  // Check if constant folding can be applied on this node.
+  if (!graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders()) ||
+      !optimizer_utils::IsOperationDeterministic(node.Domain(), node.OpType()) ||
+      // constant folding does not support executing a node that includes subgraphs (control flow operators,
+      // such as If/Loop/Scan, fall into this category). individual nodes in the subgraph will be processed
+      // by the Recurse call in ApplyImpl
+      node.ContainsSubgraph()) {
+    return false;
+  }
+
+  // every input must be a constant initializer or produced by another constant node.
+  // Important note: when an initializer appears in the graph's input, this input will not be considered constant,
+  // because it can be overridden by the user at runtime.
+  for (const auto* input_def : node.InputDefs()) {
+    const Node* producer = graph.GetProducerNode(input_def->Name());
+    if (producer != nullptr) {
+      if (constant_node_positions.find(producer->Index()) == constant_node_positions.end()) {
+        return false;
+      }
+    } else if (graph_utils::GetConstantInitializer(graph, input_def->Name(), true) == nullptr ||
+               excluded_initializers_.find(input_def->Name()) != excluded_initializers_.cend()) {
+      return false;
+    }
+  }
+
+  // don't evaluate nodes whose inferred output is larger than the limit, e.g. a Tile or Expand of a constant
+  if (max_folded_tensor_size_ != 0) {
+    for (const auto* output_def : node.OutputDefs()) {
+      if (output_def->Exists() &&
+          GetInferredTensorSize(*output_def) > static_cast<int64_t>(max_folded_tensor_size_)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+Status ConstantFolding::FoldSubgraph(const Graph& graph, const ConstantSubgraph& subgraph,
+                                     const logging::Logger& logger, FoldedSubgraph& folded) const {
+  const auto& nodes = subgraph.nodes;
+  const size_t num_nodes = nodes.size();
+  std::unordered_map<NodeIndex, size_t> node_positions;
+  for (size_t i = 0; i < num_nodes; ++i) {
+    node_positions[nodes[i]->Index()] = i;
+  }
+
+  // Create execution frame for executing constant nodes.
+  OptimizerExecutionFrame::Info info(std::vector<const Node*>(nodes.cbegin(), nodes.cend()), subgraph.constant_inputs,
+                                     graph.ModelPath(), execution_provider_);
+
+  // every output of the nodes is fetched, so that the values consumed outside of the folded nodes can be added as
+  // initializers
+  struct NodeOutput {
+    size_t node_position;
+    int output_index;
+    const NodeArg* node_arg;
+  };
+  std::vector<NodeOutput> node_outputs;
+  std::vector<int> fetch_mlvalue_idxs;
+  for (size_t i = 0; i < num_nodes; ++i) {
+    const auto& output_defs = nodes[i]->OutputDefs();
+    for (size_t j = 0; j < output_defs.size(); ++j) {
+      if (output_defs[j]->Exists()) {
+        node_outputs.push_back({i, static_cast<int>(j), output_defs[j]});
+        fetch_mlvalue_idxs.push_back(info.GetMLValueIndex(output_defs[j]->Name()));
+      }
+    }
+  }
+
+  // Returns the outputs of the folded nodes that are graph outputs or are consumed by other nodes.
+  auto get_boundary_outputs = [&](const std::vector<bool>& is_folded) {
+    std::vector<size_t> boundary_outputs;
+    for (size_t i = 0; i < node_outputs.size(); ++i) {
+      const auto& node_output = node_outputs[i];
+      if (!is_folded[node_output.node_position]) {
+        continue;
+      }
+
+      bool is_boundary = graph.IsOutput(node_output.node_arg);
+      const Node& node = *nodes[node_output.node_position];
+      for (auto edge = node.OutputEdgesBegin(), end = node.OutputEdgesEnd(); !is_boundary && edge != end; ++edge) {
+        if (edge->GetSrcArgIndex() == node_output.output_index) {
+          auto consumer = node_positions.find(edge->GetNode().Index());
+          is_boundary = consumer == node_positions.end() || !is_folded[consumer->second];
+        }
+      }
+
+      if (is_boundary) {
+        boundary_outputs.push_back(i);
+      }
+    }
+    return boundary_outputs;
+  };
+
+  auto fits_limit = [this](size_t size_in_bytes) {
+    return max_folded_tensor_size_ == 0 || size_in_bytes <= max_folded_tensor_size_;
+  };
+
+  SubgraphFingerprint fingerprint;
+  if (cache_size_ != 0) {
+    fingerprint = ComputeSubgraphFingerprint(graph, nodes, node_positions, info);
+
+    const auto boundary_outputs = get_boundary_outputs(std::vector<bool>(num_nodes, true));
+    std::vector<CachedTensor> cached_tensors;
+    if (FoldedTensorCache::Instance().Lookup(fingerprint, boundary_outputs, cached_tensors) &&
+        std::all_of(cached_tensors.cbegin(), cached_tensors.cend(),
+                    [&](const CachedTensor& tensor) { return fits_limit(tensor.size_in_bytes); })) {
+      for (size_t i = 0; i < boundary_outputs.size(); ++i) {
+        auto& tensor_proto = cached_tensors[i].tensor_proto;
+        tensor_proto.set_name(node_outputs[boundary_outputs[i]].node_arg->Name());
+        folded.initializers.push_back(std::move(tensor_proto));
+      }
+      for (const Node* node : nodes) {
+        folded.nodes_to_remove.push_back(node->Index());
+      }
+      ++cache_hit_count_;
+      return Status::OK();
+    }
+  }
+
+  OptimizerExecutionFrame frame(info, fetch_mlvalue_idxs);
+
+  std::vector<bool> is_folded(num_nodes, false);
+  for (size_t i = 0; i < num_nodes; ++i) {
+    Node& node = *nodes[i];
+
+    // a node can't be evaluated if one of the nodes producing its inputs wasn't
+    bool inputs_evaluated = true;
+    for (auto input_node = node.InputNodesBegin(), end = node.InputNodesEnd(); input_node != end; ++input_node) {
+      inputs_evaluated = inputs_evaluated && is_folded[node_positions.at(input_node->Index())];
+    }
+    if (!inputs_evaluated) {
+      continue;
+    }
+
+    // override the EP assigned to the node so that it will use the CPU kernel for Compute.
+    auto ep_type = node.GetExecutionProviderType();
+    bool cpu_ep = ep_type == kCpuExecutionProvider;
+    if (!cpu_ep) {
+      node.SetExecutionProviderType(kCpuExecutionProvider);
+    }
+
+    auto kernel = info.CreateKernel(&node);
+
+    // undo the EP change to the value that was assigned at graph partitioning time
+    if (!cpu_ep) {
+      node.SetExecutionProviderType(ep_type);
+    }
+
+    if (kernel == nullptr) {
+      LOGS(logger, WARNING) << "Could not find a CPU kernel and hence "
+                            << "can't constant fold " << node.OpType() << " node '" << node.Name() << "'";
+
+      // Move on to the next candidate node
+      continue;
+    }
+
+    OpKernelContext op_kernel_context(&frame, kernel.get(), nullptr, logger);
+    ORT_RETURN_IF_ERROR(kernel->Compute(&op_kernel_context));
+    is_folded[i] = true;
+  }
+
+  std::vector<OrtValue> fetches;
+  ORT_RETURN_IF_ERROR(frame.GetOutputs(fetches));
+
+  // A value that can't be added as an initializer, as it is not a tensor or exceeds the size limit, must still be
+  // produced by its node. Unfolding the node may in turn require the values of its input nodes to be added.
+  std::vector<size_t> boundary_outputs;
+  for (bool changed = true; changed;) {
+    changed = false;
+    boundary_outputs = get_boundary_outputs(is_folded);
+    for (size_t i : boundary_outputs) {
+      const OrtValue& ort_value = fetches[i];
+      const Node& node = *nodes[node_outputs[i].node_position];
+      if (!ort_value.IsTensor()) {
+        LOGS(logger, WARNING) << "Unsupported output type of " << ort_value.Type()
+                              << ". Can't constant fold " << node.OpType() << " node '" << node.Name() << "'";
+      } else if (!fits_limit(ort_value.Get<Tensor>().SizeInBytes())) {
+        LOGS(logger, INFO) << "Output '" << node_outputs[i].node_arg->Name() << "' of " << node.OpType() << " node '"
+                           << node.Name() << "' exceeds the maximum size of a folded tensor. Not folding the node.";
+      } else {
+        continue;
+      }
+
+      is_folded[node_outputs[i].node_position] = false;
+      changed = true;
+    }
+  }
+
+  // Build the TensorProtos that correspond to the computed OrtValues, which will be added as initializers to the graph
+  std::unordered_map<size_t, CachedTensor> cached_tensors;
+  for (size_t i : boundary_outputs) {
+    const Tensor& out_tensor = fetches[i].Get<Tensor>();
+    folded.initializers.push_back(utils::TensorToTensorProto(out_tensor, node_outputs[i].node_arg->Name()));
+    if (cache_size_ != 0) {
+      cached_tensors.emplace(i, CachedTensor{folded.initializers.back(), out_tensor.SizeInBytes()});
+    }
+  }
+
+  for (size_t i = 0; i < num_nodes; ++i) {
+    if (is_folded[i]) {
+      folded.nodes_to_remove.push_back(nodes[i]->Index());
+    }
+  }
+
+  if (!cached_tensors.empty()) {
+    FoldedTensorCache::Instance().Insert(fingerprint, std::move(cached_tensors), cache_size_);
+  }
+
+  return Status::OK();
+}
+
 Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
   bool have_updated_nodes = false;
   GraphViewer graph_viewer(graph);
   auto& order = graph_viewer.GetNodesInTopologicalOrder();
 
+  // the nodes that can be constant folded, in topological order
+  std::vector<NodeIndex> constant_nodes;
+  std::unordered_map<NodeIndex, size_t> constant_node_positions;
+
   for (NodeIndex i : order) {
     auto* node = graph.GetNode(i);
     if (!node) {
@@ -83,120 +578,122 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
       ORT_RETURN_IF_ERROR(graph.UpdateShapeInference(*node));
     }
 
-    bool converted_to_constant = false;
     if (node->OpType().compare("Shape") == 0) {
-      converted_to_constant = ConstantFoldShapeNode(graph, *node);
-    } else {
-      InitializedTensorSet constant_inputs;
-
-      // we currently constant fold using the CPU EP only.
-      // if the node is assigned to a different EP we can run it if it's an ONNX op as we have CPU based
-      // implementations for all ONNX ops. If the node/op is from a different op domain or if the CPU implementation
-      // does not support the specific input type(s) required by the node (currently we only support a subset of
-      // types in some CPU kernels) then we can't proceed with constant folding for the node.
-      auto ep_type = node->GetExecutionProviderType();
-      bool cpu_ep = ep_type == kCpuExecutionProvider;
-      if (!cpu_ep && node->Domain() != kOnnxDomain) {
-        continue;
-      }
-
-      // Check if constant folding can be applied on this node.
-      if (!graph_utils::IsSupportedProvider(*node, GetCompatibleExecutionProviders()) ||
-          !optimizer_utils::IsOperationDeterministic(node->Domain(), node->OpType()) ||
-          // constant folding does not support executing a node that includes subgraphs (control flow operators,
-          // such as If/Loop/Scan, fall into this category). individual nodes in the subgraph will be processed
-          // by the Recurse call above
-          node->ContainsSubgraph() || !graph_utils::AllNodeInputsAreConstant(graph, *node, constant_inputs, excluded_initializers_)) {
-        continue;
+      if (ConstantFoldShapeNode(graph, *node)) {
+        // a constant input node is removed with its constant subgraph if its outputs are no longer consumed
+        RemoveFoldedNode(graph, *node, constant_node_positions);
+        modified = true;
+        have_updated_nodes = true;
       }
+    } else if (CanFold(graph, *node, constant_node_positions)) {
+      constant_node_positions[i] = constant_nodes.size();
+      constant_nodes.push_back(i);
+    }
+  }
 
-      // Create execution frame for executing constant nodes.
-      OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), execution_provider_);
-
-      std::vector<int> fetch_mlvalue_idxs;
-      for (const auto* node_out : node->OutputDefs()) {
-        fetch_mlvalue_idxs.push_back(info.GetMLValueIndex(node_out->Name()));
-      }
+  // the Shape nodes folded above may have removed single-output chains of constant nodes
+  constant_nodes.erase(std::remove_if(constant_nodes.begin(), constant_nodes.end(),
+                                      [&graph](NodeIndex index) { return graph.GetNode(index) == nullptr; }),
+                       constant_nodes.end());
+  if (constant_nodes.empty()) {
+    return Status::OK();
+  }
 
-      // override the EP assigned to the node so that it will use the CPU kernel for Compute.
-      if (!cpu_ep) {
-        node->SetExecutionProviderType(kCpuExecutionProvider);
-      }
+  // group the constant nodes into connected subgraphs
+  std::vector<size_t> parents(constant_nodes.size());
+  std::iota(parents.begin(), parents.end(), size_t{0});
+  auto find_root = [&parents](size_t position) {
+    while (parents[position] != position) {
+      position = parents[position] = parents[parents[position]];
+    }
+    return position;
+  };
 
-      auto kernel = info.CreateKernel(node);
+  constant_node_positions.clear();
+  for (size_t position = 0; position < constant_nodes.size(); ++position) {
+    constant_node_positions[constant_nodes[position]] = position;
+  }
 
-      // undo the EP change to the value that was assigned at graph partitioning time
-      if (!cpu_ep) {
-        node->SetExecutionProviderType(ep_type);
-      }
+  for (size_t position = 0; position < constant_nodes.size(); ++position) {
+    const Node& node = *graph.GetNode(constant_nodes[position]);
+    for (auto input_node = node.InputNodesBegin(), end = node.InputNodesEnd(); input_node != end; ++input_node) {
+      const size_t input_root = find_root(constant_node_positions.at(input_node->Index()));
+      const size_t root = find_root(position);
+      // keep the smaller position as the root so that the subgraphs are ordered by their first node
+      parents[std::max(root, input_root)] = std::min(root, input_root);
+    }
+  }
 
-      if (kernel == nullptr) {
-        LOGS(logger, WARNING) << "Could not find a CPU kernel and hence "
-                              << "can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
+  std::vector<ConstantSubgraph> subgraphs;
+  std::unordered_map<size_t, size_t> root_subgraphs;
+  for (size_t position = 0; position < constant_nodes.size(); ++position) {
+    auto root_subgraph = root_subgraphs.emplace(find_root(position), subgraphs.size());
+    if (root_subgraph.second) {
+      subgraphs.emplace_back();
+    }
 
-        // Move on to the next candidate node
-        continue;
+    auto& subgraph = subgraphs[root_subgraph.first->second];
+    Node* node = graph.GetNode(constant_nodes[position]);
+    subgraph.nodes.push_back(node);
+    for (const auto* input_def : node->InputDefs()) {
+      const auto* initializer = graph_utils::GetConstantInitializer(graph, input_def->Name(), true);
+      if (initializer != nullptr) {
+        subgraph.constant_inputs.insert({input_def->Name(), initializer});
       }
+    }
+  }
 
-      OptimizerExecutionFrame frame(info, fetch_mlvalue_idxs);
-
-      OpKernelContext op_kernel_context(&frame, kernel.get(), nullptr, logger);
-      ORT_RETURN_IF_ERROR(kernel->Compute(&op_kernel_context));
+  // evaluate the independent subgraphs in parallel. the graph is only read until all of them are evaluated.
+  std::vector<FoldedSubgraph> folded_subgraphs(subgraphs.size());
+  std::vector<Status> statuses(subgraphs.size());
+  auto fold_subgraph = [&](std::ptrdiff_t i) {
+    ORT_TRY {
+      statuses[i] = FoldSubgraph(graph, subgraphs[i], logger, folded_subgraphs[i]);
+    }
+    ORT_CATCH(const std::exception& ex) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        statuses[i] = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exception during constant folding: ", ex.what());
+      });
+    }
+  };
 
-      std::vector<OrtValue> fetches;
-      ORT_RETURN_IF_ERROR(frame.GetOutputs(fetches));
+  const auto num_subgraphs = static_cast<std::ptrdiff_t>(subgraphs.size());
+  if (thread_pool_ != nullptr && num_subgraphs > 1) {
+    concurrency::ThreadPool::TrySimpleParallelFor(thread_pool_, num_subgraphs, fold_subgraph);
+  } else {
+    for (std::ptrdiff_t i = 0; i < num_subgraphs; ++i) {
+      fold_subgraph(i);
+    }
+  }
 
-      // Go over all output node args and substitute them with the newly computed tensors, which will be
-      // added to the graph as initializers.
-      ORT_ENFORCE(fetches.size() == node->OutputDefs().size());
-      converted_to_constant = true;
-      for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
-        OrtValue& ort_value = fetches[fetch_idx];
+  for (const auto& status : statuses) {
+    ORT_RETURN_IF_ERROR(status);
+  }
 
-        if (!ort_value.IsTensor()) {
-          LOGS(logger, WARNING) << "Unsupported output type of " << ort_value.Type()
-                                << ". Can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
-          converted_to_constant = false;
-          break;
-        }
+  for (const auto& folded : folded_subgraphs) {
+    // Go over the computed tensors and substitute the node args with them, as initializers of the graph.
+    for (const auto& initializer : folded.initializers) {
+      ONNX_NAMESPACE::TensorShapeProto result_shape;
+      for (auto dim : initializer.dims()) {
+        result_shape.add_dim()->set_dim_value(dim);
       }
 
-      if (converted_to_constant) {
-        for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
-          OrtValue& ort_value = fetches[fetch_idx];
-          // Build the TensorProto that corresponds to the computed OrtValue and add it as initializer to the graph.
-          auto* constant_arg_out = node->MutableOutputDefs()[fetch_idx];
-          const Tensor& out_tensor = ort_value.Get<Tensor>();
-          ONNX_NAMESPACE::TensorProto out_tensorproto = utils::TensorToTensorProto(out_tensor, constant_arg_out->Name());
-
-          ONNX_NAMESPACE::TensorShapeProto result_shape;
-          for (auto& dim : out_tensor.Shape().GetDims()) {
-            result_shape.add_dim()->set_dim_value(dim);
-          }
+      graph.GetNodeArg(initializer.name())->SetShape(result_shape);
+      graph.AddInitializedTensor(initializer);
+    }
 
-          constant_arg_out->SetShape(result_shape);
-          graph.AddInitializedTensor(out_tensorproto);
-        }
-      }
+    std::unordered_map<NodeIndex, size_t> nodes_to_remove;
+    for (size_t i = 0; i < folded.nodes_to_remove.size(); ++i) {
+      nodes_to_remove[folded.nodes_to_remove[i]] = i;
     }
 
-    if (converted_to_constant) {
-      // Remove single-output node chain for inputs of the node
-      auto p_ip_node = node->InputNodesBegin();
-      const auto p_ip_node_end = node->InputNodesEnd();
-      while (p_ip_node != p_ip_node_end) {
-        const auto& input_node = *p_ip_node;
-        // Update the node iterator before removing the corresponding node because removing
-        // the node will invalidate the node iterator
-        ++p_ip_node;
-        graph_utils::RemoveNodesWithOneOutputBottomUp(graph, input_node);
+    for (NodeIndex index : folded.nodes_to_remove) {
+      // the node may have been removed with the single-output chain of a node removed before
+      Node* node = graph.GetNode(index);
+      if (node != nullptr) {
+        RemoveFoldedNode(graph, *node, nodes_to_remove);
+        modified = true;
       }
-
-      // Remove the output edges of the constant node and then remove the node itself.
-      graph_utils::RemoveNodeOutputEdges(graph, *node);
-      graph.RemoveNode(node->Index());
-      modified = true;
-      have_updated_nodes = true;
     }
   }
 
@@ -5,34 +5,65 @@
 
 #include "core/optimizer/graph_transformer.h"
 #include "core/framework/ml_value.h"
+#include <atomic>
 #include <memory>
 #include "core/framework/execution_provider.h"
 
 namespace onnxruntime {
+namespace concurrency {
+class ThreadPool;
+}
 
 /**
 @class ConstantFolding
 
 Transformer that traverses the graph top-down and performs constant folding, i.e.,
 it statically computes parts of the graph that rely only on constant initializers.
+
+The constant nodes are grouped into connected subgraphs, each of which is evaluated in a single execution frame.
+Only the values consumed outside of a subgraph are added to the graph as initializers. Independent subgraphs are
+evaluated in parallel if a thread pool is provided.
 */
 class ConstantFolding : public GraphTransformer {
  public:
   /*! Constant folding will not be applied to nodes that have one of initializers from excluded_initializers as input.
       For pre-training, the trainable weights are those initializers to be excluded.
       \param execution_provider Execution provider instance to execute constant folding.
+      \param max_folded_tensor_size Maximum size in bytes of a tensor produced by constant folding. 0 means no limit.
+      \param thread_pool Thread pool used to evaluate independent constant subgraphs in parallel. May be null.
+      \param cache_size Budget in bytes of the process wide cache of folded tensors, which lets sessions loading the
+                        same model skip the evaluation. 0 disables the cache.
   */
   ConstantFolding(const IExecutionProvider& execution_provider,
                   bool skip_dequantize_linear,
                   const std::unordered_set<std::string>& compatible_execution_providers = {},
-                  const std::unordered_set<std::string>& excluded_initializers = {}) noexcept;
+                  const std::unordered_set<std::string>& excluded_initializers = {},
+                  size_t max_folded_tensor_size = 0,
+                  concurrency::ThreadPool* thread_pool = nullptr,
+                  size_t cache_size = 0) noexcept;
+
+  /*! Number of constant subgraphs whose values were taken from the cache of folded tensors. */
+  size_t CacheHitCount() const { return cache_hit_count_; }
 
  private:
+  struct ConstantSubgraph;
+  struct FoldedSubgraph;
+
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
 
+  bool CanFold(const Graph& graph, const Node& node,
+               const std::unordered_map<NodeIndex, size_t>& constant_node_positions) const;
+
+  Status FoldSubgraph(const Graph& graph, const ConstantSubgraph& subgraph, const logging::Logger& logger,
+                      FoldedSubgraph& folded) const;
+
   bool skip_dequantize_linear_;
   const std::unordered_set<std::string> excluded_initializers_;
   const IExecutionProvider& execution_provider_;
+  const size_t max_folded_tensor_size_;
+  concurrency::ThreadPool* const thread_pool_;
+  const size_t cache_size_;
+  mutable std::atomic<size_t> cache_hit_count_{0};
 };
 
 }  // namespace onnxruntime
@@ -31,6 +31,7 @@ bool IsFusableActivation(const Node& node) {
          IsSupportedOptypeVersionAndDomain(node, "Softsign", {1}, kOnnxDomain) ||
          IsSupportedOptypeVersionAndDomain(node, "Tanh", {6, 13}, kOnnxDomain) ||
 #ifndef DISABLE_CONTRIB_OPS
+         IsSupportedOptypeVersionAndDomain(node, "Gelu", {1}, kMSDomain) ||
          IsSupportedOptypeVersionAndDomain(node, "ScaledTanh", {1}, kOnnxDomain) ||
          IsSupportedOptypeVersionAndDomain(node, "ParametricSoftplus", {1}, kOnnxDomain) ||
 #endif
@@ -2,6 +2,9 @@
 // Licensed under the MIT License.
 
 #include "core/optimizer/graph_transformer_mgr.h"
+
+#include <chrono>
+
 #include "core/optimizer/rule_based_graph_transformer.h"
 
 using namespace onnxruntime;
@@ -19,20 +22,42 @@ common::Status GraphTransformerManager::GetSteps(unsigned& steps) const {
   return Status::OK();
 }
 
-common::Status GraphTransformerManager::ApplyTransformers(Graph& graph, TransformerLevel level, const logging::Logger& logger) const {
+common::Status GraphTransformerManager::ApplyTransformers(Graph& graph, TransformerLevel level,
+                                                          const logging::Logger& logger,
+                                                          profiling::Profiler* profiler) const {
   const auto& transformers = level_to_transformer_map_.find(level);
   if (transformers == level_to_transformer_map_.end()) {
     return Status::OK();
   }
 
+  // time spent in each transformer, including the Resolve of the graph it modified, over all the steps
+  struct TransformerStats {
+    std::chrono::nanoseconds duration{0};
+    int num_applied = 0;
+    int num_modified = 0;
+  };
+  std::vector<TransformerStats> stats(transformers->second.size());
+
   for (unsigned step = 0; step < steps_; ++step) {
     bool graph_changed = false;
-    for (const auto& transformer : transformers->second) {
+    for (size_t i = 0, end = transformers->second.size(); i < end; ++i) {
+      const auto& transformer = transformers->second[i];
       if (step > 0 && transformer->ShouldOnlyApplyOnce())
         continue;
 
       bool modified = false;
+      const auto start = std::chrono::high_resolution_clock::now();
       ORT_RETURN_IF_ERROR(transformer->Apply(graph, modified, logger));
+      stats[i].duration += std::chrono::high_resolution_clock::now() - start;
+      if (profiler != nullptr) {
+        profiler->RecordInitializationPhase(transformer->Name(), start,
+                                            {{"graph", graph.Name()},
+                                             {"level", std::to_string(static_cast<int>(level))},
+                                             {"step", std::to_string(step)},
+                                             {"modified", modified ? "1" : "0"}});
+      }
+      ++stats[i].num_applied;
+      stats[i].num_modified += modified ? 1 : 0;
       graph_changed = graph_changed || modified;
     }
     if (!graph_changed) {
@@ -40,6 +65,15 @@ common::Status GraphTransformerManager::ApplyTransformers(Graph& graph, Transfor
     }
   }
 
+  if (logger.OutputIsEnabled(logging::Severity::kINFO, logging::DataType::SYSTEM)) {
+    for (size_t i = 0, end = transformers->second.size(); i < end; ++i) {
+      LOGS(logger, INFO) << "GraphTransformer " << transformers->second[i]->Name() << " applied "
+                         << stats[i].num_applied << " times, modified the graph " << stats[i].num_modified
+                         << " times, took "
+                         << std::chrono::duration_cast<std::chrono::microseconds>(stats[i].duration).count() << " us";
+    }
+  }
+
   return Status::OK();
 }
 
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "core/common/logging/logging.h"
+#include "core/common/profiler.h"
 #include "core/optimizer/graph_transformer.h"
 #include "core/optimizer/constant_folding.h"
 #include "core/optimizer/rewrite_rule.h"
@@ -26,8 +27,10 @@ class GraphTransformerManager {
   // Register a transformer with a level.
   common::Status Register(std::unique_ptr<GraphTransformer> transformer, TransformerLevel level);
 
-  // Apply all transformers registered for the given level on the given graph
-  common::Status ApplyTransformers(Graph& graph, TransformerLevel level, const logging::Logger& logger) const;
+  // Apply all transformers registered for the given level on the given graph.
+  // If a profiler is given, each application of a transformer is recorded as an initialization phase.
+  common::Status ApplyTransformers(Graph& graph, TransformerLevel level, const logging::Logger& logger,
+                                   profiling::Profiler* profiler = nullptr) const;
 
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(GraphTransformerManager);
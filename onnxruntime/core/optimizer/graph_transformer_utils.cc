@@ -3,6 +3,7 @@
 
 #include "core/optimizer/graph_transformer_utils.h"
 
+#include "core/common/parse_string.h"
 #include "core/mlas/inc/mlas.h"
 #include "core/optimizer/attention_fusion.h"
 #include "core/optimizer/bias_gelu_fusion.h"
@@ -39,6 +40,7 @@
 #include "core/optimizer/shape_to_initializer.h"
 #include "core/optimizer/skip_layer_norm_fusion.h"
 #include "core/optimizer/slice_elimination.h"
+#include "core/optimizer/sparse_matmul_transformer.h"
 #include "core/optimizer/unsqueeze_elimination.h"
 #include "core/optimizer/qdq_transformer/qdq_propagation.h"
 #include "core/optimizer/qdq_transformer/qdq_s8_to_u8.h"
@@ -130,19 +132,37 @@ std::vector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
     TransformerLevel level,
     const SessionOptions& session_options,
     const IExecutionProvider& execution_provider, /*required by constant folding*/
-    const std::unordered_set<std::string>& rules_and_transformers_to_disable) {
+    const std::unordered_set<std::string>& rules_and_transformers_to_disable,
+    concurrency::ThreadPool* thread_pool) {
   std::vector<std::unique_ptr<GraphTransformer>> transformers;
   std::unique_ptr<RuleBasedGraphTransformer> rule_transformer = nullptr;
   bool disable_quant_qdq = session_options.GetConfigOrDefault(kOrtSessionOptionsDisableQuantQDQ, "0") == "1";
+  size_t constant_folding_max_tensor_size = 0;
+  ORT_ENFORCE(TryParseStringWithClassicLocale(
+                  session_options.GetConfigOrDefault(kOrtSessionOptionsConfigConstantFoldingMaxTensorSize, "0"),
+                  constant_folding_max_tensor_size),
+              "Invalid value for ", kOrtSessionOptionsConfigConstantFoldingMaxTensorSize);
+  size_t constant_folding_cache_size = 0;
+  ORT_ENFORCE(TryParseStringWithClassicLocale(
+                  session_options.GetConfigOrDefault(kOrtSessionOptionsConfigConstantFoldingCacheSize, "0"),
+                  constant_folding_cache_size),
+              "Invalid value for ", kOrtSessionOptionsConfigConstantFoldingCacheSize);
 #ifndef DISABLE_CONTRIB_OPS
   bool enable_gelu_approximation = session_options.GetConfigOrDefault(kOrtSessionOptionsEnableGeluApproximation, "0") == "1";
+  float sparse_matmul_threshold = 0.0f;
+  ORT_ENFORCE(TryParseStringWithClassicLocale(
+                  session_options.GetConfigOrDefault(kOrtSessionOptionsConfigSparseMatMulThreshold, "0"),
+                  sparse_matmul_threshold),
+              "Invalid value for ", kOrtSessionOptionsConfigSparseMatMulThreshold);
 #endif
 
   switch (level) {
     case TransformerLevel::Level1: {
       // no filtering on execution provider for L1 optimizations as they only use official ONNX operators
       transformers.emplace_back(std::make_unique<CommonSubexpressionElimination>());
-      transformers.emplace_back(std::make_unique<ConstantFolding>(execution_provider, !disable_quant_qdq));
+      transformers.emplace_back(std::make_unique<ConstantFolding>(
+          execution_provider, !disable_quant_qdq, std::unordered_set<std::string>{}, std::unordered_set<std::string>{},
+          constant_folding_max_tensor_size, thread_pool, constant_folding_cache_size));
       transformers.emplace_back(std::make_unique<MatMulAddFusion>());
       transformers.emplace_back(std::make_unique<ReshapeFusion>());
       transformers.emplace_back(std::make_unique<FreeDimensionOverrideTransformer>(
@@ -197,6 +217,11 @@ std::vector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
 
       transformers.emplace_back(std::make_unique<MatMulScaleFusion>(cpu_cuda_rocm_eps));
 
+      // Runs after the fusions above so that the MatMul/Gemm nodes they produce are also considered.
+      if (sparse_matmul_threshold > 0.0f) {
+        transformers.emplace_back(std::make_unique<SparseMatMulTransformer>(sparse_matmul_threshold, cpu_ep));
+      }
+
       // GeluApproximation has side effects which may change results. It needs to be manually enabled,
       // or alternatively the model can be updated offline using a model conversion script
       //   e.g. fusion_gelu_approximation function used by onnxruntime/python/tools/transformers/onnx_model_bert.py
@@ -114,7 +114,10 @@ class NchwcTransformerImpl {
                               const ONNX_NAMESPACE::TensorProto* filter_shape);
   Node& InsertReshape(NodeArg* input_arg, NodeArg* output_arg, int64_t channels, bool split_channels);
 
+  bool IsWinogradConv(const Node& node, const ONNX_NAMESPACE::TensorProto& conv_W_tensor_proto, int64_t group_count);
+
   void TransformConv(Node& node);
+  void TransformQLinearConv(Node& node);
   void TransformPool(Node& node);
   void TransformBinary(Node& node, bool add_node);
   void TransformConcat(Node& node);
@@ -141,11 +144,17 @@ class NchwcTransformerImpl {
   // multiple nodes can share the NCHWc filter.
   std::unordered_map<NodeArg*, NodeArg*> filters_OIHWBo_;
   std::unordered_map<NodeArg*, NodeArg*> filters_OIHWBiBo_;
+  std::unordered_map<NodeArg*, NodeArg*> filters_HWIO_;
 
   // Stores a mapping of NodeArg biases that have already been aligned to the
   // NCHWc block size, so multiple nodes can share the NCHWc biases.
   std::unordered_map<NodeArg*, NodeArg*> aligned_biases_;
 
+  // Stores a mapping of NodeArg per-channel filter scales that have already
+  // been aligned to the NCHWc block size, so multiple nodes can share the
+  // NCHWc filter scales.
+  std::unordered_map<NodeArg*, NodeArg*> aligned_scales_;
+
   // Stores a mapping of shape initializers for use by Reshape when splitting
   // or unsplitting the channels dimension of a tensor.
   std::unordered_map<int64_t, NodeArg*> reshape_split_;
@@ -315,6 +324,51 @@ void NchwcTransformerImpl::ConvPoolShapeInference(const Node& node,
   }
 }
 
+// Returns true if the CPU convolution kernel runs the node with the Winograd
+// algorithm, which the NCHWc convolution does not implement. The kernel only
+// transforms the filter once if the spatial shape is static, so convolutions
+// with dynamic shapes are still converted.
+bool NchwcTransformerImpl::IsWinogradConv(const Node& node,
+                                          const ONNX_NAMESPACE::TensorProto& conv_W_tensor_proto,
+                                          int64_t group_count) {
+  const auto* output_shape = node.OutputDefs()[0]->Shape();
+  if (group_count <= 0 || output_shape == nullptr || output_shape->dim_size() != 4 ||
+      !utils::HasDimValue(output_shape->dim(2)) || !utils::HasDimValue(output_shape->dim(3))) {
+    return false;
+  }
+
+  int64_t strides[kNchwcSpatialDims] = {1, 1};
+  int64_t dilations[kNchwcSpatialDims] = {1, 1};
+
+  const auto* strides_attr = graph_utils::GetNodeAttribute(node, "strides");
+  if (strides_attr != nullptr) {
+    if (strides_attr->ints_size() != kNchwcSpatialDims) {
+      return false;
+    }
+    std::copy(strides_attr->ints().begin(), strides_attr->ints().end(), strides);
+  }
+
+  const auto* dilations_attr = graph_utils::GetNodeAttribute(node, "dilations");
+  if (dilations_attr != nullptr) {
+    if (dilations_attr->ints_size() != kNchwcSpatialDims) {
+      return false;
+    }
+    std::copy(dilations_attr->ints().begin(), dilations_attr->ints().end(), dilations);
+  }
+
+  const int64_t kernel_shape[kNchwcSpatialDims] = {conv_W_tensor_proto.dims(2), conv_W_tensor_proto.dims(3)};
+  const int64_t spatial_output_shape[kNchwcSpatialDims] = {output_shape->dim(2).dim_value(),
+                                                           output_shape->dim(3).dim_value()};
+
+  return MlasConvWinogradIsSelected(kNchwcSpatialDims,
+                                    kernel_shape,
+                                    dilations,
+                                    strides,
+                                    spatial_output_shape,
+                                    static_cast<size_t>(conv_W_tensor_proto.dims(1)),
+                                    static_cast<size_t>(conv_W_tensor_proto.dims(0) / group_count));
+}
+
 void NchwcTransformerImpl::TransformConv(Node& node) {
   auto& input_defs = node.MutableInputDefs();
   auto& output_defs = node.MutableOutputDefs();
@@ -339,6 +393,10 @@ void NchwcTransformerImpl::TransformConv(Node& node) {
     group_count = 1;
   }
 
+  if (IsWinogradConv(node, *conv_W_tensor_proto, group_count)) {
+    return;
+  }
+
   const size_t nchwc_block_size = MlasNchwcGetBlockSize();
   const int64_t nchwc_output_channels = (output_channels + nchwc_block_size - 1) & ~(nchwc_block_size - 1);
 
@@ -499,6 +557,254 @@ void NchwcTransformerImpl::TransformConv(Node& node) {
   removed_nodes_.push_front(node.Index());
 }
 
+void NchwcTransformerImpl::TransformQLinearConv(Node& node) {
+  auto& input_defs = node.MutableInputDefs();
+  auto& output_defs = node.MutableOutputDefs();
+
+  // The NCHWc quantized convolution supports uint8 activations.
+  const auto* input_type = input_defs[0]->TypeAsProto();
+  if ((input_type == nullptr) || (input_type->tensor_type().elem_type() != TensorProto_DataType_UINT8)) {
+    return;
+  }
+
+  // Require that the weights tensor be static.
+  const ONNX_NAMESPACE::TensorProto* conv_W_tensor_proto = nullptr;
+  if (!graph_utils::NodeArgIsConstant(graph_, *input_defs[3]) ||
+      !graph_.GetInitializedTensor(input_defs[3]->Name(), conv_W_tensor_proto) ||
+      ((conv_W_tensor_proto->data_type() != ONNX_NAMESPACE::TensorProto_DataType_UINT8) &&
+       (conv_W_tensor_proto->data_type() != ONNX_NAMESPACE::TensorProto_DataType_INT8)) ||
+      (conv_W_tensor_proto->dims_size() != 4)) {
+    return;
+  }
+
+  const int64_t output_channels = conv_W_tensor_proto->dims(0);
+  const int64_t input_channels = conv_W_tensor_proto->dims(1);
+
+  // Require that the weights zero point be static and identical for all
+  // output channels. The NCHWc kernel applies a single filter zero point.
+  const ONNX_NAMESPACE::TensorProto* conv_W_zero_point_tensor_proto = nullptr;
+  if (!graph_utils::NodeArgIsConstant(graph_, *input_defs[5]) ||
+      !graph_.GetInitializedTensor(input_defs[5]->Name(), conv_W_zero_point_tensor_proto)) {
+    return;
+  }
+  uint8_t filter_zero_point;
+  {
+    Initializer conv_W_zero_point{*conv_W_zero_point_tensor_proto, graph_.ModelPath()};
+    const auto* zero_point_data = conv_W_zero_point.data<uint8_t>();
+    const size_t zero_point_count = gsl::narrow<size_t>(conv_W_zero_point.size());
+    if (zero_point_count == 0) {
+      return;
+    }
+    filter_zero_point = zero_point_data[0];
+    for (size_t i = 1; i < zero_point_count; i++) {
+      if (zero_point_data[i] != filter_zero_point) {
+        return;
+      }
+    }
+  }
+
+  // Require that the weights scale be static and either per-tensor or
+  // per-output channel.
+  const ONNX_NAMESPACE::TensorProto* conv_W_scale_tensor_proto = nullptr;
+  if (!graph_utils::NodeArgIsConstant(graph_, *input_defs[4]) ||
+      !graph_.GetInitializedTensor(input_defs[4]->Name(), conv_W_scale_tensor_proto) ||
+      (conv_W_scale_tensor_proto->data_type() != ONNX_NAMESPACE::TensorProto_DataType_FLOAT)) {
+    return;
+  }
+  int64_t filter_scale_count = 1;
+  for (int i = 0; i < conv_W_scale_tensor_proto->dims_size(); i++) {
+    filter_scale_count *= conv_W_scale_tensor_proto->dims(i);
+  }
+  if (filter_scale_count != 1 && filter_scale_count != output_channels) {
+    return;
+  }
+
+  int64_t group_count;
+  const auto* group_attr = graph_utils::GetNodeAttribute(node, "group");
+  if (group_attr != nullptr && utils::HasInt(*group_attr)) {
+    group_count = group_attr->i();
+  } else {
+    group_count = 1;
+  }
+
+  const size_t nchwc_block_size = MlasNchwcGetBlockSize();
+  const int64_t nchwc_output_channels = (output_channels + nchwc_block_size - 1) & ~(nchwc_block_size - 1);
+
+  // The quantized ReorderInput has no channel alignment requirement, so the
+  // input is always reordered to NCHWc format.
+  bool reorder_filter_OIHWBo = false;
+  int64_t filter_input_channels = input_channels;
+  int64_t nchwc_group_count = group_count;
+
+  if (group_count > 1) {
+    if (input_channels == 1 && output_channels == group_count) {
+      // Depthwise convolution.
+      reorder_filter_OIHWBo = true;
+      nchwc_group_count = nchwc_output_channels;
+    } else if (((input_channels % nchwc_block_size) != 0) ||
+               ((output_channels % group_count) != 0) ||
+               (((output_channels / group_count) % nchwc_block_size) != 0)) {
+      return;
+    }
+  } else {
+    // Padded input channels are cancelled by filling the filter with its zero
+    // point.
+    filter_input_channels = (input_channels + nchwc_block_size - 1) & ~(nchwc_block_size - 1);
+  }
+
+  // Also require that the optional bias tensor be static.
+  const ONNX_NAMESPACE::TensorProto* conv_B_tensor_proto = nullptr;
+  if (input_defs.size() >= 9 && input_defs[8]->Exists()) {
+    if (!graph_utils::NodeArgIsConstant(graph_, *input_defs[8]) ||
+        !graph_.GetInitializedTensor(input_defs[8]->Name(), conv_B_tensor_proto) ||
+        (conv_B_tensor_proto->data_type() != ONNX_NAMESPACE::TensorProto_DataType_INT32) ||
+        (conv_B_tensor_proto->dims_size() != 1) ||
+        (conv_B_tensor_proto->dims(0) != output_channels)) {
+      return;
+    }
+  }
+
+  // Check if the filter has already been converted to the target format.
+  std::unordered_map<NodeArg*, NodeArg*>* filters_map;
+  if (reorder_filter_OIHWBo) {
+    filters_map = &filters_OIHWBo_;
+  } else {
+    filters_map = &filters_HWIO_;
+  }
+
+  NodeArg* nchwc_conv_W_arg;
+  auto filters_it = filters_map->find(input_defs[3]);
+  if (filters_it != filters_map->end()) {
+    // Reuse the existing NodeArg.
+    nchwc_conv_W_arg = filters_it->second;
+  } else {
+    Initializer conv_W{*conv_W_tensor_proto, graph_.ModelPath()};
+    const auto& conv_W_dims = conv_W.dims();
+
+    int64_t reordered_filter_size = nchwc_output_channels * filter_input_channels;
+    for (size_t i = 2; i < 4; i++) {
+      reordered_filter_size *= conv_W_dims[i];
+    }
+    std::vector<uint8_t> reordered_filter(gsl::narrow<size_t>(reordered_filter_size));
+
+    // Reorder the weights tensor statically.
+    if (reorder_filter_OIHWBo) {
+      MlasReorderFilterOIHWBo(conv_W_dims.data(), conv_W.data<uint8_t>(), reordered_filter.data(), filter_zero_point);
+    } else {
+      MlasReorderFilterHWIO(conv_W_dims.data(), static_cast<size_t>(group_count), conv_W.data<uint8_t>(),
+                            reordered_filter.data(), filter_zero_point);
+    }
+
+    ONNX_NAMESPACE::TensorProto nchwc_conv_W_tensor_proto;
+
+    nchwc_conv_W_tensor_proto.set_data_type(conv_W_tensor_proto->data_type());
+    nchwc_conv_W_tensor_proto.set_name(graph_.GenerateNodeArgName("reorder"));
+    nchwc_conv_W_tensor_proto.set_raw_data(reordered_filter.data(), reordered_filter.size());
+
+    nchwc_conv_W_tensor_proto.add_dims(nchwc_output_channels);
+    nchwc_conv_W_tensor_proto.add_dims(filter_input_channels);
+    for (size_t i = 2; i < 4; i++) {
+      nchwc_conv_W_tensor_proto.add_dims(conv_W_dims[i]);
+    }
+
+    nchwc_conv_W_arg = &graph_utils::AddInitializer(graph_, nchwc_conv_W_tensor_proto);
+    filters_map->emplace(input_defs[3], nchwc_conv_W_arg);
+  }
+
+  // Align the per-channel filter scale tensor up to the number of NCHWc output
+  // channels. The padded output channels are discarded by ReorderOutput, so any
+  // finite scale works.
+  NodeArg* nchwc_conv_W_scale_arg = nullptr;
+  if ((filter_scale_count > 1) && (output_channels != nchwc_output_channels)) {
+    auto scales_it = aligned_scales_.find(input_defs[4]);
+    if (scales_it != aligned_scales_.end()) {
+      // Reuse the existing NodeArg.
+      nchwc_conv_W_scale_arg = scales_it->second;
+    } else {
+      Initializer conv_W_scale{*conv_W_scale_tensor_proto, graph_.ModelPath()};
+
+      std::vector<float> aligned_scale(gsl::narrow<size_t>(nchwc_output_channels), 1.0f);
+      std::copy_n(conv_W_scale.data<float>(), output_channels, aligned_scale.data());
+
+      ONNX_NAMESPACE::TensorProto nchwc_conv_W_scale_tensor_proto;
+
+      nchwc_conv_W_scale_tensor_proto.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+      nchwc_conv_W_scale_tensor_proto.set_name(graph_.GenerateNodeArgName("reorder"));
+      nchwc_conv_W_scale_tensor_proto.set_raw_data(aligned_scale.data(), aligned_scale.size() * sizeof(float));
+
+      nchwc_conv_W_scale_tensor_proto.add_dims(nchwc_output_channels);
+
+      nchwc_conv_W_scale_arg = &graph_utils::AddInitializer(graph_, nchwc_conv_W_scale_tensor_proto);
+      aligned_scales_.emplace(input_defs[4], nchwc_conv_W_scale_arg);
+    }
+  }
+
+  // Align the optional bias tensor up to the number of NCHWc output channels.
+  NodeArg* nchwc_conv_B_arg = nullptr;
+  if ((conv_B_tensor_proto != nullptr) && (output_channels != nchwc_output_channels)) {
+    auto biases_it = aligned_biases_.find(input_defs[8]);
+    if (biases_it != aligned_biases_.end()) {
+      // Reuse the existing NodeArg.
+      nchwc_conv_B_arg = biases_it->second;
+    } else {
+      Initializer conv_B{*conv_B_tensor_proto, graph_.ModelPath()};
+
+      std::vector<int32_t> aligned_bias(gsl::narrow<size_t>(nchwc_output_channels));
+      std::copy_n(conv_B.data<int32_t>(), output_channels, aligned_bias.data());
+
+      ONNX_NAMESPACE::TensorProto nchwc_conv_B_tensor_proto;
+
+      nchwc_conv_B_tensor_proto.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_INT32);
+      nchwc_conv_B_tensor_proto.set_name(graph_.GenerateNodeArgName("reorder"));
+      nchwc_conv_B_tensor_proto.set_raw_data(aligned_bias.data(), aligned_bias.size() * sizeof(int32_t));
+
+      nchwc_conv_B_tensor_proto.add_dims(nchwc_output_channels);
+
+      nchwc_conv_B_arg = &graph_utils::AddInitializer(graph_, nchwc_conv_B_tensor_proto);
+      aligned_biases_.emplace(input_defs[8], nchwc_conv_B_arg);
+    }
+  }
+
+  // Create the replacement node.
+  std::string nchwc_node_name = graph_.GenerateNodeName(output_defs[0]->Name() + "_nchwc");
+  Node& nchwc_node = graph_.AddNode(nchwc_node_name,
+                                    "QLinearConv",
+                                    nchwc_node_name,
+                                    input_defs,
+                                    output_defs,
+                                    &node.GetAttributes(),
+                                    kMSNchwcDomain);
+  nchwc_node.SetExecutionProviderType(kCpuExecutionProvider);
+  if (nchwc_group_count != group_count) {
+    nchwc_node.AddAttribute("group", nchwc_group_count);
+  }
+
+  nchwc_node.MutableInputDefs()[3] = nchwc_conv_W_arg;
+
+  if (nchwc_conv_W_scale_arg != nullptr) {
+    nchwc_node.MutableInputDefs()[4] = nchwc_conv_W_scale_arg;
+  }
+
+  if (nchwc_conv_B_arg != nullptr) {
+    nchwc_node.MutableInputDefs()[8] = nchwc_conv_B_arg;
+  }
+
+  NchwcArgument::Shape output_shape(output_defs[0]);
+
+  auto it = nchwc_args_.find(input_defs[0]);
+  if (it == nchwc_args_.end()) {
+    InsertReorderInput(nchwc_node);
+  } else {
+    auto* nchwc_input = it->second.get();
+    nchwc_node.MutableInputDefs()[0] = nchwc_input->nchwc_arg_;
+    nchwc_input->remaining_original_uses_--;
+    ConvPoolShapeInference(node, nchwc_input->shape_, output_shape, conv_W_tensor_proto);
+  }
+
+  CreateNchwcArgument(node, nchwc_node, output_channels, output_shape);
+  removed_nodes_.push_front(node.Index());
+}
+
 void NchwcTransformerImpl::TransformPool(Node& node) {
   auto& input_defs = node.MutableInputDefs();
   auto& output_defs = node.MutableOutputDefs();
@@ -510,8 +816,14 @@ void NchwcTransformerImpl::TransformPool(Node& node) {
 
   const size_t nchwc_block_size = MlasNchwcGetBlockSize();
 
+  // MaxPool also supports quantized uint8 tensors.
   const auto* input_type = input_defs[0]->TypeAsProto();
-  if ((input_type == nullptr) || (input_type->tensor_type().elem_type() != TensorProto_DataType_FLOAT)) {
+  if (input_type == nullptr) {
+    return;
+  }
+  const auto elem_type = input_type->tensor_type().elem_type();
+  if ((elem_type != TensorProto_DataType_FLOAT) &&
+      ((elem_type != TensorProto_DataType_UINT8) || (node.OpType() != "MaxPool"))) {
     return;
   }
   const auto* input_shape = input_defs[0]->Shape();
@@ -982,6 +1294,12 @@ void NchwcTransformerImpl::TransformResize(Node& node) {
   }
   auto* nchwc_input = it->second.get();
 
+  // The NCHWc Upsample kernel only supports float tensors.
+  const auto* input_type = input_defs[0]->TypeAsProto();
+  if ((input_type == nullptr) || (input_type->tensor_type().elem_type() != TensorProto_DataType_FLOAT)) {
+    return;
+  }
+
   // Only support the nearest interpolation mode (the default value).
   const auto* mode_attr = graph_utils::GetNodeAttribute(node, "mode");
   if (mode_attr != nullptr && utils::HasString(*mode_attr)) {
@@ -1138,6 +1456,8 @@ void NchwcTransformerImpl::Transform(Node& node) {
   if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Conv", {1, 11}) ||
       graph_utils::IsSupportedOptypeVersionAndDomain(node, "FusedConv", {1}, kMSDomain)) {
     TransformConv(node);
+  } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearConv", {10})) {
+    TransformQLinearConv(node);
   } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "MaxPool", {1, 8, 10, 11, 12}) ||
              graph_utils::IsSupportedOptypeVersionAndDomain(node, "AveragePool", {1, 7, 10, 11})) {
     TransformPool(node);
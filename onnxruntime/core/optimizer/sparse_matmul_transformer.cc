@@ -0,0 +1,138 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/sparse_matmul_transformer.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/initializer.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+int64_t GetIntAttribute(const Node& node, const std::string& attr_name, int64_t default_value) {
+  const auto* attr = graph_utils::GetNodeAttribute(node, attr_name);
+  return (attr != nullptr && attr->has_i()) ? attr->i() : default_value;
+}
+
+float GetFloatAttribute(const Node& node, const std::string& attr_name, float default_value) {
+  const auto* attr = graph_utils::GetNodeAttribute(node, attr_name);
+  return (attr != nullptr && attr->has_f()) ? attr->f() : default_value;
+}
+
+// Gemm accepts any C that is unidirectionally broadcastable to (M, N). SparseMatMul only accepts a scalar or a
+// row vector, so the shape must be known to be one of those.
+bool IsRowBroadcastBias(const NodeArg& bias) {
+  const auto* shape = bias.Shape();
+  if (shape == nullptr) {
+    return false;
+  }
+  const int rank = shape->dim_size();
+  if (rank <= 1) {
+    return true;
+  }
+  return rank == 2 && utils::HasDimValue(shape->dim(0)) && shape->dim(0).dim_value() == 1;
+}
+
+// Returns the fraction of zero elements in a constant 2-D float weight, or a negative value if the weight is
+// not supported.
+float GetWeightSparsity(const Graph& graph, const NodeArg& weight) {
+  const auto* tensor_proto = graph_utils::GetConstantInitializer(graph, weight.Name());
+  if (tensor_proto == nullptr ||
+      tensor_proto->data_type() != TensorProto_DataType_FLOAT ||
+      tensor_proto->dims_size() != 2) {
+    return -1.0f;
+  }
+
+  Initializer initializer{*tensor_proto, graph.ModelPath()};
+  if (initializer.size() == 0) {
+    return -1.0f;
+  }
+
+  const float* data = initializer.data<float>();
+  const int64_t zero_count = std::count(data, data + initializer.size(), 0.0f);
+  return static_cast<float>(zero_count) / static_cast<float>(initializer.size());
+}
+
+}  // namespace
+
+Status SparseMatMulTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                          const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto index : order) {
+    auto* node_ptr = graph.GetNode(index);
+    if (!node_ptr)
+      continue;  // node was removed
+
+    auto& node = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders()) ||
+        !optimizer_utils::IsSupportedDataType(node, {"tensor(float)"})) {
+      continue;
+    }
+
+    const bool is_gemm = graph_utils::IsSupportedOptypeVersionAndDomain(node, "Gemm", {7, 9, 11, 13});
+    if (!is_gemm &&
+        !graph_utils::IsSupportedOptypeVersionAndDomain(node, "MatMul", {1, 9, 13}) &&
+        !graph_utils::IsSupportedOptypeVersionAndDomain(node, "FusedMatMul", {1}, kMSDomain)) {
+      continue;
+    }
+
+    // SparseMatMul has no transA attribute.
+    if (GetIntAttribute(node, "transA", 0) != 0) {
+      continue;
+    }
+
+    auto& input_defs = node.MutableInputDefs();
+    const bool has_bias = is_gemm && input_defs.size() > 2 && input_defs[2]->Exists();
+    if (has_bias && !IsRowBroadcastBias(*input_defs[2])) {
+      continue;
+    }
+
+    const float sparsity = GetWeightSparsity(graph, *input_defs[1]);
+    if (sparsity < sparsity_threshold_) {
+      continue;
+    }
+
+    NodeAttributes sparse_matmul_attrs;
+    sparse_matmul_attrs["alpha"] = ONNX_NAMESPACE::MakeAttribute("alpha", GetFloatAttribute(node, "alpha", 1.0f));
+    sparse_matmul_attrs["transB"] = ONNX_NAMESPACE::MakeAttribute("transB", GetIntAttribute(node, "transB", 0));
+    if (has_bias) {
+      sparse_matmul_attrs["beta"] = ONNX_NAMESPACE::MakeAttribute("beta", GetFloatAttribute(node, "beta", 1.0f));
+    }
+
+    std::vector<NodeArg*> sparse_matmul_inputs{input_defs[0], input_defs[1]};
+    if (has_bias) {
+      sparse_matmul_inputs.push_back(input_defs[2]);
+    }
+
+    Node& sparse_matmul = graph.AddNode(graph.GenerateNodeName(node.Name() + "_SparseMatMul"),
+                                        "SparseMatMul",
+                                        "Sparse " + node.OpType() + " " + node.Name(),
+                                        sparse_matmul_inputs,
+                                        {},
+                                        &sparse_matmul_attrs,
+                                        kMSDomain);
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    sparse_matmul.SetExecutionProviderType(node.GetExecutionProviderType());
+
+    LOGS(logger, VERBOSE) << "Replacing " << node.OpType() << " node '" << node.Name()
+                          << "' with SparseMatMul. Weight sparsity: " << sparsity;
+
+    // move input edges, output definitions and output edges to sparse_matmul and delete the original node.
+    graph_utils::FinalizeNodeFusion(graph, {node}, sparse_matmul);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class SparseMatMulTransformer
+
+Rewrites MatMul, FusedMatMul and Gemm nodes whose B input is a constant 2-D float initializer with at least
+the given fraction of zero elements to the SparseMatMul contrib op. The SparseMatMul CPU kernel packs the
+weight into a block compressed sparse row format at PrePack time, so the dense weight is released and the
+zero elements are skipped during the multiply.
+*/
+class SparseMatMulTransformer : public GraphTransformer {
+ public:
+  SparseMatMulTransformer(float sparsity_threshold,
+                          const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("SparseMatMulTransformer", compatible_execution_providers),
+        sparsity_threshold_(sparsity_threshold) {}
+
+ private:
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const float sparsity_threshold_;
+};
+
+}  // namespace onnxruntime
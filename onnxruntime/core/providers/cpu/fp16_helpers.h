@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/framework/allocator.h"
+#include "core/framework/float16.h"
+#include "core/framework/tensor.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+
+namespace onnxruntime {
+namespace fp16 {
+
+// The MLFloat16 kernels of the CPU provider store tensors in half precision and compute in single precision.
+// These helpers convert between the two formats with MLAS, which uses F16C where the processor supports it.
+
+inline void ConvertToFloat(const MLFloat16* source, float* destination, size_t count,
+                           concurrency::ThreadPool* thread_pool) {
+  concurrency::ThreadPool::TryParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(count),
+      {static_cast<double>(sizeof(MLFloat16)), static_cast<double>(sizeof(float)), 1.0},
+      [source, destination](std::ptrdiff_t first, std::ptrdiff_t last) {
+        MlasConvertHalfToFloatBuffer(&source[first].val, destination + first, static_cast<size_t>(last - first));
+      });
+}
+
+inline void ConvertToHalf(const float* source, MLFloat16* destination, size_t count,
+                          concurrency::ThreadPool* thread_pool) {
+  concurrency::ThreadPool::TryParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(count),
+      {static_cast<double>(sizeof(float)), static_cast<double>(sizeof(MLFloat16)), 1.0},
+      [source, destination](std::ptrdiff_t first, std::ptrdiff_t last) {
+        MlasConvertFloatToHalfBuffer(source + first, &destination[first].val, static_cast<size_t>(last - first));
+      });
+}
+
+// Returns a temporary single precision copy of a half precision tensor.
+inline IAllocatorUniquePtr<float> ToFloatBuffer(const AllocatorPtr& alloc, const Tensor& tensor,
+                                                concurrency::ThreadPool* thread_pool) {
+  const size_t count = static_cast<size_t>(tensor.Shape().Size());
+  auto buffer = IAllocator::MakeUniquePtr<float>(alloc, count);
+  ConvertToFloat(tensor.Data<MLFloat16>(), buffer.get(), count, thread_pool);
+  return buffer;
+}
+
+}  // namespace fp16
+}  // namespace onnxruntime
@@ -162,53 +162,65 @@ REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 7, 12, float, Add);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 7, 12, double, Add);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 7, 12, int32_t, Add);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 7, 12, int64_t, Add);
+REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 7, 12, MLFloat16, Add);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 13, 13, float, Add);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 13, 13, double, Add);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 13, 13, int32_t, Add);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 13, 13, int64_t, Add);
+REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Add, 13, 13, MLFloat16, Add);
 REG_ELEMENTWISE_TYPED_KERNEL(Add, 14, float, Add);
 REG_ELEMENTWISE_TYPED_KERNEL(Add, 14, double, Add);
 REG_ELEMENTWISE_TYPED_KERNEL(Add, 14, int32_t, Add);
 REG_ELEMENTWISE_TYPED_KERNEL(Add, 14, int64_t, Add);
+REG_ELEMENTWISE_TYPED_KERNEL(Add, 14, MLFloat16, Add);
 
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 7, 12, float, Sub);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 7, 12, double, Sub);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 7, 12, int32_t, Sub);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 7, 12, int64_t, Sub);
+REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 7, 12, MLFloat16, Sub);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 13, 13, float, Sub);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 13, 13, double, Sub);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 13, 13, int32_t, Sub);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 13, 13, int64_t, Sub);
+REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Sub, 13, 13, MLFloat16, Sub);
 REG_ELEMENTWISE_TYPED_KERNEL(Sub, 14, float, Sub);
 REG_ELEMENTWISE_TYPED_KERNEL(Sub, 14, double, Sub);
 REG_ELEMENTWISE_TYPED_KERNEL(Sub, 14, int32_t, Sub);
 REG_ELEMENTWISE_TYPED_KERNEL(Sub, 14, int64_t, Sub);
+REG_ELEMENTWISE_TYPED_KERNEL(Sub, 14, MLFloat16, Sub);
 
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 7, 12, float, Mul);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 7, 12, double, Mul);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 7, 12, int32_t, Mul);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 7, 12, int64_t, Mul);
+REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 7, 12, MLFloat16, Mul);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 13, 13, float, Mul);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 13, 13, double, Mul);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 13, 13, int32_t, Mul);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 13, 13, int64_t, Mul);
+REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Mul, 13, 13, MLFloat16, Mul);
 REG_ELEMENTWISE_TYPED_KERNEL(Mul, 14, float, Mul);
 REG_ELEMENTWISE_TYPED_KERNEL(Mul, 14, double, Mul);
 REG_ELEMENTWISE_TYPED_KERNEL(Mul, 14, int32_t, Mul);
 REG_ELEMENTWISE_TYPED_KERNEL(Mul, 14, int64_t, Mul);
+REG_ELEMENTWISE_TYPED_KERNEL(Mul, 14, MLFloat16, Mul);
 
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 7, 12, float, Div);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 7, 12, double, Div);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 7, 12, int32_t, Div);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 7, 12, int64_t, Div);
+REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 7, 12, MLFloat16, Div);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 13, 13, float, Div);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 13, 13, double, Div);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 13, 13, int32_t, Div);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 13, 13, int64_t, Div);
+REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Div, 13, 13, MLFloat16, Div);
 REG_ELEMENTWISE_TYPED_KERNEL(Div, 14, float, Div);
 REG_ELEMENTWISE_TYPED_KERNEL(Div, 14, double, Div);
 REG_ELEMENTWISE_TYPED_KERNEL(Div, 14, int32_t, Div);
 REG_ELEMENTWISE_TYPED_KERNEL(Div, 14, int64_t, Div);
+REG_ELEMENTWISE_TYPED_KERNEL(Div, 14, MLFloat16, Div);
 
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Abs, 6, 12, float, Abs);
 REG_ELEMENTWISE_VERSIONED_TYPED_KERNEL(Abs, 6, 12, double, Abs);
@@ -418,8 +430,150 @@ static void UntypedBroadcastVariadic(int input_count, OpKernelContext& context,
                                      AllocateTensorFunc allocate_tensor,
                                      const ProcessBroadcastSpanFuncs& funcs);
 
+// Broadcast two inputs through the MLAS element-wise kernels. The output is processed as rows of one span
+// where each input advances by a constant stride per row, so each thread handles a block of rows with a single
+// call instead of a function dispatch per span. Returns false if the broadcast pattern is not supported, in
+// which case the output has not been allocated.
+template <typename T>
+static bool MlasBroadcastTwo(OpKernelContext& context, MLAS_ELTWISE_BINARY_KIND kind) {
+  const Tensor& input0_tensor = *context.Input<Tensor>(0);
+  const Tensor& input1_tensor = *context.Input<Tensor>(1);
+  InputBroadcaster input_broadcaster(input0_tensor, input1_tensor);
+
+  ptrdiff_t input0_stride;
+  ptrdiff_t input1_stride;
+  if (!input_broadcaster.GetSpanStrides(input0_stride, input1_stride)) {
+    return false;
+  }
+
+  Tensor& output_tensor = *context.Output(0, input_broadcaster.GetOutputShape());
+
+  const ptrdiff_t output_size = static_cast<ptrdiff_t>(output_tensor.Shape().Size());
+  if (output_size == 0) {
+    return true;
+  }
+
+  const ptrdiff_t span_size = static_cast<ptrdiff_t>(input_broadcaster.GetSpanSize());
+  const ptrdiff_t rows = output_size / span_size;
+  const bool input0_scalar = input_broadcaster.IsInput0Scalar();
+  const bool input1_scalar = input_broadcaster.IsInput1Scalar();
+
+  const T* input0 = input0_tensor.template Data<T>();
+  const T* input1 = input1_tensor.template Data<T>();
+  T* output = output_tensor.template MutableData<T>();
+
+  concurrency::ThreadPool* tp = context.GetOperatorThreadPool();
+
+  if (rows == 1) {
+    // Parallelize within the span.
+    concurrency::ThreadPool::TryParallelFor(
+        tp, span_size, TensorOpCost{static_cast<double>(2 * sizeof(T)), static_cast<double>(sizeof(T)), 1.0},
+        [=](std::ptrdiff_t first, std::ptrdiff_t last) {
+          MlasEltwiseBinary<T>(kind,
+                               input0 + (input0_scalar ? 0 : first), 0, input0_scalar,
+                               input1 + (input1_scalar ? 0 : first), 0, input1_scalar,
+                               output + first, 1, static_cast<size_t>(last - first));
+        });
+  } else {
+    concurrency::ThreadPool::TryParallelFor(
+        tp, rows,
+        TensorOpCost{static_cast<double>(2 * sizeof(T) * span_size), static_cast<double>(sizeof(T) * span_size),
+                     static_cast<double>(span_size)},
+        [=](std::ptrdiff_t first, std::ptrdiff_t last) {
+          MlasEltwiseBinary<T>(kind,
+                               input0 + first * input0_stride, static_cast<size_t>(input0_stride), input0_scalar,
+                               input1 + first * input1_stride, static_cast<size_t>(input1_stride), input1_scalar,
+                               output + first * span_size, static_cast<size_t>(last - first),
+                               static_cast<size_t>(span_size));
+        });
+  }
+
+  return true;
+}
+
+// Only the types with MLAS element-wise kernels use MlasBroadcastTwo.
+template <typename T>
+static bool TryMlasBroadcastTwo(OpKernelContext&, MLAS_ELTWISE_BINARY_KIND) {
+  return false;
+}
+
+template <>
+bool TryMlasBroadcastTwo<float>(OpKernelContext& context, MLAS_ELTWISE_BINARY_KIND kind) {
+  return MlasBroadcastTwo<float>(context, kind);
+}
+
+template <>
+bool TryMlasBroadcastTwo<int32_t>(OpKernelContext& context, MLAS_ELTWISE_BINARY_KIND kind) {
+  return MlasBroadcastTwo<int32_t>(context, kind);
+}
+
+template <>
+bool TryMlasBroadcastTwo<int64_t>(OpKernelContext& context, MLAS_ELTWISE_BINARY_KIND kind) {
+  return MlasBroadcastTwo<int64_t>(context, kind);
+}
+
+// Half precision inputs are processed in blocks that are widened to single precision, combined by the MLAS
+// element-wise kernels and narrowed back, so no full size single precision copy of either input is made.
+static void ComputeHalfSpan(MLAS_ELTWISE_BINARY_KIND kind,
+                            const MLFloat16* input0, bool input0_scalar,
+                            const MLFloat16* input1, bool input1_scalar,
+                            MLFloat16* output, size_t count) {
+  constexpr size_t kBlockSize = 512;
+  float buffer0[kBlockSize];
+  float buffer1[kBlockSize];
+  float output_buffer[kBlockSize];
+
+  if (input0_scalar) {
+    MlasConvertHalfToFloatBuffer(&input0->val, buffer0, 1);
+  }
+  if (input1_scalar) {
+    MlasConvertHalfToFloatBuffer(&input1->val, buffer1, 1);
+  }
+
+  for (size_t offset = 0; offset < count; offset += kBlockSize) {
+    const size_t block_size = std::min(kBlockSize, count - offset);
+    if (!input0_scalar) {
+      MlasConvertHalfToFloatBuffer(&input0[offset].val, buffer0, block_size);
+    }
+    if (!input1_scalar) {
+      MlasConvertHalfToFloatBuffer(&input1[offset].val, buffer1, block_size);
+    }
+    MlasEltwiseBinary<float>(kind, buffer0, 0, input0_scalar, buffer1, 0, input1_scalar, output_buffer, 1,
+                             block_size);
+    MlasConvertFloatToHalfBuffer(output_buffer, &output[offset].val, block_size);
+  }
+}
+
+static void HalfBroadcastTwo(OpKernelContext& context, MLAS_ELTWISE_BINARY_KIND kind) {
+  ProcessBroadcastSpanFuncs funcs{
+      [](BroadcastHelper& per_iter_bh) {
+        auto input1 = per_iter_bh.SpanInput1<MLFloat16>();
+        ComputeHalfSpan(*static_cast<MLAS_ELTWISE_BINARY_KIND*>(per_iter_bh.GetUserData()),
+                        &per_iter_bh.ScalarInput0<MLFloat16>(), true, input1.data(), false,
+                        per_iter_bh.OutputSpan<MLFloat16>().data(), input1.size());
+      },
+      [](BroadcastHelper& per_iter_bh) {
+        auto input0 = per_iter_bh.SpanInput0<MLFloat16>();
+        ComputeHalfSpan(*static_cast<MLAS_ELTWISE_BINARY_KIND*>(per_iter_bh.GetUserData()),
+                        input0.data(), false, &per_iter_bh.ScalarInput1<MLFloat16>(), true,
+                        per_iter_bh.OutputSpan<MLFloat16>().data(), input0.size());
+      },
+      [](BroadcastHelper& per_iter_bh) {
+        auto input0 = per_iter_bh.SpanInput0<MLFloat16>();
+        ComputeHalfSpan(*static_cast<MLAS_ELTWISE_BINARY_KIND*>(per_iter_bh.GetUserData()),
+                        input0.data(), false, per_iter_bh.SpanInput1<MLFloat16>().data(), false,
+                        per_iter_bh.OutputSpan<MLFloat16>().data(), input0.size());
+      }};
+
+  UntypedBroadcastTwo(context, funcs, 1.0, &kind);
+}
+
 template <typename T>
 Status Add<T>::Compute(OpKernelContext* context) const {
+  if (TryMlasBroadcastTwo<T>(*context, MlasEltwiseAdd)) {
+    return Status::OK();
+  }
+
   // BroadcastHelper received as argument may differ from 'helper' when parallelizing within a span
   ProcessBroadcastSpanFuncs funcs{
       [](BroadcastHelper& per_iter_bh) {
@@ -438,6 +592,10 @@ Status Add<T>::Compute(OpKernelContext* context) const {
 
 template <typename T>
 Status Sub<T>::Compute(OpKernelContext* context) const {
+  if (TryMlasBroadcastTwo<T>(*context, MlasEltwiseSubtract)) {
+    return Status::OK();
+  }
+
   ProcessBroadcastSpanFuncs funcs{
       [](BroadcastHelper& per_iter_bh) {
         per_iter_bh.OutputEigen<T>() = per_iter_bh.ScalarInput0<T>() - per_iter_bh.EigenInput1<T>().array();
@@ -455,6 +613,10 @@ Status Sub<T>::Compute(OpKernelContext* context) const {
 
 template <typename T>
 Status Mul<T>::Compute(OpKernelContext* context) const {
+  if (TryMlasBroadcastTwo<T>(*context, MlasEltwiseMultiply)) {
+    return Status::OK();
+  }
+
   ProcessBroadcastSpanFuncs funcs{
       [](BroadcastHelper& per_iter_bh) {
         per_iter_bh.OutputEigen<T>() = per_iter_bh.ScalarInput0<T>() * per_iter_bh.EigenInput1<T>().array();
@@ -472,6 +634,10 @@ Status Mul<T>::Compute(OpKernelContext* context) const {
 
 template <typename T>
 Status Div<T>::Compute(OpKernelContext* context) const {
+  if (TryMlasBroadcastTwo<T>(*context, MlasEltwiseDivide)) {
+    return Status::OK();
+  }
+
   ProcessBroadcastSpanFuncs funcs{
       [](BroadcastHelper& per_iter_bh) {
         per_iter_bh.OutputEigen<T>() = per_iter_bh.ScalarInput0<T>() / per_iter_bh.EigenInput1<T>().array();
@@ -487,6 +653,30 @@ Status Div<T>::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+template <>
+Status Add<MLFloat16>::Compute(OpKernelContext* context) const {
+  HalfBroadcastTwo(*context, MlasEltwiseAdd);
+  return Status::OK();
+}
+
+template <>
+Status Sub<MLFloat16>::Compute(OpKernelContext* context) const {
+  HalfBroadcastTwo(*context, MlasEltwiseSubtract);
+  return Status::OK();
+}
+
+template <>
+Status Mul<MLFloat16>::Compute(OpKernelContext* context) const {
+  HalfBroadcastTwo(*context, MlasEltwiseMultiply);
+  return Status::OK();
+}
+
+template <>
+Status Div<MLFloat16>::Compute(OpKernelContext* context) const {
+  HalfBroadcastTwo(*context, MlasEltwiseDivide);
+  return Status::OK();
+}
+
 namespace pow_internal {
 
 template <typename T, typename E>
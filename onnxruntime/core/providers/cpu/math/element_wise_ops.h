@@ -517,6 +517,21 @@ struct BroadcastIterator {
     count_ *= axis;
   }
 
+  // Computes the constant offset between the starts of successive spans of span_size elements. This is only
+  // possible for an iterator at its initial position whose entries are at most a single span followed by
+  // one repeat, which covers element-wise, scalar, row broadcast and column broadcast patterns.
+  bool GetSpanStride(ptrdiff_t span_size, ptrdiff_t& stride) const {
+    if (counts_.size() == 1) {
+      stride = deltas_[0] * span_size;
+      return true;
+    }
+    if (counts_.size() == 2 && counts_[0] == span_size) {
+      stride = deltas_[0] * span_size + deltas_[1];
+      return stride >= 0;
+    }
+    return false;
+  }
+
   void StopBroadcasting() {
     deltas_.push_back(count_);
     counts_.push_back(1);
@@ -674,6 +689,14 @@ struct InputBroadcaster {
   bool IsInput0Scalar() const { return broadcaster_.iterator1_.deltas_.front() == 0; }
   bool IsInput1Scalar() const { return broadcaster_.iterator2_.deltas_.front() == 0; }
 
+  // Check whether the broadcast can be processed as a sequence of spans where each input advances by a
+  // constant stride from one span to the next. Must be called before the broadcaster is advanced.
+  bool GetSpanStrides(ptrdiff_t& input0_stride, ptrdiff_t& input1_stride) const {
+    ptrdiff_t span_size = static_cast<ptrdiff_t>(span_size_);
+    return broadcaster_.iterator1_.GetSpanStride(span_size, input0_stride) &&
+           broadcaster_.iterator2_.GetSpanStride(span_size, input1_stride);
+  }
+
   size_t Input0ElementSize() const { return input0_element_size_; }
   size_t Input1ElementSize() const { return input1_element_size_; }
 
@@ -3,6 +3,7 @@
 
 #include "core/providers/cpu/math/gemm.h"
 #include "core/providers/cpu/math/gemm_matmul_common.h"
+#include "core/providers/cpu/fp16_helpers.h"
 #include "core/util/math_cpuonly.h"
 #include "gemm_helper.h"
 #include "core/mlas/inc/mlas.h"
@@ -23,6 +24,13 @@ ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
     double,
     KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<double>()),
     Gemm<double>);
+ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
+    Gemm,
+    7,
+    8,
+    MLFloat16,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<MLFloat16>()),
+    Gemm<MLFloat16>);
 
 // opset 9 added support for additional types (int32, uint32, int64, uint64), however we haven't enabled those yet.
 ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
@@ -39,6 +47,13 @@ ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
     double,
     KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<double>()),
     Gemm<double>);
+ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
+    Gemm,
+    9,
+    10,
+    MLFloat16,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<MLFloat16>()),
+    Gemm<MLFloat16>);
 
 // opset 11 made bias input 'C' optional
 ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
@@ -55,6 +70,13 @@ ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
     double,
     KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<double>()),
     Gemm<double>);
+ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
+    Gemm,
+    11,
+    12,
+    MLFloat16,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<MLFloat16>()),
+    Gemm<MLFloat16>);
 
 // opset 13 Adds BFloat16 support but we are not supporting it yet
 ONNX_CPU_OPERATOR_TYPED_KERNEL(
@@ -69,6 +91,12 @@ ONNX_CPU_OPERATOR_TYPED_KERNEL(
     double,
     KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<double>()),
     Gemm<double>);
+ONNX_CPU_OPERATOR_TYPED_KERNEL(
+    Gemm,
+    13,
+    MLFloat16,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<MLFloat16>()),
+    Gemm<MLFloat16>);
 
 bool GemmPackBFp32(const OpKernelInfo& info,
                    const Tensor& tensor_b,
@@ -263,29 +291,82 @@ Status Gemm<float>::Compute(OpKernelContext* context) const {
   const float* c_data = C != nullptr ? C->Data<float>() : nullptr;
   const TensorShape* c_shape = C != nullptr ? &C->Shape() : nullptr;
 
-  if (B) {
-    ComputeGemm(trans_A_, trans_B_, M, N, K, alpha_, A->Data<float>(), B->Data<float>(), beta_,
-                c_data, c_shape, y_data, thread_pool);
-  } else {
+  // A bias of shape (N,) or (1, N), or a scalar if N is 1, that isn't scaled is added by the epilogue of each output
+  // tile, together with the activation, instead of being broadcast to the output before the multiplication.
+  const bool fuse_bias = c_data != nullptr && beta_ == 1.0f && c_shape->Size() == N &&
+                         (c_shape->NumDimensions() <= 1 || (*c_shape)[0] == 1);
+  if (!fuse_bias) {
     GemmBroadcastBias(M, N, beta_, c_data, c_shape, y_data);
-    MlasGemm(
-        trans_A_,
-        static_cast<size_t>(M),
-        static_cast<size_t>(N),
-        static_cast<size_t>(K),
-        alpha_,
-        A->Data<float>(),
-        static_cast<size_t>(trans_A_ != CblasNoTrans ? M : K),
-        packed_b_.get(),
-        c_data != nullptr ? beta_ : 0.0f,
-        y_data,
-        static_cast<size_t>(N),
-        thread_pool);
   }
 
+  MLAS_SGEMM_BIAS_ACTIVATION_OUTPUT_PROCESSOR output_processor(fuse_bias ? c_data : nullptr,
+                                                               has_mlas_activation_ ? &mlas_activation_ : nullptr);
+
+  MLAS_SGEMM_DATA_PARAMS data;
+  data.BIsPacked = bool(packed_b_);
+  data.A = A->Data<float>();
+  data.lda = static_cast<size_t>(trans_A_ != CblasNoTrans ? M : K);
+  data.B = data.BIsPacked ? static_cast<const float*>(packed_b_.get()) : B->Data<float>();
+  data.ldb = static_cast<size_t>(trans_B_ != CblasNoTrans ? K : N);
+  data.C = y_data;
+  data.ldc = static_cast<size_t>(N);
+  data.alpha = alpha_;
+  // passing 0 for beta ignores any junk in the output buffer if the bias is missing or added by the epilogue
+  data.beta = c_data != nullptr && !fuse_bias ? beta_ : 0.0f;
+  data.OutputProcessor = fuse_bias || has_mlas_activation_ ? &output_processor : nullptr;
+
+  MlasGemm(trans_A_, trans_B_, static_cast<size_t>(M), static_cast<size_t>(N), static_cast<size_t>(K), data,
+           thread_pool);
+
   ComputeActivation(y_data, M * N, thread_pool);
 
   return Status::OK();
 }
 
+template <>
+Status Gemm<MLFloat16>::Compute(OpKernelContext* context) const {
+  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
+
+  const auto* A = context->Input<Tensor>(0);
+  const auto* B = context->Input<Tensor>(1);
+  const auto* C = context->Input<Tensor>(2);
+
+  // Bias could be missing. Treat as scalar 0 if that is the case.
+  GemmHelper helper(A->Shape(), trans_A_ != CblasNoTrans, B->Shape(), trans_B_ != CblasNoTrans,
+                    C != nullptr ? C->Shape() : TensorShape({}));
+
+  if (!helper.State().IsOK())
+    return helper.State();
+
+  int64_t M = helper.M();
+  int64_t N = helper.N();
+  int64_t K = helper.K();
+
+  auto Y = context->Output(0, {M, N});
+
+  // if input is empty tensor, return as nothing need to be calculated and we've set the shape for the output
+  if (M == 0 || N == 0)
+    return Status::OK();
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+  // Compute in single precision on temporary copies of the half precision inputs.
+  auto a_data = fp16::ToFloatBuffer(alloc, *A, thread_pool);
+  auto b_data = fp16::ToFloatBuffer(alloc, *B, thread_pool);
+  IAllocatorUniquePtr<float> c_data;
+  if (C != nullptr) {
+    c_data = fp16::ToFloatBuffer(alloc, *C, thread_pool);
+  }
+  const size_t y_size = static_cast<size_t>(M * N);
+  auto y_data = IAllocator::MakeUniquePtr<float>(alloc, y_size);
+
+  Gemm<float>::ComputeGemm(trans_A_, trans_B_, M, N, K, alpha_, a_data.get(), b_data.get(), beta_,
+                           c_data.get(), C != nullptr ? &C->Shape() : nullptr, y_data.get(), thread_pool);
+
+  fp16::ConvertToHalf(y_data.get(), Y->MutableData<MLFloat16>(), y_size, thread_pool);
+
+  return Status::OK();
+}
+
 }  // namespace onnxruntime
@@ -38,4 +38,13 @@ class MatMul<float> final : public OpKernel {
   int64_t trans_b_attr_;
 };
 
+// Half precision tensors are converted to single precision and multiplied with MLAS.
+template <>
+class MatMul<MLFloat16> final : public OpKernel {
+ public:
+  MatMul(const OpKernelInfo& info) : OpKernel(info) {}
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
 }  // namespace onnxruntime
@@ -9,7 +9,14 @@ namespace onnxruntime {
 
 class MatMulIntegerBase : public OpKernel {
  public:
-  MatMulIntegerBase(const OpKernelInfo& info) : OpKernel(info) {}
+  MatMulIntegerBase(const OpKernelInfo& info) : OpKernel(info) {
+    // The packed format of matrix B depends on the signedness of matrix A.
+    // Inputs that are not int8, such as the float input that is quantized to
+    // uint8 by DynamicQuantizeMatMul, are multiplied as unsigned data.
+    const auto* a_type = info.GetInputType(0);
+    a_is_signed_ = a_type != nullptr &&
+                   a_type->tensor_type().elem_type() == ONNX_NAMESPACE::TensorProto_DataType_INT8;
+  }
 
   Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override {
     is_packed = false;
@@ -29,7 +36,7 @@ class MatMulIntegerBase : public OpKernel {
       const auto* b_data = static_cast<const uint8_t*>(tensor.DataRaw());
       b_is_signed_ = tensor.IsDataType<int8_t>();
 
-      const size_t packed_b_size = MlasGemmPackBSize(N, K, b_is_signed_);
+      const size_t packed_b_size = MlasGemmPackBSize(N, K, a_is_signed_, b_is_signed_);
       if (packed_b_size == 0) {
         return Status::OK();
       }
@@ -37,7 +44,7 @@ class MatMulIntegerBase : public OpKernel {
       auto alloc = Info().GetAllocator(0, OrtMemTypeDefault);
       auto* packed_b_data = alloc->Alloc(packed_b_size);
       packed_b_ = BufferUniquePtr(packed_b_data, BufferDeleter(alloc));
-      MlasGemmPackB(N, K, b_data, N, b_is_signed_, packed_b_data);
+      MlasGemmPackB(N, K, b_data, N, a_is_signed_, b_is_signed_, packed_b_data);
       is_packed = true;
     }
     return Status::OK();
@@ -49,6 +56,7 @@ class MatMulIntegerBase : public OpKernel {
   */
   virtual int GetBIdx() = 0;
 
+  bool a_is_signed_{false};
   bool b_is_signed_{true};
   TensorShape b_shape_;
   BufferUniquePtr packed_b_;
@@ -24,6 +24,8 @@
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
 #include "core/mlas/inc/mlas.h"
+#include "core/framework/float16.h"
+#include "core/platform/threadpool.h"
 
 namespace onnxruntime {
 template <typename T>
@@ -100,4 +102,35 @@ common::Status SoftmaxCPU<float>(size_t N,
   return Status::OK();
 }
 
+template <>
+common::Status SoftmaxCPU<MLFloat16>(size_t N,
+                                     size_t D,
+                                     const MLFloat16* Xdata,
+                                     MLFloat16* Ydata,
+                                     bool logarithmic,
+                                     onnxruntime::concurrency::ThreadPool* thread_pool) {
+  // Each block of rows is widened to single precision, normalized by MLAS and narrowed back in place, so the
+  // single precision copy stays in the cache and the input may alias the output.
+  constexpr size_t kBlockElements = 16384;
+  const size_t block_rows = std::max<size_t>(1, kBlockElements / std::max<size_t>(D, 1));
+  const std::ptrdiff_t block_count = static_cast<std::ptrdiff_t>((N + block_rows - 1) / block_rows);
+  const double block_size = static_cast<double>(block_rows * D);
+
+  concurrency::ThreadPool::TryParallelFor(
+      thread_pool, block_count, {block_size * sizeof(MLFloat16), block_size * sizeof(MLFloat16), block_size * 16.0},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        std::vector<float> buffer(block_rows * D);
+        for (std::ptrdiff_t block = first; block < last; block++) {
+          const size_t row = static_cast<size_t>(block) * block_rows;
+          const size_t rows = std::min(block_rows, N - row);
+          const size_t count = rows * D;
+          MlasConvertHalfToFloatBuffer(&Xdata[row * D].val, buffer.data(), count);
+          MlasComputeSoftmax(buffer.data(), buffer.data(), rows, D, logarithmic, nullptr);
+          MlasConvertFloatToHalfBuffer(buffer.data(), &Ydata[row * D].val, count);
+        }
+      });
+
+  return Status::OK();
+}
+
 }  // namespace onnxruntime
@@ -18,6 +18,7 @@
 #include "core/providers/cpu/nn/conv.h"
 
 #include "core/common/safeint.h"
+#include "core/framework/tensorprotoutils.h"
 #include "core/util/math_cpuonly.h"
 
 namespace onnxruntime {
@@ -151,18 +152,113 @@ Status Conv<T>::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+Status Conv<float>::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  // only transform the filter of 2D convolutions
+  if (input_idx != 1 || tensor.Shape().NumDimensions() != 4) {
+    return Status::OK();
+  }
+
+  // The tile size of the Winograd algorithm depends on the output image size,
+  // so the filter is only transformed if the spatial dimensions of the input
+  // are known now. Otherwise Compute transforms it on every run.
+  const auto* X_shape_proto = Node().InputDefs()[0]->Shape();
+  if (X_shape_proto == nullptr) {
+    return Status::OK();
+  }
+  const TensorShape X_shape = utils::GetTensorShapeFromTensorShapeProto(*X_shape_proto);
+  if (X_shape.NumDimensions() != 4 || X_shape[2] < 0 || X_shape[3] < 0) {
+    return Status::OK();
+  }
+
+  // leave reporting invalid attributes to Compute
+  std::vector<int64_t> kernel_shape;
+  if (!conv_attrs_.ComputeKernelShape(tensor.Shape(), kernel_shape).IsOK()) {
+    return Status::OK();
+  }
+
+  std::vector<int64_t> pads(conv_attrs_.pads);
+  if (pads.empty()) {
+    pads.resize(kernel_shape.size() * 2, 0);
+  }
+  std::vector<int64_t> dilations(conv_attrs_.dilations);
+  if (dilations.empty()) {
+    dilations.resize(kernel_shape.size(), 1);
+  }
+  std::vector<int64_t> strides(conv_attrs_.strides);
+  if (strides.empty()) {
+    strides.resize(kernel_shape.size(), 1);
+  }
+
+  TensorShape input_shape = X_shape.Slice(2);
+  std::vector<int64_t> output_shape;
+  if (!conv_attrs_.InferOutputShape(input_shape, kernel_shape, strides, dilations, pads, output_shape).IsOK()) {
+    return Status::OK();
+  }
+
+  // The algorithm doesn't depend on the batch size, so select it the way
+  // Compute will.
+  const size_t group_count = static_cast<size_t>(conv_attrs_.group);
+  MLAS_CONV_PARAMETERS Parameters;
+  size_t WorkingBufferSize;
+  MlasConvPrepare(&Parameters,
+                  kernel_shape.size(),
+                  1,
+                  group_count,
+                  static_cast<size_t>(tensor.Shape()[1]),
+                  input_shape.GetDims().data(),
+                  kernel_shape.data(),
+                  dilations.data(),
+                  pads.data(),
+                  strides.data(),
+                  output_shape.data(),
+                  static_cast<size_t>(tensor.Shape()[0]) / group_count,
+                  &activation_,
+                  &WorkingBufferSize,
+                  nullptr,
+                  true /* AllowWinograd */);
+  if (Parameters.Algorithm != MlasConvAlgorithmWinograd) {
+    return Status::OK();
+  }
+
+  const size_t tile_size = Parameters.u.Winograd.TileSize;
+  const size_t packed_W_size = MlasConvWinogradPackFilterSize(tile_size,
+                                                              Parameters.GroupCount,
+                                                              Parameters.FilterCount,
+                                                              Parameters.InputChannels);
+
+  auto alloc = Info().GetAllocator(0, OrtMemTypeDefault);
+  auto* packed_W_data = alloc->Alloc(SafeInt<size_t>(sizeof(float)) * packed_W_size);
+  winograd_packed_W_ = BufferUniquePtr(packed_W_data, BufferDeleter(alloc));
+  winograd_tile_size_ = tile_size;
+  W_shape_ = tensor.Shape();
+
+  MlasConvWinogradPackFilter(tile_size,
+                             Parameters.GroupCount,
+                             Parameters.FilterCount,
+                             Parameters.InputChannels,
+                             tensor.Data<float>(),
+                             static_cast<float*>(packed_W_data));
+
+  // only the transformed filter is used from now on, so release the original
+  is_packed = true;
+  return Status::OK();
+}
+
 Status Conv<float>::Compute(OpKernelContext* context) const {
   size_t num_inputs = OpKernel::Node().InputDefs().size();
   const auto* X = context->Input<Tensor>(0);
-  const auto* W = context->Input<Tensor>(1);
+  const auto* W = winograd_packed_W_ ? nullptr : context->Input<Tensor>(1);
+  const auto& W_shape = W ? W->Shape() : W_shape_;
   const Tensor* B = num_inputs == 3 ? context->Input<Tensor>(2) : nullptr;
   const int64_t N = X->Shape()[0];
   const int64_t C = X->Shape()[1];
-  const int64_t M = W->Shape()[0];
-  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X, W));
+  const int64_t M = W_shape[0];
+  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X->Shape(), W_shape));
 
   std::vector<int64_t> kernel_shape;
-  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W->Shape(), kernel_shape));
+  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W_shape, kernel_shape));
 
   std::vector<int64_t> pads(conv_attrs_.pads);
   if (pads.empty()) {
@@ -215,15 +311,45 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
                     static_cast<size_t>(M / conv_attrs_.group),
                     &activation_,
                     &WorkingBufferSize,
-                    thread_pool);
+                    thread_pool,
+                    true /* AllowWinograd */);
 
     auto* working_data = WorkingBufferSize > 0 ? alloc->Alloc(SafeInt<size_t>(sizeof(float)) * WorkingBufferSize)
                                                : nullptr;
     BufferUniquePtr working_buffer(working_data, BufferDeleter(alloc));
 
+    const float* filter_data = W ? W->template Data<float>() : nullptr;
+
+    // The Winograd algorithm requires the transformed filter, so use the
+    // prepacked filter or transform the filter for this run.
+    BufferUniquePtr winograd_filter_buffer;
+    if (winograd_packed_W_) {
+      // the original filter was released, which PrePack only does if the
+      // input shape fixes the algorithm and its tile size.
+      ORT_RETURN_IF_NOT(Parameters.Algorithm == MlasConvAlgorithmWinograd &&
+                            Parameters.u.Winograd.TileSize == winograd_tile_size_,
+                        "Conv input shape ", X->Shape(), " does not match the shape the filter was packed for");
+      filter_data = static_cast<const float*>(winograd_packed_W_.get());
+    } else if (Parameters.Algorithm == MlasConvAlgorithmWinograd) {
+      const size_t tile_size = Parameters.u.Winograd.TileSize;
+      const size_t packed_W_size = MlasConvWinogradPackFilterSize(tile_size,
+                                                                  Parameters.GroupCount,
+                                                                  Parameters.FilterCount,
+                                                                  Parameters.InputChannels);
+      auto* packed_W_data = alloc->Alloc(SafeInt<size_t>(sizeof(float)) * packed_W_size);
+      winograd_filter_buffer = BufferUniquePtr(packed_W_data, BufferDeleter(alloc));
+      MlasConvWinogradPackFilter(tile_size,
+                                 Parameters.GroupCount,
+                                 Parameters.FilterCount,
+                                 Parameters.InputChannels,
+                                 filter_data,
+                                 static_cast<float*>(packed_W_data));
+      filter_data = static_cast<const float*>(packed_W_data);
+    }
+
     MlasConv(&Parameters,
              Xdata,
-             W->template Data<float>(),
+             filter_data,
              Bdata,
              static_cast<float*>(working_buffer.get()),
              Ydata,
@@ -234,7 +360,7 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
     const int64_t kernel_size = TensorShape(kernel_shape).Size();
     const int64_t X_offset = C / conv_attrs_.group * input_image_size;
     const int64_t Y_offset = Y->Shape().Size() / Y->Shape()[0] / conv_attrs_.group;
-    const int64_t W_offset = W->Shape().Size() / conv_attrs_.group;
+    const int64_t W_offset = W_shape.Size() / conv_attrs_.group;
     const int64_t kernel_dim = C / conv_attrs_.group * kernel_size;
     const int64_t col_buffer_size = kernel_dim * output_image_size;
 
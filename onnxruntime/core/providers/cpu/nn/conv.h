@@ -28,12 +28,24 @@ class Conv<float> : public OpKernel {
     activation_.ActivationKind = MlasIdentityActivation;
   }
 
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+
   Status Compute(OpKernelContext* context) const override;
 
  protected:
   MLAS_ACTIVATION activation_;
 
   ConvAttributes conv_attrs_;
+
+ private:
+  // 3x3 filters transformed for the Winograd algorithm. The transform takes
+  // (tile_size + 2)^2 / 9 times the memory of the filter, so it is only
+  // prepacked, and the original filter released, if the input shape fixes the
+  // algorithm and tile size at PrePack. Otherwise Compute transforms the filter
+  // on every run that selects the Winograd algorithm.
+  BufferUniquePtr winograd_packed_W_;
+  size_t winograd_tile_size_{0};
+  TensorShape W_shape_;
 };
 
 }  // namespace onnxruntime
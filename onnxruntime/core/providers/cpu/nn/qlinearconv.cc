@@ -20,6 +20,11 @@ class QLinearConv : public OpKernel {
                                                    is_W_signed_(false),
                                                    is_W_packed_(false) {
     channels_last_ = (info.GetAttrOrDefault<int64_t>("channels_last", static_cast<int64_t>(0)) != 0);
+
+    // The packed format of the filter depends on the signedness of the input.
+    const auto* X_type = info.GetInputType(0);
+    is_X_signed_ = X_type != nullptr &&
+                   X_type->tensor_type().elem_type() == ONNX_NAMESPACE::TensorProto_DataType_INT8;
   }
 
   Status Compute(OpKernelContext* context) const override;
@@ -41,11 +46,20 @@ class QLinearConv : public OpKernel {
     }
   }
 
+  // Converts int8 data to uint8 data, or back, by flipping the sign bit. This preserves the difference between
+  // each value and the zero point, which is converted the same way.
+  static void FlipSignBit(const uint8_t* input, uint8_t* output, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+      output[i] = static_cast<uint8_t>(input[i] ^ 0x80);
+    }
+  }
+
   ConvAttributes conv_attrs_;
   TensorShape W_shape_;
   BufferUniquePtr packed_W_buffer_;
   size_t packed_W_size_;
   BufferUniquePtr reordered_W_buffer_;
+  bool is_X_signed_;
   bool is_W_signed_;
   bool is_W_packed_;
   bool channels_last_;
@@ -55,9 +69,9 @@ ONNX_CPU_OPERATOR_KERNEL(
     QLinearConv,
     10,
     KernelDefBuilder()
-        .TypeConstraint("T1", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T1", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
         .TypeConstraint("T2", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
-        .TypeConstraint("T3", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T3", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
         .TypeConstraint("T4", DataTypeImpl::GetTensorType<int32_t>()),
     QLinearConv);
 
@@ -73,9 +87,9 @@ ONNX_OPERATOR_KERNEL_EX(
     1,
     kCpuExecutionProvider,
     KernelDefBuilder()
-        .TypeConstraint("T1", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T1", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
         .TypeConstraint("T2", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
-        .TypeConstraint("T3", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T3", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()})
         .TypeConstraint("T4", DataTypeImpl::GetTensorType<int32_t>()),
     QLinearConv);
 
@@ -120,7 +134,7 @@ Status QLinearConv::PrePack(const Tensor& tensor, int input_idx, bool& is_packed
 
   // Don't pack the filter buffer if the MlasConvDepthwise path is used.
   if (group_input_channels != 1 && group_output_channels != 1) {
-    packed_W_size_ = MlasGemmPackBSize(group_output_channels, kernel_dim, is_W_signed_);
+    packed_W_size_ = MlasGemmPackBSize(group_output_channels, kernel_dim, is_X_signed_, is_W_signed_);
 
     if (packed_W_size_ != 0) {
       auto* packed_W = static_cast<uint8_t*>(alloc->Alloc(SafeInt<size_t>(group_count) * packed_W_size_));
@@ -138,7 +152,7 @@ Status QLinearConv::PrePack(const Tensor& tensor, int input_idx, bool& is_packed
 
       for (int64_t group_id = 0; group_id < conv_attrs_.group; ++group_id) {
         ReorderFilter(Wdata, group_reordered_W, group_output_channels, group_input_channels, kernel_size);
-        MlasGemmPackB(group_output_channels, kernel_dim, group_reordered_W, group_output_channels, is_W_signed_, packed_W);
+        MlasGemmPackB(group_output_channels, kernel_dim, group_reordered_W, group_output_channels, is_X_signed_, is_W_signed_, packed_W);
         packed_W += packed_W_size_;
         Wdata += W_offset;
       }
@@ -177,8 +191,13 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
   ORT_ENFORCE(IsScalarOr1ElementVector(Y_zero_point),
               "QLinearConv : result zero point must be a scalar or 1D tensor of size 1");
 
-  auto X_zero_point_value = *(X_zero_point->template Data<uint8_t>());
-  auto Y_zero_point_value = *(Y_zero_point->template Data<uint8_t>());
+  // Signed activations are consumed directly by the GEMM. The depthwise kernel and the requantization only support
+  // unsigned data, so their inputs and outputs are converted by flipping the sign bit along with the zero points.
+  const bool is_X_signed = X->IsDataType<int8_t>();
+  const uint8_t sign_bit = is_X_signed ? 0x80 : 0;
+
+  const uint8_t X_zero_point_value = *static_cast<const uint8_t*>(X_zero_point->DataRaw());
+  const uint8_t Y_zero_point_value = *static_cast<const uint8_t*>(Y_zero_point->DataRaw()) ^ sign_bit;
 
   uint8_t W_zero_point_value;
   const auto& W_zero_point_shape = W_zero_point->Shape();
@@ -258,6 +277,7 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
     Y_dims.push_back(M);
   }
   Tensor* Y = context->Output(0, TensorShape(Y_dims));
+  ORT_RETURN_IF_NOT(Y->IsDataType<int8_t>() == is_X_signed, "QLinearConv : input and output must have the same type");
   TensorShape output_shape = Y->Shape().Slice(spatial_dim_start, spatial_dim_end);
 
   // Bail out early if one of the dimensions is zero.
@@ -317,9 +337,9 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
   BufferUniquePtr gemm_output_buffer(gemm_output_data, BufferDeleter(alloc));
   auto* gemm_output = static_cast<int32_t*>(gemm_output_buffer.get());
 
-  const auto* Xdata = X->template Data<uint8_t>();
+  const auto* Xdata = static_cast<const uint8_t*>(X->DataRaw());
   const auto* Bdata = B != nullptr ? B->template Data<int32_t>() : nullptr;
-  auto* Ydata = Y->template MutableData<uint8_t>();
+  auto* Ydata = static_cast<uint8_t*>(Y->MutableDataRaw());
 
   BufferUniquePtr transpose_input_buffer;
   BufferUniquePtr transpose_output_buffer;
@@ -340,7 +360,13 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
     // the im2col transform.
     auto* col_data = alloc->Alloc(SafeInt<size_t>(sizeof(const uint8_t*)) * kernel_size * output_image_size);
     col_buffer = BufferUniquePtr(col_data, BufferDeleter(alloc));
-    padding_data.resize(static_cast<size_t>(C), X_zero_point_value);
+    padding_data.resize(static_cast<size_t>(C), X_zero_point_value ^ sign_bit);
+
+    // The channels last input can't be converted in place, so use a temporary buffer.
+    if (is_X_signed && channels_last_) {
+      auto* transpose_input = alloc->Alloc(SafeInt<size_t>(sizeof(uint8_t)) * X_offset);
+      transpose_input_buffer = BufferUniquePtr(transpose_input, BufferDeleter(alloc));
+    }
   } else if (kernel_size != 1 || !conv_attrs_.HasStridesOneAndNoPadding()) {
     // Pointwise convolutions can use the original input tensor in place,
     // otherwise a temporary buffer is required for the im2col transform.
@@ -390,6 +416,12 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
       output_data = static_cast<uint8_t*>(transpose_output_buffer.get());
     }
 
+    if (is_depthwise_conv && is_X_signed) {
+      auto* unsigned_input = static_cast<uint8_t*>(transpose_input_buffer.get());
+      FlipSignBit(input_data, unsigned_input, static_cast<size_t>(X_offset));
+      input_data = unsigned_input;
+    }
+
     // Threaded implementation of ND convolution is not yet supported, so
     // prepare all im2col transformations here.
     if (!is_depthwise_conv && col_buffer && kernel_rank > 2) {
@@ -436,7 +468,7 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
             padding_data.data());
         MlasConvDepthwise(
             worker_col_buffer,
-            X_zero_point_value,
+            X_zero_point_value ^ sign_bit,
             reordered_W,
             W_zero_point_value,
             is_W_signed,
@@ -504,6 +536,7 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
           gemm_shape.M = static_cast<size_t>(output_count);
           gemm_shape.N = static_cast<size_t>(group_output_channels);
           gemm_shape.K = static_cast<size_t>(kernel_dim);
+          gemm_shape.AIsSigned = is_X_signed;
           gemm_shape.BIsSigned = is_W_signed;
 
           MLAS_GEMM_U8X8_DATA_PARAMS gemm_params;
@@ -533,6 +566,10 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
           output_scales.data(),
           output_scales.size() > 1,
           Y_zero_point_value);
+
+      if (is_X_signed) {
+        FlipSignBit(worker_requantize_output, worker_requantize_output, static_cast<size_t>(output_count * M));
+      }
     };
 
     concurrency::ThreadPool::TrySimpleParallelFor(thread_pool, thread_count, conv_worker);
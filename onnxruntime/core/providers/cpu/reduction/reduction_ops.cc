@@ -3,6 +3,7 @@
 
 #include "core/providers/cpu/reduction/reduction_ops.h"
 #include "core/providers/common.h"
+#include "core/mlas/inc/mlas.h"
 
 using namespace std;
 namespace onnxruntime {
@@ -355,11 +356,86 @@ void NoTransposePrepareForReduce(const TensorShape& new_input_shape,
   }
 }
 
+// Views the input as [outer, reduce, inner] if the sorted reduced axes are adjacent,
+// which is the layout handled by the MLAS reduction routines.
+static bool GetAdjacentReduceCounts(const TensorShape& new_input_shape, const std::vector<int64_t>& reduced_axes,
+                                    size_t& outer_count, size_t& reduce_count, size_t& inner_count) {
+  const int64_t ndim = static_cast<int64_t>(new_input_shape.NumDimensions());
+  const int64_t first_axis = reduced_axes.empty() ? 0 : reduced_axes.front();
+  const int64_t last_axis = reduced_axes.empty() ? ndim - 1 : reduced_axes.back();
+
+  for (size_t i = 1; i < reduced_axes.size(); ++i) {
+    if (reduced_axes[i] != first_axis + static_cast<int64_t>(i)) {
+      return false;
+    }
+  }
+
+  outer_count = static_cast<size_t>(new_input_shape.SizeToDimension(static_cast<size_t>(first_axis)));
+  reduce_count = static_cast<size_t>(new_input_shape.Slice(static_cast<size_t>(first_axis), static_cast<size_t>(last_axis + 1)).Size());
+  inner_count = static_cast<size_t>(new_input_shape.SizeFromDimension(static_cast<size_t>(last_axis + 1)));
+  return reduce_count > 0;
+}
+
+// Dispatches reductions with an MLAS implementation. Returns false if the
+// caller must use the generic aggregator loops instead.
+template <typename AGG>
+struct MlasReduction {
+  static bool Compute(const Tensor&, Tensor&, size_t, size_t, size_t, concurrency::ThreadPool*) {
+    return false;
+  }
+};
+
+template <MLAS_REDUCTION_KIND ReductionKind>
+struct MlasFloatReduction {
+  static bool Compute(const Tensor& input, Tensor& output, size_t outer_count, size_t reduce_count,
+                      size_t inner_count, concurrency::ThreadPool* tp) {
+    MlasReduce(ReductionKind, input.Data<float>(), output.MutableData<float>(),
+               outer_count, reduce_count, inner_count, tp);
+    return true;
+  }
+};
+
+template <bool SelectLastIndex>
+struct MlasArgMaxReduction {
+  static bool Compute(const Tensor& input, Tensor& output, size_t outer_count, size_t reduce_count,
+                      size_t inner_count, concurrency::ThreadPool* tp) {
+    MlasArgMaximum(input.Data<float>(), output.MutableData<int64_t>(),
+                   outer_count, reduce_count, inner_count, SelectLastIndex, tp);
+    return true;
+  }
+};
+
+template <>
+struct MlasReduction<ReduceAggregatorSum<float>> : MlasFloatReduction<MlasSumReduction> {};
+template <>
+struct MlasReduction<ReduceAggregatorSumSquare<float>> : MlasFloatReduction<MlasSumSquareReduction> {};
+template <>
+struct MlasReduction<ReduceAggregatorMean<float>> : MlasFloatReduction<MlasMeanReduction> {};
+template <>
+struct MlasReduction<ReduceAggregatorMax<float>> : MlasFloatReduction<MlasMaximumReduction> {};
+template <>
+struct MlasReduction<ReduceAggregatorMin<float>> : MlasFloatReduction<MlasMinimumReduction> {};
+template <>
+struct MlasReduction<ReduceAggregatorLogSumExp<float>> : MlasFloatReduction<MlasLogSumExpReduction> {};
+template <>
+struct MlasReduction<ReduceAggregatorArgMax<float>> : MlasArgMaxReduction<false> {};
+template <>
+struct MlasReduction<ReduceAggregatorArgMaxLastIndex<float>> : MlasArgMaxReduction<true> {};
+
 template <typename T, typename AGG>
 void NoTransposeReduce(Tensor* output, const TensorShape& new_input_shape, const Tensor& input,
                        const std::vector<int64_t>& reduced_axes, concurrency::ThreadPool* tp,
                        ResultsNoTransposePrepareForReduce& last_results) {
   auto output_shape = output->Shape();
+
+  size_t outer_count;
+  size_t reduce_count;
+  size_t inner_count;
+  if (GetAdjacentReduceCounts(new_input_shape, reduced_axes, outer_count, reduce_count, inner_count) &&
+      MlasReduction<AGG>::Compute(input, *output, outer_count, reduce_count, inner_count, tp)) {
+    return;
+  }
+
   const T* from_data = input.template Data<T>();
   typename AGG::value_type* to_data = output->template MutableData<typename AGG::value_type>();
   int64_t count = output_shape.Size();
@@ -148,6 +148,10 @@ ONNX_CPU_OPERATOR_KERNEL(
 
 using namespace rnn::detail;
 
+// Largest per step recurrence GEMM (batch_size x 3*hidden_size x hidden_size multiply-adds) for which the
+// directions of a bidirectional GRU are run concurrently instead of splitting each GEMM across threads.
+static constexpr int64_t kConcurrentDirectionsMaxStepComplexity = 256 * 1024;
+
 // internal helper code
 namespace detail {
 
@@ -160,9 +164,10 @@ class UniDirectionalGru {
                     const ActivationFuncs::Entry& activation_func_g, float clip,
                     onnxruntime::concurrency::ThreadPool* ttp);
 
+  // recurrent_weights are R[zrh] if linear_before_reset is set, otherwise R[zr] with Rh in recurrent_weights_H
   void Compute(const gsl::span<const T>& inputs, const gsl::span<const int>& sequence_lengths, int num_directions,
-               const gsl::span<const T>& input_weights, const gsl::span<const T>& recurrent_weights,
-               gsl::span<T>& outputs, gsl::span<T>& final_hidden_state);
+               const GemmWeights<T>& input_weights, const GemmWeights<T>& recurrent_weights,
+               const GemmWeights<T>& recurrent_weights_H, gsl::span<T>& outputs, gsl::span<T>& final_hidden_state);
 
   ~UniDirectionalGru() = default;
 
@@ -236,6 +241,72 @@ class UniDirectionalGru {
 #define DumpMatrix(...) ((void)0)
 #endif
 
+Status DeepCpuGruOp::TryPackWeights(const Tensor& weights, int row_offset, int rows,
+                                    PackedWeights& packed_weights, bool& is_packed) {
+  const auto& shape = weights.Shape();
+  if (shape.NumDimensions() != 3) {
+    return Status::OK();
+  }
+
+  // weights: [num_directions, 3*hidden_size, input_size]
+  // recurrence weights: [num_directions, 3*hidden_size, hidden_size]
+  // rows [row_offset, row_offset + rows) of each direction are packed as the N x K matrix B^T.
+  const size_t N = static_cast<size_t>(rows);
+  const size_t K = static_cast<size_t>(shape[2]);
+
+  if ((shape[0] != num_directions_) || (shape[1] != static_cast<int64_t>(hidden_size_ * 3))) {
+    return Status::OK();
+  }
+
+  const size_t packed_weights_size = MlasGemmPackBSize(N, K);
+  if (packed_weights_size == 0) {
+    return Status::OK();
+  }
+
+  auto alloc = Info().GetAllocator(0, OrtMemTypeDefault);
+  auto* packed_weights_data = alloc->Alloc(SafeInt<size_t>(packed_weights_size) * num_directions_);
+  packed_weights.buffer_ = BufferUniquePtr(packed_weights_data, BufferDeleter(alloc));
+  packed_weights.weights_size_ = packed_weights_size;
+  packed_weights.shape_ = shape;
+
+  const size_t weights_size_per_direction = static_cast<size_t>(shape[1]) * K;
+  const auto* weights_data = weights.Data<float>() + static_cast<size_t>(row_offset) * K;
+  for (int i = 0; i < num_directions_; i++) {
+    MlasGemmPackB(CblasTrans, N, K, weights_data, K, packed_weights_data);
+    packed_weights_data = static_cast<uint8_t*>(packed_weights_data) + packed_weights_size;
+    weights_data += weights_size_per_direction;
+  }
+
+  is_packed = true;
+  return Status::OK();
+}
+
+Status DeepCpuGruOp::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  if (tensor.IsDataType<float>()) {
+    if (input_idx == 1) {
+      return TryPackWeights(tensor, 0, 3 * hidden_size_, packed_W_, is_packed);
+    } else if (input_idx == 2) {
+      if (linear_before_reset_) {
+        return TryPackWeights(tensor, 0, 3 * hidden_size_, packed_R_, is_packed);
+      }
+
+      // R is only released if both R[zr] and Rh were packed
+      ORT_RETURN_IF_ERROR(TryPackWeights(tensor, 0, 2 * hidden_size_, packed_R_, is_packed));
+      if (is_packed) {
+        is_packed = false;
+        ORT_RETURN_IF_ERROR(TryPackWeights(tensor, 2 * hidden_size_, hidden_size_, packed_Rh_, is_packed));
+        if (!is_packed) {
+          packed_R_.buffer_.reset();
+        }
+      }
+    }
+  }
+
+  return Status::OK();
+}
+
 Status DeepCpuGruOp::Compute(OpKernelContext* context) const {
   const Tensor& X = *context->Input<Tensor>(0);  // inputs. [seq_length, batch_size, input_size]
 
@@ -258,8 +329,13 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
   concurrency::ThreadPool* thread_pool = context.GetOperatorThreadPool();
 
   const Tensor& X = *context.Input<Tensor>(0);  // inputs. [seq_length, batch_size, input_size]
-  const Tensor& W = *context.Input<Tensor>(1);  // weights. [num_directions, 3*hidden_size, input_size]
-  const Tensor& R = *context.Input<Tensor>(2);  // recurrence weights. [num_directions, 3*hidden_size, hidden_size]
+  const Tensor* W = packed_W_.buffer_ ? nullptr : context.Input<Tensor>(1);
+  // weights. [num_directions, 3*hidden_size, input_size]
+  const Tensor* R = packed_R_.buffer_ ? nullptr : context.Input<Tensor>(2);
+  // recurrence weights. [num_directions, 3*hidden_size, hidden_size]
+
+  const auto& W_shape = (W != nullptr) ? W->Shape() : packed_W_.shape_;
+  const auto& R_shape = (R != nullptr) ? R->Shape() : packed_R_.shape_;
 
   // optional
   const auto* B = context.Input<Tensor>(3);              // bias. [num_directions, 6*hidden_size]
@@ -272,7 +348,7 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
   int batch_size = gsl::narrow<int>(X_shape[1]);
   int input_size = gsl::narrow<int>(X_shape[2]);
 
-  auto status = ValidateCommonRnnInputs(X, W.Shape(), R.Shape(), B, 3, sequence_lens, initial_h, num_directions_, hidden_size_);
+  auto status = ValidateCommonRnnInputs(X, W_shape, R_shape, B, 3, sequence_lens, initial_h, num_directions_, hidden_size_);
   ORT_RETURN_IF_ERROR(status);
 
   // GRU outputs are optional but must be in the same order
@@ -295,17 +371,20 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
   AllocatorPtr alloc;
   status = context.GetTempSpaceAllocator(&alloc);
   ORT_RETURN_IF_ERROR(status);
-  gsl::span<const T> input_weights = W.DataAsSpan<T>();
-  gsl::span<const T> recurrent_weights = R.DataAsSpan<T>();
+  const T* input_weights = (W != nullptr) ? W->Data<T>() : nullptr;
+  const T* recurrent_weights = (R != nullptr) ? R->Data<T>() : nullptr;
+  // Rh is the last hidden_size rows of R[zrh] for each direction
+  const T* recurrent_weights_H = (R != nullptr) ? recurrent_weights + 2 * hidden_size_ * hidden_size_ : nullptr;
   gsl::span<const T> bias = B != nullptr ? B->DataAsSpan<T>() : gsl::span<const T>();
 
-  // spans for first direction
+  // weights for first direction
   const size_t input_weights_size_per_direction = 3 * hidden_size_ * input_size;
   const size_t recurrent_weights_size_per_direction = 3 * hidden_size_ * hidden_size_;
   const size_t bias_size_per_direction = 6 * hidden_size_;
 
-  gsl::span<const T> input_weights_1 = input_weights.subspan(0, input_weights_size_per_direction);
-  gsl::span<const T> recurrent_weights_1 = recurrent_weights.subspan(0, recurrent_weights_size_per_direction);
+  GemmWeights<T> input_weights_1(0, input_weights, input_weights_size_per_direction, packed_W_);
+  GemmWeights<T> recurrent_weights_1(0, recurrent_weights, recurrent_weights_size_per_direction, packed_R_);
+  GemmWeights<T> recurrent_weights_H_1(0, recurrent_weights_H, recurrent_weights_size_per_direction, packed_Rh_);
   gsl::span<const T> bias_1 = bias.empty() ? bias : bias.subspan(0, bias_size_per_direction);
 
   gsl::span<const T> input = X.DataAsSpan<T>();
@@ -339,11 +418,11 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
   gsl::span<T> hidden_output_1 = hidden_output.subspan(0, hidden_output_size_per_direction);
 
   if (direction_ == Direction::kBidirectional) {
-    // spans for second direction
-    gsl::span<const T> input_weights_2 = input_weights.subspan(input_weights_size_per_direction,
-                                                               input_weights_size_per_direction);
-    gsl::span<const T> recurrent_weights_2 = recurrent_weights.subspan(recurrent_weights_size_per_direction,
-                                                                       recurrent_weights_size_per_direction);
+    // weights and spans for second direction
+    GemmWeights<T> input_weights_2(1, input_weights, input_weights_size_per_direction, packed_W_);
+    GemmWeights<T> recurrent_weights_2(1, recurrent_weights, recurrent_weights_size_per_direction, packed_R_);
+    GemmWeights<T> recurrent_weights_H_2(1, recurrent_weights_H, recurrent_weights_size_per_direction,
+                                         packed_Rh_);
     gsl::span<const T> bias_2 = bias.empty() ? bias : bias.subspan(bias_size_per_direction, bias_size_per_direction);
 
     gsl::span<const T> initial_hidden_2 = initial_hidden.empty()
@@ -357,21 +436,43 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
     gsl::span<T> hidden_output_2 = hidden_output.subspan(hidden_output_size_per_direction,
                                                          hidden_output_size_per_direction);
 
+    // The two directions are independent and write to disjoint elements of Y and Y_h. Each time step is a chain
+    // of small GEMMs, so if those are too small to be split across more than a couple of threads it is faster to
+    // run the directions concurrently with single threaded GEMMs. The thread pool does not support nested
+    // parallelism, so the directions cannot use it themselves in that case.
+    const bool concurrent_directions =
+        concurrency::ThreadPool::DegreeOfParallelism(thread_pool) > 1 &&
+        static_cast<int64_t>(batch_size) * 3 * hidden_size_ * hidden_size_ <= kConcurrentDirectionsMaxStepComplexity;
+    concurrency::ThreadPool* direction_thread_pool = concurrent_directions ? nullptr : thread_pool;
+
     detail::UniDirectionalGru<T> fw(alloc, seq_length, batch_size, input_size, hidden_size_,
                                     linear_before_reset_, Direction::kForward, bias_1, initial_hidden_1,
                                     activation_funcs_.Entries()[0],
                                     activation_funcs_.Entries()[1],
-                                    clip_, thread_pool);
-    fw.Compute(input, sequence_lens_span, num_directions_, input_weights_1, recurrent_weights_1,
-               output_1, hidden_output_1);
+                                    clip_, direction_thread_pool);
 
     detail::UniDirectionalGru<T> bw(alloc, seq_length, batch_size, input_size, hidden_size_,
                                     linear_before_reset_, Direction::kReverse, bias_2, initial_hidden_2,
                                     activation_funcs_.Entries()[2],
                                     activation_funcs_.Entries()[3],
-                                    clip_, thread_pool);
-    bw.Compute(input, sequence_lens_span, num_directions_, input_weights_2, recurrent_weights_2,
-               output_2, hidden_output_2);
+                                    clip_, direction_thread_pool);
+
+    auto compute_direction = [&](std::ptrdiff_t direction) {
+      if (direction == 0) {
+        fw.Compute(input, sequence_lens_span, num_directions_, input_weights_1, recurrent_weights_1,
+                   recurrent_weights_H_1, output_1, hidden_output_1);
+      } else {
+        bw.Compute(input, sequence_lens_span, num_directions_, input_weights_2, recurrent_weights_2,
+                   recurrent_weights_H_2, output_2, hidden_output_2);
+      }
+    };
+
+    if (concurrent_directions) {
+      concurrency::ThreadPool::TrySimpleParallelFor(thread_pool, 2, compute_direction);
+    } else {
+      compute_direction(0);
+      compute_direction(1);
+    }
   } else {
     detail::UniDirectionalGru<T> gru_p(alloc, seq_length, batch_size, input_size, hidden_size_,
                                        linear_before_reset_, direction_, bias_1, initial_hidden_1,
@@ -379,7 +480,7 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
                                        activation_funcs_.Entries()[1],
                                        clip_, thread_pool);
     gru_p.Compute(input, sequence_lens_span, num_directions_, input_weights_1, recurrent_weights_1,
-                  output_1, hidden_output_1);
+                  recurrent_weights_H_1, output_1, hidden_output_1);
   }
 
   if (!output.empty())
@@ -478,8 +579,9 @@ template <typename T>
 void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
                                    const gsl::span<const int>& sequence_lengths_arg,
                                    const int num_directions,
-                                   const gsl::span<const T>& input_weights,
-                                   const gsl::span<const T>& recurrent_weights,
+                                   const GemmWeights<T>& input_weights,
+                                   const GemmWeights<T>& recurrent_weights,
+                                   const GemmWeights<T>& recurrent_weights_H,
                                    gsl::span<T>& outputs,
                                    gsl::span<T>& final_hidden_state) {
   using span_T_const_iter = typename gsl::span<T>::const_iterator;
@@ -496,11 +598,6 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
   }
 
   DumpMatrix("Inputs", inputs.data(), seq_length_ * batch_size_, input_size_);
-  DumpMatrix("input_weights", input_weights.data(), 3 * hidden_size_, input_size_);
-  DumpMatrix("recurrent_weights", recurrent_weights.data(), 3 * hidden_size_, hidden_size_);
-
-  gsl::span<const T> recurrent_weightsZR = recurrent_weights.subspan(0, 2 * hidden_size_ * hidden_size_);
-  gsl::span<const T> recurrent_weightsH = recurrent_weights.subspan(2 * hidden_size_ * hidden_size_, hidden_size_ * hidden_size_);
 
   gsl::span<T> original_outputs = outputs;
   const bool output_sequence = !outputs.empty();
@@ -529,12 +626,10 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
 
   // apply weights to all the inputs
   ComputeGemm(total_rows, hidden_size_x3, input_size_, alpha,
-              inputs.cbegin(), inputs.cend(),
-              input_size_,
-              input_weights.cbegin(), input_weights.cend(),
-              input_size_, 0.f,
-              outputZRH_.begin(), outputZRH_.end(),
-              hidden_size_x3, ttp_);
+              inputs.data(), inputs.data() + inputs.size(),
+              input_weights, 0.f,
+              outputZRH_.data(), outputZRH_.data() + outputZRH_.size(),
+              hidden_size_x3, allocator_, ttp_);
 
   DumpMatrix("inputs with weights applied", outputZRH_.data(), seq_length_ * batch_size_ * 3, hidden_size_);
 
@@ -596,39 +691,44 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
 
       out_added_offset = (step * batch_size_) * hidden_size_x3;
 
-      // calculate Ht-1*R[zr], and add to the weighted inputs that are in outputZRH_
-      // Ht-1 * R[zr] + Xt*(W[zr]^T)
-      ComputeGemm(batch_size_, hidden_size_x2, hidden_size_, alpha,
-                  prev_Ht, prev_Ht_end,
-                  hidden_size_,
-                  recurrent_weightsZR.cbegin(), recurrent_weightsZR.cend(),
-                  hidden_size_, 1.f,  // beta == 1 so we add existing values in outputZRH_
-                  outputZRH_.begin() + out_added_offset, outputZRH_.end(),
-                  hidden_size_x3, ttp_);
-
-      DumpMatrix("Ht-1 * R[zr] + Xt*(W[zr]^T)" + seqno_str,
-                 outputZRH_.data() + out_added_offset, batch_size_, hidden_size_x2, 0, hidden_size_x3);
-
       if (linear_before_reset_) {
-        // copy Rbh to linear output
-        if (use_bias_) {
-          gsl::copy(batched_bias_Rh_.subspan(batched_bias_Rh_local - batched_bias_Rh_.begin(),
-                                             batched_bias_Rh_local_end - batched_bias_Rh_local),
-                    linear_output_);
+        // Ht-1 * R[zr] and Ht-1 * (Rh^T) + Rbh are computed with a single GEMM over all 3 gates. Move Xt*(Wh^T)
+        // out of outputZRH_ to linear_output_ and replace it with Rbh so the GEMM can accumulate into it.
+        for (int r = 0; r < batch_size_; r++) {
+          T* p_h = SafeRawPointer<T>(outputZRH_, out_added_offset + r * hidden_size_x3 + hidden_size_x2,
+                                     hidden_size_);
+          T* p_linear_output = SafeRawPointer<T>(linear_output_, r * hidden_size_, hidden_size_);
+          std::copy_n(p_h, hidden_size_, p_linear_output);
+
+          if (use_bias_) {
+            const T* p_bias_Rh = SafeRawConstPointer<T>(batched_bias_Rh_local + r * hidden_size_,
+                                                        batched_bias_Rh_local_end, hidden_size_);
+            std::copy_n(p_bias_Rh, hidden_size_, p_h);
+          } else {
+            std::fill_n(p_h, hidden_size_, T{});
+          }
         }
 
-        // compute Ht-1 * (Rh^T) + Rbh
-        ComputeGemm(batch_size_, hidden_size_, hidden_size_, alpha,
-                    prev_Ht, prev_Ht_end,  // Ht-1
-                    hidden_size_,
-                    recurrent_weightsH.cbegin(), recurrent_weightsH.cend(),  // Rh^T
-                    hidden_size_,
-                    use_bias_ ? 1.f : 0.f,  // don't add values in linear_output_ if no bias input
-                    linear_output_.begin(),
-                    linear_output_.end(),  // pre: Rbh if use_bias_, post:output
-                    hidden_size_, ttp_);
-
-        DumpMatrix("Ht-1 * (Rh^T) + Rbh " + seqno_str, linear_output_.data(), batch_size_, hidden_size_);
+        // calculate Ht-1*R[zrh], and add to Xt*(W[zr]^T) and Rbh that are in outputZRH_
+        ComputeGemm(batch_size_, hidden_size_x3, hidden_size_, alpha,
+                    &*prev_Ht, &*prev_Ht + (prev_Ht_end - prev_Ht),
+                    recurrent_weights, 1.f,  // beta == 1 so we add existing values in outputZRH_
+                    outputZRH_.data() + out_added_offset, outputZRH_.data() + outputZRH_.size(),
+                    hidden_size_x3, allocator_, ttp_);
+
+        DumpMatrix("Ht-1 * R[zrh] + [Xt*(W[zr]^T), Rbh]" + seqno_str,
+                   outputZRH_.data() + out_added_offset, batch_size_, hidden_size_x3);
+      } else {
+        // calculate Ht-1*R[zr], and add to the weighted inputs that are in outputZRH_
+        // Ht-1 * R[zr] + Xt*(W[zr]^T)
+        ComputeGemm(batch_size_, hidden_size_x2, hidden_size_, alpha,
+                    &*prev_Ht, &*prev_Ht + (prev_Ht_end - prev_Ht),
+                    recurrent_weights, 1.f,  // beta == 1 so we add existing values in outputZRH_
+                    outputZRH_.data() + out_added_offset, outputZRH_.data() + outputZRH_.size(),
+                    hidden_size_x3, allocator_, ttp_);
+
+        DumpMatrix("Ht-1 * R[zr] + Xt*(W[zr]^T)" + seqno_str,
+                   outputZRH_.data() + out_added_offset, batch_size_, hidden_size_x2, 0, hidden_size_x3);
       }
 
       // 1st Set Of Activations
@@ -644,13 +744,14 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
         clip_with_bias_ptr_(clip_, p_bias_r, p_rt, hidden_size_);
 
         if (linear_before_reset_) {
-          // p_linear_output = Ht-1 * (Rh^T) + Rbh
-          T* p_linear_output = SafeRawPointer<T>(linear_output_, r * hidden_size_, hidden_size_);
+          // p_linear_Rh = Ht-1 * (Rh^T) + Rbh
+          const T* p_linear_Rh = SafeRawPointer<T>(outputZRH_, out_added_offset + r * hidden_size_x3 + hidden_size_x2,
+                                                   hidden_size_);
           T* p_cur_h = SafeRawPointer<T>(cur_h_local + r * hidden_size_, cur_h_local_end, hidden_size_);
 
           // calculate rt in-place [p_rt = f(p_rt)]
-          // calculate rt (.) (Ht-1 * (Rh^T) + Rbh) using p_linear_output. write to p_cur_h
-          reset_gate_(p_linear_output, p_rt, p_cur_h, hidden_size_, zr_alpha_, zr_beta_);
+          // calculate rt (.) (Ht-1 * (Rh^T) + Rbh) using p_linear_Rh. write to p_cur_h
+          reset_gate_(p_linear_Rh, p_rt, p_cur_h, hidden_size_, zr_alpha_, zr_beta_);
 
         } else {
           const T* p_prev_Ht = SafeRawConstPointer<T>(prev_Ht + r * hidden_size_, prev_Ht_end, hidden_size_);
@@ -670,15 +771,17 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
       if (linear_before_reset_) {
         // input contains rt (.) (Ht-1*(Rh^T) + Rbh)
         auto input = cur_h_local;
-        // out_H currently contains Xt*(W[zrh]^T).
+        // linear_output_ contains Xt*(Wh^T)
+        auto linear_output = linear_output_.cbegin();
         auto out_H = outputZRH_.begin() + out_added_offset;
 
         for (int r = 0; r < batch_size_; r++) {
           // skip over the inputs with Z and R weights
           out_H += hidden_size_x2;
           for (int h = 0; h < hidden_size_; ++h) {
-            *out_H += *input;
+            *out_H = *linear_output + *input;
             ++out_H;
+            ++linear_output;
             ++input;
           }
         }
@@ -692,12 +795,10 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
 
         // Calculate Xt*(Wh^T) + rt (.) Ht-1 * Rh
         ComputeGemm(batch_size_, hidden_size_, hidden_size_, alpha,
-                    cur_h_local, cur_h_local_end,  // rt (.) Ht-1
-                    hidden_size_,
-                    recurrent_weightsH.cbegin(), recurrent_weightsH.cend(),  // Rh^T
-                    hidden_size_, 1.f,                                       // beta == 1 to add Xt*(Wh^T) from out_H
-                    out_H, outputZRH_.end(),
-                    hidden_size_x3, ttp_);
+                    cur_h_.data(), cur_h_.data() + cur_h_.size(),  // rt (.) Ht-1
+                    recurrent_weights_H, 1.f,                        // Rh^T. beta == 1 to add Xt*(Wh^T) from out_H
+                    &*out_H, outputZRH_.data() + outputZRH_.size(),
+                    hidden_size_x3, allocator_, ttp_);
       }
 
       DumpMatrix("Xt*(Wh^T) + (" + label + ")" + seqno_str, outputZRH_.data() + out_added_offset,
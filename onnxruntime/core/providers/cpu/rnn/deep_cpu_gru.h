@@ -51,6 +51,7 @@ class DeepCpuGruOp final : public OpKernel {
                                                      activation_func_betas);
   }
 
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
   Status Compute(OpKernelContext* context) const override;
 
   ~DeepCpuGruOp() override = default;
@@ -65,6 +66,15 @@ class DeepCpuGruOp final : public OpKernel {
 
   rnn::detail::ActivationFuncs activation_funcs_;
 
+  // W[zrh] for all gates. R[zrh] for all gates if linear_before_reset_ is set as the recurrence is then
+  // computed with a single GEMM, otherwise R[zr] with Rh packed separately as it is applied after the reset gate.
+  rnn::detail::PackedWeights packed_W_;
+  rnn::detail::PackedWeights packed_R_;
+  rnn::detail::PackedWeights packed_Rh_;
+
+  Status TryPackWeights(const Tensor& weights, int row_offset, int rows,
+                        rnn::detail::PackedWeights& packed_weights, bool& is_packed);
+
   template <typename T>
   Status ComputeImpl(OpKernelContext& context) const;
 };
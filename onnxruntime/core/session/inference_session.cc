@@ -13,6 +13,7 @@
 
 #include "core/common/denormal.h"
 #include "core/common/logging/logging.h"
+#include "core/common/parse_string.h"
 #include "core/framework/allocatormgr.h"
 #include "core/framework/error_code_helper.h"
 #include "core/framework/execution_frame.h"
@@ -289,6 +290,24 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
     StartProfiling(session_options_.profile_file_prefix);
   }
 
+  {
+    uint32_t sample_rate = 0;
+    size_t sample_buffer_size = 0;
+    ORT_ENFORCE(TryParseStringWithClassicLocale(
+                    session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigProfilingSampleRate, "0"),
+                    sample_rate),
+                "Invalid value for ", kOrtSessionOptionsConfigProfilingSampleRate);
+    ORT_ENFORCE(TryParseStringWithClassicLocale(
+                    session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigProfilingSampleBufferSize, "4096"),
+                    sample_buffer_size) &&
+                    sample_buffer_size > 0,
+                "Invalid value for ", kOrtSessionOptionsConfigProfilingSampleBufferSize);
+    if (sample_rate > 0) {
+      sampling_profiler_.Enable(sample_rate, sample_buffer_size);
+      LOGS(*session_logger_, INFO) << "Sampling profiler enabled for 1 in every " << sample_rate << " runs";
+    }
+  }
+
   telemetry_ = {};
   // a monotonically increasing session id for use in telemetry
   session_id_ = global_session_id_.fetch_add(1);
@@ -582,10 +601,8 @@ common::Status InferenceSession::SaveToOrtFormat(const std::basic_string<ORTCHAR
 common::Status InferenceSession::Load(std::function<common::Status(std::shared_ptr<Model>&)> loader,
                                       const std::string& event_name) {
   Status status = Status::OK();
-  TimePoint tp;
-  if (session_profiler_.IsEnabled()) {
-    tp = session_profiler_.Now();
-  }
+  // the initialization phases are recorded whether or not profiling is enabled
+  const TimePoint tp = std::chrono::high_resolution_clock::now();
   ORT_TRY {
     std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
     if (is_model_loaded_) {  // already loaded
@@ -617,9 +634,7 @@ common::Status InferenceSession::Load(std::function<common::Status(std::shared_p
     status = Status(common::ONNXRUNTIME, common::RUNTIME_EXCEPTION, "Encountered unknown exception in Load()");
   }
 
-  if (session_profiler_.IsEnabled()) {
-    session_profiler_.EndTimeAndRecordEvent(profiling::SESSION_EVENT, event_name, tp);
-  }
+  session_profiler_.RecordInitializationPhase(event_name, tp);
 
   return status;
 }
@@ -858,7 +873,7 @@ common::Status InferenceSession::TransformGraph(onnxruntime::Graph& graph,
 
   // first apply global(execution provider independent),  level 1(default/system/basic) graph to graph optimizations
   ORT_RETURN_IF_ERROR_SESSIONID_(
-      graph_transformer_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *session_logger_));
+      graph_transformer_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *session_logger_, &session_profiler_));
 
 #ifdef USE_DML
   // TODO: this is a temporary workaround to apply the DML EP's custom graph transformer prior to partitioning. This
@@ -886,19 +901,24 @@ common::Status InferenceSession::TransformGraph(onnxruntime::Graph& graph,
 
   // Do partitioning based on execution providers' capability.
   GraphPartitioner partitioner(kernel_registry_manager, providers);
+  TimePoint tp = std::chrono::high_resolution_clock::now();
   ORT_RETURN_IF_ERROR_SESSIONID_(partitioner.Partition(graph, session_state.ExportDll(),
                                                        session_state.GetMutableFuncMgr(), mode));
+  session_profiler_.RecordInitializationPhase("graph_partitioning", tp);
 
   // apply transformers except default transformers
   // Default transformers are required for correctness and they are owned and run by inference session
   for (int i = static_cast<int>(TransformerLevel::Level1); i <= static_cast<int>(TransformerLevel::MaxLevel); i++) {
     ORT_RETURN_IF_ERROR_SESSIONID_(
-        graph_transformer_mgr.ApplyTransformers(graph, static_cast<TransformerLevel>(i), *session_logger_));
+        graph_transformer_mgr.ApplyTransformers(graph, static_cast<TransformerLevel>(i), *session_logger_,
+                                                &session_profiler_));
   }
 
   bool modified = false;
   // Insert cast node/s.
+  tp = std::chrono::high_resolution_clock::now();
   ORT_RETURN_IF_ERROR_SESSIONID_(insert_cast_transformer.Apply(graph, modified, *session_logger_));
+  session_profiler_.RecordInitializationPhase(insert_cast_transformer.Name(), tp);
 
   // Now every node should be already assigned to an execution provider
   std::unordered_map<std::string, std::vector<std::string>> node_placements;
@@ -946,7 +966,9 @@ common::Status InferenceSession::TransformGraph(onnxruntime::Graph& graph,
 
   // Insert copy node/s.
   MemcpyTransformer copy_transformer{provider_types, kernel_registry_manager};
+  tp = std::chrono::high_resolution_clock::now();
   ORT_RETURN_IF_ERROR_SESSIONID_(copy_transformer.Apply(graph, modified, *session_logger_));
+  session_profiler_.RecordInitializationPhase(copy_transformer.Name(), tp);
 
   return common::Status::OK();
 }
@@ -1136,10 +1158,7 @@ static bool ModelHasFP16Inputs(const Graph& graph) {
 
 common::Status InferenceSession::Initialize() {
   Status status = Status::OK();
-  TimePoint tp;
-  if (session_profiler_.IsEnabled()) {
-    tp = session_profiler_.Now();
-  }
+  const TimePoint tp = std::chrono::high_resolution_clock::now();
 
   ORT_TRY {
     LOGS(*session_logger_, INFO) << "Initializing session.";
@@ -1249,7 +1268,9 @@ common::Status InferenceSession::Initialize() {
                                                     saving_ort_format));
 
       // now that all the transforms are done, call Resolve on the main graph. this will recurse into the subgraphs.
+      const TimePoint resolve_tp = std::chrono::high_resolution_clock::now();
       ORT_RETURN_IF_ERROR_SESSIONID_(graph.Resolve());
+      session_profiler_.RecordInitializationPhase("graph_resolve", resolve_tp);
 
       // Update temporary copies of metadata, input- and output definitions to the same state as the resolved graph
       ORT_RETURN_IF_ERROR_SESSIONID_(SaveModelMetadata(*model_));
@@ -1262,8 +1283,10 @@ common::Status InferenceSession::Initialize() {
       //
       // We always have the CPU EP, so only need to run this if some other EP is enabled
       if (execution_providers_.NumProviders() > 1) {
+        const TimePoint partition_tp = std::chrono::high_resolution_clock::now();
         ORT_RETURN_IF_ERROR_SESSIONID_(PartitionOrtFormatModel(graph, execution_providers_, kernel_registry_manager_,
                                                                *session_state_));
+        session_profiler_.RecordInitializationPhase("graph_partitioning", partition_tp);
       }
 #endif
     }
@@ -1338,9 +1361,7 @@ common::Status InferenceSession::Initialize() {
     LOGS(*session_logger_, ERROR) << status.ErrorMessage();
   }
 
-  if (session_profiler_.IsEnabled()) {
-    session_profiler_.EndTimeAndRecordEvent(profiling::SESSION_EVENT, "session_initialization", tp);
-  }
+  session_profiler_.RecordInitializationPhase("session_initialization", tp);
 
   if (status.IsOK()) {
     for (auto& xp : execution_providers_) {
@@ -1650,6 +1671,16 @@ Status InferenceSession::Run(const RunOptions& run_options,
 
     ++current_num_runs_;
 
+    // record per-kernel statistics if the sampling profiler selects this run
+    profiling::SamplingProfiler::RunScope sampled_run_scope(sampling_profiler_);
+
+    // apply the run's intra-op thread budget and priority to the parallel loops of its kernels
+    concurrency::ThreadPool::RunSettings run_settings;
+    run_settings.max_degree_of_parallelism = run_options.max_degree_of_parallelism;
+    run_settings.priority = run_options.priority == ORT_RUN_PRIORITY_HIGH ? concurrency::ThreadPool::Priority::High
+                                                                          : concurrency::ThreadPool::Priority::Normal;
+    concurrency::ThreadPool::ScopedRunSettings run_settings_scope(run_settings);
+
     // scope of owned_run_logger is just the call to Execute.
     // If Execute ever becomes async we need a different approach
     std::unique_ptr<logging::Logger> owned_run_logger;
@@ -1862,6 +1893,61 @@ const profiling::Profiler& InferenceSession::GetProfiling() const {
   return session_profiler_;
 }
 
+std::string InferenceSession::GetInitializationTimings() const {
+  const auto phases = session_profiler_.GetInitializationPhases();
+
+  std::ostringstream ss;
+  ss << "[";
+  for (size_t i = 0; i < phases.size(); ++i) {
+    if (i > 0) {
+      ss << ", ";
+    }
+    ss << "{\"name\" : \"" << profiling::EscapeJsonString(phases[i].name) << "\"";
+    if (!phases[i].graph.empty()) {
+      ss << ", \"graph\" : \"" << profiling::EscapeJsonString(phases[i].graph) << "\"";
+    }
+    ss << ", \"dur\" : " << phases[i].duration_us << "}";
+  }
+  ss << "]";
+  return ss.str();
+}
+
+std::string InferenceSession::GetProfilingSnapshot() {
+  if (!sampling_profiler_.IsEnabled()) {
+    LOGS(*session_logger_, VERBOSE) << "Sampling profiler is disabled.";
+    return std::string();
+  }
+
+  const auto snapshot = sampling_profiler_.GetSnapshot();
+
+  std::ostringstream ss;
+  ss << "{\"total_runs\" : " << snapshot.total_runs
+     << ", \"sampled_runs\" : " << snapshot.sampled_runs
+     << ", \"dropped_events\" : " << snapshot.dropped_events
+     << ", \"kernels\" : [";
+  for (size_t i = 0; i < snapshot.kernels.size(); ++i) {
+    const auto& stats = snapshot.kernels[i];
+    // the keys recorded by the executors are the kernels owned by the session state (or its subgraphs), which
+    // live as long as the session.
+    const auto& node = static_cast<const OpKernel*>(stats.kernel)->Node();
+    if (i > 0) {
+      ss << ", ";
+    }
+    ss << "{\"name\" : \"" << profiling::EscapeJsonString(node.Name()) << "\""
+       << ", \"op_type\" : \"" << profiling::EscapeJsonString(node.OpType()) << "\""
+       << ", \"provider\" : \"" << profiling::EscapeJsonString(node.GetExecutionProviderType()) << "\""
+       << ", \"count\" : " << stats.count
+       << ", \"mean_us\" : " << (stats.count > 0 ? stats.total_ns / stats.count / 1000.0 : 0.0)
+       << ", \"p50_us\" : " << stats.p50_ns / 1000.0
+       << ", \"p99_us\" : " << stats.p99_ns / 1000.0
+       << ", \"max_us\" : " << stats.max_ns / 1000.0
+       << ", \"mean_output_bytes\" : " << (stats.count > 0 ? stats.total_output_bytes / stats.count : 0)
+       << "}";
+  }
+  ss << "]}";
+  return ss.str();
+}
+
 AllocatorPtr InferenceSession::GetAllocator(const OrtMemoryInfo& mem_info) const {
   return session_state_->GetAllocator(mem_info);
 }
@@ -2007,7 +2093,8 @@ void InferenceSession::AddPredefinedTransformers(GraphTransformerManager& transf
     if (graph_optimization_level >= level) {
       // Generate and register transformers for level
       auto transformers_to_register = optimizer_utils::GenerateTransformers(level, session_options_, cpu_ep,
-                                                                            optimizers_to_disable_);
+                                                                            optimizers_to_disable_,
+                                                                            GetIntraOpThreadPoolToUse());
       for (auto& entry : transformers_to_register) {
         transformer_manager.Register(std::move(entry), level);
       }
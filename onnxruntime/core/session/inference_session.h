@@ -9,6 +9,7 @@
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
 #include "core/common/profiler.h"
+#include "core/common/sampling_profiler.h"
 #include "core/common/status.h"
 #include "core/framework/execution_providers.h"
 #include "core/framework/framework_common.h"
@@ -406,6 +407,20 @@ class InferenceSession {
     */
   const profiling::Profiler& GetProfiling() const;
 
+  /**
+    * Drain the sampling profiler and return the per-kernel statistics aggregated over the sampled runs as JSON.
+    * The sampling profiler is enabled with the session.profiling.sample_rate session config key.
+    @return the snapshot, or an empty string if the sampling profiler is disabled.
+    */
+  std::string GetProfilingSnapshot();
+
+  /**
+    * Return the duration of each phase of the session initialization as a JSON array, in the order the phases were
+    * recorded, e.g. model loading, each graph transformer, graph partitioning and kernel creation.
+    * The phases are recorded whether or not profiling is enabled.
+    */
+  std::string GetInitializationTimings() const;
+
   /**
     * Search registered execution providers for an allocator that has characteristics
     * specified within mem_info
@@ -589,6 +604,9 @@ class InferenceSession {
   // Profiler for this session.
   profiling::Profiler session_profiler_;
 
+  // Sampling profiler for this session. Only records the runs it selects.
+  profiling::SamplingProfiler sampling_profiler_;
+
   // Immutable state for each op in the model. Shared by all executors.
   // It has a dependency on execution_providers_.
   std::unique_ptr<SessionState> session_state_;
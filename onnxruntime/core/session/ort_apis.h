@@ -263,4 +263,13 @@ ORT_API_STATUS_IMPL(SetCurrentGpuDeviceId, _In_ int device_id);
 ORT_API_STATUS_IMPL(GetCurrentGpuDeviceId, _In_ int* device_id);
 ORT_API_STATUS_IMPL(KernelInfoGetAttributeArray_float, _In_ const OrtKernelInfo* info, _In_ const char* name, _Out_ float* out, _Inout_ size_t* size);
 ORT_API_STATUS_IMPL(KernelInfoGetAttributeArray_int64, _In_ const OrtKernelInfo* info, _In_ const char* name, _Out_ int64_t* out, _Inout_ size_t* size);
+ORT_API_STATUS_IMPL(SessionGetProfilingSnapshot, _In_ OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
+
+ORT_API_STATUS_IMPL(RunOptionsSetMaxDegreeOfParallelism, _Inout_ OrtRunOptions* options, int value);
+ORT_API_STATUS_IMPL(RunOptionsGetMaxDegreeOfParallelism, _In_ const OrtRunOptions* options, _Out_ int* out);
+ORT_API_STATUS_IMPL(RunOptionsSetPriority, _Inout_ OrtRunOptions* options, OrtRunPriority priority);
+ORT_API_STATUS_IMPL(RunOptionsGetPriority, _In_ const OrtRunOptions* options, _Out_ OrtRunPriority* out);
+ORT_API_STATUS_IMPL(SessionGetInitializationTimings, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
 }  // namespace OrtApis
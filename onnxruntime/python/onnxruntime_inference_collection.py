@@ -197,6 +197,30 @@ class Session:
             else:
                 raise
 
+    def run_many(self, output_names, input_feeds, run_options=None, max_concurrency=1):
+        """
+        Compute the predictions for a list of feeds. The GIL is released once for all the runs.
+
+        :param output_names: name of the outputs
+        :param input_feeds: list of dictionaries ``{ input_name: input_value }``
+        :param run_options: See :class:`onnxruntime.RunOptions`.
+        :param max_concurrency: maximum number of runs executed in parallel
+
+        ::
+
+            sess.run_many([output_name], [{input_name: x0}, {input_name: x1}])
+        """
+        num_required_inputs = len(self._inputs_meta)
+        for input_feed in input_feeds:
+            num_inputs = len(input_feed)
+            # the graph may have optional inputs used to override initializers. allow for that.
+            if num_inputs < num_required_inputs:
+                raise ValueError("Model requires {} inputs. Input Feed contains {}".format(num_required_inputs,
+                                                                                          num_inputs))
+        if not output_names:
+            output_names = [output.name for output in self._outputs_meta]
+        return self._sess.run_many(output_names, input_feeds, run_options, max_concurrency)
+
     def end_profiling(self):
         """
         End profiling and return results in a file.
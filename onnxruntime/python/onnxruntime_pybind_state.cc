@@ -228,7 +228,9 @@ constexpr const char* kExecutionProviderSharedLibraryPath = "shared_lib_path";
 #pragma warning(disable : 4267 4996 4503 4003)
 #endif  // _MSC_VER
 
+#include <atomic>
 #include <iterator>
+#include <thread>
 
 #if defined(_MSC_VER)
 #pragma warning(disable : 4267 4996 4503 4003)
@@ -442,6 +444,71 @@ static void AddTensorAsPyObj(const OrtValue& val, std::vector<py::object>& pyobj
   pyobjs.push_back(obj);
 }
 
+// Returns a numpy array viewing the buffer of a CPU tensor output. The array holds a reference to the OrtValue, so the
+// buffer lives as long as the array. Falls back to a copy for tensors on other devices, string tensors and tensors
+// that do not own their buffer, e.g. outputs aliasing a feed, or initializers that are shared with the session.
+static void AddTensorAsPyObjNoCopy(const OrtValue& val, const SessionState& session_state,
+                                   const std::string& output_name, std::vector<py::object>& pyobjs) {
+  const Tensor& rtensor = val.Get<Tensor>();
+  int ort_value_idx;
+  if (rtensor.Location().device.Type() != OrtDevice::CPU || rtensor.IsDataTypeString() || !rtensor.OwnsBuffer() ||
+      (session_state.GetOrtValueNameIdxMap().GetIdx(output_name, ort_value_idx).IsOK() &&
+       session_state.GetInitializedTensors().count(ort_value_idx) != 0)) {
+    AddTensorAsPyObj(val, pyobjs, nullptr, nullptr);
+    return;
+  }
+
+  std::vector<npy_intp> npy_dims;
+  const TensorShape& shape = rtensor.Shape();
+  for (size_t n = 0; n < shape.NumDimensions(); ++n) {
+    npy_dims.push_back(shape[n]);
+  }
+
+  py::capsule owner(new OrtValue(val), [](void* p) { delete static_cast<OrtValue*>(p); });
+  auto obj = py::reinterpret_steal<py::object>(PyArray_SimpleNewFromData(
+      static_cast<int>(shape.NumDimensions()), npy_dims.data(), OnnxRuntimeTensorToNumpyType(rtensor.DataType()),
+      const_cast<void*>(rtensor.DataRaw())));
+  if (!obj) {
+    throw py::error_already_set();
+  }
+  // PyArray_SetBaseObject steals the reference to the owner
+  if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(obj.ptr()), owner.release().ptr()) != 0) {
+    throw py::error_already_set();
+  }
+  pyobjs.push_back(obj);
+}
+
+static void CreateFeeds(PyInferenceSession* sess, const std::map<std::string, py::object>& pyfeeds,
+                        NameMLValMap& feeds) {
+  auto px = sess->GetSessionHandle()->GetModelInputs();
+  if (!px.first.IsOK() || !px.second) {
+    throw std::runtime_error("Either failed to get model inputs from the session object or the input def list was null");
+  }
+  for (const auto& _ : pyfeeds) {
+    OrtValue ml_value;
+    CreateGenericMLValue(px.second, GetAllocator(), _.first, _.second, &ml_value);
+    ThrowIfPyErrOccured();
+    feeds.insert(std::make_pair(_.first, ml_value));
+  }
+}
+
+static std::vector<py::object> GetPyObjsFromFetches(PyInferenceSession* sess,
+                                                    const std::vector<std::string>& output_names,
+                                                    const std::vector<OrtValue>& fetches) {
+  const SessionState& session_state = sess->GetSessionHandle()->GetSessionState();
+  std::vector<py::object> rfetch;
+  rfetch.reserve(fetches.size());
+  for (size_t i = 0, end = fetches.size(); i < end; ++i) {
+    const auto& _ = fetches[i];
+    if (_.IsTensor()) {
+      AddTensorAsPyObjNoCopy(_, session_state, output_names[i], rfetch);
+    } else {
+      AddNonTensorAsPyObj(_, rfetch, nullptr, nullptr);
+    }
+  }
+  return rfetch;
+}
+
 static inline void RegisterExecutionProvider(InferenceSession* sess, onnxruntime::IExecutionProviderFactory& f) {
   auto p = f.CreateProvider();
   OrtPybindThrowIfError(sess->RegisterExecutionProvider(std::move(p)));
@@ -1262,7 +1329,8 @@ void addObjectMethods(py::module& m, Environment& env) {
 
   py::enum_<ExecutionOrder>(m, "ExecutionOrder")
       .value("DEFAULT", ExecutionOrder::DEFAULT)
-      .value("PRIORITY_BASED", ExecutionOrder::PRIORITY_BASED);
+      .value("PRIORITY_BASED", ExecutionOrder::PRIORITY_BASED)
+      .value("MEMORY_EFFICIENT", ExecutionOrder::MEMORY_EFFICIENT);
 
   py::enum_<OrtAllocatorType>(m, "OrtAllocatorType")
       .value("INVALID", OrtAllocatorType::Invalid)
@@ -1812,7 +1880,18 @@ RunOptions instance. The individual calls will exit gracefully and return an err
                      R"pbdoc(Choose to run in training or inferencing mode)pbdoc")
 #endif
       .def_readwrite("only_execute_path_to_fetches", &RunOptions::only_execute_path_to_fetches,
-                     R"pbdoc(Only execute the nodes needed by fetch list)pbdoc");
+                     R"pbdoc(Only execute the nodes needed by fetch list)pbdoc")
+      .def_readwrite("max_degree_of_parallelism", &RunOptions::max_degree_of_parallelism,
+                     R"pbdoc(Maximum number of intra-op threads, including the calling thread, used by parallel
+loops of a particular Run() invocation. Default is 0, which means no limit.)pbdoc")
+      .def_property(
+          "high_priority",
+          [](const RunOptions* options) -> bool { return options->priority == ORT_RUN_PRIORITY_HIGH; },
+          [](RunOptions* options, bool high_priority) -> void {
+            options->priority = high_priority ? ORT_RUN_PRIORITY_HIGH : ORT_RUN_PRIORITY_NORMAL;
+          },
+          R"pbdoc(Set to True to have the intra-op threads pick up the work of a particular Run() invocation
+ahead of queued work of other runs. Default is False.)pbdoc");
 
   py::class_<ModelMetadata>(m, "ModelMetadata", R"pbdoc(Pre-defined and custom metadata about the model.
 It is usually used to identify the model used to run the prediction and
@@ -1934,16 +2013,7 @@ including arg name, arg type (contains both type and shape).)pbdoc")
               std::map<std::string, py::object> pyfeeds, RunOptions* run_options = nullptr)
                -> std::vector<py::object> {
              NameMLValMap feeds;
-             for (auto _ : pyfeeds) {
-               OrtValue ml_value;
-               auto px = sess->GetSessionHandle()->GetModelInputs();
-               if (!px.first.IsOK() || !px.second) {
-                 throw std::runtime_error("Either failed to get model inputs from the session object or the input def list was null");
-               }
-               CreateGenericMLValue(px.second, GetAllocator(), _.first, _.second, &ml_value);
-               ThrowIfPyErrOccured();
-               feeds.insert(std::make_pair(_.first, ml_value));
-             }
+             CreateFeeds(sess, pyfeeds, feeds);
 
              std::vector<OrtValue> fetches;
              common::Status status;
@@ -1958,17 +2028,61 @@ including arg name, arg type (contains both type and shape).)pbdoc")
                }
              }
 
-             std::vector<py::object> rfetch;
-             rfetch.reserve(fetches.size());
-             for (auto _ : fetches) {
-               if (_.IsTensor()) {
-                 AddTensorAsPyObj(_, rfetch, nullptr, nullptr);
-               } else {
-                 AddNonTensorAsPyObj(_, rfetch, nullptr, nullptr);
-               }
-             }
-             return rfetch;
+             return GetPyObjsFromFetches(sess, output_names, fetches);
            })
+      .def(
+          "run_many",
+          [](PyInferenceSession* sess, std::vector<std::string> output_names,
+             std::vector<std::map<std::string, py::object>> pyfeeds_list, RunOptions* run_options = nullptr,
+             size_t max_concurrency = 1) -> std::vector<std::vector<py::object>> {
+            const size_t num_runs = pyfeeds_list.size();
+            std::vector<NameMLValMap> feeds_list(num_runs);
+            for (size_t i = 0; i < num_runs; ++i) {
+              CreateFeeds(sess, pyfeeds_list[i], feeds_list[i]);
+            }
+
+            std::vector<std::vector<OrtValue>> fetches_list(num_runs);
+            std::vector<common::Status> statuses(num_runs);
+
+            {
+              // release GIL once for all the runs. the feeds are only read and the python objects they
+              // reference are kept alive by pyfeeds_list.
+              py::gil_scoped_release release;
+              InferenceSession* session = sess->GetSessionHandle();
+              std::atomic<size_t> next_run{0};
+              auto run_worker = [&]() {
+                for (size_t i = next_run++; i < num_runs; i = next_run++) {
+                  statuses[i] = run_options != nullptr
+                                    ? session->Run(*run_options, feeds_list[i], output_names, &fetches_list[i])
+                                    : session->Run(feeds_list[i], output_names, &fetches_list[i]);
+                }
+              };
+
+              // each run still uses the intra-op thread pool of the session, so the runs share it
+              const size_t num_threads = std::min(std::max<size_t>(max_concurrency, 1), num_runs);
+              std::vector<std::thread> threads;
+              for (size_t t = 1; t < num_threads; ++t) {
+                threads.emplace_back(run_worker);
+              }
+              run_worker();
+              for (auto& thread : threads) {
+                thread.join();
+              }
+            }
+
+            for (const auto& status : statuses) {
+              OrtPybindThrowIfError(status);
+            }
+
+            std::vector<std::vector<py::object>> rfetches;
+            rfetches.reserve(num_runs);
+            for (const auto& fetches : fetches_list) {
+              rfetches.push_back(GetPyObjsFromFetches(sess, output_names, fetches));
+            }
+            return rfetches;
+          },
+          R"pbdoc(Runs the session on a list of feeds, releasing the GIL once for all of them.
+max_concurrency runs are executed in parallel.)pbdoc")
       .def("end_profiling", [](PyInferenceSession* sess) -> std::string {
         return sess->GetSessionHandle()->EndProfiling();
       })
@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+// A * B = {4, 5, -10, -11}
+static void RunFusedGemmTest(const std::string& activation,
+                             const std::vector<int64_t>& c_dims, const std::vector<float>& c_data,
+                             float beta, const std::vector<float>& expected,
+                             const std::vector<std::pair<std::string, float>>& activation_attrs = {}) {
+  OpTester test("FusedGemm", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("transA", static_cast<int64_t>(0));
+  test.AddAttribute("transB", static_cast<int64_t>(0));
+  test.AddAttribute("alpha", 1.0f);
+  test.AddAttribute("beta", beta);
+  test.AddAttribute("activation", activation);
+  for (const auto& attr : activation_attrs) {
+    test.AddAttribute(attr.first, attr.second);
+  }
+
+  test.AddInput<float>("A", {2, 3}, {1.0f, 2.0f, 3.0f, -4.0f, -5.0f, -6.0f});
+  test.AddInput<float>("B", {3, 2}, {1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
+  test.AddInput<float>("C", c_dims, c_data);
+  test.AddOutput<float>("Y", {2, 2}, expected);
+  test.Run();
+}
+
+TEST(FusedGemmTest, ReluWithRowBias) {
+  // the bias is added by the epilogue of the output tiles
+  RunFusedGemmTest("Relu", {2}, {0.5f, -1.0f}, 1.0f, {4.5f, 4.0f, 0.0f, 0.0f});
+}
+
+TEST(FusedGemmTest, ReluWithScaledMatrixBias) {
+  // the bias is broadcast to the output before the multiplication
+  RunFusedGemmTest("Relu", {2, 2}, {1.0f, 2.0f, 3.0f, 4.0f}, 2.0f, {6.0f, 9.0f, 0.0f, 0.0f});
+}
+
+TEST(FusedGemmTest, LeakyRelu) {
+  RunFusedGemmTest("LeakyRelu", {1, 2}, {0.5f, -1.0f}, 1.0f, {4.5f, 4.0f, -0.95f, -1.2f},
+                   {{"activation_alpha", 0.1f}});
+}
+
+TEST(FusedGemmTest, Sigmoid) {
+  RunFusedGemmTest("Sigmoid", {2}, {-4.0f, -5.0f}, 1.0f, {0.5f, 0.5f, 8.3152803e-7f, 1.1253516e-7f});
+}
+
+TEST(FusedGemmTest, Gelu) {
+  OpTester test("FusedGemm", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("activation", "Gelu");
+
+  test.AddInput<float>("A", {2, 2}, {1.0f, 0.0f, 0.0f, 1.0f});
+  test.AddInput<float>("B", {2, 2}, {0.5f, -0.5f, 1.0f, -1.0f});
+  test.AddInput<float>("C", {2}, {0.0f, 0.25f});
+  test.AddOutput<float>("Y", {2, 2}, {0.3457312f, -0.1003234f, 0.8413447f, -0.1699705f});
+  test.Run();
+}
+
+TEST(FusedGemmTest, ActivationNotSupportedByMlas) {
+  // HardSigmoid is applied to the whole output after the multiplication
+  RunFusedGemmTest("HardSigmoid", {2}, {0.5f, -1.0f}, 1.0f, {1.0f, 1.0f, 0.0f, 0.0f});
+}
+
+}  // namespace test
+}  // namespace onnxruntime
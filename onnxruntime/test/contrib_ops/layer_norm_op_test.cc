@@ -66,5 +66,20 @@ TEST(LayerNormTest, BERTLayerNorm_NoBias) {
   tester.Run();
 }
 
+TEST(LayerNormTest, LayerNorm_Float16) {
+  OpTester tester("LayerNormalization", 1 /*opset_version*/);
+  tester.AddAttribute<int64_t>("axis", -1);
+  tester.AddAttribute<float>("epsilon", 1e-5f);
+
+  std::vector<int64_t> dims{2, 4};
+  tester.AddInput<MLFloat16>("X", dims, FloatsToMLFloat16s({1.0f, 2.0f, 3.0f, 4.0f, -2.0f, -2.0f, 2.0f, 2.0f}));
+  tester.AddInput<MLFloat16>("Scale", {4}, FloatsToMLFloat16s({0.5f, 0.5f, 0.5f, 0.5f}));
+  tester.AddInput<MLFloat16>("B", {4}, FloatsToMLFloat16s({0.0f, 0.0f, 0.0f, 0.25f}));
+  tester.AddOutput<MLFloat16>("Y", dims,
+                              FloatsToMLFloat16s({-0.670817f, -0.223606f, 0.223606f, 0.920817f,
+                                                  -0.499999f, -0.499999f, 0.499999f, 0.749999f}));
+  tester.Run();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
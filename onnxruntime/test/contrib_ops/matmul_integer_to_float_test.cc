@@ -75,6 +75,98 @@ void TestMatMulIntegerToFloat(const std::vector<int64_t>& A_dims,
   test.Run();
 }
 
+// There are no reference models with int8 A, so compute the expected output here.
+template <typename WeightType>
+void TestMatMulIntegerToFloatS8A(const std::vector<int64_t>& A_dims,
+                                 const std::vector<int64_t>& B_dims,
+                                 bool is_matrix_b_constant,
+                                 bool has_zp = true,
+                                 bool has_bias = false) {
+  RandomValueGenerator random{};
+
+  const int64_t M = A_dims[0];
+  const int64_t K = A_dims[1];
+  const int64_t N = B_dims[1];
+
+  std::vector<int8_t> A_data;
+  std::vector<int> tmp_A_data = random.Uniform<int32_t>(A_dims, -128, 127);
+  std::transform(tmp_A_data.begin(), tmp_A_data.end(), std::back_inserter(A_data), [](int32_t v) -> int8_t {
+    return static_cast<int8_t>(v);
+  });
+
+  std::vector<WeightType> B_data;
+  std::vector<int> tmp_B_data = random.Uniform<int32_t>(B_dims,
+                                                        std::numeric_limits<WeightType>::min(),
+                                                        std::numeric_limits<WeightType>::max());
+  std::transform(tmp_B_data.begin(), tmp_B_data.end(), std::back_inserter(B_data), [](int32_t v) -> WeightType {
+    return static_cast<WeightType>(v);
+  });
+
+  std::vector<float> A_scale = random.Uniform<float>({1}, -0.1f, 0.1f);
+  std::vector<float> B_scale = random.Uniform<float>({1}, -0.1f, 0.1f);
+
+  std::vector<int8_t> A_zero_point{has_zp ? static_cast<int8_t>(-7) : static_cast<int8_t>(0)};
+  std::vector<WeightType> B_zero_point{has_zp ? static_cast<WeightType>(random.Uniform<int32_t>(
+                                                    {1}, std::numeric_limits<WeightType>::min(),
+                                                    std::numeric_limits<WeightType>::max())[0])
+                                              : static_cast<WeightType>(0)};
+
+  std::vector<float> Bias = random.Uniform<float>({N}, -0.1f, 0.1f);
+
+  const float multiplier = A_scale[0] * B_scale[0];
+  std::vector<float> Y_data(static_cast<size_t>(M * N));
+  for (int64_t m = 0; m < M; m++) {
+    for (int64_t n = 0; n < N; n++) {
+      int32_t sum = 0;
+      for (int64_t k = 0; k < K; k++) {
+        sum += (static_cast<int32_t>(A_data[m * K + k]) - A_zero_point[0]) *
+               (static_cast<int32_t>(B_data[k * N + n]) - B_zero_point[0]);
+      }
+      Y_data[m * N + n] = static_cast<float>(sum) * multiplier + (has_bias ? Bias[n] : 0.0f);
+    }
+  }
+
+  OpTester test("MatMulIntegerToFloat", 1, onnxruntime::kMSDomain);
+  test.AddInput<int8_t>("A", A_dims, A_data);
+  test.AddInput<WeightType>("B", B_dims, B_data, is_matrix_b_constant);
+  test.AddInput<float>("a_scale", {1}, A_scale);
+  test.AddInput<float>("b_scale", {1}, B_scale);
+
+  if (has_zp) {
+    test.AddInput<int8_t>("a_zero_point", {1}, A_zero_point);
+    test.AddInput<WeightType>("b_zero_point", {1}, B_zero_point);
+  } else {
+    test.AddMissingOptionalInput<int8_t>();
+    test.AddMissingOptionalInput<WeightType>();
+  }
+
+  if (has_bias) {
+    test.AddInput<float>("bias", {N}, Bias);
+  } else {
+    test.AddMissingOptionalInput<float>();
+  }
+
+  test.AddOutput<float>("Y", {M, N}, Y_data);
+  test.SetOutputRelErr("Y", 1e-4f);
+  test.Run();
+}
+
+TEST(MatMulIntegerToFloat, Int8A_Int8B_test) {
+  for (bool is_matrix_b_constant : {false, true}) {
+    TestMatMulIntegerToFloatS8A<int8_t>({4, 128}, {128, 128}, is_matrix_b_constant);
+    TestMatMulIntegerToFloatS8A<int8_t>({4, 128}, {128, 128}, is_matrix_b_constant, false /*has_zp*/,
+                                        true /*has_bias*/);
+  }
+}
+
+TEST(MatMulIntegerToFloat, Int8A_UInt8B_test) {
+  for (bool is_matrix_b_constant : {false, true}) {
+    TestMatMulIntegerToFloatS8A<uint8_t>({4, 128}, {128, 128}, is_matrix_b_constant);
+    TestMatMulIntegerToFloatS8A<uint8_t>({4, 128}, {128, 128}, is_matrix_b_constant, false /*has_zp*/,
+                                         true /*has_bias*/);
+  }
+}
+
 TEST(MatMulIntegerToFloat, Int8_test) {
   std::vector<int64_t> A_dims{4, 128};
   std::vector<int64_t> B_dims{128, 128};
@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+void RunMatMulNBitsTest(int64_t batch, int64_t M, int64_t N, int64_t K, int64_t block_size, int64_t bits,
+                        bool has_zero_points, bool has_bias, bool is_b_initializer = true) {
+  const int64_t k_blocks = (K + block_size - 1) / block_size;
+  const int64_t blob_size = block_size * bits / 8;
+  const int64_t zero_point_stride = (k_blocks * bits + 7) / 8;
+
+  std::vector<float> a(static_cast<size_t>(batch * M * K));
+  for (size_t i = 0; i < a.size(); i++) {
+    a[i] = static_cast<float>(static_cast<int64_t>(i % 11) - 5) * 0.25f;
+  }
+
+  std::vector<uint8_t> b(static_cast<size_t>(N * k_blocks * blob_size));
+  for (size_t i = 0; i < b.size(); i++) {
+    b[i] = static_cast<uint8_t>((i * 37 + 11) & 0xFF);
+  }
+
+  std::vector<float> scales(static_cast<size_t>(N * k_blocks));
+  for (size_t i = 0; i < scales.size(); i++) {
+    scales[i] = 0.01f * static_cast<float>((i % 7) + 1);
+  }
+
+  std::vector<uint8_t> zero_points(static_cast<size_t>(N * zero_point_stride));
+  for (size_t i = 0; i < zero_points.size(); i++) {
+    zero_points[i] = static_cast<uint8_t>((i * 29 + 3) & 0xFF);
+  }
+
+  std::vector<float> bias(static_cast<size_t>(N));
+  for (size_t i = 0; i < bias.size(); i++) {
+    bias[i] = static_cast<float>(i % 5) - 2.0f;
+  }
+
+  // dequantize B to K x N
+  std::vector<float> dequantized_b(static_cast<size_t>(K * N));
+  for (int64_t n = 0; n < N; n++) {
+    for (int64_t k = 0; k < K; k++) {
+      const int64_t block = k / block_size;
+      const int64_t i = k % block_size;
+      const uint8_t* blob = b.data() + (n * k_blocks + block) * blob_size;
+
+      int q;
+      int zp = 1 << (bits - 1);
+      if (bits == 4) {
+        q = (blob[i / 2] >> ((i % 2) * 4)) & 0x0F;
+        if (has_zero_points) {
+          zp = (zero_points[n * zero_point_stride + block / 2] >> ((block % 2) * 4)) & 0x0F;
+        }
+      } else {
+        q = blob[i];
+        if (has_zero_points) {
+          zp = zero_points[n * zero_point_stride + block];
+        }
+      }
+
+      dequantized_b[k * N + n] = static_cast<float>(q - zp) * scales[n * k_blocks + block];
+    }
+  }
+
+  // The reference is accumulated in double precision. The sum of the magnitudes of the terms bounds the rounding
+  // error of the single precision kernel, which can be much larger than the final result.
+  std::vector<float> y(static_cast<size_t>(batch * M * N));
+  std::vector<float> y_magnitude(static_cast<size_t>(batch * M * N));
+  for (int64_t bm = 0; bm < batch * M; bm++) {
+    for (int64_t n = 0; n < N; n++) {
+      double sum = has_bias ? bias[n] : 0.0;
+      double magnitude = has_bias ? std::abs(bias[n]) : 0.0;
+      for (int64_t k = 0; k < K; k++) {
+        const double product = static_cast<double>(a[bm * K + k]) * static_cast<double>(dequantized_b[k * N + n]);
+        sum += product;
+        magnitude += std::abs(product);
+      }
+      y[bm * N + n] = static_cast<float>(sum);
+      y_magnitude[bm * N + n] = static_cast<float>(magnitude);
+    }
+  }
+
+  OpTester test("MatMulNBits", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("K", K);
+  test.AddAttribute("N", N);
+  test.AddAttribute("bits", bits);
+  test.AddAttribute("block_size", block_size);
+
+  test.AddInput<float>("A", {batch, M, K}, a);
+  test.AddInput<uint8_t>("B", {N, k_blocks, blob_size}, b, is_b_initializer);
+  test.AddInput<float>("scales", {N * k_blocks}, scales, is_b_initializer);
+  if (has_zero_points) {
+    test.AddInput<uint8_t>("zero_points", {N * zero_point_stride}, zero_points, is_b_initializer);
+  } else {
+    test.AddMissingOptionalInput<uint8_t>();
+  }
+  if (has_bias) {
+    test.AddInput<float>("bias", {N}, bias);
+  }
+  test.AddOutput<float>("Y", {batch, M, N}, y);
+
+  auto checker = [&](const std::vector<OrtValue>& fetches, const std::string& provider_type) {
+    const Tensor& output_tensor = fetches[0].Get<Tensor>();
+    ASSERT_EQ(output_tensor.Shape(), TensorShape({batch, M, N})) << "provider_type: " << provider_type;
+    const float* output = output_tensor.Data<float>();
+    for (size_t i = 0; i < y.size(); i++) {
+      EXPECT_LE(std::abs(output[i] - y[i]), 1e-5f * std::max(y_magnitude[i], 1.0f))
+          << "i:" << i << " expected:" << y[i] << ", got:" << output[i] << ", provider_type: " << provider_type;
+    }
+  };
+  test.SetCustomOutputVerifier(checker);
+  test.Run();
+}
+
+}  // namespace
+
+TEST(MatMulNBitsTest, Int4) {
+  RunMatMulNBitsTest(1, 1, 16, 64, 32, 4, false, false);
+  RunMatMulNBitsTest(2, 3, 67, 45, 16, 4, true, false);
+  RunMatMulNBitsTest(1, 17, 130, 200, 64, 4, true, true);
+}
+
+TEST(MatMulNBitsTest, Int8) {
+  RunMatMulNBitsTest(1, 1, 24, 64, 32, 8, false, false);
+  RunMatMulNBitsTest(3, 2, 33, 100, 128, 8, true, true);
+  RunMatMulNBitsTest(1, 9, 300, 256, 256, 8, false, true);
+}
+
+TEST(MatMulNBitsTest, NonConstantB) {
+  RunMatMulNBitsTest(2, 3, 17, 40, 16, 4, true, true, false);
+  RunMatMulNBitsTest(1, 1, 9, 70, 32, 8, false, false, false);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -226,6 +226,58 @@ static void RunQAttentionU8S8(
       batch_size, sequence_length, hidden_size, number_of_heads, is_unidirectional, false, input_hidden_size);
 }
 
+static void RunQAttentionS8S8(
+    const std::vector<float>& input_data,
+    const std::vector<float>& weights_data,
+    const std::vector<float>& bias_data,
+    const std::vector<int32_t>& mask_index_data,
+    const std::vector<float>& output_data,
+    int batch_size,
+    int sequence_length,
+    int hidden_size,
+    int number_of_heads,
+    bool use_special_quantize_parameter = true,
+    bool is_unidirectional = false,
+    int input_hidden_size = 0) {
+  QuantizeParameters<int8_t, int8_t> qp_int8{0.0f, 0.0f, 0, 0};
+  if (use_special_quantize_parameter) {
+    qp_int8.input_scale = 0.1f;
+    qp_int8.weight_scale = 0.1f;
+    qp_int8.input_zero_point = -3;
+    qp_int8.weight_zero_point = 1;
+  }
+
+  RunQAttention<int8_t, int8_t, EP::CPU>(
+      input_data, weights_data, bias_data, mask_index_data, output_data, qp_int8,
+      batch_size, sequence_length, hidden_size, number_of_heads, is_unidirectional, false, input_hidden_size);
+}
+
+static void RunQAttentionS8U8(
+    const std::vector<float>& input_data,
+    const std::vector<float>& weights_data,
+    const std::vector<float>& bias_data,
+    const std::vector<int32_t>& mask_index_data,
+    const std::vector<float>& output_data,
+    int batch_size,
+    int sequence_length,
+    int hidden_size,
+    int number_of_heads,
+    bool use_special_quantize_parameter = true,
+    bool is_unidirectional = false,
+    int input_hidden_size = 0) {
+  QuantizeParameters<int8_t, uint8_t> qp{0.0f, 0.0f, 0, 0};
+  if (use_special_quantize_parameter) {
+    qp.input_scale = 0.1f;
+    qp.weight_scale = 0.1f;
+    qp.input_zero_point = 5;
+    qp.weight_zero_point = 128;
+  }
+
+  RunQAttention<int8_t, uint8_t, EP::CPU>(
+      input_data, weights_data, bias_data, mask_index_data, output_data, qp,
+      batch_size, sequence_length, hidden_size, number_of_heads, is_unidirectional, false, input_hidden_size);
+}
+
 static void RunQAttentionAll(
     const std::vector<float>& input_data,
     const std::vector<float>& weight_data,
@@ -246,6 +298,12 @@ static void RunQAttentionAll(
   RunQAttentionU8S8(input_data, weight_data, bias_data, mask_index_data, output_data,
                     batch_size, sequence_length, hidden_size, number_of_heads,
                     use_special_quantize_parameter, is_unidirectional, input_hidden_size);
+  RunQAttentionS8S8(input_data, weight_data, bias_data, mask_index_data, output_data,
+                    batch_size, sequence_length, hidden_size, number_of_heads,
+                    use_special_quantize_parameter, is_unidirectional, input_hidden_size);
+  RunQAttentionS8U8(input_data, weight_data, bias_data, mask_index_data, output_data,
+                    batch_size, sequence_length, hidden_size, number_of_heads,
+                    use_special_quantize_parameter, is_unidirectional, input_hidden_size);
   RunQAttentionCUDA(input_data, weight_data, bias_data, mask_index_data, output_data,
                     batch_size, sequence_length, hidden_size, number_of_heads,
                     use_special_quantize_parameter, is_unidirectional, use_float16, input_hidden_size);
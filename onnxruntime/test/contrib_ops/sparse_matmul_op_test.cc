@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+// Generates a K x N (or N x K when transposed) weight where roughly three of every four elements are zero.
+std::vector<float> GenerateSparseWeight(int64_t rows, int64_t cols) {
+  std::vector<float> weight(static_cast<size_t>(rows * cols), 0.0f);
+  for (int64_t i = 0; i < rows * cols; i++) {
+    if ((i * 7) % 4 == 1) {
+      weight[static_cast<size_t>(i)] = static_cast<float>((i % 13) - 6) * 0.25f;
+    }
+  }
+  return weight;
+}
+
+void RunSparseMatMulTest(int64_t batch, int64_t M, int64_t N, int64_t K,
+                         bool trans_b, float alpha, bool has_bias, bool scalar_bias, float beta,
+                         bool is_b_initializer = true) {
+  std::vector<float> a(static_cast<size_t>(batch * M * K));
+  for (size_t i = 0; i < a.size(); i++) {
+    a[i] = static_cast<float>(static_cast<int64_t>(i % 11) - 5) * 0.5f;
+  }
+
+  const std::vector<int64_t> b_dims = trans_b ? std::vector<int64_t>{N, K} : std::vector<int64_t>{K, N};
+  const std::vector<float> b = GenerateSparseWeight(b_dims[0], b_dims[1]);
+
+  std::vector<float> bias(scalar_bias ? 1 : static_cast<size_t>(N));
+  for (size_t i = 0; i < bias.size(); i++) {
+    bias[i] = static_cast<float>(i) - 2.0f;
+  }
+
+  std::vector<float> y(static_cast<size_t>(batch * M * N));
+  for (int64_t bm = 0; bm < batch * M; bm++) {
+    for (int64_t n = 0; n < N; n++) {
+      float sum = 0.0f;
+      for (int64_t k = 0; k < K; k++) {
+        sum += a[bm * K + k] * (trans_b ? b[n * K + k] : b[k * N + n]);
+      }
+      float value = alpha * sum;
+      if (has_bias) {
+        value += beta * bias[scalar_bias ? 0 : n];
+      }
+      y[bm * N + n] = value;
+    }
+  }
+
+  OpTester test("SparseMatMul", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("alpha", alpha);
+  test.AddAttribute("transB", static_cast<int64_t>(trans_b ? 1 : 0));
+  if (has_bias) {
+    test.AddAttribute("beta", beta);
+  }
+
+  test.AddInput<float>("A", {batch, M, K}, a);
+  test.AddInput<float>("B", b_dims, b, is_b_initializer);
+  if (has_bias) {
+    test.AddInput<float>("C", {scalar_bias ? 1 : N}, bias);
+  }
+  test.AddOutput<float>("Y", {batch, M, N}, y);
+  test.Run();
+}
+
+}  // namespace
+
+TEST(SparseMatMulTest, Basic) {
+  RunSparseMatMulTest(1, 4, 16, 32, false, 1.0f, false, false, 1.0f);
+  RunSparseMatMulTest(2, 3, 67, 45, false, 1.0f, false, false, 1.0f);
+}
+
+TEST(SparseMatMulTest, TransB) {
+  RunSparseMatMulTest(1, 5, 24, 19, true, 1.0f, false, false, 1.0f);
+  RunSparseMatMulTest(3, 2, 300, 33, true, 0.5f, false, false, 1.0f);
+}
+
+TEST(SparseMatMulTest, Bias) {
+  RunSparseMatMulTest(2, 3, 17, 40, false, 2.0f, true, false, 0.5f);
+  RunSparseMatMulTest(1, 7, 9, 12, true, 1.0f, true, true, 1.0f);
+}
+
+TEST(SparseMatMulTest, NonConstantB) {
+  RunSparseMatMulTest(2, 3, 17, 40, false, 1.0f, true, false, 1.0f, false);
+  RunSparseMatMulTest(1, 4, 9, 12, true, 1.0f, false, false, 1.0f, false);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -131,15 +131,19 @@ typedef std::unordered_map<const onnxruntime::NodeArg*, TensorShapeProto*> Shape
 
 class SequentialPlannerTestContext : public ISequentialPlannerContext {
  public:
-  SequentialPlannerTestContext(ShapeMap* shape_map) : shape_map_(shape_map) {}
+  SequentialPlannerTestContext(ShapeMap* shape_map, ExecutionOrder execution_order = ExecutionOrder::DEFAULT)
+      : shape_map_(shape_map), execution_order_(execution_order) {}
 
   TensorShapeProto* GetShape(const onnxruntime::NodeArg& arg) const override {
     auto iter = shape_map_->find(&arg);
     return (shape_map_->end() != iter) ? iter->second : nullptr;
   }
 
+  ExecutionOrder GetExecutionOrder() const override { return execution_order_; }
+
  private:
   ShapeMap* shape_map_;
+  ExecutionOrder execution_order_;
 };
 
 class PlannerTest : public ::testing::Test {
@@ -245,7 +249,8 @@ class PlannerTest : public ::testing::Test {
     }
   }
 
-  void CreatePlan(const std::vector<const NodeArg*>& outer_scope_node_args = {}) {
+  void CreatePlan(const std::vector<const NodeArg*>& outer_scope_node_args = {},
+                  ExecutionOrder execution_order = ExecutionOrder::DEFAULT) {
     EXPECT_EQ(graph_.Resolve(), Status::OK());
 
     std::shared_ptr<KernelRegistry> reg = std::make_shared<KernelRegistry>();
@@ -267,7 +272,7 @@ class PlannerTest : public ::testing::Test {
     status = state_->FinalizeSessionState(ORT_TSTR(""), kernel_registry_manager, {}, nullptr, remove_initializers);
 
     EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
-    SequentialPlannerTestContext test_context(&shape_map_);
+    SequentialPlannerTestContext test_context(&shape_map_, execution_order);
 
     status = SequentialPlanner::CreatePlan(nullptr, GraphViewer(graph_), outer_scope_node_args, execution_providers_,
                                            kernel_create_info_map, state_->GetOrtValueNameIdxMap(), test_context,
@@ -474,6 +479,41 @@ TEST_F(PlannerTest, InPlaceSizeMismatchTest) {
   CheckFreed(3, {X2});
 }
 
+// MemoryEfficientOrderTest: Check that the memory efficient order runs the node consuming a large temporary
+// before starting the other branch, and that the estimated peak is reported in the plan.
+TEST_F(PlannerTest, MemoryEfficientOrderTest) {
+  // tensor variables:
+  std::string X("X"), A1("A1"), A2("A2"), B1("B1"), B2("B2");
+
+  // graph structure: two independent branches, each producing a large temporary and a small output
+  auto* a1 = AddNormalNode(X, A1);
+  auto* b1 = AddNormalNode(X, B1);
+  auto* a2 = AddNormalNode(A1, A2);
+  auto* b2 = AddNormalNode(B1, B2);
+
+  // simulate shape-inference results:
+  Shape large_shape{1000};
+  Shape small_shape{10};
+  SetShape({{X, &large_shape.value}, {A1, &large_shape.value}, {B1, &large_shape.value},
+            {A2, &small_shape.value}, {B2, &small_shape.value}});
+
+  CreatePlan({}, ExecutionOrder::MEMORY_EFFICIENT);
+
+  const auto& execution_plan = GetPlan().execution_plan;
+  ASSERT_EQ(execution_plan.size(), 4u);
+  auto step_of = [&execution_plan](const Node* node) {
+    for (size_t i = 0; i < execution_plan.size(); ++i) {
+      if (execution_plan[i].node_index == node->Index()) return i;
+    }
+    return execution_plan.size();
+  };
+  EXPECT_EQ(step_of(a2), step_of(a1) + 1);
+  EXPECT_EQ(step_of(b2), step_of(b1) + 1);
+
+  // one large temporary, its small output and the small output of the other branch at most
+  EXPECT_EQ(GetPlan().estimated_peak_activation_size, sizeof(float) * (1000 + 10 + 10));
+}
+
 // Test operator<< to output details of an allocation & execution plan.
 TEST_F(PlannerTest, PlanOutputTest) {
   // tensor variables:
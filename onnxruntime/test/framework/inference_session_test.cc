@@ -710,6 +710,55 @@ TEST(InferenceSessionTests, CheckRunProfilerStartTime) {
   ASSERT_TRUE(before_start_time <= profiling_start_time && profiling_start_time <= after_start_time);
 }
 
+TEST(InferenceSessionTests, CheckRunSamplingProfiler) {
+  SessionOptions so;
+
+  so.session_logid = "CheckRunSamplingProfiler";
+  ASSERT_STATUS_OK(so.AddConfigEntry(kOrtSessionOptionsConfigProfilingSampleRate, "2"));
+
+  InferenceSession session_object(so, GetEnvironment());
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  for (int i = 0; i < 5; ++i) {
+    RunModel(session_object, run_options);
+  }
+
+  std::string snapshot = session_object.GetProfilingSnapshot();
+  EXPECT_NE(snapshot.find("\"total_runs\" : 5"), string::npos) << snapshot;
+  EXPECT_NE(snapshot.find("\"sampled_runs\" : 3"), string::npos) << snapshot;
+  EXPECT_NE(snapshot.find("\"name\" : \"mul_1\""), string::npos) << snapshot;
+  EXPECT_NE(snapshot.find("\"count\" : 3"), string::npos) << snapshot;
+  EXPECT_NE(snapshot.find("p99_us"), string::npos) << snapshot;
+
+  // the snapshot is cumulative, so reading it again without running returns the same counts
+  EXPECT_NE(session_object.GetProfilingSnapshot().find("\"sampled_runs\" : 3"), string::npos);
+}
+
+TEST(InferenceSessionTests, CheckInitializationTimings) {
+  SessionOptions so;
+
+  so.session_logid = "CheckInitializationTimings";
+
+  // the phases are recorded without enabling profiling
+  InferenceSession session_object(so, GetEnvironment());
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::string timings = session_object.GetInitializationTimings();
+  EXPECT_EQ(timings.front(), '[') << timings;
+  EXPECT_EQ(timings.back(), ']') << timings;
+  for (const char* phase : {"model_loading_uri", "graph_partitioning", "graph_resolve", "execution_planning",
+                            "initializers_loading", "kernel_creation", "session_initialization"}) {
+    EXPECT_NE(timings.find(std::string("\"name\" : \"") + phase + "\""), string::npos) << phase << " " << timings;
+  }
+  EXPECT_NE(timings.find("\"dur\" : "), string::npos) << timings;
+  // the phases run on a graph carry its name
+  EXPECT_NE(timings.find("\"name\" : \"kernel_creation\", \"graph\" : \"mul test\""), string::npos) << timings;
+  EXPECT_FALSE(session_object.GetProfiling().IsEnabled());
+}
+
 TEST(InferenceSessionTests, MultipleSessionsNoTimeout) {
   SessionOptions session_options;
 
@@ -35,5 +35,71 @@ TEST(MemPatternPlannerTest, TraceAllocaitonTest) {
   EXPECT_EQ(pattern.GetBlock(5)->offset_, 1024u + 256u + 512u);
   EXPECT_EQ(pattern.GetBlock(6)->offset_, 1024u);
 }
+
+// Trace an allocation sequence for which the first-fit planner leaves a gap that is too small for a later
+// allocation, and check the greedy-by-size planner achieves the peak live size instead.
+static void TraceFragmentingAllocations(MemPatternPlanner& planner) {
+  planner.TraceAllocation(0, 256);
+  planner.TraceAllocation(1, 1024);
+  planner.TraceFree(0);
+  planner.TraceAllocation(2, 512);
+  planner.TraceFree(1);
+  planner.TraceAllocation(3, 1024);
+  planner.TraceAllocation(4, 0);
+}
+
+TEST(MemPatternPlannerTest, FirstFitFragmentation) {
+  MemPatternPlanner planner{false, MemPatternPlannerType::kFirstFit};
+  TraceFragmentingAllocations(planner);
+
+  auto pattern = planner.GenerateMemPattern();
+
+  EXPECT_EQ(pattern.LowerBoundSize(), 1024u + 512u);
+  EXPECT_EQ(pattern.PeakSize(), 256u + 1024u + 512u);
+  EXPECT_EQ(pattern.GetBlock(2)->offset_, 256u + 1024u);
+  EXPECT_EQ(pattern.GetBlock(3)->offset_, 0u);
+}
+
+TEST(MemPatternPlannerTest, GreedyBySize) {
+  MemPatternPlanner planner{false, MemPatternPlannerType::kGreedyBySize};
+  TraceFragmentingAllocations(planner);
+
+  auto pattern = planner.GenerateMemPattern();
+
+  EXPECT_EQ(pattern.LowerBoundSize(), 1024u + 512u);
+  EXPECT_EQ(pattern.PeakSize(), 1024u + 512u);
+
+  // largest first. 1 and 3 are never live at the same time so they share offset 0.
+  EXPECT_EQ(pattern.GetBlock(1)->offset_, 0u);
+  EXPECT_EQ(pattern.GetBlock(3)->offset_, 0u);
+  EXPECT_EQ(pattern.GetBlock(2)->offset_, 1024u);
+  EXPECT_EQ(pattern.GetBlock(0)->offset_, 1024u);
+  EXPECT_EQ(pattern.GetBlock(4)->size_, 0u);
+}
+
+#ifdef ENABLE_TRAINING
+TEST(MemPatternPlannerTest, CounterLowerBound) {
+  // 0 is live at [0, 1] and [6, 7], 1 at [2, 3], and 2 at [1, 2], so at most two blocks are live at once
+  AllocPlanPerValue::ProgramCounter counter0, counter1, counter2;
+  counter0.AddStart(0);
+  counter0.AddEnd(1);
+  counter0.AddStart(6);
+  counter0.AddEnd(7);
+  counter1.AddStart(2);
+  counter1.AddEnd(3);
+  counter2.AddStart(1);
+  counter2.AddEnd(2);
+
+  MemPatternPlanner planner{true};
+  planner.TraceAllocation(0, counter0, 1024);
+  planner.TraceAllocation(1, counter1, 256);
+  planner.TraceAllocation(2, counter2, 512);
+
+  auto pattern = planner.GenerateMemPattern();
+
+  EXPECT_EQ(pattern.LowerBoundSize(), 1024u + 512u);
+  EXPECT_EQ(pattern.PeakSize(), 1024u + 512u);
+}
+#endif
 }  // namespace test
 }  // namespace onnxruntime
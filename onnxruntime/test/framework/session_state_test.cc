@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include <iostream>
+#include <thread>
 
 #include "asserts.h"
 #include "core/framework/execution_providers.h"
@@ -283,6 +284,73 @@ TEST(SessionStateTest, TestInitializerMemoryAllocatedUsingNonArenaMemory) {
 
 INSTANTIATE_TEST_SUITE_P(SessionStateTests, SessionStateTestP, testing::ValuesIn(param_list));
 
+// Test that the memory pattern of new input shapes is generated from the symbolic shapes of the activations
+// before any run with them.
+TEST(SessionStateTest, MemoryPatternFromSymbolicShapes) {
+  OrtThreadPoolParams to;
+  auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
+
+  Model model("symbolic_shapes", false, DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+
+  TypeProto type;
+  type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("N");
+  type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+
+  auto& x = graph.GetOrCreateNodeArg("X", &type);
+  auto& a = graph.GetOrCreateNodeArg("A", nullptr);
+  auto& b = graph.GetOrCreateNodeArg("B", nullptr);
+  auto& y = graph.GetOrCreateNodeArg("Y", nullptr);
+  graph.AddNode("node_0", "Abs", "", {&x}, {&a});
+  graph.AddNode("node_1", "Neg", "", {&a}, {&b});
+  graph.AddNode("node_2", "Add", "", {&a, &b}, {&y});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  ExecutionProviders execution_providers;
+  ASSERT_STATUS_OK(execution_providers.Add(kCpuExecutionProvider,
+                                           std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo{false})));
+  KernelRegistryManager krm;
+  ASSERT_STATUS_OK(krm.RegisterKernels(execution_providers));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  SessionState session_state(graph, execution_providers, true, tp.get(), nullptr, dtm,
+                             DefaultLoggingManager().DefaultLogger(), profiler);
+
+  GraphPartitioner partitioner(krm, execution_providers);
+  ASSERT_STATUS_OK(partitioner.Partition(graph, session_state.ExportDll(), session_state.GetMutableFuncMgr()));
+  ASSERT_STATUS_OK(session_state.FinalizeSessionState(ORT_TSTR(""), krm));
+
+  int x_idx, a_idx, b_idx;
+  const auto& name_to_idx = session_state.GetOrtValueNameIdxMap();
+  ASSERT_STATUS_OK(name_to_idx.GetIdx("X", x_idx));
+  ASSERT_STATUS_OK(name_to_idx.GetIdx("A", a_idx));
+  ASSERT_STATUS_OK(name_to_idx.GetIdx("B", b_idx));
+
+  for (int64_t n : {3, 100}) {
+    TensorShape input_shape({n, 4});
+    std::vector<std::reference_wrapper<const TensorShape>> input_shapes{std::cref(input_shape)};
+    std::unordered_map<int, TensorShape> inferred_shapes;
+    const auto* mem_patterns = session_state.GetMemoryPatternGroup(input_shapes, {x_idx}, inferred_shapes);
+    ASSERT_NE(mem_patterns, nullptr);
+
+    const auto* pattern = mem_patterns->GetPatterns(session_state.GetExecutionPlan()->GetLocation(a_idx));
+    ASSERT_NE(pattern, nullptr);
+    size_t expected_size = 0;
+    ASSERT_TRUE(IAllocator::CalcMemSizeForArrayWithAlignment<kAllocAlignment>(static_cast<size_t>(n * 4),
+                                                                              sizeof(float), &expected_size));
+    const auto* a_block = pattern->GetBlock(a_idx);
+    const auto* b_block = pattern->GetBlock(b_idx);
+    ASSERT_NE(a_block, nullptr);
+    ASSERT_NE(b_block, nullptr);
+    EXPECT_EQ(a_block->size_, expected_size);
+    EXPECT_EQ(b_block->size_, expected_size);
+    // A and B are live at the same time
+    EXPECT_GE(pattern->PeakSize(), 2 * expected_size);
+  }
+}
+
 #ifndef ENABLE_TRAINING
 class PrePackingTestOpKernel : public OpKernel {
  public:
@@ -429,6 +497,14 @@ static void PlaceAllNodesToCPUEP(Graph& graph) {
   }
 }
 
+static void RegisterPrePackingTestSchema() {
+  ONNX_OPERATOR_SCHEMA(PrePackingTest)
+      .SetDoc("Faking Node for PrePacking")
+      .Input(0, "Input_0", "input 0", "tensor(float)")
+      .Input(1, "Input_1", "input 1", "tensor(float)")
+      .Output(0, "output_0", "docstr for output_0.", "tensor(float)");
+}
+
 struct PrepackingTestParam {
   bool test_subgraph;
   bool test_prepacking;
@@ -440,11 +516,7 @@ TEST_P(SessionStatePrepackingTest, PrePackingTest) {
 
   OrtThreadPoolParams to;
   auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
-  ONNX_OPERATOR_SCHEMA(PrePackingTest)
-      .SetDoc("Faking Node for PrePacking")
-      .Input(0, "Input_0", "input 0", "tensor(float)")
-      .Input(1, "Input_1", "input 1", "tensor(float)")
-      .Output(0, "output_0", "docstr for output_0.", "tensor(float)");
+  RegisterPrePackingTestSchema();
 
   ExecutionProviders execution_providers;
   auto cpu_execution_provider = std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo(false));
@@ -504,6 +576,183 @@ INSTANTIATE_TEST_SUITE_P(SessionStateTests,
                                          PrepackingTestParam{false, true},
                                          PrepackingTestParam{true, false},
                                          PrepackingTestParam{true, true}));
+
+// Test that the built-in CPU kernels are created and prepacked on the thread pool, and that an initializer shared by
+// several nodes is released once all of them packed it.
+TEST(SessionStateTest, ParallelInitialization) {
+  for (const char* disable_parallel_initialization : {"0", "1"}) {
+    OrtThreadPoolParams to;
+    to.thread_pool_size = 4;
+    auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
+
+    std::unordered_map<std::string, int> domain_to_version;
+    domain_to_version[kOnnxDomain] = 13;
+    Model model("graph_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                DefaultLoggingManager().DefaultLogger());
+    Graph& graph = model.MainGraph();
+
+    constexpr int K = 16;
+    constexpr int N = 8;
+
+    TypeProto input_type;
+    input_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+    input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(K);
+
+    TypeProto weight_type;
+    weight_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    weight_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(K);
+    weight_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(N);
+
+    // the even nodes share an initializer, the odd nodes have their own. MatMul prepacks its constant B input.
+    auto& input_arg = graph.GetOrCreateNodeArg("input", &input_type);
+    constexpr int num_nodes = 16;
+    for (int i = 0; i < num_nodes; ++i) {
+      const std::string weight_name = (i % 2 == 0) ? "shared_weight" : "weight_" + std::to_string(i);
+      if (!graph.IsInitializedTensor(weight_name)) {
+        ONNX_NAMESPACE::TensorProto tensor;
+        tensor.add_dims(K);
+        tensor.add_dims(N);
+        for (int j = 0; j < K * N; ++j) {
+          tensor.add_float_data(static_cast<float>(i + j));
+        }
+        tensor.set_data_type(TensorProto_DataType_FLOAT);
+        tensor.set_name(weight_name);
+        graph.AddInitializedTensor(tensor);
+      }
+
+      auto& weight_arg = graph.GetOrCreateNodeArg(weight_name, &weight_type);
+      auto& output_arg = graph.GetOrCreateNodeArg("output_" + std::to_string(i), nullptr);
+      graph.AddNode("node_" + std::to_string(i), "MatMul", "node", {&input_arg, &weight_arg}, {&output_arg});
+    }
+    ASSERT_STATUS_OK(graph.Resolve());
+
+    ExecutionProviders execution_providers;
+    auto cpu_execution_provider = std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo(false));
+    execution_providers.Add(kCpuExecutionProvider, std::move(cpu_execution_provider));
+
+    DataTransferManager dtm;
+    profiling::Profiler profiler;
+    SessionState session_state(graph, execution_providers, true, tp.get(), nullptr, dtm,
+                               DefaultLoggingManager().DefaultLogger(), profiler);
+
+    KernelRegistryManager kernel_registry_manager;
+    ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+
+    PlaceAllNodesToCPUEP(graph);
+
+    SessionOptions sess_options;
+    sess_options.session_configurations[kOrtSessionOptionsConfigDisableParallelInitialization] =
+        disable_parallel_initialization;
+    ASSERT_STATUS_OK(session_state.FinalizeSessionState(std::basic_string<PATH_CHAR_TYPE>(),
+                                                        kernel_registry_manager,
+                                                        sess_options));
+
+    for (const auto& node : session_state.GetGraphViewer().Nodes()) {
+      EXPECT_NE(session_state.GetKernel(node.Index()), nullptr);
+    }
+
+    // every MatMul packed its weight, so all the initializers were released
+    EXPECT_TRUE(session_state.GetConstantInitializedTensors().empty());
+    EXPECT_TRUE(session_state.GetInitializedTensors().empty());
+  }
+}
+
+class PrePackingThreadTestOpKernel : public OpKernel {
+ public:
+  PrePackingThreadTestOpKernel(const OpKernelInfo& info, std::vector<std::thread::id>& prepack_threads)
+      : OpKernel(info), prepack_threads_(prepack_threads) {}
+
+  Status Compute(OpKernelContext* context) const override {
+    ORT_UNUSED_PARAMETER(context);
+    return Status::OK();
+  }
+
+  // not synchronized, as custom op kernels are expected to be prepacked sequentially
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override {
+    ORT_UNUSED_PARAMETER(tensor);
+    ORT_UNUSED_PARAMETER(input_idx);
+    prepack_threads_.push_back(std::this_thread::get_id());
+    is_packed = true;
+    return Status::OK();
+  }
+
+ private:
+  std::vector<std::thread::id>& prepack_threads_;
+};
+
+// Test that custom op kernels on the CPU execution provider are prepacked on the calling thread even when parallel
+// initialization is enabled.
+TEST(SessionStateTest, ParallelInitializationCustomKernelsSequential) {
+  RegisterPrePackingTestSchema();
+
+  OrtThreadPoolParams to;
+  to.thread_pool_size = 4;
+  auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
+
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 11;
+  Model model("graph_main", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              domain_to_version, std::vector<ONNX_NAMESPACE::FunctionProto>(),
+              DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+
+  TypeProto type;
+  type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+  auto& input_arg = graph.GetOrCreateNodeArg("input", &type);
+  constexpr int num_nodes = 16;
+  for (int i = 0; i < num_nodes; ++i) {
+    const std::string weight_name = "weight_" + std::to_string(i);
+    ONNX_NAMESPACE::TensorProto tensor;
+    tensor.add_dims(1);
+    tensor.add_float_data(static_cast<float>(i));
+    tensor.set_data_type(TensorProto_DataType_FLOAT);
+    tensor.set_name(weight_name);
+    graph.AddInitializedTensor(tensor);
+
+    auto& weight_arg = graph.GetOrCreateNodeArg(weight_name, &type);
+    auto& output_arg = graph.GetOrCreateNodeArg("output_" + std::to_string(i), &type);
+    graph.AddNode("node_" + std::to_string(i), "PrePackingTest", "node", {&input_arg, &weight_arg}, {&output_arg});
+  }
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  ExecutionProviders execution_providers;
+  auto cpu_execution_provider = std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo(false));
+  execution_providers.Add(kCpuExecutionProvider, std::move(cpu_execution_provider));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  SessionState session_state(graph, execution_providers, true, tp.get(), nullptr, dtm,
+                             DefaultLoggingManager().DefaultLogger(), profiler);
+
+  std::vector<std::thread::id> prepack_threads;
+  KernelRegistryManager kernel_registry_manager;
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+  std::shared_ptr<KernelRegistry> kernel_registry = std::make_shared<KernelRegistry>();
+  auto kernel_def = KernelDefBuilder().SetName("PrePackingTest").Provider(kCpuExecutionProvider).SinceVersion(1).Build();
+  ASSERT_STATUS_OK(kernel_registry->Register(
+      KernelCreateInfo(std::move(kernel_def), [&prepack_threads](const OpKernelInfo& info) -> OpKernel* {
+        return new PrePackingThreadTestOpKernel(info, prepack_threads);
+      })));
+  kernel_registry_manager.RegisterKernelRegistry(kernel_registry);
+
+  PlaceAllNodesToCPUEP(graph);
+
+  SessionOptions sess_options;
+  sess_options.session_configurations[kOrtSessionOptionsConfigDisableParallelInitialization] = "0";
+  ASSERT_STATUS_OK(session_state.FinalizeSessionState(std::basic_string<PATH_CHAR_TYPE>(),
+                                                      kernel_registry_manager,
+                                                      sess_options));
+
+  ASSERT_EQ(prepack_threads.size(), static_cast<size_t>(num_nodes));
+  for (const auto& thread_id : prepack_threads) {
+    EXPECT_EQ(thread_id, std::this_thread::get_id());
+  }
+  EXPECT_TRUE(session_state.GetConstantInitializedTensors().empty());
+}
 #endif
 
 }  // namespace test
@@ -1397,6 +1397,68 @@ TEST_F(GraphTest, ShapeInferenceErrorHandling) {
                                                         "[ShapeInferenceError] try harder"));
 }
 
+// count the calls to the type/shape inferencing of this op to check which nodes a Resolve infers again
+static int shape_inference_counting_op_calls = 0;
+
+TEST_F(GraphTest, IncrementalTypeAndShapeInference) {
+  OPERATOR_SCHEMA(ShapeInferenceCountingOp)
+      .SetDoc("Count the calls to the shape inferencing.")
+      .Input(0, "input_1", "docstr for input_1.", "tensor(float)")
+      .Output(0, "output_1", "docstr for output_1.", "tensor(float)")
+      .TypeAndShapeInferenceFunction([](InferenceContext& ctx) {
+        ++shape_inference_counting_op_calls;
+        propagateElemTypeFromInputToOutput(ctx, 0, 0);
+        propagateShapeFromInputToOutput(ctx, 0, 0);
+      });
+
+  Model model("graph", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  // input_1 has no shape yet. node_1 -> node_2 consume it, node_3 is independent.
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  TypeProto tensor_float_1;
+  tensor_float_1.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  tensor_float_1.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+  auto& input_arg1 = graph.GetOrCreateNodeArg("input_1", &tensor_float);
+  auto& input_arg2 = graph.GetOrCreateNodeArg("input_2", &tensor_float_1);
+  auto& output_arg1 = graph.GetOrCreateNodeArg("node_1_out_1", nullptr);
+  auto& output_arg2 = graph.GetOrCreateNodeArg("node_2_out_1", nullptr);
+  auto& output_arg3 = graph.GetOrCreateNodeArg("node_3_out_1", nullptr);
+  graph.AddNode("node_1", "ShapeInferenceCountingOp", "node 1", {&input_arg1}, {&output_arg1});
+  graph.AddNode("node_2", "ShapeInferenceCountingOp", "node 2", {&output_arg1}, {&output_arg2});
+  auto& node_3 = graph.AddNode("node_3", "ShapeInferenceCountingOp", "node 3", {&input_arg2}, {&output_arg3});
+
+  shape_inference_counting_op_calls = 0;
+  ASSERT_STATUS_OK(graph.Resolve());
+  EXPECT_EQ(shape_inference_counting_op_calls, 3);
+  EXPECT_EQ(output_arg2.Shape(), nullptr);
+
+  // nothing changed, so nothing is inferred again
+  graph.SetGraphResolveNeeded();
+  ASSERT_STATUS_OK(graph.Resolve());
+  EXPECT_EQ(shape_inference_counting_op_calls, 3);
+
+  // the new shape of input_1 flows through node_1 and node_2 only
+  TensorShapeProto shape;
+  shape.add_dim()->set_dim_value(2);
+  shape.add_dim()->set_dim_value(3);
+  input_arg1.SetShape(shape);
+  graph.SetGraphResolveNeeded();
+  ASSERT_STATUS_OK(graph.Resolve());
+  EXPECT_EQ(shape_inference_counting_op_calls, 5);
+  ASSERT_NE(output_arg2.Shape(), nullptr);
+  ASSERT_EQ(output_arg2.Shape()->dim_size(), 2);
+  EXPECT_EQ(output_arg2.Shape()->dim(0).dim_value(), 2);
+  EXPECT_EQ(output_arg2.Shape()->dim(1).dim_value(), 3);
+
+  // changing an attribute infers the node again
+  node_3.AddAttribute("unused", static_cast<int64_t>(1));
+  ASSERT_STATUS_OK(graph.Resolve());
+  EXPECT_EQ(shape_inference_counting_op_calls, 6);
+}
+
 TEST_F(GraphTest, AddTensorAttribute) {
   OPERATOR_SCHEMA(__Constant)
       .SetDoc("Constant Op.")
@@ -38,8 +38,7 @@ static const std::vector<std::string>& ArgNamesForConv(size_t rank) {
   return rank_to_args_name[rank];
 }
 
-// dummy for some strange build error when using Bench capture
-void SCONV_NCHW(benchmark::State& state, const char* /*dummy*/) {
+static void SconvNchw(benchmark::State& state, bool allow_winograd) {
   const int64_t rank = state.range(0);                       // Rank
   const int64_t batch_size = state.range(1);                 // N
   const int64_t groups = state.range(2);                     // G
@@ -109,10 +108,26 @@ void SCONV_NCHW(benchmark::State& state, const char* /*dummy*/) {
                   static_cast<size_t>(output_channels_per_group),
                   &activation,
                   &WorkingBufferSize,
-                  nullptr);
+                  nullptr,
+                  allow_winograd);
 
   auto X = RandomVectorUniform(x_shape, -2.0, 2.0);
   auto F = RandomVectorUniform(f_shape, -1.0, 1.0);
+
+  if (Parameters.Algorithm == MlasConvAlgorithmWinograd) {
+    const size_t tile_size = Parameters.u.Winograd.TileSize;
+    std::vector<float> packed_F(MlasConvWinogradPackFilterSize(tile_size,
+                                                               Parameters.GroupCount,
+                                                               Parameters.FilterCount,
+                                                               Parameters.InputChannels));
+    MlasConvWinogradPackFilter(tile_size,
+                               Parameters.GroupCount,
+                               Parameters.FilterCount,
+                               Parameters.InputChannels,
+                               F.data(),
+                               packed_F.data());
+    F = std::move(packed_F);
+  }
   int64_t y_size = std::accumulate(y_shape.begin(), y_shape.end(), 1LL, std::multiplies<int64_t>());
   std::vector<float> Y(static_cast<size_t>(y_size));
   std::vector<float> working_buffer(WorkingBufferSize);
@@ -137,6 +152,15 @@ void SCONV_NCHW(benchmark::State& state, const char* /*dummy*/) {
   }
 }
 
+// dummy for some strange build error when using Bench capture
+void SCONV_NCHW(benchmark::State& state, const char* /*dummy*/) {
+  SconvNchw(state, false);
+}
+
+void SCONV_NCHW_WINOGRAD(benchmark::State& state, const char* /*dummy*/) {
+  SconvNchw(state, true);
+}
+
 static void ResNet50(benchmark::internal::Benchmark* b) {
   b->ArgNames(ArgNamesForConv(2));
 
@@ -198,6 +222,7 @@ static void ResNet50(benchmark::internal::Benchmark* b) {
 }
 
 BENCHMARK_CAPTURE(SCONV_NCHW, ResNet50, "")->Apply(ResNet50)->UseRealTime();
+BENCHMARK_CAPTURE(SCONV_NCHW_WINOGRAD, ResNet50, "")->Apply(ResNet50)->UseRealTime();
 
 static void TeamsModel(benchmark::internal::Benchmark* b) {
   b->ArgNames(ArgNamesForConv(2));
@@ -220,6 +245,7 @@ static void TeamsModel(benchmark::internal::Benchmark* b) {
 }
 
 BENCHMARK_CAPTURE(SCONV_NCHW, TeamsModel, "")->Apply(TeamsModel)->UseRealTime();
+BENCHMARK_CAPTURE(SCONV_NCHW_WINOGRAD, TeamsModel, "")->Apply(TeamsModel)->UseRealTime();
 
 static void General_Conv2d(benchmark::internal::Benchmark* b) {
   b->ArgNames(ArgNamesForConv(2));
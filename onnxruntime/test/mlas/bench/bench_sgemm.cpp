@@ -3,11 +3,14 @@
 
 #include "mlas.h"
 #include "bench_util.h"
+#include "core/util/thread_utils.h"
 
 #include <stdexcept>
+#include <memory>
 #include <numeric>
 
 static const std::vector<std::string> sgemm_bench_arg_names = {"M", "N", "K"};
+static const std::vector<std::string> sgemv_packed_bench_arg_names = {"N", "K", "Threads"};
 
 void SGEMM(benchmark::State& state, bool pack_b, bool trans_a, bool trans_b, float alpha = 1.0f, float beta = 0.0f) {
   if (state.range(0) <= 0) throw std::invalid_argument("M must greater than 0!");
@@ -94,6 +97,46 @@ void SGEMM(benchmark::State& state, bool pack_b, bool trans_a, bool trans_b, flo
   }
 }
 
+void SGEMV_PACKB(benchmark::State& state, bool trans_a) {
+  if (state.range(0) <= 0) throw std::invalid_argument("N must greater than 0!");
+  if (state.range(1) <= 0) throw std::invalid_argument("K must greater than 0!");
+  if (state.range(2) <= 0) throw std::invalid_argument("Threads must greater than 0!");
+  const size_t N = static_cast<size_t>(state.range(0));
+  const size_t K = static_cast<size_t>(state.range(1));
+  const size_t threads = static_cast<size_t>(state.range(2));
+
+  OrtThreadPoolParams tpo;
+  tpo.thread_pool_size = int(threads);
+  tpo.auto_set_affinity = true;
+  std::unique_ptr<onnxruntime::concurrency::ThreadPool> tp(
+      onnxruntime::concurrency::CreateThreadPool(&onnxruntime::Env::Default(),
+      tpo, onnxruntime::concurrency::ThreadPoolType::INTRA_OP));
+
+  auto A = RandomVectorUniform(K, -1.0f, 1.0f);
+  auto B = RandomVectorUniform(static_cast<size_t>(N * K), -1.0f, 1.0f);
+  std::vector<float> C(N);
+
+  size_t pack_b_size = MlasGemmPackBSize(N, K);
+  std::vector<float> B_packed(pack_b_size);
+  MlasGemmPackB(CblasNoTrans, N, K, B.data(), N, B_packed.data());
+
+  for (auto _ : state) {
+    MlasGemm(
+        trans_a ? CblasTrans : CblasNoTrans,
+        1,
+        N,
+        K,
+        1.0f,
+        A.data(),
+        trans_a ? 1 : K,
+        B_packed.data(),
+        0.0f,
+        C.data(),
+        N,
+        tp.get());
+  }
+}
+
 static void GemmSizeWithOne(benchmark::internal::Benchmark* b) {
   b->ArgNames(sgemm_bench_arg_names);
   ArgsProduct(b, {{1}, {63, 255, 1023}, {63, 255, 1023}});
@@ -101,6 +144,11 @@ static void GemmSizeWithOne(benchmark::internal::Benchmark* b) {
   ArgsProduct(b, {{63, 255, 1023}, {63, 255, 1023}, {1}});
 }
 
+static void GemvPackedSizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames(sgemv_packed_bench_arg_names);
+  ArgsProduct(b, {{768, 1024, 3072, 4096}, {768, 1024, 3072, 4096}, {1, 4, 8}});
+}
+
 static void GemmSizeProducts(benchmark::internal::Benchmark* b) {
   b->ArgNames(sgemm_bench_arg_names);
   ArgsProduct(b, {{63, 255, 1023}, {63, 255, 1023}, {63, 255, 1023}});
@@ -118,3 +166,6 @@ BENCHMARK_CAPTURE(SGEMM, GEMV_ABTrans, false, true, true)->Apply(GemmSizeWithOne
 
 BENCHMARK_CAPTURE(SGEMM, PACKB_NoTransA, true, false, false)->Apply(GemmSizeProducts)->UseRealTime();
 BENCHMARK_CAPTURE(SGEMM, PACKB_TransA, true, true, false)->Apply(GemmSizeProducts)->UseRealTime();
+
+BENCHMARK_CAPTURE(SGEMV_PACKB, NoTransA, false)->Apply(GemvPackedSizes)->UseRealTime();
+BENCHMARK_CAPTURE(SGEMV_PACKB, TransA, true)->Apply(GemvPackedSizes)->UseRealTime();
@@ -0,0 +1,152 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Threaded>
+class MlasBlkQGemmTest : public MlasTestBase {
+ private:
+  MLAS_THREADPOOL* threadpool_;
+  MatrixGuardBuffer<float> BufferA;
+  MatrixGuardBuffer<uint8_t> BufferQuantData;
+  MatrixGuardBuffer<float> BufferScales;
+  MatrixGuardBuffer<uint8_t> BufferZeroPoints;
+  MatrixGuardBuffer<uint8_t> BufferPackedB;
+  MatrixGuardBuffer<float> BufferBias;
+  MatrixGuardBuffer<float> BufferC;
+  MatrixGuardBuffer<float> BufferCReference;
+  MatrixGuardBuffer<float> BufferCMagnitude;
+
+  void Test(size_t M, size_t N, size_t K, size_t BlockSize, size_t Bits, bool HasZeroPoints, bool HasBias) {
+    const size_t BlockCount = (K + BlockSize - 1) / BlockSize;
+    const size_t BlobSize = BlockSize * Bits / 8;
+    const size_t ZeroPointStride = (BlockCount * Bits + 7) / 8;
+
+    const float* A = BufferA.GetBuffer(K * M);
+    uint8_t* QuantData = BufferQuantData.GetBuffer(N * BlockCount * BlobSize);
+    float* Scales = BufferScales.GetBuffer(N * BlockCount);
+    uint8_t* ZeroPoints = HasZeroPoints ? BufferZeroPoints.GetBuffer(N * ZeroPointStride) : nullptr;
+    const float* Bias = HasBias ? BufferBias.GetBuffer(N) : nullptr;
+    float* C = BufferC.GetBuffer(N * M);
+    float* CReference = BufferCReference.GetBuffer(N * M);
+    float* CMagnitude = BufferCMagnitude.GetBuffer(N * M);
+
+    for (size_t i = 0; i < N * BlockCount * BlobSize; i++) {
+      QuantData[i] = static_cast<uint8_t>((i * 37 + 11) & 0xFF);
+    }
+    for (size_t i = 0; i < N * BlockCount; i++) {
+      Scales[i] = 0.01f * static_cast<float>((i % 13) + 1);
+    }
+    for (size_t i = 0; HasZeroPoints && i < N * ZeroPointStride; i++) {
+      ZeroPoints[i] = static_cast<uint8_t>((i * 29 + 3) & 0xFF);
+    }
+
+    size_t PackedBSize = MlasBlkQGemmPackBSize(N, K, BlockSize, Bits);
+    ASSERT_NE(PackedBSize, size_t(0)) << "BlockSize=" << BlockSize << ", Bits=" << Bits;
+
+    void* PackedB = BufferPackedB.GetBuffer(PackedBSize, true);
+    MlasBlkQGemmPackB(N, K, BlockSize, Bits, QuantData, Scales, ZeroPoints, PackedB);
+
+    std::fill_n(C, M * N, -0.5f);
+    MlasBlkQGemm(M, N, K, A, K, PackedB, Bias, C, N, threadpool_);
+
+    ReferenceBlkQGemm(M, N, K, BlockSize, Bits, A, QuantData, Scales, ZeroPoints, Bias, CReference, CMagnitude);
+
+    for (size_t i = 0; i < M * N; i++) {
+      ASSERT_TRUE(CloseEnough(C[i], CReference[i], CMagnitude[i]))
+          << "@[" << i / N << "," << i % N << "], "
+          << "M=" << M << ", N=" << N << ", K=" << K << ", BlockSize=" << BlockSize << ", Bits=" << Bits
+          << ", ZeroPoints=" << HasZeroPoints << ", Bias=" << HasBias;
+    }
+  }
+
+  void ReferenceBlkQGemm(size_t M, size_t N, size_t K, size_t BlockSize, size_t Bits, const float* A,
+                         const uint8_t* QuantData, const float* Scales, const uint8_t* ZeroPoints,
+                         const float* Bias, float* C, float* CMagnitude) {
+    const size_t BlockCount = (K + BlockSize - 1) / BlockSize;
+    const size_t BlobSize = BlockSize * Bits / 8;
+    const size_t ZeroPointStride = (BlockCount * Bits + 7) / 8;
+
+    std::vector<float> B(K * N);
+
+    for (size_t n = 0; n < N; n++) {
+      for (size_t k = 0; k < K; k++) {
+        const size_t block = k / BlockSize;
+        const size_t i = k % BlockSize;
+        const uint8_t* blob = QuantData + (n * BlockCount + block) * BlobSize;
+
+        int q;
+        int zp = 1 << (Bits - 1);
+        if (Bits == 4) {
+          q = (blob[i / 2] >> ((i % 2) * 4)) & 0x0F;
+          if (ZeroPoints != nullptr) {
+            zp = (ZeroPoints[n * ZeroPointStride + block / 2] >> ((block % 2) * 4)) & 0x0F;
+          }
+        } else {
+          q = blob[i];
+          if (ZeroPoints != nullptr) {
+            zp = ZeroPoints[n * ZeroPointStride + block];
+          }
+        }
+
+        B[k * N + n] = static_cast<float>(q - zp) * Scales[n * BlockCount + block];
+      }
+    }
+
+    // The reference is accumulated in double precision. The sum of the magnitudes of the terms bounds the rounding
+    // error of the single precision kernel, which can be much larger than the final result.
+    for (size_t m = 0; m < M; m++) {
+      for (size_t n = 0; n < N; n++) {
+        double sum = (Bias != nullptr) ? Bias[n] : 0.0;
+        double magnitude = (Bias != nullptr) ? std::abs(Bias[n]) : 0.0;
+        for (size_t k = 0; k < K; k++) {
+          const double product = double(A[m * K + k]) * double(B[k * N + n]);
+          sum += product;
+          magnitude += std::abs(product);
+        }
+        C[m * N + n] = static_cast<float>(sum);
+        CMagnitude[m * N + n] = static_cast<float>(magnitude);
+      }
+    }
+  }
+
+  static bool CloseEnough(float actual, float expected, float magnitude) {
+    return std::abs(actual - expected) <= 1e-5f * std::max(magnitude, 1.0f);
+  }
+
+ public:
+  MlasBlkQGemmTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name = std::string("BlkQGemm") + (Threaded ? "_Threaded" : "_SingleThread");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    static const size_t shapes[][3] = {{1, 1, 16}, {1, 37, 64}, {1, 300, 200}, {3, 19, 33},
+                                       {4, 160, 512}, {5, 17, 16}, {16, 129, 300}, {33, 300, 96}};
+
+    for (size_t bits : {4, 8}) {
+      for (size_t block_size : {16, 32, 64, 128, 256}) {
+        for (const auto& shape : shapes) {
+          Test(shape[0], shape[1], shape[2], block_size, bits, false, false);
+          Test(shape[0], shape[1], shape[2], block_size, bits, true, true);
+        }
+      }
+    }
+  }
+};
+
+template <> MlasBlkQGemmTest<false>* MlasTestFixture<MlasBlkQGemmTest<false>>::mlas_tester(nullptr);
+template <> MlasBlkQGemmTest<true>* MlasTestFixture<MlasBlkQGemmTest<true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasBlkQGemmTest<false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasBlkQGemmTest<true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
@@ -0,0 +1,124 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_conv2d.h"
+
+template <bool Threaded>
+class MlasConv2DWinogradTest : public MlasConv2DTest<Threaded> {
+ private:
+  MatrixGuardBuffer<float> BufferPackedFilter;
+
+  void Test(size_t BatchCount,
+            size_t GroupCount,
+            size_t InputChannels,
+            size_t InputHeight,
+            size_t InputWidth,
+            size_t FilterCount,
+            size_t PaddingLeftHeight,
+            size_t PaddingLeftWidth,
+            size_t PaddingRightHeight,
+            size_t PaddingRightWidth) {
+    const size_t OutputHeight = InputHeight + PaddingLeftHeight + PaddingRightHeight - 2;
+    const size_t OutputWidth = InputWidth + PaddingLeftWidth + PaddingRightWidth - 2;
+
+    const size_t InputElements = BatchCount * GroupCount * InputChannels * InputHeight * InputWidth;
+    const size_t FilterElements = GroupCount * FilterCount * InputChannels * 9;
+    const size_t BiasElements = GroupCount * FilterCount;
+    const size_t OutputElements = BatchCount * GroupCount * FilterCount * OutputHeight * OutputWidth;
+
+    const float* Input = this->BufferInput.GetBuffer(InputElements);
+    const float* Filter = this->BufferFilter.GetBuffer(FilterElements);
+    const float* Bias = this->BufferBias.GetBuffer(BiasElements);
+    float* Output = this->BufferOutput.GetBuffer(OutputElements);
+    float* OutputReference = this->BufferOutputReference.GetBuffer(OutputElements);
+
+    int64_t InputShape[] = {int64_t(InputHeight), int64_t(InputWidth)};
+    int64_t KernelShape[] = {3, 3};
+    int64_t DilationShape[] = {1, 1};
+    int64_t Padding[] = {int64_t(PaddingLeftHeight), int64_t(PaddingLeftWidth),
+                         int64_t(PaddingRightHeight), int64_t(PaddingRightWidth)};
+    int64_t StrideShape[] = {1, 1};
+    int64_t OutputShape[] = {int64_t(OutputHeight), int64_t(OutputWidth)};
+
+    MLAS_ACTIVATION Activation;
+    Activation.ActivationKind = MlasIdentityActivation;
+
+    MLAS_CONV_PARAMETERS Parameters;
+    size_t WorkingBufferSize;
+
+    MlasConvPrepare(&Parameters, 2, BatchCount, GroupCount, InputChannels, InputShape, KernelShape,
+                    DilationShape, Padding, StrideShape, OutputShape, FilterCount, &Activation,
+                    &WorkingBufferSize, this->threadpool_, true);
+
+    ASSERT_EQ(Parameters.Algorithm, MlasConvAlgorithmWinograd)
+        << "Cpg" << InputChannels << "/Fpg" << FilterCount << "/H" << InputHeight << "/W" << InputWidth;
+
+    const size_t TileSize = Parameters.u.Winograd.TileSize;
+    const size_t PackedFilterSize = MlasConvWinogradPackFilterSize(TileSize, GroupCount, FilterCount, InputChannels);
+    ASSERT_NE(PackedFilterSize, size_t(0));
+
+    float* PackedFilter = BufferPackedFilter.GetBuffer(PackedFilterSize);
+    MlasConvWinogradPackFilter(TileSize, GroupCount, FilterCount, InputChannels, Filter, PackedFilter);
+
+    MlasConv(&Parameters, Input, PackedFilter, Bias, this->BufferWorking.GetBuffer(WorkingBufferSize), Output,
+             this->threadpool_);
+
+    this->ReferenceConv2D(BatchCount, GroupCount, InputChannels, InputHeight, InputWidth, FilterCount, 3, 3,
+                          PaddingLeftHeight, PaddingLeftWidth, 1, 1, 1, 1, OutputHeight, OutputWidth,
+                          Input, Filter, Bias, OutputReference);
+
+    //
+    // The Winograd transforms change the order of the floating point
+    // operations, so compare relative to the largest output magnitude.
+    //
+
+    float MaximumMagnitude = 1.0f;
+    for (size_t i = 0; i < OutputElements; i++) {
+      MaximumMagnitude = std::max(MaximumMagnitude, std::abs(OutputReference[i]));
+    }
+
+    for (size_t i = 0; i < OutputElements; i++) {
+      ASSERT_LE(std::abs(Output[i] - OutputReference[i]), 1e-4f * MaximumMagnitude)
+          << "@" << i << ", TileSize=" << TileSize << ", "
+          << "B" << BatchCount << "/G" << GroupCount << "/Cpg" << InputChannels << "/Fpg" << FilterCount
+          << "/H" << InputHeight << "/W" << InputWidth
+          << "/Pad" << PaddingLeftHeight << "," << PaddingLeftWidth << ","
+          << PaddingRightHeight << "," << PaddingRightWidth;
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(Threaded ? "Conv2dWinograd_Threaded" : "Conv2dWinograd_SingleThread");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    // F(2x2, 3x3) for small output images.
+    Test(1, 1, 16, 6, 6, 16, 0, 0, 0, 0);
+    Test(1, 1, 16, 7, 9, 24, 1, 1, 1, 1);
+    Test(2, 2, 17, 5, 9, 16, 2, 0, 1, 3);
+
+    // F(4x4, 3x3) for larger output images.
+    Test(1, 1, 16, 8, 8, 16, 1, 1, 1, 1);
+    Test(2, 2, 16, 13, 11, 17, 1, 1, 1, 1);
+    Test(1, 1, 32, 56, 56, 24, 1, 1, 1, 1);
+    Test(3, 1, 17, 200, 9, 33, 1, 1, 1, 1);
+    Test(1, 1, 64, 14, 14, 64, 1, 1, 1, 1);
+    Test(1, 1, 19, 150, 150, 16, 0, 2, 1, 0);
+  }
+};
+
+template <> MlasConv2DWinogradTest<false>* MlasTestFixture<MlasConv2DWinogradTest<false>>::mlas_tester(nullptr);
+template <> MlasConv2DWinogradTest<true>* MlasTestFixture<MlasConv2DWinogradTest<true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasConv2DWinogradTest<false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasConv2DWinogradTest<true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <typename T>
+class MlasEltwiseBinaryTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<T> BufferInputA;
+  MatrixGuardBuffer<T> BufferInputB;
+  MatrixGuardBuffer<T> BufferOutput;
+
+  static T ReferenceOperation(MLAS_ELTWISE_BINARY_KIND Kind, T a, T b) {
+    switch (Kind) {
+      case MlasEltwiseAdd:
+        return a + b;
+      case MlasEltwiseSubtract:
+        return a - b;
+      case MlasEltwiseMultiply:
+        return a * b;
+      default:
+        return a / b;
+    }
+  }
+
+  static void Fill(T* Buffer, size_t N, std::default_random_engine& generator) {
+    std::uniform_int_distribution<int> distribution(-50, 50);
+    for (size_t i = 0; i < N; i++) {
+      int value = distribution(generator);
+      // Avoid division by zero.
+      Buffer[i] = static_cast<T>(value == 0 ? 7 : value);
+    }
+  }
+
+  void Test(size_t Rows, size_t Columns, size_t InputARowStride, bool IsScalarA, size_t InputBRowStride, bool IsScalarB) {
+    const size_t InputASize = (Rows - 1) * InputARowStride + (IsScalarA ? 1 : Columns);
+    const size_t InputBSize = (Rows - 1) * InputBRowStride + (IsScalarB ? 1 : Columns);
+
+    T* InputA = BufferInputA.GetBuffer(InputASize);
+    T* InputB = BufferInputB.GetBuffer(InputBSize);
+    T* Output = BufferOutput.GetBuffer(Rows * Columns);
+
+    std::default_random_engine generator(static_cast<unsigned>(Rows * 131 + Columns));
+    Fill(InputA, InputASize, generator);
+    Fill(InputB, InputBSize, generator);
+
+    for (MLAS_ELTWISE_BINARY_KIND Kind : {MlasEltwiseAdd, MlasEltwiseSubtract, MlasEltwiseMultiply, MlasEltwiseDivide}) {
+      MlasEltwiseBinary<T>(Kind, InputA, InputARowStride, IsScalarA, InputB, InputBRowStride, IsScalarB,
+                           Output, Rows, Columns);
+
+      for (size_t r = 0; r < Rows; r++) {
+        for (size_t c = 0; c < Columns; c++) {
+          T a = InputA[r * InputARowStride + (IsScalarA ? 0 : c)];
+          T b = InputB[r * InputBRowStride + (IsScalarB ? 0 : c)];
+          ASSERT_EQ(Output[r * Columns + c], ReferenceOperation(Kind, a, b))
+              << "Kind=" << Kind << " @[" << r << "," << c << "] of " << Rows << "x" << Columns
+              << " strides " << InputARowStride << "/" << IsScalarA << ", " << InputBRowStride << "/" << IsScalarB;
+        }
+      }
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(std::string("EltwiseBinary_") +
+                                        (std::is_same<T, float>::value ? "Float" : std::is_same<T, int32_t>::value ? "Int32" : "Int64"));
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    for (size_t n = 1; n < 40; n++) {
+      // Element-wise and scalar broadcasts.
+      Test(1, n, 0, false, 0, false);
+      Test(1, n, 0, true, 0, false);
+      Test(1, n, 0, false, 0, true);
+      Test(3, n, n, false, n, false);
+
+      // Row broadcast.
+      Test(5, n, n, false, 0, false);
+      Test(5, n, 0, false, n, false);
+
+      // Column broadcast.
+      Test(4, n, n, false, 1, true);
+      Test(4, n, 1, true, n, false);
+
+      // Outer product style broadcast.
+      Test(6, n, 1, true, 0, false);
+    }
+
+    Test(1, 1, 0, true, 0, true);
+    Test(2, 1000, 1000, false, 0, false);
+  }
+};
+
+template <> MlasEltwiseBinaryTest<float>* MlasTestFixture<MlasEltwiseBinaryTest<float>>::mlas_tester(nullptr);
+template <> MlasEltwiseBinaryTest<int32_t>* MlasTestFixture<MlasEltwiseBinaryTest<int32_t>>::mlas_tester(nullptr);
+template <> MlasEltwiseBinaryTest<int64_t>* MlasTestFixture<MlasEltwiseBinaryTest<int64_t>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasEltwiseBinaryTest<float>>::RegisterShortExecute();
+    count += MlasDirectShortExecuteTests<MlasEltwiseBinaryTest<int32_t>>::RegisterShortExecute();
+    count += MlasDirectShortExecuteTests<MlasEltwiseBinaryTest<int64_t>>::RegisterShortExecute();
+  }
+  return count;
+});
@@ -70,6 +70,9 @@ class FgemmShortExecuteTest : public MlasTestFixture<MlasFgemmTest<T, Packed, Th
     test_registered += RegisterTestTransposeABProduct(128, 3072, 768, 1, 1.0f, 0.0f);
     test_registered += RegisterTestTransposeABProduct(128, 768, 3072, 1, 1.0f, 0.0f);
     test_registered += RegisterTestTransposeABProduct(25, 81, 79, 7, 1.0f, 0.0f);
+    test_registered += RegisterTestTransposeABProduct(1, 3072, 768, 1, 1.0f, 0.0f);
+    test_registered += RegisterTestTransposeABProduct(1, 1001, 2049, 1, 0.5f, 0.0f);
+    test_registered += RegisterTestTransposeABProduct(1, 97, 513, 1, -1.0f, 0.0f);
     return test_registered;
   }
 
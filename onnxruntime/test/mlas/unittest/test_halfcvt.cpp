@@ -0,0 +1,151 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+#include <cmath>
+#include <cstring>
+
+class MlasHalfConvertTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<unsigned short> BufferHalf;
+  MatrixGuardBuffer<unsigned short> BufferHalfOutput;
+  MatrixGuardBuffer<float> BufferFloat;
+
+  // Table of the values of the finite positive half precision bit patterns,
+  // which are monotonically increasing.
+  std::vector<double> PositiveValues;
+
+  static double ReferenceHalfToDouble(unsigned short Value) {
+    const int Exponent = (Value >> 10) & 0x1F;
+    const int Mantissa = Value & 0x3FF;
+    double Magnitude;
+
+    if (Exponent == 0x1F) {
+      Magnitude = (Mantissa == 0) ? std::numeric_limits<double>::infinity()
+                                  : std::numeric_limits<double>::quiet_NaN();
+    } else if (Exponent == 0) {
+      Magnitude = std::ldexp(double(Mantissa), -24);
+    } else {
+      Magnitude = std::ldexp(double(Mantissa + 1024), Exponent - 25);
+    }
+
+    return (Value & 0x8000) ? -Magnitude : Magnitude;
+  }
+
+  unsigned short ReferenceFloatToHalf(float Value) {
+    if (std::isnan(Value)) {
+      return 0x7E00;
+    }
+
+    const unsigned short Sign = std::signbit(Value) ? 0x8000 : 0;
+    const double Magnitude = std::fabs(double(Value));
+
+    // Values at or beyond the midpoint of the largest finite value and the
+    // next power of two round to infinity.
+    if (Magnitude >= 65520.0) {
+      return Sign | 0x7C00;
+    }
+
+    size_t Index = std::lower_bound(PositiveValues.begin(), PositiveValues.end(), Magnitude) - PositiveValues.begin();
+
+    if (Index == PositiveValues.size()) {
+      Index--;
+    } else if (Index > 0) {
+      double Above = PositiveValues[Index];
+      double Below = PositiveValues[Index - 1];
+      if ((Magnitude - Below) < (Above - Magnitude) ||
+          ((Magnitude - Below) == (Above - Magnitude) && ((Index - 1) & 1) == 0)) {
+        Index--;
+      }
+    }
+
+    return Sign | static_cast<unsigned short>(Index);
+  }
+
+  void TestHalfToFloat() {
+    const size_t Count = 0x10000;
+    unsigned short* Input = BufferHalf.GetBuffer(Count);
+    float* Output = BufferFloat.GetBuffer(Count);
+
+    for (size_t i = 0; i < Count; i++) {
+      Input[i] = static_cast<unsigned short>(i);
+    }
+
+    MlasConvertHalfToFloatBuffer(Input, Output, Count);
+
+    for (size_t i = 0; i < Count; i++) {
+      double Expected = ReferenceHalfToDouble(Input[i]);
+      if (std::isnan(Expected)) {
+        ASSERT_TRUE(std::isnan(Output[i])) << "@" << i;
+      } else {
+        ASSERT_EQ(double(Output[i]), Expected) << "@" << i;
+        ASSERT_EQ(std::signbit(Output[i]), std::signbit(Expected)) << "@" << i;
+      }
+    }
+  }
+
+  void TestFloatToHalf(size_t Count) {
+    float* Input = BufferFloat.GetBuffer(Count);
+    unsigned short* Output = BufferHalfOutput.GetBuffer(Count);
+
+    std::default_random_engine generator(static_cast<unsigned>(Count));
+    std::uniform_int_distribution<uint32_t> distribution(0, 0xFFFFFFFF);
+
+    static const float Specials[] = {
+        0.0f, -0.0f, 1.0f, -1.0f, 65504.0f, 65519.0f, 65520.0f, -65536.0f, 5.9604645e-08f, 2.9802322e-08f,
+        2.9802326e-08f, 6.1035156e-05f, 1.0009766f, 1.0004883f, 1.0014648f,
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::denorm_min()};
+
+    for (size_t i = 0; i < Count; i++) {
+      if (i < _countof(Specials)) {
+        Input[i] = Specials[i];
+      } else {
+        // Bias the random bit patterns toward the half precision range.
+        uint32_t Bits = distribution(generator);
+        Bits = (Bits & 0x807FFFFF) | (((Bits >> 23) % 50 + 94) << 23);
+        std::memcpy(&Input[i], &Bits, sizeof(float));
+      }
+    }
+
+    MlasConvertFloatToHalfBuffer(Input, Output, Count);
+
+    for (size_t i = 0; i < Count; i++) {
+      unsigned short Expected = ReferenceFloatToHalf(Input[i]);
+      if (std::isnan(Input[i])) {
+        ASSERT_EQ(Output[i] & 0x7E00, 0x7E00) << "@" << i;
+      } else {
+        ASSERT_EQ(Output[i], Expected) << "@" << i << " value " << Input[i];
+      }
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name("HalfConvert");
+    return suite_name.c_str();
+  }
+
+  MlasHalfConvertTest() {
+    for (unsigned short i = 0; i < 0x7C00; i++) {
+      PositiveValues.push_back(ReferenceHalfToDouble(i));
+    }
+  }
+
+  void ExecuteShort(void) override {
+    TestHalfToFloat();
+
+    for (size_t Count = 1; Count < 40; Count++) {
+      TestFloatToHalf(Count);
+    }
+
+    TestFloatToHalf(100003);
+  }
+};
+
+template <> MlasHalfConvertTest* MlasTestFixture<MlasHalfConvertTest>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  return is_short_execute ? MlasDirectShortExecuteTests<MlasHalfConvertTest>::RegisterShortExecute() : 0;
+});
@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Threaded>
+class MlasLayerNormTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferInput;
+  MatrixGuardBuffer<float> BufferSkip;
+  MatrixGuardBuffer<float> BufferBias;
+  MatrixGuardBuffer<float> BufferScale;
+  MatrixGuardBuffer<float> BufferShift;
+  MatrixGuardBuffer<float> BufferOutput;
+  MatrixGuardBuffer<float> BufferOutputReference;
+  MatrixGuardBuffer<float> BufferMean;
+  MatrixGuardBuffer<float> BufferInvStdDev;
+  MLAS_THREADPOOL* threadpool_;
+
+  void ReferenceLayerNorm(const float* Input, const float* Skip, const float* Bias, const float* Scale,
+                          const float* Shift, float* Output, float* Mean, float* InvStdDev,
+                          size_t Rows, size_t Columns, float Epsilon, bool Simplified) {
+    std::vector<double> Row(Columns);
+
+    for (size_t r = 0; r < Rows; r++) {
+      double Sum = 0.0;
+
+      for (size_t c = 0; c < Columns; c++) {
+        double Value = Input[r * Columns + c];
+        if (Skip != nullptr) {
+          Value += Skip[r * Columns + c];
+          if (Bias != nullptr) {
+            Value += Bias[c];
+          }
+        }
+        Row[c] = Value;
+        Sum += Value;
+      }
+
+      double RowMean = Simplified ? 0.0 : Sum / double(Columns);
+      double Variance = 0.0;
+
+      for (size_t c = 0; c < Columns; c++) {
+        Variance += (Row[c] - RowMean) * (Row[c] - RowMean);
+      }
+
+      double RowInvStdDev = 1.0 / std::sqrt(Variance / double(Columns) + double(Epsilon));
+
+      for (size_t c = 0; c < Columns; c++) {
+        double Value = (Row[c] - RowMean) * RowInvStdDev * Scale[c];
+        if (Shift != nullptr) {
+          Value += Shift[c];
+        }
+        Output[r * Columns + c] = float(Value);
+      }
+
+      Mean[r] = float(RowMean);
+      InvStdDev[r] = float(RowInvStdDev);
+    }
+  }
+
+  void Test(size_t Rows, size_t Columns, bool UseSkip, bool UseBias, bool UseShift, bool Simplified) {
+    float* Input = BufferInput.GetBuffer(Rows * Columns);
+    float* Skip = BufferSkip.GetBuffer(Rows * Columns);
+    float* Bias = BufferBias.GetBuffer(Columns);
+    float* Scale = BufferScale.GetBuffer(Columns);
+    float* Shift = BufferShift.GetBuffer(Columns);
+    float* Output = BufferOutput.GetBuffer(Rows * Columns);
+    float* OutputReference = BufferOutputReference.GetBuffer(Rows * Columns);
+    float* Mean = BufferMean.GetBuffer(Rows * 2);
+    float* InvStdDev = BufferInvStdDev.GetBuffer(Rows * 2);
+
+    std::default_random_engine generator(static_cast<unsigned>(Rows * Columns));
+    std::uniform_real_distribution<float> distribution(-2.0f, 3.0f);
+
+    for (size_t i = 0; i < Rows * Columns; i++) {
+      Input[i] = distribution(generator);
+      Skip[i] = distribution(generator);
+    }
+
+    for (size_t c = 0; c < Columns; c++) {
+      Bias[c] = distribution(generator);
+      Scale[c] = distribution(generator);
+      Shift[c] = distribution(generator);
+    }
+
+    const float Epsilon = 1e-5f;
+
+    const float* skip = UseSkip ? Skip : nullptr;
+    const float* bias = UseBias ? Bias : nullptr;
+    const float* shift = UseShift ? Shift : nullptr;
+
+    MlasLayerNormalization(Input, skip, bias, Scale, shift, Output, Mean, InvStdDev,
+                           Rows, Columns, Epsilon, Simplified, threadpool_);
+    ReferenceLayerNorm(Input, skip, bias, Scale, shift, OutputReference, Mean + Rows, InvStdDev + Rows,
+                       Rows, Columns, Epsilon, Simplified);
+
+    constexpr float AbsoluteTolerance = 1e-4f;
+    constexpr float RelativeTolerance = 1e-4f;
+
+    for (size_t i = 0; i < Rows * Columns; i++) {
+      float diff = std::fabs(Output[i] - OutputReference[i]);
+      ASSERT_TRUE(diff <= AbsoluteTolerance || diff <= std::fabs(OutputReference[i]) * RelativeTolerance)
+          << "@" << i << " of " << Rows << "x" << Columns << " skip:" << UseSkip << " bias:" << UseBias
+          << " shift:" << UseShift << " simplified:" << Simplified
+          << ", got: " << Output[i] << ", expecting: " << OutputReference[i];
+    }
+
+    for (size_t r = 0; r < Rows; r++) {
+      ASSERT_NEAR(Mean[r], Mean[Rows + r], 1e-5f) << "mean @" << r;
+      ASSERT_NEAR(InvStdDev[r], InvStdDev[Rows + r], std::fabs(InvStdDev[Rows + r]) * 1e-4f) << "inv_std_dev @" << r;
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(Threaded ? "LayerNorm_Threaded" : "LayerNorm_SingleThread");
+    return suite_name.c_str();
+  }
+
+  MlasLayerNormTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  void ExecuteShort(void) override {
+    for (size_t c = 1; c < 40; c++) {
+      Test(3, c, false, false, true, false);
+      Test(3, c, true, true, true, false);
+      Test(3, c, false, false, false, true);
+    }
+
+    Test(64, 768, false, false, true, false);
+    Test(64, 768, true, true, true, false);
+    Test(64, 768, true, false, false, false);
+    Test(17, 1024, false, false, false, true);
+  }
+};
+
+template <> MlasLayerNormTest<false>* MlasTestFixture<MlasLayerNormTest<false>>::mlas_tester(nullptr);
+template <> MlasLayerNormTest<true>* MlasTestFixture<MlasLayerNormTest<true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasLayerNormTest<false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasLayerNormTest<true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
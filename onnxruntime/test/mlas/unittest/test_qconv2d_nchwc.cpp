@@ -0,0 +1,321 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Threaded>
+class MlasNchwcQConv2DTest : public MlasTestBase {
+ private:
+  MLAS_THREADPOOL* threadpool_;
+  const size_t BlockSize = MlasNchwcGetBlockSize();
+
+  MatrixGuardBuffer<uint8_t> BufferInput;
+  MatrixGuardBuffer<uint8_t> BufferFilter;
+  MatrixGuardBuffer<int32_t> BufferBias;
+  MatrixGuardBuffer<float> BufferScale;
+  MatrixGuardBuffer<uint8_t> BufferOutput;
+  MatrixGuardBuffer<uint8_t> BufferOutputReference;
+  MatrixGuardBuffer<uint8_t> BufferNchwcInput;
+  MatrixGuardBuffer<uint8_t> BufferNchwcFilter;
+  MatrixGuardBuffer<uint8_t> BufferNchwcPackedFilter;
+  MatrixGuardBuffer<int32_t> BufferNchwcBias;
+  MatrixGuardBuffer<float> BufferNchwcScale;
+  MatrixGuardBuffer<uint8_t> BufferNchwcOutput;
+
+  static uint8_t RequantizeValue(int32_t Value, float Scale, uint8_t ZeroPoint) {
+    float FloatValue = float(Value) * Scale;
+    FloatValue = std::max(FloatValue, float(0 - ZeroPoint));
+    FloatValue = std::min(FloatValue, float(255 - ZeroPoint));
+    return uint8_t(int32_t(std::nearbyintf(FloatValue)) + ZeroPoint);
+  }
+
+  void ReferenceQConv2D(size_t BatchCount, size_t GroupCount, size_t InputChannels, size_t InputHeight,
+                        size_t InputWidth, size_t FilterCount, size_t KernelHeight, size_t KernelWidth,
+                        size_t PaddingLeftHeight, size_t PaddingLeftWidth, size_t DilationHeight,
+                        size_t DilationWidth, size_t StrideHeight, size_t StrideWidth, size_t OutputHeight,
+                        size_t OutputWidth, const uint8_t* Input, uint8_t InputZeroPoint, const uint8_t* Filter,
+                        uint8_t FilterZeroPoint, bool FilterIsSigned, const int32_t* Bias, const float* Scale,
+                        bool PerChannelScale, uint8_t OutputZeroPoint, uint8_t* Output) {
+    const int32_t zw = FilterIsSigned ? int32_t(int8_t(FilterZeroPoint)) : int32_t(FilterZeroPoint);
+
+    for (size_t b = 0; b < BatchCount; b++) {
+      for (size_t g = 0; g < GroupCount; g++) {
+        for (size_t f = 0; f < FilterCount; f++) {
+          const size_t Channel = g * FilterCount + f;
+          for (size_t oh = 0; oh < OutputHeight; oh++) {
+            for (size_t ow = 0; ow < OutputWidth; ow++) {
+              int32_t Sum = Bias[Channel];
+              for (size_t ic = 0; ic < InputChannels; ic++) {
+                for (size_t kh = 0; kh < KernelHeight; kh++) {
+                  const size_t ih = oh * StrideHeight + kh * DilationHeight - PaddingLeftHeight;
+                  if (ih >= InputHeight) {
+                    continue;
+                  }
+                  for (size_t kw = 0; kw < KernelWidth; kw++) {
+                    const size_t iw = ow * StrideWidth + kw * DilationWidth - PaddingLeftWidth;
+                    if (iw >= InputWidth) {
+                      continue;
+                    }
+                    const size_t InputIndex =
+                        (((b * GroupCount + g) * InputChannels + ic) * InputHeight + ih) * InputWidth + iw;
+                    const size_t FilterIndex =
+                        ((Channel * InputChannels + ic) * KernelHeight + kh) * KernelWidth + kw;
+                    const int32_t w = FilterIsSigned ? int32_t(int8_t(Filter[FilterIndex]))
+                                                     : int32_t(Filter[FilterIndex]);
+                    Sum += (int32_t(Input[InputIndex]) - int32_t(InputZeroPoint)) * (w - zw);
+                  }
+                }
+              }
+              const size_t OutputIndex =
+                  (((b * GroupCount * FilterCount) + Channel) * OutputHeight + oh) * OutputWidth + ow;
+              Output[OutputIndex] = RequantizeValue(Sum, Scale[PerChannelScale ? Channel : 0], OutputZeroPoint);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  void Test(size_t BatchCount, size_t GroupCount, size_t InputChannels, size_t InputHeight, size_t InputWidth,
+            size_t FilterCount, size_t KernelHeight, size_t KernelWidth, size_t PaddingLeftHeight,
+            size_t PaddingLeftWidth, size_t PaddingRightHeight, size_t PaddingRightWidth, size_t DilationHeight,
+            size_t DilationWidth, size_t StrideHeight, size_t StrideWidth, bool FilterIsSigned,
+            bool PerChannelScale) {
+    const size_t OutputHeight =
+        (InputHeight + PaddingLeftHeight + PaddingRightHeight - DilationHeight * (KernelHeight - 1) - 1) /
+            StrideHeight + 1;
+    const size_t OutputWidth =
+        (InputWidth + PaddingLeftWidth + PaddingRightWidth - DilationWidth * (KernelWidth - 1) - 1) /
+            StrideWidth + 1;
+
+    const size_t Channels = GroupCount * InputChannels;
+    const size_t OutputChannels = GroupCount * FilterCount;
+    const size_t NchwcChannels = (Channels + BlockSize - 1) & ~(BlockSize - 1);
+    const size_t NchwcOutputChannels = (OutputChannels + BlockSize - 1) & ~(BlockSize - 1);
+    const size_t InputSize = InputHeight * InputWidth;
+    const size_t OutputSize = OutputHeight * OutputWidth;
+    const size_t KernelSize = KernelHeight * KernelWidth;
+
+    const uint8_t InputZeroPoint = 131;
+    const uint8_t FilterZeroPoint = FilterIsSigned ? uint8_t(-3) : uint8_t(121);
+    const uint8_t OutputZeroPoint = 119;
+
+    uint8_t* Input = BufferInput.GetBuffer(BatchCount * Channels * InputSize);
+    uint8_t* Filter = BufferFilter.GetBuffer(OutputChannels * InputChannels * KernelSize);
+    int32_t* Bias = BufferBias.GetBuffer(OutputChannels);
+    float* Scale = BufferScale.GetBuffer(OutputChannels);
+    uint8_t* Output = BufferOutput.GetBuffer(BatchCount * OutputChannels * OutputSize);
+    uint8_t* OutputReference = BufferOutputReference.GetBuffer(BatchCount * OutputChannels * OutputSize);
+
+    for (size_t i = 0; i < BatchCount * Channels * InputSize; i++) {
+      Input[i] = uint8_t((i * 73 + 11) % 256);
+    }
+    // Signed filter values are limited to 7 bits, as the U8S8 kernels without
+    // VNNI saturate the 16-bit sums of pairs of products.
+    for (size_t i = 0; i < OutputChannels * InputChannels * KernelSize; i++) {
+      Filter[i] = FilterIsSigned ? uint8_t((i * 29 + 7) % 128 - 64) : uint8_t((i * 29 + 7) % 256);
+    }
+    for (size_t i = 0; i < OutputChannels; i++) {
+      Bias[i] = (int32_t(i * 97 % 1000) - 500) * 64;
+      Scale[i] = 1.0f / (float(48 * (1 + i % 3)) * std::sqrt(float(InputChannels * KernelSize)));
+    }
+
+    ReferenceQConv2D(BatchCount, GroupCount, InputChannels, InputHeight, InputWidth, FilterCount, KernelHeight,
+                     KernelWidth, PaddingLeftHeight, PaddingLeftWidth, DilationHeight, DilationWidth, StrideHeight,
+                     StrideWidth, OutputHeight, OutputWidth, Input, InputZeroPoint, Filter, FilterZeroPoint,
+                     FilterIsSigned, Bias, Scale, PerChannelScale, OutputZeroPoint, OutputReference);
+
+    //
+    // Reorder the filter, bias, and scale buffers to the NCHWc block size.
+    //
+
+    int64_t FilterShape[] = {int64_t(OutputChannels), int64_t(InputChannels), int64_t(KernelHeight),
+                             int64_t(KernelWidth)};
+
+    const bool Depthwise = (GroupCount > 1 && InputChannels == 1 && FilterCount == 1);
+
+    uint8_t* NchwcFilter;
+    uint8_t* NchwcPackedFilter = nullptr;
+    if (Depthwise) {
+      NchwcFilter = BufferNchwcFilter.GetBuffer(NchwcOutputChannels * KernelSize);
+      MlasReorderFilterOIHWBo(FilterShape, Filter, NchwcFilter, FilterZeroPoint);
+    } else {
+      const size_t NchwcInputChannels = (InputChannels + BlockSize - 1) & ~(BlockSize - 1);
+      const size_t NchwcFilterCount = (FilterCount + BlockSize - 1) & ~(BlockSize - 1);
+      NchwcFilter = BufferNchwcFilter.GetBuffer(GroupCount * KernelSize * NchwcInputChannels * NchwcFilterCount);
+      MlasReorderFilterHWIO(FilterShape, GroupCount, Filter, NchwcFilter, FilterZeroPoint);
+      const size_t PackedFilterSize = MlasNchwcPackFilterSize(FilterShape, GroupCount, FilterIsSigned);
+      if (PackedFilterSize > 0) {
+        NchwcPackedFilter = BufferNchwcPackedFilter.GetBuffer(PackedFilterSize);
+        MlasNchwcPackFilter(FilterShape, GroupCount, NchwcFilter, FilterIsSigned, NchwcPackedFilter);
+      }
+    }
+
+    int32_t* NchwcBias = BufferNchwcBias.GetBuffer(NchwcOutputChannels, true);
+    std::copy_n(Bias, OutputChannels, NchwcBias);
+    float* NchwcScale = BufferNchwcScale.GetBuffer(NchwcOutputChannels, true);
+    std::copy_n(Scale, OutputChannels, NchwcScale);
+
+    //
+    // Reorder the input buffer.
+    //
+
+    uint8_t* NchwcInput = BufferNchwcInput.GetBuffer(BatchCount * NchwcChannels * InputSize);
+    for (size_t b = 0; b < BatchCount; b++) {
+      MlasReorderInputNchw(Input + b * Channels * InputSize, NchwcInput + b * NchwcChannels * InputSize, Channels,
+                           InputSize);
+    }
+
+    int64_t InputShape[] = {int64_t(BatchCount), int64_t(NchwcChannels), int64_t(InputHeight), int64_t(InputWidth)};
+    int64_t KernelShape[] = {int64_t(KernelHeight), int64_t(KernelWidth)};
+    int64_t DilationShape[] = {int64_t(DilationHeight), int64_t(DilationWidth)};
+    int64_t Padding[] = {int64_t(PaddingLeftHeight), int64_t(PaddingLeftWidth), int64_t(PaddingRightHeight),
+                         int64_t(PaddingRightWidth)};
+    int64_t StrideShape[] = {int64_t(StrideHeight), int64_t(StrideWidth)};
+    int64_t NchwcOutputShape[] = {int64_t(BatchCount), int64_t(NchwcOutputChannels), int64_t(OutputHeight),
+                                  int64_t(OutputWidth)};
+    int64_t OutputShape[] = {int64_t(BatchCount), int64_t(OutputChannels), int64_t(OutputHeight),
+                             int64_t(OutputWidth)};
+
+    uint8_t* NchwcOutput = BufferNchwcOutput.GetBuffer(BatchCount * NchwcOutputChannels * OutputSize);
+
+    for (bool FilterIsPacked : {false, true}) {
+      if (FilterIsPacked && NchwcPackedFilter == nullptr) {
+        continue;
+      }
+
+      MlasNchwcConv(InputShape, KernelShape, DilationShape, Padding, StrideShape, NchwcOutputShape,
+                    Depthwise ? NchwcChannels : GroupCount, NchwcInput, InputZeroPoint,
+                    FilterIsPacked ? NchwcPackedFilter : NchwcFilter, FilterZeroPoint, FilterIsSigned,
+                    FilterIsPacked, NchwcBias, NchwcScale, PerChannelScale, OutputZeroPoint, NchwcOutput,
+                    threadpool_);
+
+      MlasReorderOutputNchw(OutputShape, NchwcOutput, Output);
+
+      for (size_t i = 0; i < BatchCount * OutputChannels * OutputSize; i++) {
+        ASSERT_EQ(Output[i], OutputReference[i])
+            << "@" << i << ", B" << BatchCount << "/G" << GroupCount << "/Cpg" << InputChannels << "/Fpg"
+            << FilterCount << "/H" << InputHeight << "/W" << InputWidth << "/KH" << KernelHeight << "/KW"
+            << KernelWidth << "/Pad" << PaddingLeftHeight << "," << PaddingLeftWidth << "," << PaddingRightHeight
+            << "," << PaddingRightWidth << "/Dilation" << DilationHeight << "," << DilationWidth << "/Stride"
+            << StrideHeight << "," << StrideWidth << ", FilterIsSigned=" << FilterIsSigned
+            << ", PerChannelScale=" << PerChannelScale << ", FilterIsPacked=" << FilterIsPacked;
+      }
+    }
+  }
+
+  void TestMaximumPool(size_t BatchCount, size_t Channels, size_t InputHeight, size_t InputWidth,
+                       size_t KernelHeight, size_t KernelWidth, size_t PaddingLeftHeight, size_t PaddingLeftWidth,
+                       size_t PaddingRightHeight, size_t PaddingRightWidth, size_t StrideHeight,
+                       size_t StrideWidth) {
+    const size_t OutputHeight = (InputHeight + PaddingLeftHeight + PaddingRightHeight - KernelHeight) / StrideHeight + 1;
+    const size_t OutputWidth = (InputWidth + PaddingLeftWidth + PaddingRightWidth - KernelWidth) / StrideWidth + 1;
+
+    const size_t NchwcChannels = (Channels + BlockSize - 1) & ~(BlockSize - 1);
+    const size_t InputSize = InputHeight * InputWidth;
+    const size_t OutputSize = OutputHeight * OutputWidth;
+
+    uint8_t* Input = BufferInput.GetBuffer(BatchCount * Channels * InputSize);
+    uint8_t* Output = BufferOutput.GetBuffer(BatchCount * Channels * OutputSize);
+    uint8_t* OutputReference = BufferOutputReference.GetBuffer(BatchCount * Channels * OutputSize);
+
+    for (size_t i = 0; i < BatchCount * Channels * InputSize; i++) {
+      Input[i] = uint8_t((i * 151 + 17) % 256);
+    }
+
+    for (size_t bc = 0; bc < BatchCount * Channels; bc++) {
+      for (size_t oh = 0; oh < OutputHeight; oh++) {
+        for (size_t ow = 0; ow < OutputWidth; ow++) {
+          uint8_t Maximum = 0;
+          for (size_t kh = 0; kh < KernelHeight; kh++) {
+            const size_t ih = oh * StrideHeight + kh - PaddingLeftHeight;
+            for (size_t kw = 0; kw < KernelWidth; kw++) {
+              const size_t iw = ow * StrideWidth + kw - PaddingLeftWidth;
+              if (ih < InputHeight && iw < InputWidth) {
+                Maximum = std::max(Maximum, Input[(bc * InputHeight + ih) * InputWidth + iw]);
+              }
+            }
+          }
+          OutputReference[(bc * OutputHeight + oh) * OutputWidth + ow] = Maximum;
+        }
+      }
+    }
+
+    uint8_t* NchwcInput = BufferNchwcInput.GetBuffer(BatchCount * NchwcChannels * InputSize);
+    for (size_t b = 0; b < BatchCount; b++) {
+      MlasReorderInputNchw(Input + b * Channels * InputSize, NchwcInput + b * NchwcChannels * InputSize, Channels,
+                           InputSize);
+    }
+
+    int64_t InputShape[] = {int64_t(BatchCount), int64_t(NchwcChannels), int64_t(InputHeight), int64_t(InputWidth)};
+    int64_t KernelShape[] = {int64_t(KernelHeight), int64_t(KernelWidth)};
+    int64_t DilationShape[] = {1, 1};
+    int64_t Padding[] = {int64_t(PaddingLeftHeight), int64_t(PaddingLeftWidth), int64_t(PaddingRightHeight),
+                         int64_t(PaddingRightWidth)};
+    int64_t StrideShape[] = {int64_t(StrideHeight), int64_t(StrideWidth)};
+    int64_t NchwcOutputShape[] = {int64_t(BatchCount), int64_t(NchwcChannels), int64_t(OutputHeight),
+                                  int64_t(OutputWidth)};
+    int64_t OutputShape[] = {int64_t(BatchCount), int64_t(Channels), int64_t(OutputHeight), int64_t(OutputWidth)};
+
+    uint8_t* NchwcOutput = BufferNchwcOutput.GetBuffer(BatchCount * NchwcChannels * OutputSize);
+
+    MlasNchwcPool(MlasMaximumPooling, InputShape, KernelShape, DilationShape, Padding, StrideShape,
+                  NchwcOutputShape, NchwcInput, NchwcOutput, threadpool_);
+
+    MlasReorderOutputNchw(OutputShape, NchwcOutput, Output);
+
+    for (size_t i = 0; i < BatchCount * Channels * OutputSize; i++) {
+      ASSERT_EQ(Output[i], OutputReference[i])
+          << "@" << i << ", B" << BatchCount << "/C" << Channels << "/H" << InputHeight << "/W" << InputWidth
+          << "/KH" << KernelHeight << "/KW" << KernelWidth << "/Stride" << StrideHeight << "," << StrideWidth;
+    }
+  }
+
+ public:
+  MlasNchwcQConv2DTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(Threaded ? "QConv2dNchwc_Threaded" : "QConv2dNchwc_SingleThread");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    for (bool FilterIsSigned : {false, true}) {
+      for (bool PerChannelScale : {false, true}) {
+        // NCHWc convolutions with padded input and output channels.
+        Test(1, 1, 16, 9, 11, 16, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, FilterIsSigned, PerChannelScale);
+        Test(2, 1, 20, 12, 7, 37, 3, 3, 0, 1, 2, 0, 1, 1, 2, 2, FilterIsSigned, PerChannelScale);
+        Test(1, 1, 64, 14, 14, 64, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, FilterIsSigned, PerChannelScale);
+        Test(1, 1, 32, 21, 35, 24, 5, 3, 2, 1, 2, 1, 2, 1, 1, 2, FilterIsSigned, PerChannelScale);
+        Test(1, 1, 17, 5, 30, 9, 5, 30, 0, 0, 0, 0, 1, 1, 1, 1, FilterIsSigned, PerChannelScale);
+        Test(1, 1, 32, 6, 6, 272, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, FilterIsSigned, PerChannelScale);
+        // Grouped convolutions.
+        Test(1, 2, 16, 8, 8, 32, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, FilterIsSigned, PerChannelScale);
+        // Depthwise convolutions.
+        Test(1, 32, 1, 28, 28, 1, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, FilterIsSigned, PerChannelScale);
+        Test(2, 20, 1, 15, 19, 1, 3, 3, 1, 1, 1, 1, 1, 1, 2, 2, FilterIsSigned, PerChannelScale);
+        Test(1, 48, 1, 17, 17, 1, 5, 5, 2, 2, 2, 2, 2, 2, 1, 1, FilterIsSigned, PerChannelScale);
+        Test(1, 16, 1, 34, 35, 1, 33, 33, 0, 1, 0, 1, 1, 1, 1, 1, FilterIsSigned, PerChannelScale);
+      }
+    }
+
+    TestMaximumPool(1, 16, 8, 8, 2, 2, 0, 0, 0, 0, 2, 2);
+    TestMaximumPool(2, 20, 13, 11, 3, 3, 1, 1, 1, 1, 2, 2);
+    TestMaximumPool(1, 64, 7, 7, 7, 7, 0, 0, 0, 0, 1, 1);
+    TestMaximumPool(3, 9, 28, 29, 3, 3, 1, 1, 1, 1, 1, 1);
+  }
+};
+
+template <> MlasNchwcQConv2DTest<false>* MlasTestFixture<MlasNchwcQConv2DTest<false>>::mlas_tester(nullptr);
+template <> MlasNchwcQConv2DTest<true>* MlasTestFixture<MlasNchwcQConv2DTest<true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute && MlasNchwcGetBlockSize() > 1) {
+    count += MlasDirectShortExecuteTests<MlasNchwcQConv2DTest<false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasNchwcQConv2DTest<true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
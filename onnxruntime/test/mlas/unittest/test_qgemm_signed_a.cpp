@@ -0,0 +1,146 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Packed, bool Threaded>
+class MlasQgemmSignedATest : public MlasTestBase {
+ private:
+  MLAS_THREADPOOL* threadpool_;
+  MatrixGuardBuffer<uint8_t> BufferA;
+  MatrixGuardBuffer<uint8_t> BufferB;
+  MatrixGuardBuffer<uint8_t> BufferBPacked;
+  MatrixGuardBuffer<uint8_t> BufferZeroPointB;
+  MatrixGuardBuffer<int32_t> BufferC;
+  MatrixGuardBuffer<int32_t> BufferCReference;
+
+  void Test(size_t M, size_t N, size_t K, int8_t offa, uint8_t offb, bool BIsSigned, bool PerColumnZeroPoints,
+            bool FullRange = false) {
+    uint8_t* A = BufferA.GetBuffer(K * M);
+    uint8_t* B = BufferB.GetBuffer(N * K);
+
+    if (FullRange) {
+      // Products of the int8 extremes overflow the 16-bit intermediates of
+      // kernels that multiply unsigned by signed bytes with saturation.
+      // Adjacent elements along K are paired so that both products of a pair
+      // share the same sign.
+      static const int8_t extremes[] = {-128, -127, 127, 126};
+      for (size_t m = 0; m < M; m++) {
+        for (size_t k = 0; k < K; k++) {
+          A[m * K + k] = static_cast<uint8_t>(extremes[(k / 2 + m) % 4]);
+        }
+      }
+      for (size_t k = 0; k < K; k++) {
+        for (size_t n = 0; n < N; n++) {
+          B[k * N + n] = BIsSigned ? static_cast<uint8_t>(extremes[(k / 2 + n) % 4])
+                                   : static_cast<uint8_t>(((k / 2 + n) % 2) ? 255 : 0);
+        }
+      }
+    }
+
+    const uint8_t* ZeroPointB = PerColumnZeroPoints ? BufferZeroPointB.GetBuffer(N) : &offb;
+    int32_t* C = BufferC.GetBuffer(N * M);
+    int32_t* CReference = BufferCReference.GetBuffer(N * M);
+
+    MLAS_GEMM_U8X8_SHAPE_PARAMS GemmShape;
+    GemmShape.M = M;
+    GemmShape.N = N;
+    GemmShape.K = K;
+    GemmShape.AIsSigned = true;
+    GemmShape.BIsSigned = BIsSigned;
+
+    MLAS_GEMM_U8X8_DATA_PARAMS GemmParameters;
+    GemmParameters.A = A;
+    GemmParameters.lda = K;
+    GemmParameters.ZeroPointA = static_cast<uint8_t>(offa);
+    GemmParameters.ZeroPointB = ZeroPointB;
+    GemmParameters.PerColumnZeroPoints = PerColumnZeroPoints;
+    GemmParameters.C = C;
+    GemmParameters.ldc = N;
+
+    if (Packed) {
+      void* PackedB = BufferBPacked.GetBuffer(MlasGemmPackBSize(N, K, true, BIsSigned));
+      MlasGemmPackB(N, K, B, N, true, BIsSigned, PackedB);
+      GemmParameters.B = PackedB;
+      GemmParameters.BIsPacked = true;
+    } else {
+      GemmParameters.B = B;
+      GemmParameters.ldb = N;
+    }
+
+    std::fill_n(C, M * N, -1);
+    MlasGemm(GemmShape, GemmParameters, threadpool_);
+
+    for (size_t m = 0; m < M; m++) {
+      for (size_t n = 0; n < N; n++) {
+        const int32_t zb = BIsSigned ? int32_t(int8_t(ZeroPointB[PerColumnZeroPoints ? n : 0]))
+                                     : int32_t(ZeroPointB[PerColumnZeroPoints ? n : 0]);
+        int32_t sum = 0;
+        for (size_t k = 0; k < K; k++) {
+          const int32_t a = int32_t(int8_t(A[m * K + k])) - offa;
+          const int32_t b = BIsSigned ? int32_t(int8_t(B[k * N + n])) : int32_t(B[k * N + n]);
+          sum += a * (b - zb);
+        }
+        CReference[m * N + n] = sum;
+      }
+    }
+
+    for (size_t i = 0; i < M * N; i++) {
+      ASSERT_EQ(C[i], CReference[i])
+          << "@[" << i / N << "," << i % N << "], "
+          << "M=" << M << ", N=" << N << ", K=" << K << ", offa=" << int(offa) << ", offb=" << int(offb)
+          << ", BIsSigned=" << BIsSigned << ", PerColumnZeroPoints=" << PerColumnZeroPoints
+          << ", FullRange=" << FullRange;
+    }
+  }
+
+ public:
+  MlasQgemmSignedATest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name = std::string("QGemmSignedA") +
+                                          (Packed ? "_Packed" : "_NoPack") +
+                                          (Threaded ? "_Threaded" : "_SingleThread");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    static const size_t shapes[][3] = {{1, 1, 1}, {1, 32, 64}, {1, 37, 19}, {7, 9, 300},
+                                       {16, 160, 70}, {33, 257, 129}, {128, 17, 513}};
+
+    for (bool b_is_signed : {false, true}) {
+      for (const auto& shape : shapes) {
+        Test(shape[0], shape[1], shape[2], 0, 0, b_is_signed, false);
+        Test(shape[0], shape[1], shape[2], -128, 0, b_is_signed, false);
+        Test(shape[0], shape[1], shape[2], 5, 3, b_is_signed, false);
+        Test(shape[0], shape[1], shape[2], -17, 0, b_is_signed, true);
+        Test(shape[0], shape[1], shape[2], 0, 0, b_is_signed, false, true);
+        Test(shape[0], shape[1], shape[2], -128, 127, b_is_signed, false, true);
+      }
+    }
+  }
+};
+
+template <> MlasQgemmSignedATest<false, false>* MlasTestFixture<MlasQgemmSignedATest<false, false>>::mlas_tester(nullptr);
+template <> MlasQgemmSignedATest<false, true>* MlasTestFixture<MlasQgemmSignedATest<false, true>>::mlas_tester(nullptr);
+template <> MlasQgemmSignedATest<true, false>* MlasTestFixture<MlasQgemmSignedATest<true, false>>::mlas_tester(nullptr);
+template <> MlasQgemmSignedATest<true, true>* MlasTestFixture<MlasQgemmSignedATest<true, true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    const bool packing_supported = MlasGemmPackBSize(128, 128, true, false) > 0 &&
+                                   MlasGemmPackBSize(128, 128, true, true) > 0;
+    count += MlasDirectShortExecuteTests<MlasQgemmSignedATest<false, false>>::RegisterShortExecute();
+    if (packing_supported) {
+      count += MlasDirectShortExecuteTests<MlasQgemmSignedATest<true, false>>::RegisterShortExecute();
+    }
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasQgemmSignedATest<false, true>>::RegisterShortExecute();
+      if (packing_supported) {
+        count += MlasDirectShortExecuteTests<MlasQgemmSignedATest<true, true>>::RegisterShortExecute();
+      }
+    }
+  }
+  return count;
+});
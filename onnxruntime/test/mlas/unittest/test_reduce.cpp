@@ -0,0 +1,176 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Threaded>
+class MlasReduceTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferInput;
+  MatrixGuardBuffer<float> BufferOutput;
+  MatrixGuardBuffer<int64_t> BufferIndices;
+  MLAS_THREADPOOL* threadpool_;
+
+  static const char* GetReductionKindName(MLAS_REDUCTION_KIND ReductionKind) {
+    static const char* names[] = {"Sum", "SumSquare", "Mean", "Maximum", "Minimum", "LogSumExp"};
+    return names[ReductionKind];
+  }
+
+  void ReferenceReduce(MLAS_REDUCTION_KIND ReductionKind, const float* Input, size_t ReduceCount,
+                       size_t InnerCount, double* Result) {
+    double Maximum = -std::numeric_limits<double>::infinity();
+    double Minimum = std::numeric_limits<double>::infinity();
+    double Sum = 0.0;
+    double SumSquare = 0.0;
+
+    for (size_t r = 0; r < ReduceCount; r++) {
+      double v = Input[r * InnerCount];
+      Maximum = (std::max)(Maximum, v);
+      Minimum = (std::min)(Minimum, v);
+      Sum += v;
+      SumSquare += v * v;
+    }
+
+    switch (ReductionKind) {
+      case MlasSumReduction:
+        *Result = Sum;
+        break;
+      case MlasSumSquareReduction:
+        *Result = SumSquare;
+        break;
+      case MlasMeanReduction:
+        *Result = Sum / double(ReduceCount);
+        break;
+      case MlasMaximumReduction:
+        *Result = Maximum;
+        break;
+      case MlasMinimumReduction:
+        *Result = Minimum;
+        break;
+      default: {
+        double SumExp = 0.0;
+        for (size_t r = 0; r < ReduceCount; r++) {
+          SumExp += std::exp(double(Input[r * InnerCount]) - Maximum);
+        }
+        *Result = std::log(SumExp) + Maximum;
+        break;
+      }
+    }
+  }
+
+  int64_t ReferenceArgMaximum(const float* Input, size_t ReduceCount, size_t InnerCount, bool SelectLastIndex) {
+    float Maximum = Input[0];
+    int64_t Index = 0;
+
+    for (size_t r = 1; r < ReduceCount; r++) {
+      float v = Input[r * InnerCount];
+      if (v > Maximum || (SelectLastIndex && v == Maximum)) {
+        Maximum = v;
+        Index = int64_t(r);
+      }
+    }
+
+    return Index;
+  }
+
+  void Test(size_t OuterCount, size_t ReduceCount, size_t InnerCount, float MinimumValue, float MaximumValue) {
+    const size_t InputSize = OuterCount * ReduceCount * InnerCount;
+    const size_t OutputSize = OuterCount * InnerCount;
+
+    float* Input = BufferInput.GetBuffer(InputSize);
+    float* Output = BufferOutput.GetBuffer(OutputSize);
+    int64_t* Indices = BufferIndices.GetBuffer(OutputSize);
+
+    std::default_random_engine generator(static_cast<unsigned>(InputSize));
+    std::uniform_real_distribution<float> distribution(MinimumValue, MaximumValue);
+
+    for (size_t i = 0; i < InputSize; i++) {
+      Input[i] = distribution(generator);
+    }
+
+    for (int kind = 0; kind < MlasReductionKindCount; kind++) {
+      MLAS_REDUCTION_KIND ReductionKind = MLAS_REDUCTION_KIND(kind);
+
+      MlasReduce(ReductionKind, Input, Output, OuterCount, ReduceCount, InnerCount, threadpool_);
+
+      for (size_t o = 0; o < OuterCount; o++) {
+        for (size_t j = 0; j < InnerCount; j++) {
+          double Reference;
+          ReferenceReduce(ReductionKind, Input + o * ReduceCount * InnerCount + j, ReduceCount, InnerCount, &Reference);
+
+          float Value = Output[o * InnerCount + j];
+          double Tolerance = 1e-5 * (std::max)(1.0, std::fabs(Reference));
+          if (ReductionKind == MlasSumReduction || ReductionKind == MlasSumSquareReduction) {
+            Tolerance *= double(ReduceCount);
+          }
+
+          ASSERT_LE(std::fabs(double(Value) - Reference), Tolerance)
+              << GetReductionKindName(ReductionKind) << " @[" << o << "," << j << "] of "
+              << OuterCount << "/" << ReduceCount << "/" << InnerCount
+              << ", got: " << Value << ", expecting: " << Reference;
+        }
+      }
+    }
+
+    //
+    // Quantize the input to force repeated values for the argmax tests.
+    //
+
+    for (size_t i = 0; i < InputSize; i++) {
+      Input[i] = std::round(Input[i]);
+    }
+
+    for (bool SelectLastIndex : {false, true}) {
+      MlasArgMaximum(Input, Indices, OuterCount, ReduceCount, InnerCount, SelectLastIndex, threadpool_);
+
+      for (size_t o = 0; o < OuterCount; o++) {
+        for (size_t j = 0; j < InnerCount; j++) {
+          int64_t Reference = ReferenceArgMaximum(Input + o * ReduceCount * InnerCount + j,
+                                                  ReduceCount, InnerCount, SelectLastIndex);
+
+          ASSERT_EQ(Indices[o * InnerCount + j], Reference)
+              << "ArgMaximum(SelectLastIndex=" << SelectLastIndex << ") @[" << o << "," << j << "] of "
+              << OuterCount << "/" << ReduceCount << "/" << InnerCount;
+        }
+      }
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(Threaded ? "Reduce_Threaded" : "Reduce_SingleThread");
+    return suite_name.c_str();
+  }
+
+  MlasReduceTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  void ExecuteShort(void) override {
+    for (size_t r = 1; r < 80; r++) {
+      Test(1, r, 1, -10.f, 10.f);
+      Test(3, r, 5, -10.f, 10.f);
+    }
+
+    for (size_t i = 1; i < 40; i++) {
+      Test(2, 7, i, -10.f, 10.f);
+    }
+
+    Test(1, 100000, 1, -5.f, 5.f);
+    Test(7, 300, 1, 20.f, 30.f);
+    Test(4, 33, 600, -100.f, 100.f);
+    Test(1, 4000, 33, -1.f, 1.f);
+  }
+};
+
+template <> MlasReduceTest<false>* MlasTestFixture<MlasReduceTest<false>>::mlas_tester(nullptr);
+template <> MlasReduceTest<true>* MlasTestFixture<MlasReduceTest<true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasReduceTest<false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasReduceTest<true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
@@ -0,0 +1,137 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Packed, bool Threaded>
+class MlasSgemmOutputProcessorTest : public MlasTestBase {
+ private:
+  MLAS_THREADPOOL* threadpool_;
+  MatrixGuardBuffer<float> BufferA;
+  MatrixGuardBuffer<float> BufferB;
+  MatrixGuardBuffer<uint8_t> BufferBPacked;
+  MatrixGuardBuffer<float> BufferBias;
+  MatrixGuardBuffer<float> BufferResidual;
+  MatrixGuardBuffer<float> BufferC;
+  MatrixGuardBuffer<float> BufferCReference;
+
+  void Test(CBLAS_TRANSPOSE TransA, CBLAS_TRANSPOSE TransB, size_t M, size_t N, size_t K,
+            MLAS_ACTIVATION_KIND ActivationKind, bool HasBias, bool HasResidual) {
+    const float* A = BufferA.GetBuffer(K * M);
+    const float* B = BufferB.GetBuffer(N * K);
+    const float* Bias = HasBias ? BufferBias.GetBuffer(N) : nullptr;
+    const float* Residual = HasResidual ? BufferResidual.GetBuffer(N * M) : nullptr;
+    float* C = BufferC.GetBuffer(N * M);
+    float* CReference = BufferCReference.GetBuffer(N * M);
+
+    MLAS_ACTIVATION Activation;
+    Activation.ActivationKind = ActivationKind;
+    Activation.Parameters.LeakyRelu.alpha = 0.1f;
+
+    MLAS_SGEMM_BIAS_ACTIVATION_OUTPUT_PROCESSOR OutputProcessor(Bias, &Activation, Residual, N);
+
+    MLAS_SGEMM_DATA_PARAMS Data;
+    Data.A = A;
+    Data.lda = (TransA == CblasNoTrans) ? K : M;
+    Data.B = B;
+    Data.ldb = (TransB == CblasNoTrans) ? N : K;
+    Data.C = C;
+    Data.ldc = N;
+    Data.OutputProcessor = &OutputProcessor;
+
+    if (Packed) {
+      void* PackedB = BufferBPacked.GetBuffer(MlasGemmPackBSize(N, K), true);
+      MlasGemmPackB(TransB, N, K, B, Data.ldb, PackedB);
+      Data.B = static_cast<const float*>(PackedB);
+      Data.BIsPacked = true;
+    }
+
+    std::fill_n(C, M * N, -0.5f);
+    MlasGemm(TransA, TransB, M, N, K, Data, threadpool_);
+
+    ReferenceGemm(TransA, TransB, M, N, K, A, B, Bias, &Activation, Residual, CReference);
+
+    for (size_t i = 0; i < M * N; i++) {
+      ASSERT_TRUE(CloseEnough(C[i], CReference[i]))
+          << "@[" << i / N << "," << i % N << "], "
+          << "TransA=" << TransA << ", TransB=" << TransB << ", M=" << M << ", N=" << N << ", K=" << K
+          << ", Activation=" << ActivationKind << ", Bias=" << HasBias << ", Residual=" << HasResidual;
+    }
+  }
+
+  void ReferenceGemm(CBLAS_TRANSPOSE TransA, CBLAS_TRANSPOSE TransB, size_t M, size_t N, size_t K,
+                     const float* A, const float* B, const float* Bias, const MLAS_ACTIVATION* Activation,
+                     const float* Residual, float* C) {
+    for (size_t m = 0; m < M; m++) {
+      for (size_t n = 0; n < N; n++) {
+        float sum = 0.0f;
+        for (size_t k = 0; k < K; k++) {
+          const float a = (TransA == CblasNoTrans) ? A[m * K + k] : A[k * M + m];
+          const float b = (TransB == CblasNoTrans) ? B[k * N + n] : B[n * K + k];
+          sum += a * b;
+        }
+        C[m * N + n] = sum + (Bias != nullptr ? Bias[n] : 0.0f);
+      }
+    }
+
+    MlasActivation(Activation, C, nullptr, M, N, N);
+
+    if (Residual != nullptr) {
+      for (size_t i = 0; i < M * N; i++) {
+        C[i] += Residual[i];
+      }
+    }
+  }
+
+  static bool CloseEnough(float actual, float expected) {
+    return std::abs(actual - expected) <= 0.0001f * std::max(std::abs(expected), 1.0f);
+  }
+
+ public:
+  MlasSgemmOutputProcessorTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name = std::string("SgemmOutputProcessor") +
+                                          (Packed ? "_Packed" : "_NoPack") +
+                                          (Threaded ? "_Threaded" : "_SingleThread");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    static const MLAS_ACTIVATION_KIND activations[] = {MlasIdentityActivation, MlasReluActivation,
+                                                       MlasLeakyReluActivation, MlasLogisticActivation,
+                                                       MlasGeluActivation};
+    static const size_t shapes[][3] = {{1, 1, 1}, {1, 37, 16}, {37, 1, 16}, {5, 19, 3},
+                                       {16, 160, 70}, {33, 300, 300}, {128, 17, 513}};
+
+    for (CBLAS_TRANSPOSE trans_a : {CblasNoTrans, CblasTrans}) {
+      for (CBLAS_TRANSPOSE trans_b : {CblasNoTrans, CblasTrans}) {
+        for (const auto& shape : shapes) {
+          for (MLAS_ACTIVATION_KIND activation : activations) {
+            Test(trans_a, trans_b, shape[0], shape[1], shape[2], activation, true, false);
+          }
+          Test(trans_a, trans_b, shape[0], shape[1], shape[2], MlasIdentityActivation, false, true);
+          Test(trans_a, trans_b, shape[0], shape[1], shape[2], MlasGeluActivation, true, true);
+        }
+      }
+    }
+  }
+};
+
+template <> MlasSgemmOutputProcessorTest<false, false>* MlasTestFixture<MlasSgemmOutputProcessorTest<false, false>>::mlas_tester(nullptr);
+template <> MlasSgemmOutputProcessorTest<false, true>* MlasTestFixture<MlasSgemmOutputProcessorTest<false, true>>::mlas_tester(nullptr);
+template <> MlasSgemmOutputProcessorTest<true, false>* MlasTestFixture<MlasSgemmOutputProcessorTest<true, false>>::mlas_tester(nullptr);
+template <> MlasSgemmOutputProcessorTest<true, true>* MlasTestFixture<MlasSgemmOutputProcessorTest<true, true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasSgemmOutputProcessorTest<false, false>>::RegisterShortExecute();
+    count += MlasDirectShortExecuteTests<MlasSgemmOutputProcessorTest<true, false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasSgemmOutputProcessorTest<false, true>>::RegisterShortExecute();
+      count += MlasDirectShortExecuteTests<MlasSgemmOutputProcessorTest<true, true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
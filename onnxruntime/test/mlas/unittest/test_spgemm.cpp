@@ -0,0 +1,141 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Threaded>
+class MlasSparseGemmTest : public MlasTestBase {
+ private:
+  MLAS_THREADPOOL* threadpool_;
+  MatrixGuardBuffer<float> BufferA;
+  MatrixGuardBuffer<float> BufferB;
+  MatrixGuardBuffer<uint8_t> BufferBPacked;
+  MatrixGuardBuffer<float> BufferC;
+  MatrixGuardBuffer<float> BufferCReference;
+  std::default_random_engine generator_{1234};
+
+  //
+  // Zero out a fraction of matrix B. Sparsity is applied either to single
+  // elements or to runs of adjacent elements to exercise each block width.
+  //
+  void Sparsify(float* B, size_t Count, float Sparsity, size_t RunLength) {
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    for (size_t i = 0; i < Count; i += RunLength) {
+      if (distribution(generator_) < Sparsity) {
+        std::fill_n(B + i, std::min(RunLength, Count - i), 0.0f);
+      }
+    }
+  }
+
+  void Test(CBLAS_TRANSPOSE TransB, size_t M, size_t N, size_t K, float Sparsity, size_t RunLength,
+            float alpha, float beta, bool NonFinite = false) {
+    float* A = BufferA.GetBuffer(K * M);
+    float* B = BufferB.GetBuffer(N * K);
+    float* C = BufferC.GetBuffer(N * M);
+    float* CReference = BufferCReference.GetBuffer(N * M);
+
+    Sparsify(B, N * K, Sparsity, RunLength);
+
+    const size_t ldb = (TransB == CblasNoTrans) ? N : K;
+
+    //
+    // Place an infinity and a NaN in matrix B and multiply them by zero in
+    // the first row of matrix A. Like the dense product, the result must be
+    // NaN even though these rows of matrix B are scaled by zero.
+    //
+    if (NonFinite) {
+      const size_t k_inf = 0;
+      const size_t k_nan = K - 1;
+      B[(TransB == CblasNoTrans) ? (k_inf * ldb) : k_inf] = std::numeric_limits<float>::infinity();
+      B[(TransB == CblasNoTrans) ? (k_nan * ldb + N - 1) : ((N - 1) * ldb + k_nan)] =
+          std::numeric_limits<float>::quiet_NaN();
+      A[k_inf] = 0.0f;
+      A[k_nan] = 0.0f;
+    }
+
+    size_t PackedBSize = MlasSparseGemmPackBSize(TransB, N, K, B, ldb);
+    ASSERT_GT(PackedBSize, size_t(0));
+    void* PackedB = BufferBPacked.GetBuffer(PackedBSize, true);
+    MlasSparseGemmPackB(TransB, N, K, B, ldb, PackedB);
+
+    std::fill_n(C, M * N, -0.5f);
+    std::fill_n(CReference, M * N, -0.5f);
+
+    MlasSparseGemm(M, N, K, alpha, A, K, PackedB, beta, C, N, threadpool_);
+    ReferenceGemm(TransB, M, N, K, alpha, A, B, ldb, beta, CReference);
+
+    for (size_t i = 0; i < M * N; i++) {
+      ASSERT_TRUE(CloseEnough(C[i], CReference[i]))
+          << "@[" << i / N << "," << i % N << "], "
+          << "TransB=" << TransB << ", M=" << M << ", N=" << N << ", K=" << K
+          << ", Sparsity=" << Sparsity << ", RunLength=" << RunLength
+          << ", alpha=" << alpha << ", beta=" << beta << ", NonFinite=" << NonFinite;
+    }
+  }
+
+  void ReferenceGemm(CBLAS_TRANSPOSE TransB, size_t M, size_t N, size_t K, float alpha,
+                     const float* A, const float* B, size_t ldb, float beta, float* C) {
+    for (size_t m = 0; m < M; m++) {
+      for (size_t n = 0; n < N; n++) {
+        float sum = 0.0f;
+        for (size_t k = 0; k < K; k++) {
+          sum += A[m * K + k] * ((TransB == CblasNoTrans) ? B[k * ldb + n] : B[n * ldb + k]);
+        }
+        C[m * N + n] = (C[m * N + n] * beta) + (sum * alpha);
+      }
+    }
+  }
+
+  static bool CloseEnough(float actual, float expected) {
+    if (std::isnan(expected)) {
+      return std::isnan(actual);
+    }
+    if (std::isinf(expected)) {
+      return actual == expected;
+    }
+    return std::abs(actual - expected) <= 0.0001f * std::max(std::abs(expected), 1.0f);
+  }
+
+ public:
+  MlasSparseGemmTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name = std::string("SparseGemm") +
+                                          (Threaded ? "_Threaded" : "_SingleThread");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    static const float sparsities[] = {0.0f, 0.5f, 0.9f, 1.0f};
+    static const size_t run_lengths[] = {1, 4, 8, 16};
+
+    for (CBLAS_TRANSPOSE trans_b : {CblasNoTrans, CblasTrans}) {
+      for (float sparsity : sparsities) {
+        for (size_t run_length : run_lengths) {
+          for (size_t n = 1; n <= 19; n += 3) {
+            Test(trans_b, 1, n, 17, sparsity, run_length, 1.0f, 0.0f);
+            Test(trans_b, 5, n, 3, sparsity, run_length, 1.0f, 1.0f);
+          }
+          Test(trans_b, 3, 300, 64, sparsity, run_length, 0.5f, 0.0f);
+          Test(trans_b, 16, 517, 33, sparsity, run_length, 1.0f, 2.5f);
+          Test(trans_b, 1, 1024, 256, sparsity, run_length, 1.0f, 0.0f);
+          Test(trans_b, 4, 37, 17, sparsity, run_length, 1.0f, 0.0f, true);
+        }
+      }
+    }
+  }
+};
+
+template <> MlasSparseGemmTest<false>* MlasTestFixture<MlasSparseGemmTest<false>>::mlas_tester(nullptr);
+template <> MlasSparseGemmTest<true>* MlasTestFixture<MlasSparseGemmTest<true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasSparseGemmTest<false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasSparseGemmTest<true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
@@ -54,6 +54,7 @@
 #include "core/optimizer/shape_to_initializer.h"
 #include "core/optimizer/skip_layer_norm_fusion.h"
 #include "core/optimizer/slice_elimination.h"
+#include "core/optimizer/sparse_matmul_transformer.h"
 #include "core/optimizer/unsqueeze_elimination.h"
 #include "core/optimizer/isinf_reducesum_fusion.h"
 #include "core/optimizer/propagate_cast_ops.h"
@@ -62,11 +63,13 @@
 #include "core/session/inference_session.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
 #include "core/util/math.h"
+#include "core/util/thread_utils.h"
 #include "gtest/gtest.h"
 #include "test/capturing_sink.h"
 #include "test/common/tensor_op_test_utils.h"
 #include "test/compare_ortvalue.h"
 #include "test/framework/test_utils.h"
+#include "test/optimizer/graph_transform_test_builder.h"
 #include "test/optimizer/graph_transform_test_fixture.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/test_environment.h"
@@ -460,6 +463,115 @@ TEST_F(GraphTransformationTests, ConstantFolding_RemoveDanglingInputNodesToConst
   ASSERT_TRUE(op_to_count["RandomUniform"] == 0);
 }
 
+// Builds X + Abs(Neg(c0)) and X * Sqrt(c1), which contain two independent constant subgraphs.
+// Returns the output of Neg, which is only consumed inside of its constant subgraph.
+static std::string BuildConstantFoldingBatchTestGraph(ModelTestBuilder& builder, const std::vector<float>& c0) {
+  auto* input_arg = builder.MakeInput<float>({2, 4}, -1.0f, 1.0f);
+  auto* c0_arg = builder.MakeInitializer<float>({4}, c0);
+  auto* c1_arg = builder.MakeInitializer<float>({4}, {4.0f, 9.0f, 16.0f, 25.0f});
+  auto* neg_out = builder.MakeIntermediate();
+  auto* abs_out = builder.MakeIntermediate();
+  auto* sqrt_out = builder.MakeIntermediate();
+  builder.AddNode("Neg", {c0_arg}, {neg_out});
+  builder.AddNode("Abs", {neg_out}, {abs_out});
+  builder.AddNode("Sqrt", {c1_arg}, {sqrt_out});
+  builder.AddNode("Add", {input_arg, abs_out}, {builder.MakeOutput()});
+  builder.AddNode("Mul", {input_arg, sqrt_out}, {builder.MakeOutput()});
+  return neg_out->Name();
+}
+
+TEST_F(GraphTransformationTests, ConstantFoldingBatchedSubgraphs) {
+  OrtThreadPoolParams to;
+  to.thread_pool_size = 2;
+  auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), to, concurrency::ThreadPoolType::INTRA_OP);
+  std::unique_ptr<CPUExecutionProvider> e =
+      std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
+
+  // fold the same model twice with the cache enabled, so that the second time uses the cached tensors for both
+  // subgraphs. The third model only changes the data of c0, so only the Sqrt subgraph is taken from the cache.
+  struct TestCase {
+    std::vector<float> c0;
+    std::vector<float> expected_add_constant;
+    int expected_cache_hits;  // -1 if the cache may already hold the subgraphs from another test
+  };
+  const std::vector<TestCase> test_cases{
+      {{1.0f, -2.0f, 3.0f, -4.0f}, {1.0f, 2.0f, 3.0f, 4.0f}, -1},
+      {{1.0f, -2.0f, 3.0f, -4.0f}, {1.0f, 2.0f, 3.0f, 4.0f}, 2},
+      {{-5.0f, 6.0f, -7.0f, 8.0f}, {5.0f, 6.0f, 7.0f, 8.0f}, 1},
+  };
+
+  for (const auto& test_case : test_cases) {
+    Model model("ConstantFoldingBatchedSubgraphs", false, *logger_);
+    Graph& graph = model.MainGraph();
+    ModelTestBuilder builder(graph);
+    const std::string neg_output = BuildConstantFoldingBatchTestGraph(builder, test_case.c0);
+    ASSERT_STATUS_OK(graph.Resolve());
+
+    auto constant_folding = std::make_unique<ConstantFolding>(
+        *e.get(), false /*skip_dequantize_linear*/, std::unordered_set<std::string>{},
+        std::unordered_set<std::string>{}, 0 /*max_folded_tensor_size*/, tp.get(), 1024 /*cache_size*/);
+    const ConstantFolding* constant_folding_ptr = constant_folding.get();
+
+    onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+    ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(constant_folding), TransformerLevel::Level1));
+    ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_));
+
+    if (test_case.expected_cache_hits >= 0) {
+      EXPECT_EQ(constant_folding_ptr->CacheHitCount(), static_cast<size_t>(test_case.expected_cache_hits));
+    }
+
+    std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+    EXPECT_EQ(op_to_count["Neg"], 0);
+    EXPECT_EQ(op_to_count["Abs"], 0);
+    EXPECT_EQ(op_to_count["Sqrt"], 0);
+
+    // the output of Neg is evaluated in the same frame as Abs, and is not added as an initializer
+    EXPECT_EQ(graph_utils::GetConstantInitializer(graph, neg_output), nullptr);
+
+    for (const auto& node : graph.Nodes()) {
+      const auto* constant = graph_utils::GetConstantInitializer(graph, node.InputDefs()[1]->Name());
+      ASSERT_NE(constant, nullptr);
+      Initializer initializer(*constant, graph.ModelPath());
+      const std::vector<float> expected = node.OpType() == "Add" ? test_case.expected_add_constant
+                                                                 : std::vector<float>{2.0f, 3.0f, 4.0f, 5.0f};
+      EXPECT_EQ(std::vector<float>(initializer.data<float>(), initializer.data<float>() + initializer.size()),
+                expected);
+    }
+  }
+}
+
+TEST_F(GraphTransformationTests, ConstantFoldingMaxTensorSize) {
+  auto test_case = [&](size_t max_folded_tensor_size, bool expect_folded) {
+    Model model("ConstantFoldingMaxTensorSize", false, *logger_);
+    Graph& graph = model.MainGraph();
+    ModelTestBuilder builder(graph);
+    auto* value_arg = builder.MakeScalarInitializer<float>(1.0f);
+    auto* shape_arg = builder.Make1DInitializer<int64_t>({1000});
+    auto* expand_out = builder.MakeIntermediate();
+    builder.AddNode("Expand", {value_arg, shape_arg}, {expand_out});
+    builder.AddNode("Add", {builder.MakeInput<float>({1000}, -1.0f, 1.0f), expand_out}, {builder.MakeOutput()});
+    ASSERT_STATUS_OK(graph.Resolve());
+
+    std::unique_ptr<CPUExecutionProvider> e =
+        std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
+    onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+    ASSERT_STATUS_OK(graph_transformation_mgr.Register(
+        std::make_unique<ConstantFolding>(*e.get(), false /*skip_dequantize_linear*/,
+                                          std::unordered_set<std::string>{}, std::unordered_set<std::string>{},
+                                          max_folded_tensor_size),
+        TransformerLevel::Level1));
+    ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_));
+
+    std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+    EXPECT_EQ(op_to_count["Expand"], expect_folded ? 0 : 1);
+  };
+
+  // the expanded tensor takes 4000 bytes
+  test_case(0, true);
+  test_case(4000, true);
+  test_case(1000, false);
+}
+
 TEST_F(GraphTransformationTests, ShapeToInitializer) {
   auto model_uri = MODEL_FOLDER "shape-add.onnx";
   std::shared_ptr<Model> model;
@@ -4232,5 +4344,39 @@ TEST_F(GraphTransformationTests, PropagateCastOpsTests) {
   }
 }
 
+#ifndef DISABLE_CONTRIB_OPS
+TEST_F(GraphTransformationTests, SparseMatMulTransformer) {
+  auto test_case = [&](float zero_fraction, float threshold, bool expect_sparse) {
+    std::unordered_map<std::string, int> domain_to_version{{kOnnxDomain, 12}, {kMSDomain, 1}};
+    Model model("SparseMatMulTransformer", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                domain_to_version, {}, *logger_);
+    Graph& graph = model.MainGraph();
+    ModelTestBuilder builder(graph);
+
+    std::vector<float> weight(32 * 16, 1.0f);
+    std::fill_n(weight.begin(), static_cast<size_t>(zero_fraction * weight.size()), 0.0f);
+
+    auto* input_arg = builder.MakeInput<float>({4, 32}, -1.0f, 1.0f);
+    auto* weight_arg = builder.MakeInitializer<float>({32, 16}, weight);
+    auto* bias_arg = builder.MakeInitializer<float>({16}, -1.0f, 1.0f);
+    auto* output_arg = builder.MakeOutput();
+    builder.AddNode("Gemm", {input_arg, weight_arg, bias_arg}, {output_arg});
+    ASSERT_STATUS_OK(graph.Resolve());
+
+    onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+    ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::make_unique<SparseMatMulTransformer>(threshold),
+                                                       TransformerLevel::Level2));
+    ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2, *logger_));
+
+    std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+    EXPECT_EQ(op_to_count["Gemm"], expect_sparse ? 0 : 1);
+    EXPECT_EQ(op_to_count["com.microsoft.SparseMatMul"], expect_sparse ? 1 : 0);
+  };
+
+  test_case(0.9f, 0.8f, true);
+  test_case(0.5f, 0.8f, false);
+}
+#endif
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include "core/framework/tensorprotoutils.h"
 #include "core/graph/model.h"
 #include "core/graph/onnx_protobuf.h"
 #include "core/mlas/inc/mlas.h"
@@ -101,6 +102,24 @@ struct NchwcTestHelper {
     return AddNode("Conv", input_args, {output_arg});
   }
 
+  Node& AddQLinearConvNode(NodeArg* input_arg, NodeArg* output_arg, const std::vector<int64_t>& weights_shape,
+                           bool per_channel_scale) {
+    std::vector<float> weights_scale(per_channel_scale ? static_cast<size_t>(weights_shape[0]) : 1);
+    for (size_t i = 0; i < weights_scale.size(); i++) {
+      weights_scale[i] = 0.01f * static_cast<float>((i % 3) + 1);
+    }
+    std::vector<NodeArg*> input_args{input_arg,
+                                     Make1DInitializer<float>({0.05f}),
+                                     Make1DInitializer<uint8_t>({128}),
+                                     MakeInitializer<uint8_t>(weights_shape, FillRandomData<uint8_t>(weights_shape)),
+                                     Make1DInitializer<float>(weights_scale),
+                                     Make1DInitializer<uint8_t>({117}),
+                                     Make1DInitializer<float>({4.0f}),
+                                     Make1DInitializer<uint8_t>({120}),
+                                     MakeInitializer<int32_t>({weights_shape[0]}, FillRandomData<int32_t>({weights_shape[0]}))};
+    return AddNode("QLinearConv", input_args, {output_arg});
+  }
+
   Node& AddClipNode(NodeArg* input_arg, NodeArg* output_arg, float min, float max) {
     int opset_version = graph_.DomainToVersionMap().find(kOnnxDomain)->second;
     std::vector<NodeArg*> input_args{input_arg};
@@ -271,7 +290,9 @@ TEST(NchwcOptimizerTests, ConvNchw) {
 TEST(NchwcOptimizerTests, ConvNchwc) {
   auto test_case = [&](const std::string& activation_op_type) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
-      auto* input_arg = helper.MakeInput<float>({16, 64, 28, 28});
+      // Produce fewer than four output rows so that the 3x3 convolution
+      // isn't eligible for the Winograd algorithm, which stays in NCHW format.
+      auto* input_arg = helper.MakeInput<float>({16, 64, 5, 28});
       auto* output_arg = helper.MakeOutput();
 
       auto* conv_output_arg = output_arg;
@@ -309,7 +330,7 @@ TEST(NchwcOptimizerTests, ConvNchwc) {
 TEST(NchwcOptimizerTests, ConvNchwcGrouped) {
   auto test_case = [&](const std::string& activation_op_type) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
-      auto* input_arg = helper.MakeInput<float>({16, 48, 28, 28});
+      auto* input_arg = helper.MakeInput<float>({16, 48, 5, 28});
       auto* output_arg = helper.MakeOutput();
 
       auto* conv_output_arg = output_arg;
@@ -410,6 +431,96 @@ TEST(NchwcOptimizerTests, ConvPointwise) {
   }
 }
 
+TEST(NchwcOptimizerTests, ConvWinograd) {
+  auto build_test_case = [&](NchwcTestHelper& helper) {
+    auto* input_arg = helper.MakeInput<float>({1, 32, 28, 28});
+    auto* output_arg = helper.MakeOutput();
+
+    auto& conv_node = helper.AddConvNode(input_arg, output_arg, {64, 32, 3, 3});
+    conv_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+  };
+
+  auto check_nchwc_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Conv"], 1);
+    EXPECT_EQ(op_to_count["com.microsoft.nchwc.Conv"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderInput"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderOutput"], 0);
+  };
+
+  // Verify that a 3x3 convolution that the CPU convolution kernel runs with
+  // the Winograd algorithm is left in NCHW format.
+  NchwcOptimizerTester(build_test_case, check_nchwc_graph);
+}
+
+TEST(NchwcOptimizerTests, ConvWinogradDefaultOptimization) {
+  // Ignore the test if NCHWc is not supported by the platform.
+  if (MlasNchwcGetBlockSize() <= 1) {
+    return;
+  }
+
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 13;
+  Model model("nchwc", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              domain_to_version, {}, DefaultLoggingManager().DefaultLogger());
+  NchwcTestHelper helper(model.MainGraph());
+
+  const std::vector<int64_t> input_shape{1, 32, 28, 28};
+  const std::vector<int64_t> weights_shape{64, 32, 3, 3};
+  auto* input_arg = helper.MakeInput<float>(input_shape);
+  auto* conv_output_arg = helper.MakeIntermediate();
+  auto* output_arg = helper.MakeOutput();
+  auto& conv_node = helper.AddConvNode(input_arg, conv_output_arg, weights_shape);
+  conv_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+  helper.AddNode("Relu", {conv_output_arg}, {output_arg});
+  ASSERT_TRUE(model.MainGraph().Resolve().IsOK());
+
+  std::string model_data;
+  model.ToProto().SerializeToString(&model_data);
+
+  // Use the default optimization level, which includes the NCHWc transformer.
+  SessionOptions session_options;
+  session_options.session_logid = "NchwcOptimizerTests";
+  InferenceSessionWrapper session{session_options, GetEnvironment()};
+  ASSERT_TRUE(session.Load(model_data.data(), static_cast<int>(model_data.size())).IsOK());
+  ASSERT_TRUE(session.Initialize().IsOK());
+
+  // The convolution must still be an NCHW node with the shapes from the model
+  // after Conv/Relu fusion and the NCHWc transformer have run.
+  const Node* nchw_conv_node = nullptr;
+  for (auto& node : session.GetGraph().Nodes()) {
+    EXPECT_NE(node.Domain(), kMSNchwcDomain);
+    if (node.OpType() == "Conv" || node.OpType() == "FusedConv") {
+      nchw_conv_node = &node;
+    }
+  }
+  ASSERT_NE(nchw_conv_node, nullptr);
+  const auto* output_shape_proto = nchw_conv_node->OutputDefs()[0]->Shape();
+  ASSERT_NE(output_shape_proto, nullptr);
+  const TensorShape output_shape = utils::GetTensorShapeFromTensorShapeProto(*output_shape_proto);
+  ASSERT_EQ(output_shape, TensorShape({1, 64, 28, 28}));
+
+  // Verify that the CPU convolution kernel selects the Winograd algorithm for
+  // the convolution that reaches it.
+  const int64_t kernel_shape[] = {3, 3};
+  const int64_t dilations[] = {1, 1};
+  const int64_t pads[] = {1, 1, 1, 1};
+  const int64_t strides[] = {1, 1};
+  MLAS_ACTIVATION activation;
+  activation.ActivationKind = MlasIdentityActivation;
+  MLAS_CONV_PARAMETERS parameters;
+  size_t working_buffer_size;
+  MlasConvPrepare(&parameters, 2, 1, 1, static_cast<size_t>(input_shape[1]), input_shape.data() + 2,
+                  kernel_shape, dilations, pads, strides, output_shape.GetDims().data() + 2,
+                  static_cast<size_t>(weights_shape[0]), &activation, &working_buffer_size, nullptr,
+                  true /* AllowWinograd */);
+  EXPECT_EQ(parameters.Algorithm, MlasConvAlgorithmWinograd);
+
+  std::vector<OrtValue> fetches;
+  RunOptions run_options;
+  ASSERT_TRUE(session.Run(run_options, helper.feeds_, helper.output_names_, &fetches).IsOK());
+}
+
 TEST(NchwcOptimizerTests, ConvMaxPool) {
   auto build_test_case = [&](NchwcTestHelper& helper) {
     auto* input_arg = helper.MakeInput<float>({1, 48, 34, 34});
@@ -523,7 +634,7 @@ TEST(NchwcOptimizerTests, ConvGlobalPool) {
 TEST(NchwcOptimizerTests, ConvAddFusion) {
   auto test_case = [&](const std::string& op_type, int opset_version, bool do_relu) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
-      auto* input_arg = helper.MakeInput<float>({1, 32, 28, 28});
+      auto* input_arg = helper.MakeInput<float>({1, 32, 5, 28});
       auto* conv1_output_arg = helper.MakeIntermediate();
       auto* conv2_output_arg = helper.MakeIntermediate();
       auto* output_arg = helper.MakeOutput();
@@ -566,7 +677,7 @@ TEST(NchwcOptimizerTests, ConvAddFusion) {
 
 TEST(NchwcOptimizerTests, ConvNoBiasAddFusion) {
   auto build_test_case = [&](NchwcTestHelper& helper) {
-    auto* input_arg = helper.MakeInput<float>({1, 32, 28, 28});
+    auto* input_arg = helper.MakeInput<float>({1, 32, 5, 28});
     auto* conv1_output_arg = helper.MakeIntermediate();
     auto* conv2_output_arg = helper.MakeIntermediate();
     auto* output_arg = helper.MakeOutput();
@@ -592,7 +703,7 @@ TEST(NchwcOptimizerTests, ConvNoBiasAddFusion) {
 TEST(NchwcOptimizerTests, FusedConvAddFusion) {
   auto test_case = [&](bool do_relu1, bool do_relu2, int add_count) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
-      auto* input_arg = helper.MakeInput<float>({1, 32, 28, 28});
+      auto* input_arg = helper.MakeInput<float>({1, 32, 5, 28});
       auto* add1_input_arg = helper.MakeIntermediate();
       auto* add2_input_arg = helper.MakeIntermediate();
       auto* output_arg = helper.MakeOutput();
@@ -639,7 +750,7 @@ TEST(NchwcOptimizerTests, FusedConvAddFusion) {
 TEST(NchwcOptimizerTests, ConvBinary) {
   auto test_case = [&](const std::string& op_type) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
-      auto* input_arg = helper.MakeInput<float>({1, 32, 23, 23});
+      auto* input_arg = helper.MakeInput<float>({1, 32, 5, 23});
       auto* conv1_output_arg = helper.MakeIntermediate();
       auto* conv2_output_arg = helper.MakeIntermediate();
       auto* relu1_output_arg = helper.MakeIntermediate();
@@ -677,7 +788,7 @@ TEST(NchwcOptimizerTests, ConvBinary) {
 TEST(NchwcOptimizerTests, ConvBinaryBroadcast) {
   auto test_case = [&](const std::string& op_type) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
-      auto* input_arg = helper.MakeInput<float>({1, 32, 25, 21});
+      auto* input_arg = helper.MakeInput<float>({1, 32, 5, 21});
       auto* conv_output_arg = helper.MakeIntermediate();
       auto* pool_output_arg = helper.MakeIntermediate();
       auto* output_arg = helper.MakeOutput();
@@ -747,7 +858,7 @@ TEST(NchwcOptimizerTests, ConvConcat) {
 
 TEST(NchwcOptimizerTests, ConvReuseWeightsOIHWBiBo) {
   auto build_test_case = [&](NchwcTestHelper& helper) {
-    auto* input_arg = helper.MakeInput<float>({1, 64, 7, 7});
+    auto* input_arg = helper.MakeInput<float>({1, 64, 5, 7});
     auto* output1_arg = helper.MakeOutput();
     auto* output2_arg = helper.MakeOutput();
     auto* output3_arg = helper.MakeOutput();
@@ -845,7 +956,10 @@ TEST(NchwcOptimizerTests, ShapeInferencing) {
     type_proto.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("input_height");
     type_proto.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("input_width");
 
-    auto* input_arg = helper.MakeInput<float>({1, 3, 50, 100}, type_proto);
+    // Keep the height small so that the unoptimized graph doesn't run the 3x3
+    // convolutions with the Winograd algorithm, which isn't bit identical to
+    // the NCHWc convolution.
+    auto* input_arg = helper.MakeInput<float>({1, 3, 3, 100}, type_proto);
     auto* output_arg = helper.MakeOutput();
 
     // With these padding and kernel arguments, the shape along each spatial
@@ -939,7 +1053,7 @@ TEST(NchwcOptimizerTests, ShapeInferencing2) {
 
 TEST(NchwcOptimizerTests, MixedOutputUsage) {
   auto build_test_case = [&](NchwcTestHelper& helper) {
-    auto* input_arg = helper.MakeInput<float>({6, 5, 11, 11});
+    auto* input_arg = helper.MakeInput<float>({6, 5, 4, 11});
     auto* output_arg = helper.MakeOutput();
 
     auto* conv1_output_arg = helper.MakeIntermediate();
@@ -1286,7 +1400,7 @@ TEST(NchwcOptimizerTests, Upsample) {
 TEST(NchwcOptimizerTests, Activation) {
   auto test_case = [&](const std::string& activation_op_type) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
-      auto* input_arg = helper.MakeInput<float>({1, 48, 11, 15});
+      auto* input_arg = helper.MakeInput<float>({1, 48, 5, 15});
       auto* conv1_output_arg = helper.MakeIntermediate();
       auto* activation_output_arg = helper.MakeIntermediate();
       auto* mul_output_arg = helper.MakeIntermediate();
@@ -1318,6 +1432,43 @@ TEST(NchwcOptimizerTests, Activation) {
   }
 }
 
+TEST(NchwcOptimizerTests, QLinearConv) {
+  auto test_case = [&](const std::vector<int64_t>& input_shape, const std::vector<int64_t>& weights_shape,
+                       int64_t group_count, bool per_channel_scale) {
+    auto build_test_case = [&](NchwcTestHelper& helper) {
+      auto* input_arg = helper.MakeInput<uint8_t>(input_shape);
+      auto* conv_output_arg = helper.MakeIntermediate();
+      auto* output_arg = helper.MakeOutput();
+
+      auto& conv_node = helper.AddQLinearConvNode(input_arg, conv_output_arg, weights_shape, per_channel_scale);
+      conv_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+      conv_node.AddAttribute("group", group_count);
+
+      auto& pool_node = helper.AddNode("MaxPool", {conv_output_arg}, {output_arg});
+      pool_node.AddAttribute("kernel_shape", std::vector<int64_t>{2, 2});
+      pool_node.AddAttribute("strides", std::vector<int64_t>{2, 2});
+    };
+
+    auto check_nchwc_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.QLinearConv"], 1);
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.MaxPool"], 1);
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderInput"], 1);
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderOutput"], 1);
+    };
+
+    NchwcOptimizerTester(build_test_case, check_nchwc_graph, 12);
+  };
+
+  // Input channels that are not aligned to the block size.
+  test_case({1, 30, 14, 14}, {40, 30, 3, 3}, 1, false);
+  test_case({2, 30, 14, 14}, {40, 30, 3, 3}, 1, true);
+  // Depthwise convolution.
+  test_case({1, 36, 14, 14}, {36, 1, 3, 3}, 36, true);
+  // Grouped convolution.
+  test_case({1, 64, 14, 14}, {64, 32, 3, 3}, 2, false);
+}
+
 TEST(NchwcOptimizerTests, MaxPoolTypeCheck) {
   auto build_test_case = [&](NchwcTestHelper& helper) {
     auto add_pool_node = [&](NchwcTestHelper& helper, NodeArg* input_arg) {
@@ -1330,14 +1481,15 @@ TEST(NchwcOptimizerTests, MaxPoolTypeCheck) {
     const std::vector<int64_t> input_shape{1, 32, 13, 13};
     add_pool_node(helper, helper.MakeInput<float>(input_shape));
     add_pool_node(helper, helper.MakeInput<uint8_t>(input_shape));
+    add_pool_node(helper, helper.MakeInput<int8_t>(input_shape));
   };
 
   auto check_nchwc_graph = [&](InferenceSessionWrapper& session) {
     auto op_to_count = CountOpsInGraph(session.GetGraph());
     EXPECT_EQ(op_to_count["MaxPool"], 1);
-    EXPECT_EQ(op_to_count["com.microsoft.nchwc.MaxPool"], 1);
-    EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderInput"], 1);
-    EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderOutput"], 1);
+    EXPECT_EQ(op_to_count["com.microsoft.nchwc.MaxPool"], 2);
+    EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderInput"], 2);
+    EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderOutput"], 2);
   };
 
   // Verify that the optimizer checks the type of the MaxPool node.
@@ -350,9 +350,15 @@ OnnxRuntimeTestSession::OnnxRuntimeTestSession(Ort::Env& env, std::random_device
 
   session_ = Ort::Session(env, performance_test_config.model_info.model_file_path.c_str(), session_options);
 
+  Ort::AllocatorWithDefaultOptions a;
+  if (performance_test_config.run_config.print_initialization_timings) {
+    char* timings = session_.GetInitializationTimings(a);
+    fprintf(stdout, "Session initialization timings (us): %s\n", timings);
+    a.Free(timings);
+  }
+
   size_t output_count = session_.GetOutputCount();
   output_names_.resize(output_count);
-  Ort::AllocatorWithDefaultOptions a;
   for (size_t i = 0; i != output_count; ++i) {
     char* output_name = session_.GetOutputName(i, a);
     assert(output_name != nullptr);
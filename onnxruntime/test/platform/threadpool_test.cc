@@ -7,8 +7,10 @@
 
 #include "gtest/gtest.h"
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <functional>
+#include <thread>
 
 #ifdef _WIN32
 #include <Windows.h>
@@ -186,6 +188,120 @@ void TestMultiLoopSections(const std::string& name, int num_threads, int num_loo
   }
 }
 
+void TestRunSettingsPriority(const std::string& name, int num_threads, bool use_parallel_section) {
+  // Run normal and high priority loops concurrently over the same thread pool.  The high priority
+  // loops' tasks are queued separately and taken ahead of the normal ones, which must not stop
+  // either kind of loop from completing.
+  for (int rep = 0; rep < 5; rep++) {
+    const int num_tasks = 1024;
+    const int num_concurrent = 4;
+    CreateThreadPoolAndTest(name, num_threads, [&](ThreadPool* tp) {
+      std::vector<std::unique_ptr<TestData>> td;
+      onnxruntime::Barrier b(num_concurrent - 1);
+      for (int c = 0; c < num_concurrent; c++) {
+        td.push_back(CreateTestData(num_tasks));
+      }
+
+      auto run_loops = [&](int c) {
+        ThreadPool::RunSettings settings;
+        settings.priority = (c % 2 == 0) ? ThreadPool::Priority::High : ThreadPool::Priority::Normal;
+        ThreadPool::ScopedRunSettings settings_scope(settings);
+        std::unique_ptr<ThreadPool::ParallelSection> ps;
+        if (use_parallel_section) {
+          ps = std::make_unique<ThreadPool::ParallelSection>(tp);
+        }
+        for (int l = 0; l < 2; l++) {
+          ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t i) {
+            IncrementElement(*td[c], i);
+          });
+        }
+      };
+
+      for (int c = 0; c < num_concurrent - 1; c++) {
+        ThreadPool::Schedule(tp, [&, c]() {
+          run_loops(c);
+          b.Notify();
+        });
+      }
+      run_loops(num_concurrent - 1);
+
+      b.Wait();
+      for (int c = 0; c < num_concurrent; c++) {
+        ValidateTestData(*td[c], 2);
+      }
+    });
+  }
+}
+
+void TestRunSettingsPriorityOrder(const std::string& name) {
+  // Check that a high priority loop queued behind a backlog of normal priority work is started
+  // first.  The pool has a single worker thread, which is held by a gate task while the backlog
+  // and the loop are queued.  The loop's first iteration on the main thread then opens the gate,
+  // and every task records a sequence number when it starts.
+  const int num_backlog = 16;
+  const int num_tasks = 8;
+  CreateThreadPoolAndTest(name, 2, [&](ThreadPool* tp) {
+    const auto main_thread = std::this_thread::get_id();
+    std::atomic<int> next_seq{0};
+    std::atomic<int> num_backlog_done{0};
+    std::atomic<bool> worker_loop_started{false};
+    onnxruntime::OrtMutex mutex;
+    std::vector<int> backlog_seqs;
+    std::vector<int> loop_seqs;
+    onnxruntime::Notification gate_started;
+    onnxruntime::Notification gate_released;
+
+    ThreadPool::Schedule(tp, [&]() {
+      gate_started.Notify();
+      gate_released.Wait();
+    });
+    gate_started.Wait();
+
+    for (int i = 0; i < num_backlog; i++) {
+      ThreadPool::Schedule(tp, [&]() {
+        int seq = next_seq++;
+        {
+          std::lock_guard<onnxruntime::OrtMutex> lock(mutex);
+          backlog_seqs.push_back(seq);
+        }
+        num_backlog_done++;
+      });
+    }
+
+    ThreadPool::RunSettings settings;
+    settings.priority = ThreadPool::Priority::High;
+    ThreadPool::ScopedRunSettings settings_scope(settings);
+    bool gate_opened = false;
+    ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t) {
+      if (std::this_thread::get_id() != main_thread) {
+        int seq = next_seq++;
+        {
+          std::lock_guard<onnxruntime::OrtMutex> lock(mutex);
+          loop_seqs.push_back(seq);
+        }
+        worker_loop_started = true;
+      } else if (!gate_opened) {
+        // Keep iterations available until the worker has picked up either the loop or the backlog.
+        gate_opened = true;
+        gate_released.Notify();
+        while (!worker_loop_started && num_backlog_done < num_backlog) {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    while (num_backlog_done < num_backlog) {
+      std::this_thread::yield();
+    }
+
+    std::lock_guard<onnxruntime::OrtMutex> lock(mutex);
+    ASSERT_EQ(backlog_seqs.size(), static_cast<size_t>(num_backlog));
+    ASSERT_FALSE(loop_seqs.empty());
+    ASSERT_LT(*std::max_element(loop_seqs.cbegin(), loop_seqs.cend()),
+              *std::min_element(backlog_seqs.cbegin(), backlog_seqs.cend()));
+  });
+}
+
 }  // namespace
 
 namespace onnxruntime {
@@ -379,6 +495,130 @@ TEST(ThreadPoolTest, TestMultiLoopSections_4Thread_100Loop) {
   TestMultiLoopSections("TestMultiLoopSections_4Thread_100Loop", 4, 100);
 }
 
+#ifndef _OPENMP
+TEST(ThreadPoolTest, TestRunSettings_MaxDegreeOfParallelism) {
+  auto tp = std::make_unique<ThreadPool>(&onnxruntime::Env::Default(), onnxruntime::ThreadOptions(), nullptr, 4, true);
+  const int default_dop = ThreadPool::DegreeOfParallelism(tp.get());
+  {
+    ThreadPool::RunSettings settings;
+    settings.max_degree_of_parallelism = 2;
+    ThreadPool::ScopedRunSettings settings_scope(settings);
+    ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp.get()), 2);
+
+    // A budget of a single thread runs loops on the calling thread only.
+    settings.max_degree_of_parallelism = 1;
+    ThreadPool::ScopedRunSettings nested_settings_scope(settings);
+    ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp.get()), 1);
+    ASSERT_FALSE(ThreadPool::ShouldParallelize(tp.get()));
+    const auto caller_id = std::this_thread::get_id();
+    std::atomic<int> other_threads{0};
+    ThreadPool::TrySimpleParallelFor(tp.get(), 1024, [&](std::ptrdiff_t) {
+      if (std::this_thread::get_id() != caller_id) {
+        other_threads++;
+      }
+    });
+    ASSERT_EQ(other_threads, 0);
+  }
+  // Restored once the scopes end.
+  ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp.get()), default_dop);
+
+  // A budget above the pool size has no effect.
+  ThreadPool::RunSettings settings;
+  settings.max_degree_of_parallelism = 64;
+  ThreadPool::ScopedRunSettings settings_scope(settings);
+  ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp.get()), default_dop);
+}
+#endif
+
+TEST(ThreadPoolTest, TestRunSettings_Priority_4Thread) {
+  TestRunSettingsPriority("TestRunSettings_Priority_4Thread", 4, false);
+}
+
+TEST(ThreadPoolTest, TestRunSettings_Priority_4Thread_ParallelSection) {
+  TestRunSettingsPriority("TestRunSettings_Priority_4Thread_ParallelSection", 4, true);
+}
+
+#ifndef _OPENMP
+TEST(ThreadPoolTest, TestRunSettings_Priority_Order) {
+  TestRunSettingsPriorityOrder("TestRunSettings_Priority_Order");
+}
+#endif
+
+TEST(ThreadPoolTest, TestSpinLimit) {
+  constexpr int max_spin_count = 1 << 20;
+  ThreadPoolSpinLimit spin_limit(max_spin_count);
+  ASSERT_EQ(spin_limit.Get(), max_spin_count);
+
+  // Work keeps arriving after a few iterations: the limit converges toward a small
+  // multiple of them, but not below the minimum.
+  for (int i = 0; i < 1000; i++) {
+    spin_limit.OnWorkFound(10);
+  }
+  const int min_spin_count = spin_limit.Get();
+  ASSERT_LT(min_spin_count, max_spin_count / 64);
+  ASSERT_GT(min_spin_count, 0);
+
+  // Woken with work soon after blocking: spinning longer would have paid off.
+  spin_limit.OnWokenForWork(1000, 500);
+  ASSERT_EQ(spin_limit.Get(), min_spin_count * 2);
+  for (int i = 0; i < 100; i++) {
+    spin_limit.OnWokenForWork(1000, 500);
+  }
+  ASSERT_EQ(spin_limit.Get(), max_spin_count);
+
+  // Woken after a long idle period: no change.
+  spin_limit.OnWokenForWork(1000, 1000000);
+  ASSERT_EQ(spin_limit.Get(), max_spin_count);
+
+  // Spins that find no work: back off to the minimum.
+  spin_limit.OnSpinMiss();
+  ASSERT_EQ(spin_limit.Get(), (max_spin_count + min_spin_count) / 2);
+  for (int i = 0; i < 100; i++) {
+    spin_limit.OnSpinMiss();
+  }
+  ASSERT_EQ(spin_limit.Get(), min_spin_count);
+
+  // Spinning disabled.
+  ThreadPoolSpinLimit no_spin(0);
+  no_spin.OnWokenForWork(1000, 500);
+  no_spin.OnSpinMiss();
+  no_spin.OnWorkFound(0);
+  ASSERT_EQ(no_spin.Get(), 0);
+}
+
+#ifndef ORT_MINIMAL_BUILD
+TEST(ThreadPoolTest, TestSpinAndWakeStats) {
+  // Run loops separated by idle periods long enough for the workers to block, and check
+  // that the spin and wake-up counters are reported by the thread pool profiler. A worker
+  // blocks after a single spin that finds no work, and even the initial spin limit of 2^20
+  // iterations is far shorter than the idle period.
+  auto tp = std::make_unique<ThreadPool>(&onnxruntime::Env::Default(), onnxruntime::ThreadOptions(), nullptr, 3, true);
+  ThreadPool::StartProfiling(tp.get());
+  for (int rep = 0; rep < 3; rep++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    auto test_data = CreateTestData(1024);
+    ThreadPool::TrySimpleParallelFor(tp.get(), 1024, [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+    ValidateTestData(*test_data);
+  }
+  const std::string stats = ThreadPool::StopProfiling(tp.get());
+  ASSERT_NE(stats.find("\"spin_us\""), std::string::npos);
+  ASSERT_NE(stats.find("\"max_wake_latency_us\""), std::string::npos);
+
+  // Sum the wake-ups of all of the worker threads. Workers that blocked during the idle
+  // periods are woken for the next loop.
+  const std::string num_wake_key = "\"num_wake\": ";
+  uint64_t num_wake = 0;
+  int num_threads_reported = 0;
+  for (size_t pos = stats.find(num_wake_key); pos != std::string::npos; pos = stats.find(num_wake_key, pos)) {
+    pos += num_wake_key.size();
+    num_wake += std::stoull(stats.substr(pos, stats.find_first_of(",}", pos) - pos));
+    num_threads_reported++;
+  }
+  ASSERT_GT(num_threads_reported, 0) << stats;
+  ASSERT_GT(num_wake, 0u) << stats;
+}
+#endif
+
 #ifdef _WIN32
 #pragma warning(push)
 #pragma warning(disable : 6387)
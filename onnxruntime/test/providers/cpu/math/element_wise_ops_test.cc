@@ -127,6 +127,40 @@ TEST(MathOpTest, Add_double) {
   test.Run();
 }
 
+TEST(MathOpTest, Add_float16) {
+  OpTester test("Add", 14);
+  std::vector<int64_t> dims{3, 3};
+  test.AddInput<MLFloat16>("A", dims,
+                           MakeMLFloat16({1.0f, 2.0f, -1.0f,
+                                          0.0f, 1.5f, -100.0f,
+                                          -5.5f, 9.25f, -1000.0f}));
+  test.AddInput<MLFloat16>("B", dims,
+                           MakeMLFloat16({-1.0f, 4.5f, 432.0f,
+                                          0.0f, 3.5f, 64.0f,
+                                          -5.5f, 9.25f, 1000.0f}));
+  test.AddOutput<MLFloat16>("C", dims,
+                            MakeMLFloat16({0.0f, 6.5f, 431.0f,
+                                           0.0f, 5.0f, -36.0f,
+                                           -11.0f, 18.5f, 0.0f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: fp16 is not supported
+}
+
+TEST(MathOpTest, Add_Broadcast_float16) {
+  OpTester test("Add", 14);
+  test.AddInput<MLFloat16>("A", {2, 1, 4},
+                           MakeMLFloat16({1.0f, 2.0f, 3.0f, 4.0f,
+                                          5.0f, 6.0f, 7.0f, 8.0f}));
+  test.AddInput<MLFloat16>("B", {3, 1}, MakeMLFloat16({10.0f, 20.0f, 30.0f}));
+  test.AddOutput<MLFloat16>("C", {2, 3, 4},
+                            MakeMLFloat16({11.0f, 12.0f, 13.0f, 14.0f,
+                                           21.0f, 22.0f, 23.0f, 24.0f,
+                                           31.0f, 32.0f, 33.0f, 34.0f,
+                                           15.0f, 16.0f, 17.0f, 18.0f,
+                                           25.0f, 26.0f, 27.0f, 28.0f,
+                                           35.0f, 36.0f, 37.0f, 38.0f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: fp16 is not supported
+}
+
 TEST(MathOpTest, Add_Broadcast_Axis) {
   OpTester test("Add");
 
@@ -403,6 +437,28 @@ TEST(MathOpTest, Sub_Broadcast_Scalar) {
   run(true);
 }
 
+TEST(MathOpTest, Sub_Broadcast_Column_int64) {
+  OpTester test("Sub");
+  test.AddInput<int64_t>("A", {3, 1}, {10, 20, 30});
+  test.AddInput<int64_t>("B", {3, 4}, {1, 2, 3, 4,
+                                       5, 6, 7, 8,
+                                       9, 10, 11, 12});
+  test.AddOutput<int64_t>("C", {3, 4}, {9, 8, 7, 6,
+                                        15, 14, 13, 12,
+                                        21, 20, 19, 18});
+  test.Run();
+}
+
+TEST(MathOpTest, Div_Broadcast_Row_int32) {
+  OpTester test("Div");
+  test.AddInput<int32_t>("A", {2, 5}, {12, 24, 36, 48, 60,
+                                       -12, -24, -36, -48, -60});
+  test.AddInput<int32_t>("B", {5}, {1, 2, 3, 4, 5});
+  test.AddOutput<int32_t>("C", {2, 5}, {12, 12, 12, 12, 12,
+                                        -12, -12, -12, -12, -12});
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});  //TensorRT parser:elementwise inputs must not be Int32
+}
+
 TEST(MathOpTest, Mul_int32) {
   OpTester test("Mul");
   test.AddInput<int32_t>("A", {3}, {1, 2, 3});
@@ -479,6 +535,25 @@ TEST(MathOpTest, Div) {
 #endif
 }
 
+TEST(MathOpTest, SubMulDiv_float16) {
+  std::vector<int64_t> dims{2, 3};
+  auto a = MakeMLFloat16({100.0f, 1.0f, 6.0f, 0.0f, -10.0f, -1.0f});
+  auto b = MakeMLFloat16({10.0f, 2.0f, 3.0f, 1.0f, -1.0f, 4.0f});
+
+  const std::vector<std::pair<const char*, std::vector<MLFloat16>>> cases{
+      {"Sub", MakeMLFloat16({90.0f, -1.0f, 3.0f, -1.0f, -9.0f, -5.0f})},
+      {"Mul", MakeMLFloat16({1000.0f, 2.0f, 18.0f, 0.0f, 10.0f, -4.0f})},
+      {"Div", MakeMLFloat16({10.0f, 0.5f, 2.0f, 0.0f, 10.0f, -0.25f})}};
+
+  for (const auto& c : cases) {
+    OpTester test(c.first, 14);
+    test.AddInput<MLFloat16>("A", dims, a);
+    test.AddInput<MLFloat16>("B", dims, b);
+    test.AddOutput<MLFloat16>("C", dims, c.second);
+    test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: fp16 is not supported
+  }
+}
+
 TEST(MathOpTest, Abs) {
   OpTester test("Abs");
   std::vector<int64_t> dims{2, 2};
@@ -44,8 +44,6 @@ TEST(GemmOpTest, GemmNoTrans_double) {
   TestGemmNoTrans<double>();
 }
 
-// Only CUDA kernel has float 16 support
-#if defined(USE_CUDA) || defined(USE_ROCM)
 TEST(GemmOpTest, GemmNoTrans_f16) {
 #ifdef USE_CUDA
   int min_cuda_architecture = 530;
@@ -83,7 +81,6 @@ TEST(GemmOpTest, GemmNoTrans_f16) {
   test.AddOutput<MLFloat16>("Y", {2, 3}, f_Y);
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  //TensorRT: fp16 is not supported
 }
-#endif
 
 template <typename T>
 void TestGemmBroadcast() {
@@ -304,6 +301,24 @@ TEST(GemmOpTest, GemmScalarBroadcast) {
   TestGemmScalarBroadcast<double>();
 }
 
+// A scalar C with a single output column can be added by the GEMM epilogue.
+TEST(GemmOpTest, GemmScalarBroadcast_N1) {
+  OpTester test("Gemm", 13);
+
+  test.AddAttribute("transA", (int64_t)0);
+  test.AddAttribute("transB", (int64_t)0);
+  test.AddAttribute("alpha", 1.0f);
+  test.AddAttribute("beta", 1.0f);
+
+  test.AddInput<float>("A", {2, 4},
+                       {1.0f, 2.0f, 3.0f, 4.0f,
+                        -1.0f, -2.0f, -3.0f, -4.0f});
+  test.AddInput<float>("B", {4, 1}, std::vector<float>(4, 1.0f));
+  test.AddInput<float>("C", {}, std::vector<float>{1.0f});
+  test.AddOutput<float>("Y", {2, 1}, {11.0f, -9.0f});
+  test.Run();
+}
+
 template <typename T>
 void TestGemm2DBroadcast_1() {
   OpTester test("Gemm");
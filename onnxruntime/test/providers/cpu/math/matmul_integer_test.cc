@@ -247,6 +247,50 @@ TEST(MatmulIntegerOpTest, MatMulInteger_int8_t_No_Zero_Point) {
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
 }
 
+TEST(MatmulIntegerOpTest, MatMulInteger_Int8_Int8_CPU) {
+  OpTester test("MatMulInteger", 10);
+  test.AddInput<int8_t>("T1",
+                        {2, 4},
+                        {-3, 7, 5, -6,
+                         4, -5, 8, 7});
+  test.AddInput<int8_t>("T2",
+                        {4, 4},
+                        {5, -3, 7, 8,
+                         -6, -8, -3, 6,
+                         7, 9, 9, -5,
+                         8, 7, -6, 7});
+  test.AddInput<int8_t>("a_zero_point", {}, {5});
+  test.AddInput<int8_t>("b_zero_point", {}, {5});
+  test.AddOutput<int32_t>("T3",
+                          {2, 4},
+                          {-55, 16, 89, -44,
+                           122, 154, 68, -39});
+
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kCudaExecutionProvider, kTensorrtExecutionProvider});
+}
+
+TEST(MatmulIntegerOpTest, MatMulInteger_Int8_Uint8_CPU) {
+  OpTester test("MatMulInteger", 10);
+  test.AddInput<int8_t>("T1",
+                        {2, 4},
+                        {-3, 7, 5, -6,
+                         4, -5, 8, 7});
+  test.AddInput<uint8_t>("T2",
+                         {4, 4},
+                         {20, 12, 22, 23,
+                          9, 7, 12, 21,
+                          22, 24, 24, 10,
+                          23, 22, 9, 22});
+  test.AddInput<int8_t>("a_zero_point", {}, {5});
+  test.AddInput<uint8_t>("b_zero_point", {}, {20});
+  test.AddOutput<int32_t>("T3",
+                          {2, 4},
+                          {-55, 16, 89, -44,
+                           122, 154, 68, -39});
+
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kCudaExecutionProvider, kTensorrtExecutionProvider});
+}
+
 TEST(MatmulIntegerOpTest, MatMulInteger_WithZero_ZeroPoint) {
   OpTester test("MatMulInteger", 10);
   test.AddInput<uint8_t>("T1", {4, 3}, {11, 7, 3, 10, 6, 2, 9, 5, 1, 8, 4, 0});
@@ -145,5 +145,25 @@ TEST(MathOpTest, MatMulUint64Type) {
   RunMatMulTest<uint64_t>(9);
 }
 
+TEST(MathOpTest, MatMulFloat16Type) {
+  std::vector<float> common_input_vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  for (auto t : GenerateTestCases<float>()) {
+    OpTester test("MatMul", 13);
+
+    int64_t size0 = TensorShape::ReinterpretBaseType(t.input0_dims).SizeHelper(0, t.input0_dims.size());
+    std::vector<float> input0_vals(common_input_vals.cbegin(), common_input_vals.cbegin() + size0);
+    test.AddInput<MLFloat16>("A", t.input0_dims, FloatsToMLFloat16s(input0_vals));
+
+    int64_t size1 = TensorShape::ReinterpretBaseType(t.input1_dims).SizeHelper(0, t.input1_dims.size());
+    std::vector<float> input1_vals(common_input_vals.cbegin(), common_input_vals.cbegin() + size1);
+    test.AddInput<MLFloat16>("B", t.input1_dims, FloatsToMLFloat16s(input1_vals));
+
+    test.AddOutput<MLFloat16>("Y", t.expected_dims, FloatsToMLFloat16s(t.expected_vals));
+
+    // TensorRT and OpenVINO: fp16 is not supported
+    test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
+  }
+}
+
 }  // namespace test
 }  // namespace onnxruntime
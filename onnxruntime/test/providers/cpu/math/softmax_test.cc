@@ -44,6 +44,17 @@ TEST(SoftmaxOperator, Simple) {
   RunTest(x_vals, expected_vals, dimensions);
 }
 
+TEST(SoftmaxOperator, Simple_float16) {
+  OpTester test("Softmax", 13);
+
+  test.AddInput<MLFloat16>("X", {2, 3}, FloatsToMLFloat16s({-1.0f, 0.0f, 1.0f, 2.0f, 2.0f, 2.0f}));
+  test.AddOutput<MLFloat16>("Y", {2, 3},
+                            FloatsToMLFloat16s({0.09003058f, 0.24472848f, 0.66524094f,
+                                                0.33333333f, 0.33333333f, 0.33333333f}));
+  // TensorRT: fp16 is not supported
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+
 TEST(SoftmaxOperator, LargeNumber) {
   // x = np.array([[0, 1, 2, 3], [10000, 10001, 10002, 10003]]).astype(np.float32)
   // expected output[[0.0320586, 0.08714432, 0.23688284, 0.64391428],
@@ -713,5 +713,44 @@ TEST(ConvTest, Conv_AutoPad_with_non_default_strides) {
   TestConvOp(attrs, {X, W}, {X_shape, W_shape}, expected_vals, Y_shape, true);
 }
 
+// 3x3 convolutions with enough channels use the Winograd algorithm on CPU. A 10x10 input selects the F(4x4, 3x3)
+// tiles and an 8x8 input the F(2x2, 3x3) tiles. The filter is transformed by PrePack when it is an initializer and
+// on every run otherwise.
+TEST(ConvTest, Conv2D_Winograd) {
+  constexpr int64_t channels = 16;
+  constexpr int64_t filters = 16;
+
+  for (int64_t image_size : {10, 8}) {
+    for (bool weight_is_initializer : {false, true}) {
+      OpTester test("Conv", 11);
+      test.AddAttribute("kernel_shape", vector<int64_t>{3, 3});
+      test.AddAttribute("pads", vector<int64_t>{0, 0, 0, 0});
+
+      // channel c of the input is c + 1 everywhere and filter m is m + 1 everywhere, so output channel m is
+      // 9 * (m + 1) * (1 + 2 + ... + channels) everywhere
+      vector<float> X(static_cast<size_t>(channels * image_size * image_size));
+      for (size_t i = 0; i < X.size(); i++) {
+        X[i] = static_cast<float>(i / static_cast<size_t>(image_size * image_size) + 1);
+      }
+      vector<float> W(static_cast<size_t>(filters * channels * 9));
+      for (size_t i = 0; i < W.size(); i++) {
+        W[i] = static_cast<float>(i / static_cast<size_t>(channels * 9) + 1);
+      }
+
+      const int64_t output_size = image_size - 2;
+      vector<float> Y(static_cast<size_t>(filters * output_size * output_size));
+      for (size_t i = 0; i < Y.size(); i++) {
+        Y[i] = static_cast<float>(9 * (i / static_cast<size_t>(output_size * output_size) + 1) *
+                                  (channels * (channels + 1) / 2));
+      }
+
+      test.AddInput<float>("X", {1, channels, image_size, image_size}, X);
+      test.AddInput<float>("W", {filters, channels, 3, 3}, W, weight_is_initializer);
+      test.AddOutput<float>("Y", {1, filters, output_size, output_size}, Y, false, 1e-5f);
+      test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace onnxruntime
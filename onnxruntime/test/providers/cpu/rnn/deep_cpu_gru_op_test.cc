@@ -33,7 +33,9 @@ static void RunGruTest(const std::vector<float>& X_data,
                        // copy the following vectors as we may modify them
                        std::vector<string> activations = default_activations,
                        std::vector<float> activation_alphas = {},
-                       std::vector<float> activation_betas = {}) {
+                       std::vector<float> activation_betas = {},
+                       bool is_initializer_W = true,
+                       bool is_initializer_R = true) {
   OpTester test("GRU");
 
   test.AddShapeToTensorData();
@@ -65,8 +67,8 @@ static void RunGruTest(const std::vector<float>& X_data,
   std::vector<int64_t> R_dims = {num_directions, 3 * hidden_size, hidden_size};
 
   test.AddInput<float>("X", X_dims, X_data);
-  test.AddInput<float>("W", W_dims, W_data, true);
-  test.AddInput<float>("R", R_dims, R_data, true);
+  test.AddInput<float>("W", W_dims, W_data, is_initializer_W);
+  test.AddInput<float>("R", R_dims, R_data, is_initializer_R);
 
   if (B_data) {
     std::vector<int64_t> B_dims = {num_directions, 6 * hidden_size};
@@ -370,7 +372,8 @@ class DeepCpuGruOpTestContext {
                const std::vector<float>* initial_h,
                const std::vector<float>& expected_Y,
                const std::vector<float>& expected_Y_h,
-               const bool linear_before_reset = false);
+               const bool linear_before_reset = false,
+               const bool is_initializer_weights = true);
 
  private:
   const int input_size_;
@@ -506,7 +509,8 @@ void DeepCpuGruOpTestContext::RunTest(const std::vector<float>& X,
                                       const std::vector<float>* initial_h,
                                       const std::vector<float>& expected_Y,
                                       const std::vector<float>& expected_Y_h,
-                                      const bool linear_before_reset) {
+                                      const bool linear_before_reset,
+                                      const bool is_initializer_weights) {
   //run with and without output_sequence
   RunGruTest(X, gru_input_weights_, gru_recurrent_weights_,
              expected_Y, expected_Y_h,
@@ -520,7 +524,9 @@ void DeepCpuGruOpTestContext::RunTest(const std::vector<float>& X,
              linear_before_reset,
              activation_func_names_,
              alphas_,
-             betas_);
+             betas_,
+             is_initializer_weights,
+             is_initializer_weights);
 
   RunGruTest(X, gru_input_weights_, gru_recurrent_weights_,
              expected_Y, expected_Y_h,
@@ -534,7 +540,9 @@ void DeepCpuGruOpTestContext::RunTest(const std::vector<float>& X,
              linear_before_reset,
              activation_func_names_,
              alphas_,
-             betas_);
+             betas_,
+             is_initializer_weights,
+             is_initializer_weights);
 }
 
 TEST(GRUTest, ONNXRuntime_TestGRUOpForwardBasic) {
@@ -838,6 +846,58 @@ TEST(GRUTest, ONNXRuntime_TestGRUOpSequenceLengthWithBidirectionalLinearBeforeRe
   ctx.RunTest(X, batch_size, seq_length, sequence_length, &initial_h, expected_Y, expected_Y_h, true);
 }
 
+// W and R are not constant so they are not prepacked
+TEST(GRUTest, ONNXRuntime_TestGRUOpBidirectionalNonConstantWeights) {
+  const std::string direction = "bidirectional";
+  const std::vector<std::string> activations = {"sigmoid", "tanh", "sigmoid", "tanh"};
+
+  DeepCpuGruOpTestContext ctx(direction, activations);
+
+  const int batch_size = 1;
+  const int seq_length = 2;
+  std::vector<float> X = {-0.455351f, -0.276391f,
+                          -0.185934f, -0.269585f};
+  std::vector<int> sequence_length = {2};
+  std::vector<float> initial_h = {0.0f, 0.0f, 0.0f, 0.0f};
+  std::vector<float> expected_Y = {-0.03255286f, 0.0774838f,
+                                   -0.05469977f, 0.1004222f,
+
+                                   -0.05556786f, 0.0785508f,
+                                   -0.04566499f, 0.04621252f};
+  std::vector<float> expected_Y_h = {-0.05556786f, 0.0785508f,
+                                     -0.05469977f, 0.1004222f};
+
+  ctx.RunTest(X, batch_size, seq_length, sequence_length, &initial_h, expected_Y, expected_Y_h, false, false);
+}
+
+TEST(GRUTest, ONNXRuntime_TestGRUOpSequenceLengthWithBidirectionalLinearBeforeResetNonConstantWeights) {
+  const std::string direction = "bidirectional";
+  const std::vector<std::string> activations = {"sigmoid", "tanh", "sigmoid", "tanh"};
+
+  DeepCpuGruOpTestContext ctx(direction, activations);
+
+  const int batch_size = 2;
+  const int seq_length = 2;
+  std::vector<float> X = {-0.455351f, -0.276391f,
+                          0.855351f, 0.676391f,
+                          -0.185934f, -0.269585f,
+                          0.585934f, 0.669585f};
+  std::vector<int> sequence_length = {2, 1};
+  std::vector<float> initial_h = {0.0f, 0.0f, 0.0f, 0.0f,
+                                  0.0f, 0.0f, 0.0f, 0.0f};
+  std::vector<float> expected_Y = {-0.0325528607f, 0.0774837881f, -0.275918573f, -0.00228558504f,
+                                   -0.0559310019f, 0.101836264f, -0.275918573f, -0.00228558504f,
+
+                                   -0.0577347837f, 0.0796165839f, 0.0f, 0.0f,
+                                   -0.0456649922f, 0.0462125242f, 0.0f, 0.0f};
+  std::vector<float> expected_Y_h = {-0.0577347837f, 0.0796165839f,
+                                     -0.275918573f, -0.00228558504f,
+                                     -0.0559310019f, 0.101836264f,
+                                     -0.275918573f, -0.00228558504f};
+
+  ctx.RunTest(X, batch_size, seq_length, sequence_length, &initial_h, expected_Y, expected_Y_h, true, false);
+}
+
 TEST(GRUTest, ONNXRuntime_TestGRUOpShorterSeqInMiddle) {
   const std::string direction = "bidirectional";
   const std::vector<std::string> activations = {"sigmoid", "tanh", "sigmoid", "tanh"};
@@ -254,6 +254,28 @@ class TestInferenceSession(unittest.TestCase):
         output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
         np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
 
+    def testRunModelMany(self):
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"))
+        xs = [np.full((3, 2), i, dtype=np.float32) for i in range(5)]
+        feeds = [{"X": x} for x in xs]
+        for max_concurrency in [1, 3]:
+            res = sess.run_many(["Y"], feeds, max_concurrency=max_concurrency)
+            self.assertEqual(len(res), len(xs))
+            for x, outputs in zip(xs, res):
+                np.testing.assert_allclose(x * x, outputs[0], rtol=1e-05, atol=1e-08)
+
+    def testRunModelOutputNoCopy(self):
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"))
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        res = sess.run(["Y"], {"X": x})
+        # the output views the buffer allocated by the session
+        self.assertIsNotNone(res[0].base)
+        self.assertFalse(res[0].flags.owndata)
+        res[0][0, 0] = 100.0
+        res2 = sess.run(["Y"], {"X": x})
+        output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
+        np.testing.assert_allclose(output_expected, res2[0], rtol=1e-05, atol=1e-08)
+
     def testRunModelFromBytes(self):
         with open(get_name("mul_1.onnx"), "rb") as f:
             content = f.read()